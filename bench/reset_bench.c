@@ -0,0 +1,96 @@
+/*
+ * Steady-state allocation benchmark for argo_document_reset().
+ *
+ * Reads the same document over and over, resetting between reads, and
+ * reports how many calls to malloc(), calloc() and realloc() have been made
+ * so far at regular checkpoints.  After the first few iterations the counts
+ * should stop changing.
+ *
+ * Usage: bin/argo_bench [ITERATIONS] [FILE]
+ * The default is 10000000 iterations over a small built-in document.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "argo.h"
+#include "global.h"
+#include "intern.h"
+#include "document.h"
+
+static unsigned long mallocCalls = 0;
+static unsigned long reallocCalls = 0;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *p, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    mallocCalls++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    mallocCalls++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *p, size_t size) {
+    reallocCalls++;
+    return __real_realloc(p, size);
+}
+
+static char sample[] =
+    "{\"name\":\"GitSubmit\",\"version\":\"1.0.0\",\"dependencies\":{"
+    "\"@types/bson\":{\"version\":\"1.0.6\",\"resolved\":"
+    "\"https://registry.npmjs.org/@types/bson/-/bson-1.0.6.tgz\","
+    "\"requires\":{\"@types/node\":\"8.5.2\"}},"
+    "\"@types/events\":{\"version\":\"1.1.0\",\"resolved\":"
+    "\"https://registry.npmjs.org/@types/events/-/events-1.1.0.tgz\","
+    "\"tags\":[\"a\",\"bb\",\"ccc\",\"dddd\"]}}}";
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(*(argv + 1)) : 10000000;
+    char *text = sample;
+    size_t length = sizeof(sample) - 1;
+    if (argc > 2) {
+        FILE *in = fopen(*(argv + 2), "r");
+        if (in == NULL) {
+            perror(*(argv + 2));
+            return EXIT_FAILURE;
+        }
+        fseek(in, 0, SEEK_END);
+        length = ftell(in);
+        rewind(in);
+        text = malloc(length);
+        if (text == NULL || fread(text, 1, length, in) != length) {
+            fprintf(stderr, "Failed to read %s\n", *(argv + 2));
+            return EXIT_FAILURE;
+        }
+        fclose(in);
+    }
+    FILE *f = fmemopen(text, length, "r");
+    if (f == NULL) {
+        perror("fmemopen");
+        return EXIT_FAILURE;
+    }
+    argo_intern_enabled = 1;
+    long checkpoint = iterations / 10 > 0 ? iterations / 10 : 1;
+    clock_t start = clock();
+    long i = 0;
+    while (i < iterations) {
+        rewind(f);
+        argo_document_reset();
+        if (argo_read_value(f) == NULL) {
+            fprintf(stderr, "Parse failed at iteration %ld\n", i);
+            return EXIT_FAILURE;
+        }
+        i++;
+        if (i == 1 || i % checkpoint == 0)
+            printf("%10ld iterations: %lu malloc, %lu realloc\n", i, mallocCalls, reallocCalls);
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("%.3f s, %.0f documents/s\n", seconds, iterations / seconds);
+    fclose(f);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,4114 @@
+/* Generated by bin/argo_embed from rsrc/package-lock.json.  Do not edit. */
+#include <stddef.h>
+
+#include "argo.h"
+#include "embed.h"
+
+static const ARGO_CHAR text[26820] = {
+    110, 97, 109, 101, 71, 105, 116, 83, 117, 98, 109, 105, 116, 118, 101, 114,
+    115, 105, 111, 110, 49, 46, 48, 46, 48, 108, 111, 99, 107, 102, 105, 108,
+    101, 86, 101, 114, 115, 105, 111, 110, 49, 114, 101, 113, 117, 105, 114, 101,
+    115, 100, 101, 112, 101, 110, 100, 101, 110, 99, 105, 101, 115, 64, 116, 121,
+    112, 101, 115, 47, 98, 115, 111, 110, 49, 46, 48, 46, 54, 114, 101, 115,
+    111, 108, 118, 101, 100, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    64, 116, 121, 112, 101, 115, 47, 98, 115, 111, 110, 47, 45, 47, 98, 115,
+    111, 110, 45, 49, 46, 48, 46, 54, 46, 116, 103, 122, 105, 110, 116, 101,
+    103, 114, 105, 116, 121, 115, 104, 97, 53, 49, 50, 45, 118, 55, 78, 56,
+    113, 99, 84, 71, 105, 89, 104, 76, 82, 121, 105, 43, 89, 54, 57, 82,
+    51, 116, 80, 67, 52, 71, 76, 113, 66, 121, 67, 103, 51, 78, 67, 50,
+    69, 79, 54, 80, 99, 105, 67, 49, 54, 54, 79, 57, 100, 78, 104, 106,
+    70, 80, 111, 88, 101, 77, 101, 80, 116, 90, 43, 48, 102, 43, 47, 79,
+    50, 120, 76, 68, 87, 88, 115, 53, 66, 76, 110, 82, 102, 99, 66, 97,
+    66, 65, 61, 61, 100, 101, 118, 64, 116, 121, 112, 101, 115, 47, 110, 111,
+    100, 101, 56, 46, 53, 46, 50, 64, 116, 121, 112, 101, 115, 47, 101, 118,
+    101, 110, 116, 115, 49, 46, 49, 46, 48, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 64, 116, 121, 112, 101, 115, 47, 101, 118, 101, 110, 116,
+    115, 47, 45, 47, 101, 118, 101, 110, 116, 115, 45, 49, 46, 49, 46, 48,
+    46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 121, 51, 98, 82, 57,
+    56, 109, 122, 89, 79, 111, 48, 112, 65, 90, 117, 105, 76, 97, 114, 105,
+    43, 99, 81, 121, 105, 75, 107, 51, 85, 88, 82, 117, 84, 52, 53, 104,
+    49, 82, 106, 104, 102, 101, 67, 122, 113, 107, 106, 97, 86, 115, 102, 90,
+    74, 78, 97, 120, 100, 103, 116, 107, 55, 47, 51, 116, 122, 79, 109, 49,
+    111, 122, 76, 84, 113, 69, 113, 77, 80, 51, 86, 98, 73, 52, 56, 106,
+    119, 61, 61, 64, 116, 121, 112, 101, 115, 47, 109, 111, 110, 103, 111, 100,
+    98, 50, 46, 50, 46, 49, 56, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 64, 116, 121, 112, 101, 115, 47, 109, 111, 110, 103, 111, 100, 98,
+    47, 45, 47, 109, 111, 110, 103, 111, 100, 98, 45, 50, 46, 50, 46, 49,
+    56, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 98, 78, 111, 111,
+    107, 83, 43, 89, 52, 78, 55, 66, 57, 47, 122, 57, 108, 90, 114, 84,
+    99, 86, 85, 100, 88, 83, 102, 114, 72, 56, 74, 43, 115, 118, 66, 70,
+    67, 122, 120, 98, 67, 108, 53, 112, 79, 103, 51, 50, 89, 101, 73, 103,
+    118, 75, 106, 114, 113, 68, 52, 121, 70, 55, 69, 99, 101, 99, 55, 98,
+    111, 55, 90, 67, 100, 113, 97, 106, 88, 83, 48, 54, 84, 101, 117, 87,
+    100, 65, 61, 61, 64, 116, 121, 112, 101, 115, 47, 109, 111, 110, 103, 111,
+    111, 115, 101, 52, 46, 55, 46, 51, 48, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 64, 116, 121, 112, 101, 115, 47, 109, 111, 110, 103, 111,
+    111, 115, 101, 47, 45, 47, 109, 111, 110, 103, 111, 111, 115, 101, 45, 52,
+    46, 55, 46, 51, 48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45,
+    102, 88, 116, 65, 57, 70, 71, 120, 90, 68, 72, 106, 102, 82, 117, 99,
+    68, 82, 47, 52, 115, 116, 69, 99, 111, 110, 89, 118, 114, 118, 102, 107,
+    120, 50, 100, 70, 53, 73, 116, 79, 47, 120, 50, 115, 88, 107, 55, 79,
+    47, 101, 82, 84, 86, 51, 100, 72, 107, 90, 122, 50, 110, 80, 114, 97,
+    54, 98, 71, 86, 47, 71, 43, 66, 65, 54, 84, 66, 74, 67, 75, 112,
+    110, 103, 99, 55, 65, 103, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 64, 116, 121, 112, 101, 115, 47, 110, 111, 100, 101, 47, 45,
+    47, 110, 111, 100, 101, 45, 56, 46, 53, 46, 50, 46, 116, 103, 122, 115,
+    104, 97, 53, 49, 50, 45, 75, 65, 52, 71, 75, 79, 112, 103, 88, 110,
+    114, 113, 69, 72, 50, 101, 67, 86, 104, 105, 118, 50, 67, 115, 120, 103,
+    88, 71, 81, 74, 103, 86, 49, 88, 48, 118, 115, 71, 108, 104, 43, 87,
+    67, 110, 120, 98, 101, 65, 69, 49, 71, 84, 52, 52, 90, 115, 84, 85,
+    49, 73, 78, 53, 100, 69, 101, 86, 47, 103, 68, 117, 112, 75, 97, 55,
+    103, 87, 111, 48, 56, 86, 53, 73, 120, 87, 86, 81, 61, 61, 97, 99,
+    99, 101, 112, 116, 115, 49, 46, 51, 46, 52, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 97, 99, 99, 101, 112, 116, 115, 47, 45, 47, 97,
+    99, 99, 101, 112, 116, 115, 45, 49, 46, 51, 46, 52, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 104, 105, 82, 110, 87, 77, 102, 100, 98, 83, 71,
+    109, 82, 48, 47, 119, 104, 75, 82, 48, 68, 115, 66, 101, 115, 104, 56,
+    61, 109, 105, 109, 101, 45, 116, 121, 112, 101, 115, 50, 46, 49, 46, 49,
+    55, 110, 101, 103, 111, 116, 105, 97, 116, 111, 114, 48, 46, 54, 46, 49,
+    97, 109, 112, 48, 46, 51, 46, 49, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 97, 109, 112, 47, 45, 47, 97, 109, 112, 45, 48, 46, 51,
+    46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 97, 116, 43, 78, 87,
+    75, 100, 80, 78, 104, 54, 67, 119, 102, 113, 78, 79, 74, 119, 72, 110,
+    104, 79, 102, 120, 72, 48, 61, 97, 109, 112, 45, 109, 101, 115, 115, 97,
+    103, 101, 48, 46, 49, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 97, 109, 112, 45, 109, 101, 115, 115, 97, 103, 101, 47, 45, 47,
+    97, 109, 112, 45, 109, 101, 115, 115, 97, 103, 101, 45, 48, 46, 49, 46,
+    50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 112, 52, 56, 99, 109, 74,
+    108, 81, 104, 54, 48, 50, 71, 83, 112, 66, 75, 89, 53, 78, 116, 74,
+    52, 57, 47, 69, 85, 61, 97, 110, 115, 105, 45, 114, 101, 103, 101, 120,
+    50, 46, 49, 46, 49, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    97, 110, 115, 105, 45, 114, 101, 103, 101, 120, 47, 45, 47, 97, 110, 115,
+    105, 45, 114, 101, 103, 101, 120, 45, 50, 46, 49, 46, 49, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 119, 55, 77, 54, 116, 101, 52, 50, 68, 89,
+    98, 103, 53, 105, 106, 119, 82, 111, 114, 110, 55, 121, 102, 87, 86, 78,
+    56, 61, 97, 110, 115, 105, 45, 115, 116, 121, 108, 101, 115, 50, 46, 50,
+    46, 49, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 110, 115,
+    105, 45, 115, 116, 121, 108, 101, 115, 47, 45, 47, 97, 110, 115, 105, 45,
+    115, 116, 121, 108, 101, 115, 45, 50, 46, 50, 46, 49, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 116, 68, 76, 100, 77, 49, 105, 50, 78, 77, 57,
+    49, 52, 101, 82, 109, 81, 50, 103, 107, 66, 84, 80, 66, 51, 98, 52,
+    61, 97, 110, 121, 45, 112, 114, 111, 109, 105, 115, 101, 49, 46, 51, 46,
+    48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 110, 121, 45,
+    112, 114, 111, 109, 105, 115, 101, 47, 45, 47, 97, 110, 121, 45, 112, 114,
+    111, 109, 105, 115, 101, 45, 49, 46, 51, 46, 48, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 113, 56, 97, 118, 55, 116, 122, 113, 85, 117, 103, 74,
+    122, 99, 65, 51, 97, 117, 48, 56, 52, 53, 89, 49, 48, 88, 56, 61,
+    97, 110, 121, 109, 97, 116, 99, 104, 49, 46, 51, 46, 50, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 97, 110, 121, 109, 97, 116, 99, 104,
+    47, 45, 47, 97, 110, 121, 109, 97, 116, 99, 104, 45, 49, 46, 51, 46,
+    50, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 48, 88, 78, 97,
+    121, 67, 56, 108, 84, 72, 81, 50, 79, 73, 56, 97, 108, 106, 78, 67,
+    78, 51, 115, 83, 120, 54, 104, 115, 114, 47, 49, 43, 114, 108, 99, 68,
+    65, 111, 116, 88, 74, 82, 55, 67, 49, 111, 90, 90, 72, 67, 78, 115,
+    102, 112, 98, 75, 119, 77, 106, 82, 65, 51, 85, 113, 98, 53, 116, 70,
+    49, 82, 97, 101, 50, 111, 108, 111, 84, 114, 52, 120, 112, 113, 43, 87,
+    106, 65, 61, 61, 109, 105, 99, 114, 111, 109, 97, 116, 99, 104, 50, 46,
+    51, 46, 49, 49, 110, 111, 114, 109, 97, 108, 105, 122, 101, 45, 112, 97,
+    116, 104, 97, 112, 97, 99, 104, 101, 45, 99, 114, 121, 112, 116, 49, 46,
+    50, 46, 49, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 112,
+    97, 99, 104, 101, 45, 99, 114, 121, 112, 116, 47, 45, 47, 97, 112, 97,
+    99, 104, 101, 45, 99, 114, 121, 112, 116, 45, 49, 46, 50, 46, 49, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 49, 118, 120, 121, 113, 109, 48, 110,
+    50, 90, 121, 86, 113, 85, 47, 82, 105, 78, 99, 120, 55, 118, 47, 54,
+    90, 106, 119, 61, 117, 110, 105, 120, 45, 99, 114, 121, 112, 116, 45, 116,
+    100, 45, 106, 115, 97, 112, 97, 99, 104, 101, 45, 109, 100, 53, 49, 46,
+    49, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 112,
+    97, 99, 104, 101, 45, 109, 100, 53, 47, 45, 47, 97, 112, 97, 99, 104,
+    101, 45, 109, 100, 53, 45, 49, 46, 49, 46, 50, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 55, 107, 108, 122, 97, 50, 79, 98, 84, 120, 67, 76,
+    98, 112, 53, 105, 98, 71, 50, 112, 107, 119, 97, 48, 70, 112, 73, 61,
+    97, 114, 103, 112, 97, 114, 115, 101, 49, 46, 48, 46, 57, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 97, 114, 103, 112, 97, 114, 115, 101,
+    47, 45, 47, 97, 114, 103, 112, 97, 114, 115, 101, 45, 49, 46, 48, 46,
+    57, 46, 116, 103, 122, 115, 104, 97, 49, 45, 99, 57, 103, 55, 119, 109,
+    80, 52, 98, 112, 102, 52, 122, 69, 57, 114, 114, 104, 115, 79, 107, 75,
+    102, 83, 76, 73, 89, 61, 115, 112, 114, 105, 110, 116, 102, 45, 106, 115,
+    49, 46, 48, 46, 51, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    115, 112, 114, 105, 110, 116, 102, 45, 106, 115, 47, 45, 47, 115, 112, 114,
+    105, 110, 116, 102, 45, 106, 115, 45, 49, 46, 48, 46, 51, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 66, 79, 97, 83, 98, 50, 89, 111, 108, 84,
+    86, 80, 80, 100, 65, 86, 73, 68, 89, 122, 117, 70, 99, 112, 102, 105,
+    119, 61, 97, 114, 114, 45, 100, 105, 102, 102, 50, 46, 48, 46, 48, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 114, 114, 45, 100, 105,
+    102, 102, 47, 45, 47, 97, 114, 114, 45, 100, 105, 102, 102, 45, 50, 46,
+    48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 106, 122, 117, 67,
+    102, 53, 86, 97, 105, 57, 90, 112, 97, 88, 53, 75, 81, 108, 97, 115,
+    80, 79, 114, 106, 86, 115, 56, 61, 97, 114, 114, 45, 102, 108, 97, 116,
+    116, 101, 110, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 114,
+    114, 45, 102, 108, 97, 116, 116, 101, 110, 47, 45, 47, 97, 114, 114, 45,
+    102, 108, 97, 116, 116, 101, 110, 45, 49, 46, 49, 46, 48, 46, 116, 103,
+    122, 115, 104, 97, 53, 49, 50, 45, 76, 51, 104, 75, 86, 53, 82, 47,
+    112, 53, 111, 56, 49, 82, 55, 79, 48, 50, 73, 71, 110, 119, 112, 68,
+    109, 107, 112, 54, 69, 57, 56, 50, 88, 104, 116, 98, 117, 119, 83, 101,
+    51, 79, 52, 113, 79, 116, 77, 77, 77, 116, 111, 100, 105, 99, 65, 83,
+    65, 49, 67, 110, 121, 50, 85, 43, 97, 67, 88, 99, 78, 112, 109, 108,
+    43, 109, 52, 100, 80, 115, 118, 115, 74, 51, 106, 97, 116, 103, 61, 61,
+    97, 114, 114, 97, 121, 45, 117, 110, 105, 113, 117, 101, 48, 46, 50, 46,
+    49, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 97, 114, 114, 97,
+    121, 45, 117, 110, 105, 113, 117, 101, 47, 45, 47, 97, 114, 114, 97, 121,
+    45, 117, 110, 105, 113, 117, 101, 45, 48, 46, 50, 46, 49, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 111, 100, 108, 56, 121, 118, 121, 56, 74, 105,
+    88, 77, 99, 80, 114, 99, 54, 122, 97, 108, 68, 70, 105, 119, 71, 108,
+    77, 61, 97, 115, 121, 110, 99, 50, 46, 49, 46, 52, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 97, 115, 121, 110, 99, 47, 45, 47, 97,
+    115, 121, 110, 99, 45, 50, 46, 49, 46, 52, 46, 116, 103, 122, 115, 104,
+    97, 49, 45, 76, 83, 70, 103, 120, 51, 105, 65, 77, 117, 84, 100, 98,
+    76, 52, 108, 65, 118, 72, 53, 111, 115, 106, 50, 122, 101, 81, 61, 108,
+    111, 100, 97, 115, 104, 52, 46, 49, 55, 46, 52, 97, 115, 121, 110, 99,
+    45, 101, 97, 99, 104, 49, 46, 48, 46, 49, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 97, 115, 121, 110, 99, 45, 101, 97, 99, 104, 47,
+    45, 47, 97, 115, 121, 110, 99, 45, 101, 97, 99, 104, 45, 49, 46, 48,
+    46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 71, 100, 79, 71, 111,
+    100, 110, 116, 120, 117, 102, 66, 121, 70, 48, 52, 105, 117, 50, 56, 120,
+    87, 48, 122, 89, 67, 48, 61, 97, 115, 121, 110, 99, 45, 108, 105, 115,
+    116, 101, 110, 101, 114, 48, 46, 54, 46, 57, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 97, 115, 121, 110, 99, 45, 108, 105, 115, 116, 101,
+    110, 101, 114, 47, 45, 47, 97, 115, 121, 110, 99, 45, 108, 105, 115, 116,
+    101, 110, 101, 114, 45, 48, 46, 54, 46, 57, 46, 116, 103, 122, 115, 104,
+    97, 53, 49, 50, 45, 69, 55, 90, 50, 47, 81, 77, 115, 48, 69, 80,
+    116, 47, 111, 57, 119, 112, 89, 79, 47, 74, 51, 104, 109, 77, 67, 68,
+    100, 114, 49, 97, 86, 68, 83, 51, 116, 116, 108, 117, 114, 53, 68, 53,
+    74, 108, 90, 116, 120, 104, 102, 117, 79, 119, 105, 52, 101, 55, 83, 56,
+    122, 98, 89, 73, 120, 65, 53, 113, 79, 79, 89, 100, 120, 102, 113, 71,
+    106, 57, 55, 88, 65, 102, 100, 78, 118, 107, 81, 61, 61, 115, 101, 109,
+    118, 101, 114, 53, 46, 52, 46, 49, 115, 104, 105, 109, 109, 101, 114, 49,
+    46, 50, 46, 48, 98, 97, 108, 97, 110, 99, 101, 100, 45, 109, 97, 116,
+    99, 104, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98, 97, 108,
+    97, 110, 99, 101, 100, 45, 109, 97, 116, 99, 104, 47, 45, 47, 98, 97,
+    108, 97, 110, 99, 101, 100, 45, 109, 97, 116, 99, 104, 45, 49, 46, 48,
+    46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 105, 98, 84, 82, 109,
+    97, 115, 114, 55, 107, 110, 101, 70, 107, 54, 103, 75, 52, 110, 79, 82,
+    105, 49, 120, 116, 50, 99, 61, 98, 99, 114, 121, 112, 116, 106, 115, 50,
+    46, 52, 46, 51, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98,
+    99, 114, 121, 112, 116, 106, 115, 47, 45, 47, 98, 99, 114, 121, 112, 116,
+    106, 115, 45, 50, 46, 52, 46, 51, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 109, 114, 86, 105, 101, 53, 80, 109, 66, 105, 72, 47, 102, 78, 114,
+    70, 50, 112, 99, 122, 65, 110, 51, 120, 48, 77, 115, 61, 98, 105, 110,
+    97, 114, 121, 45, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 49, 46,
+    49, 49, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98,
+    105, 110, 97, 114, 121, 45, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115,
+    47, 45, 47, 98, 105, 110, 97, 114, 121, 45, 101, 120, 116, 101, 110, 115,
+    105, 111, 110, 115, 45, 49, 46, 49, 49, 46, 48, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 82, 113, 111, 88, 85, 102, 116, 113, 76, 53, 80, 117,
+    88, 109, 105, 98, 115, 81, 104, 57, 83, 120, 84, 71, 119, 103, 85, 61,
+    98, 108, 101, 115, 115, 101, 100, 48, 46, 49, 46, 56, 49, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 98, 108, 101, 115, 115, 101, 100, 47,
+    45, 47, 98, 108, 101, 115, 115, 101, 100, 45, 48, 46, 49, 46, 56, 49,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 43, 87, 76, 87, 104, 43, 119,
+    115, 78, 112, 86, 119, 114, 110, 71, 118, 104, 68, 74, 87, 53, 116, 68,
+    75, 69, 83, 107, 61, 98, 108, 117, 101, 98, 105, 114, 100, 51, 46, 53,
+    46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98, 108, 117,
+    101, 98, 105, 114, 100, 47, 45, 47, 98, 108, 117, 101, 98, 105, 114, 100,
+    45, 51, 46, 53, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 101,
+    82, 81, 103, 49, 47, 86, 82, 55, 113, 75, 74, 100, 70, 79, 111, 112,
+    51, 90, 84, 43, 87, 89, 71, 49, 110, 119, 61, 98, 114, 97, 99, 101,
+    45, 101, 120, 112, 97, 110, 115, 105, 111, 110, 49, 46, 49, 46, 56, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98, 114, 97, 99, 101, 45,
+    101, 120, 112, 97, 110, 115, 105, 111, 110, 47, 45, 47, 98, 114, 97, 99,
+    101, 45, 101, 120, 112, 97, 110, 115, 105, 111, 110, 45, 49, 46, 49, 46,
+    56, 46, 116, 103, 122, 115, 104, 97, 49, 45, 119, 72, 115, 104, 72, 72,
+    121, 86, 76, 115, 72, 52, 55, 57, 85, 97, 100, 43, 56, 78, 72, 84,
+    109, 81, 111, 112, 73, 61, 99, 111, 110, 99, 97, 116, 45, 109, 97, 112,
+    48, 46, 48, 46, 49, 98, 114, 97, 99, 101, 115, 49, 46, 56, 46, 53,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98, 114, 97, 99, 101,
+    115, 47, 45, 47, 98, 114, 97, 99, 101, 115, 45, 49, 46, 56, 46, 53,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 117, 110, 101, 87, 76, 104, 76,
+    102, 43, 87, 110, 87, 116, 50, 99, 82, 54, 82, 83, 51, 78, 52, 86,
+    55, 57, 113, 99, 61, 101, 120, 112, 97, 110, 100, 45, 114, 97, 110, 103,
+    101, 49, 46, 56, 46, 50, 112, 114, 101, 115, 101, 114, 118, 101, 48, 46,
+    50, 46, 48, 114, 101, 112, 101, 97, 116, 45, 101, 108, 101, 109, 101, 110,
+    116, 98, 115, 111, 110, 49, 46, 48, 46, 52, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 98, 115, 111, 110, 47, 45, 47, 98, 115, 111, 110,
+    45, 49, 46, 48, 46, 52, 46, 116, 103, 122, 115, 104, 97, 49, 45, 107,
+    56, 69, 78, 79, 101, 113, 108, 116, 89, 81, 86, 121, 56, 81, 70, 76,
+    122, 53, 84, 53, 87, 75, 119, 116, 121, 119, 61, 98, 117, 102, 102, 101,
+    114, 45, 115, 104, 105, 109, 115, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 98, 117, 102, 102, 101, 114, 45, 115, 104, 105, 109, 115, 47, 45,
+    47, 98, 117, 102, 102, 101, 114, 45, 115, 104, 105, 109, 115, 45, 49, 46,
+    48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 109, 88, 106, 79,
+    77, 88, 79, 73, 120, 107, 109, 116, 104, 53, 77, 67, 106, 68, 82, 51,
+    55, 119, 82, 75, 105, 49, 69, 61, 98, 121, 116, 101, 115, 51, 46, 48,
+    46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98, 121, 116,
+    101, 115, 47, 45, 47, 98, 121, 116, 101, 115, 45, 51, 46, 48, 46, 48,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 48, 121, 103, 86, 81, 69, 49,
+    111, 108, 112, 110, 52, 87, 107, 54, 107, 43, 111, 100, 86, 51, 82, 79,
+    112, 89, 69, 103, 61, 99, 104, 97, 108, 107, 49, 46, 49, 46, 51, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 99, 104, 97, 108, 107, 47,
+    45, 47, 99, 104, 97, 108, 107, 45, 49, 46, 49, 46, 51, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 113, 66, 70, 99, 86, 101, 83, 110, 65, 118,
+    53, 78, 70, 81, 113, 57, 79, 72, 75, 67, 75, 110, 52, 74, 47, 74,
+    103, 61, 101, 115, 99, 97, 112, 101, 45, 115, 116, 114, 105, 110, 103, 45,
+    114, 101, 103, 101, 120, 112, 49, 46, 48, 46, 53, 104, 97, 115, 45, 97,
+    110, 115, 105, 115, 116, 114, 105, 112, 45, 97, 110, 115, 105, 51, 46, 48,
+    46, 49, 115, 117, 112, 112, 111, 114, 116, 115, 45, 99, 111, 108, 111, 114,
+    99, 104, 97, 114, 109, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    99, 104, 97, 114, 109, 47, 45, 47, 99, 104, 97, 114, 109, 45, 48, 46,
+    49, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 66, 115, 73, 101,
+    55, 82, 111, 98, 66, 113, 54, 50, 100, 86, 80, 78, 120, 84, 52, 106,
+    74, 48, 117, 115, 73, 112, 89, 61, 99, 104, 111, 107, 105, 100, 97, 114,
+    49, 46, 55, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    99, 104, 111, 107, 105, 100, 97, 114, 47, 45, 47, 99, 104, 111, 107, 105,
+    100, 97, 114, 45, 49, 46, 55, 46, 48, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 101, 89, 53, 111, 108, 51, 103, 86, 72, 73, 66, 50, 116, 76,
+    78, 103, 53, 101, 51, 83, 106, 78, 111, 114, 116, 71, 103, 61, 102, 115,
+    101, 118, 101, 110, 116, 115, 103, 108, 111, 98, 45, 112, 97, 114, 101, 110,
+    116, 105, 110, 104, 101, 114, 105, 116, 115, 50, 46, 48, 46, 51, 105, 115,
+    45, 98, 105, 110, 97, 114, 121, 45, 112, 97, 116, 104, 105, 115, 45, 103,
+    108, 111, 98, 50, 46, 48, 46, 49, 112, 97, 116, 104, 45, 105, 115, 45,
+    97, 98, 115, 111, 108, 117, 116, 101, 114, 101, 97, 100, 100, 105, 114, 112,
+    50, 46, 49, 46, 48, 99, 108, 105, 45, 116, 97, 98, 108, 101, 45, 114,
+    101, 100, 101, 109, 112, 116, 105, 111, 110, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 99, 108, 105, 45, 116, 97, 98, 108, 101, 45, 114, 101,
+    100, 101, 109, 112, 116, 105, 111, 110, 47, 45, 47, 99, 108, 105, 45, 116,
+    97, 98, 108, 101, 45, 114, 101, 100, 101, 109, 112, 116, 105, 111, 110, 45,
+    49, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45,
+    83, 106, 86, 67, 99, 105, 82, 121, 120, 48, 49, 73, 52, 97, 122, 111,
+    50, 75, 50, 114, 99, 99, 48, 78, 80, 47, 119, 79, 99, 101, 88, 71,
+    122, 71, 49, 90, 112, 89, 107, 69, 117, 108, 98, 98, 73, 120, 68, 65,
+    47, 53, 89, 87, 118, 48, 111, 120, 71, 50, 72, 116, 81, 52, 118, 56,
+    122, 80, 67, 54, 98, 103, 98, 82, 73, 55, 83, 98, 78, 97, 84, 90,
+    67, 120, 77, 78, 107, 103, 61, 61, 99, 111, 52, 46, 54, 46, 48, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 99, 111, 47, 45, 47, 99,
+    111, 45, 52, 46, 54, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    98, 113, 97, 57, 56, 57, 104, 84, 114, 108, 84, 77, 117, 79, 82, 55,
+    43, 103, 118, 122, 43, 81, 77, 102, 115, 89, 81, 61, 99, 111, 45, 98,
+    111, 100, 121, 53, 46, 49, 46, 49, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 99, 111, 45, 98, 111, 100, 121, 47, 45, 47, 99, 111, 45,
+    98, 111, 100, 121, 45, 53, 46, 49, 46, 49, 46, 116, 103, 122, 115, 104,
+    97, 49, 45, 50, 88, 101, 66, 48, 101, 77, 48, 83, 54, 83, 111, 73,
+    80, 48, 89, 66, 114, 51, 102, 103, 48, 70, 81, 85, 106, 89, 61, 105,
+    110, 102, 108, 97, 116, 105, 111, 110, 113, 115, 54, 46, 53, 46, 49, 114,
+    97, 119, 45, 98, 111, 100, 121, 50, 46, 51, 46, 50, 116, 121, 112, 101,
+    45, 105, 115, 49, 46, 54, 46, 49, 53, 99, 111, 108, 111, 114, 115, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 99, 111, 108, 111, 114, 115,
+    47, 45, 47, 99, 111, 108, 111, 114, 115, 45, 49, 46, 48, 46, 51, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 66, 68, 80, 48, 84, 89, 67, 87,
+    103, 80, 51, 114, 89, 79, 48, 109, 68, 120, 115, 77, 74, 105, 54, 67,
+    112, 65, 115, 61, 99, 111, 109, 109, 97, 110, 100, 101, 114, 50, 46, 49,
+    50, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 99, 111,
+    109, 109, 97, 110, 100, 101, 114, 47, 45, 47, 99, 111, 109, 109, 97, 110,
+    100, 101, 114, 45, 50, 46, 49, 50, 46, 50, 46, 116, 103, 122, 115, 104,
+    97, 53, 49, 50, 45, 66, 70, 110, 97, 113, 53, 90, 79, 71, 99, 68,
+    78, 55, 70, 108, 114, 116, 66, 84, 52, 120, 120, 107, 103, 73, 84, 111,
+    97, 108, 73, 73, 120, 119, 106, 120, 76, 87, 86, 74, 56, 98, 71, 84,
+    112, 101, 49, 76, 114, 111, 113, 77, 105, 113, 81, 88, 100, 65, 55, 121,
+    103, 99, 55, 67, 82, 118, 97, 89, 83, 43, 57, 122, 102, 80, 71, 70,
+    110, 74, 113, 70, 83, 97, 121, 120, 43, 65, 65, 61, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 99, 111, 110, 99, 97, 116, 45, 109,
+    97, 112, 47, 45, 47, 99, 111, 110, 99, 97, 116, 45, 109, 97, 112, 45,
+    48, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 50, 75,
+    108, 114, 49, 51, 47, 87, 106, 102, 100, 53, 79, 110, 77, 68, 97, 106,
+    117, 103, 49, 85, 66, 100, 82, 51, 115, 61, 99, 111, 110, 116, 101, 110,
+    116, 45, 100, 105, 115, 112, 111, 115, 105, 116, 105, 111, 110, 48, 46, 53,
+    46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 99, 111, 110,
+    116, 101, 110, 116, 45, 100, 105, 115, 112, 111, 115, 105, 116, 105, 111, 110,
+    47, 45, 47, 99, 111, 110, 116, 101, 110, 116, 45, 100, 105, 115, 112, 111,
+    115, 105, 116, 105, 111, 110, 45, 48, 46, 53, 46, 50, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 68, 80, 97, 76, 117, 100, 51, 49, 56, 114, 53,
+    53, 89, 99, 79, 111, 85, 88, 106, 76, 104, 100, 117, 110, 106, 76, 81,
+    61, 99, 111, 110, 116, 101, 110, 116, 45, 116, 121, 112, 101, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 99, 111, 110, 116, 101, 110, 116, 45,
+    116, 121, 112, 101, 47, 45, 47, 99, 111, 110, 116, 101, 110, 116, 45, 116,
+    121, 112, 101, 45, 49, 46, 48, 46, 52, 46, 116, 103, 122, 115, 104, 97,
+    53, 49, 50, 45, 104, 73, 80, 51, 69, 69, 80, 115, 56, 116, 66, 57,
+    65, 84, 49, 76, 43, 78, 85, 113, 116, 119, 79, 65, 112, 115, 52, 109,
+    107, 50, 90, 111, 98, 56, 57, 77, 87, 88, 77, 72, 106, 72, 87, 103,
+    57, 109, 105, 108, 70, 47, 106, 52, 111, 115, 110, 110, 81, 76, 88, 66,
+    67, 66, 70, 66, 107, 47, 116, 118, 73, 71, 47, 116, 85, 99, 57, 109,
+    79, 85, 74, 105, 80, 66, 104, 80, 88, 65, 61, 61, 99, 111, 110, 116,
+    105, 110, 117, 97, 116, 105, 111, 110, 45, 108, 111, 99, 97, 108, 45, 115,
+    116, 111, 114, 97, 103, 101, 51, 46, 50, 46, 49, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 99, 111, 110, 116, 105, 110, 117, 97, 116, 105,
+    111, 110, 45, 108, 111, 99, 97, 108, 45, 115, 116, 111, 114, 97, 103, 101,
+    47, 45, 47, 99, 111, 110, 116, 105, 110, 117, 97, 116, 105, 111, 110, 45,
+    108, 111, 99, 97, 108, 45, 115, 116, 111, 114, 97, 103, 101, 45, 51, 46,
+    50, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 106, 120,
+    52, 52, 99, 99, 111, 110, 86, 113, 107, 67, 69, 69, 121, 76, 83, 75,
+    87, 119, 107, 118, 85, 88, 119, 79, 53, 54, 49, 106, 88, 77, 97, 51,
+    76, 80, 106, 84, 80, 115, 109, 53, 81, 82, 50, 50, 80, 65, 48, 47,
+    109, 104, 101, 51, 51, 70, 84, 52, 88, 98, 53, 121, 55, 52, 74, 68,
+    118, 116, 47, 67, 113, 43, 53, 108, 109, 56, 83, 56, 114, 115, 107, 76,
+    118, 57, 90, 65, 61, 61, 101, 109, 105, 116, 116, 101, 114, 45, 108, 105,
+    115, 116, 101, 110, 101, 114, 49, 46, 49, 46, 49, 99, 111, 111, 107, 105,
+    101, 115, 48, 46, 55, 46, 49, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 99, 111, 111, 107, 105, 101, 115, 47, 45, 47, 99, 111, 111, 107,
+    105, 101, 115, 45, 48, 46, 55, 46, 49, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 102, 73, 112, 104, 88, 49, 83, 66, 120, 104, 113, 53, 56, 87,
+    121, 68, 78, 122, 71, 56, 117, 80, 90, 106, 117, 90, 115, 61, 100, 101,
+    112, 100, 107, 101, 121, 103, 114, 105, 112, 49, 46, 48, 46, 50, 99, 111,
+    112, 121, 45, 116, 111, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    99, 111, 112, 121, 45, 116, 111, 47, 45, 47, 99, 111, 112, 121, 45, 116,
+    111, 45, 50, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    74, 111, 68, 55, 117, 65, 97, 75, 83, 78, 67, 71, 86, 114, 89, 74,
+    103, 74, 75, 57, 114, 56, 107, 71, 57, 75, 85, 61, 99, 111, 114, 101,
+    45, 117, 116, 105, 108, 45, 105, 115, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 99, 111, 114, 101, 45, 117, 116, 105, 108, 45, 105, 115, 47,
+    45, 47, 99, 111, 114, 101, 45, 117, 116, 105, 108, 45, 105, 115, 45, 49,
+    46, 48, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 116, 102, 49,
+    85, 73, 103, 113, 105, 118, 70, 113, 49, 101, 113, 116, 120, 81, 77, 108,
+    65, 100, 85, 85, 68, 119, 97, 99, 61, 99, 114, 111, 110, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 99, 114, 111, 110, 47, 45, 47, 99,
+    114, 111, 110, 45, 49, 46, 51, 46, 48, 46, 116, 103, 122, 115, 104, 97,
+    53, 49, 50, 45, 75, 47, 83, 70, 55, 74, 108, 103, 77, 109, 78, 106,
+    99, 84, 104, 87, 120, 107, 75, 118, 115, 72, 104, 101, 121, 50, 69, 68,
+    66, 52, 67, 101, 79, 69, 87, 74, 57, 97, 88, 87, 106, 51, 102, 98,
+    81, 74, 112, 112, 115, 118, 84, 80, 73, 101, 121, 76, 100, 72, 102, 78,
+    113, 53, 73, 98, 98, 115, 77, 85, 85, 106, 82, 87, 49, 110, 114, 53,
+    100, 83, 79, 57, 53, 102, 50, 69, 52, 119, 61, 61, 109, 111, 109, 101,
+    110, 116, 45, 116, 105, 109, 101, 122, 111, 110, 101, 48, 46, 53, 46, 49,
+    52, 99, 121, 99, 108, 101, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 99, 121, 99, 108, 101, 47, 45, 47, 99, 121, 99, 108, 101, 45, 49,
+    46, 48, 46, 51, 46, 116, 103, 122, 115, 104, 97, 49, 45, 73, 101, 103,
+    76, 75, 43, 104, 89, 68, 53, 105, 48, 97, 80, 78, 53, 81, 119, 90,
+    105, 115, 69, 98, 68, 83, 116, 73, 61, 100, 101, 98, 117, 103, 51, 46,
+    49, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 100, 101,
+    98, 117, 103, 47, 45, 47, 100, 101, 98, 117, 103, 45, 51, 46, 49, 46,
+    48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 79, 88, 56, 88,
+    113, 80, 55, 47, 49, 97, 57, 99, 113, 107, 120, 89, 119, 50, 121, 88,
+    115, 115, 49, 53, 102, 50, 54, 78, 75, 87, 66, 112, 68, 88, 81, 100,
+    48, 47, 117, 75, 47, 75, 80, 113, 100, 81, 104, 120, 98, 80, 97, 57,
+    57, 52, 104, 110, 122, 106, 99, 69, 50, 86, 113, 81, 112, 68, 115, 108,
+    102, 53, 53, 55, 50, 51, 99, 75, 80, 85, 79, 71, 83, 109, 77, 89,
+    51, 103, 61, 61, 109, 115, 100, 101, 101, 112, 45, 101, 113, 117, 97, 108,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 100, 101, 101, 112, 45,
+    101, 113, 117, 97, 108, 47, 45, 47, 100, 101, 101, 112, 45, 101, 113, 117,
+    97, 108, 45, 49, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 57, 100, 74, 103, 75, 83, 116, 109, 68, 103, 104, 79, 47, 48, 122,
+    98, 121, 102, 67, 75, 48, 121, 82, 48, 83, 76, 85, 61, 100, 101, 108,
+    101, 103, 97, 116, 101, 115, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 100, 101, 108, 101, 103, 97, 116, 101, 115, 47, 45, 47, 100, 101, 108,
+    101, 103, 97, 116, 101, 115, 45, 49, 46, 48, 46, 48, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 104, 77, 98, 104, 87, 98, 103, 90, 66, 80, 51,
+    75, 87, 97, 68, 118, 82, 77, 50, 72, 68, 84, 69, 108, 68, 53, 111,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 100, 101, 112, 100,
+    47, 45, 47, 100, 101, 112, 100, 45, 49, 46, 49, 46, 49, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 86, 52, 79, 48, 52, 99, 82, 90, 56, 71,
+    43, 108, 121, 105, 102, 53, 107, 102, 80, 81, 98, 110, 111, 120, 65, 49,
+    107, 61, 100, 101, 115, 116, 114, 111, 121, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 100, 101, 115, 116, 114, 111, 121, 47, 45, 47, 100, 101,
+    115, 116, 114, 111, 121, 45, 49, 46, 48, 46, 52, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 108, 52, 104, 88, 82, 67, 120, 69, 100, 74, 53, 67,
+    66, 109, 69, 43, 78, 53, 82, 105, 66, 89, 74, 113, 118, 89, 65, 61,
+    101, 101, 45, 102, 105, 114, 115, 116, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 101, 101, 45, 102, 105, 114, 115, 116, 47, 45, 47, 101, 101,
+    45, 102, 105, 114, 115, 116, 45, 49, 46, 49, 46, 49, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 87, 81, 120, 104, 70, 87, 115, 75, 52, 118, 84,
+    119, 74, 86, 99, 121, 111, 86, 105, 121, 90, 114, 120, 87, 115, 104, 48,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 101, 109, 105, 116,
+    116, 101, 114, 45, 108, 105, 115, 116, 101, 110, 101, 114, 47, 45, 47, 101,
+    109, 105, 116, 116, 101, 114, 45, 108, 105, 115, 116, 101, 110, 101, 114, 45,
+    49, 46, 49, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 54, 76,
+    117, 43, 103, 107, 83, 56, 106, 103, 48, 76, 84, 118, 99, 99, 48, 85,
+    75, 85, 120, 47, 74, 66, 120, 43, 119, 61, 101, 114, 114, 111, 114, 45,
+    105, 110, 106, 101, 99, 116, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 101, 114, 114, 111, 114, 45, 105, 110, 106, 101, 99, 116, 47, 45, 47,
+    101, 114, 114, 111, 114, 45, 105, 110, 106, 101, 99, 116, 45, 49, 46, 48,
+    46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 52, 114, 80, 90, 71,
+    49, 83, 117, 49, 110, 76, 122, 67, 100, 108, 81, 48, 86, 83, 70, 68,
+    54, 69, 100, 84, 122, 99, 61, 101, 115, 54, 45, 112, 114, 111, 109, 105,
+    115, 101, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 101, 115, 54,
+    45, 112, 114, 111, 109, 105, 115, 101, 47, 45, 47, 101, 115, 54, 45, 112,
+    114, 111, 109, 105, 115, 101, 45, 51, 46, 50, 46, 49, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 55, 70, 89, 106, 79, 71, 103, 68, 75, 81, 107,
+    103, 99, 88, 68, 68, 108, 69, 106, 105, 82, 69, 110, 100, 72, 56, 81,
+    61, 101, 115, 99, 97, 112, 101, 45, 104, 116, 109, 108, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 101, 115, 99, 97, 112, 101, 45, 104, 116,
+    109, 108, 47, 45, 47, 101, 115, 99, 97, 112, 101, 45, 104, 116, 109, 108,
+    45, 49, 46, 48, 46, 51, 46, 116, 103, 122, 115, 104, 97, 49, 45, 65,
+    108, 106, 113, 53, 78, 80, 81, 119, 74, 100, 78, 52, 99, 70, 112, 71,
+    73, 55, 119, 66, 82, 48, 100, 71, 89, 103, 61, 101, 115, 99, 97, 112,
+    101, 45, 114, 101, 103, 101, 120, 112, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 101, 115, 99, 97, 112, 101, 45, 114, 101, 103, 101, 120, 112,
+    47, 45, 47, 101, 115, 99, 97, 112, 101, 45, 114, 101, 103, 101, 120, 112,
+    45, 48, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 57,
+    69, 118, 97, 69, 116, 82, 98, 118, 102, 110, 76, 102, 52, 89, 117, 53,
+    43, 83, 67, 101, 122, 51, 84, 73, 108, 81, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 101, 115, 99, 97, 112, 101, 45, 115, 116, 114,
+    105, 110, 103, 45, 114, 101, 103, 101, 120, 112, 47, 45, 47, 101, 115, 99,
+    97, 112, 101, 45, 115, 116, 114, 105, 110, 103, 45, 114, 101, 103, 101, 120,
+    112, 45, 49, 46, 48, 46, 53, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    71, 50, 72, 65, 86, 105, 71, 81, 113, 78, 47, 50, 114, 106, 117, 121,
+    122, 119, 73, 65, 121, 104, 77, 76, 104, 116, 81, 61, 101, 118, 101, 110,
+    116, 101, 109, 105, 116, 116, 101, 114, 50, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 101, 118, 101, 110, 116, 101, 109, 105, 116, 116, 101, 114,
+    50, 47, 45, 47, 101, 118, 101, 110, 116, 101, 109, 105, 116, 116, 101, 114,
+    50, 45, 49, 46, 48, 46, 53, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    43, 89, 78, 104, 66, 82, 101, 120, 99, 51, 119, 76, 110, 99, 90, 68,
+    118, 115, 113, 84, 105, 84, 119, 69, 51, 120, 103, 61, 101, 120, 112, 97,
+    110, 100, 45, 98, 114, 97, 99, 107, 101, 116, 115, 48, 46, 49, 46, 53,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 101, 120, 112, 97, 110,
+    100, 45, 98, 114, 97, 99, 107, 101, 116, 115, 47, 45, 47, 101, 120, 112,
+    97, 110, 100, 45, 98, 114, 97, 99, 107, 101, 116, 115, 45, 48, 46, 49,
+    46, 53, 46, 116, 103, 122, 115, 104, 97, 49, 45, 51, 119, 99, 111, 84,
+    106, 81, 113, 103, 72, 122, 88, 77, 54, 120, 97, 57, 121, 81, 82, 53,
+    89, 72, 82, 70, 51, 115, 61, 105, 115, 45, 112, 111, 115, 105, 120, 45,
+    98, 114, 97, 99, 107, 101, 116, 48, 46, 49, 46, 49, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 101, 120, 112, 97, 110, 100, 45, 114, 97,
+    110, 103, 101, 47, 45, 47, 101, 120, 112, 97, 110, 100, 45, 114, 97, 110,
+    103, 101, 45, 49, 46, 56, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 111, 112, 110, 118, 47, 84, 78, 102, 52, 110, 73, 101, 117, 117, 106,
+    105, 86, 43, 120, 53, 90, 69, 47, 73, 85, 122, 99, 61, 102, 105, 108,
+    108, 45, 114, 97, 110, 103, 101, 50, 46, 50, 46, 51, 101, 120, 116, 101,
+    110, 100, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 101, 120, 116,
+    101, 110, 100, 47, 45, 47, 101, 120, 116, 101, 110, 100, 45, 51, 46, 48,
+    46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 112, 49, 88, 113, 101,
+    56, 71, 116, 47, 77, 87, 106, 72, 79, 102, 110, 89, 116, 117, 113, 51,
+    70, 53, 106, 90, 69, 81, 61, 101, 120, 116, 103, 108, 111, 98, 48, 46,
+    51, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 101, 120,
+    116, 103, 108, 111, 98, 47, 45, 47, 101, 120, 116, 103, 108, 111, 98, 45,
+    48, 46, 51, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 76, 104,
+    106, 47, 80, 83, 57, 74, 113, 121, 100, 108, 122, 115, 107, 67, 80, 119,
+    69, 100, 113, 111, 50, 68, 83, 97, 69, 61, 105, 115, 45, 101, 120, 116,
+    103, 108, 111, 98, 101, 121, 101, 115, 48, 46, 49, 46, 56, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 101, 121, 101, 115, 47, 45, 47, 101,
+    121, 101, 115, 45, 48, 46, 49, 46, 56, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 89, 115, 56, 83, 65, 106, 84, 71, 103, 51, 104, 100, 107, 67,
+    78, 73, 113, 65, 68, 118, 80, 103, 122, 67, 67, 56, 65, 61, 102, 99,
+    108, 111, 110, 101, 49, 46, 48, 46, 49, 49, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 102, 99, 108, 111, 110, 101, 47, 45, 47, 102, 99,
+    108, 111, 110, 101, 45, 49, 46, 48, 46, 49, 49, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 69, 79, 104, 100, 111, 52, 118, 43, 112, 47, 120, 90,
+    107, 48, 72, 67, 108, 117, 52, 100, 100, 121, 90, 117, 53, 107, 65, 61,
+    102, 105, 108, 101, 110, 97, 109, 101, 45, 114, 101, 103, 101, 120, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 102, 105, 108, 101, 110, 97, 109,
+    101, 45, 114, 101, 103, 101, 120, 47, 45, 47, 102, 105, 108, 101, 110, 97,
+    109, 101, 45, 114, 101, 103, 101, 120, 45, 50, 46, 48, 46, 49, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 119, 99, 83, 53, 118, 117, 80, 103, 108,
+    121, 88, 100, 115, 81, 97, 51, 88, 66, 52, 119, 72, 43, 76, 120, 105,
+    121, 89, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 102, 105,
+    108, 108, 45, 114, 97, 110, 103, 101, 47, 45, 47, 102, 105, 108, 108, 45,
+    114, 97, 110, 103, 101, 45, 50, 46, 50, 46, 51, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 85, 76, 100, 57, 47, 88, 53, 71, 109, 56, 100, 74,
+    74, 72, 67, 87, 78, 112, 110, 43, 101, 111, 83, 70, 112, 121, 77, 61,
+    105, 115, 45, 110, 117, 109, 98, 101, 114, 105, 115, 111, 98, 106, 101, 99,
+    116, 114, 97, 110, 100, 111, 109, 97, 116, 105, 99, 49, 46, 49, 46, 55,
+    114, 101, 112, 101, 97, 116, 45, 115, 116, 114, 105, 110, 103, 49, 46, 54,
+    46, 49, 102, 111, 114, 45, 105, 110, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 102, 111, 114, 45, 105, 110, 47, 45, 47, 102, 111, 114, 45,
+    105, 110, 45, 49, 46, 48, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 103, 81, 97, 78, 75, 86, 113, 66, 81, 117, 119, 75, 120, 121, 98,
+    71, 52, 105, 65, 77, 77, 80, 116, 116, 88, 111, 65, 61, 102, 111, 114,
+    45, 111, 119, 110, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 102,
+    111, 114, 45, 111, 119, 110, 47, 45, 47, 102, 111, 114, 45, 111, 119, 110,
+    45, 48, 46, 49, 46, 53, 46, 116, 103, 122, 115, 104, 97, 49, 45, 85,
+    109, 88, 71, 103, 97, 84, 121, 108, 78, 113, 55, 56, 88, 121, 86, 67,
+    98, 90, 50, 79, 113, 104, 70, 69, 77, 52, 61, 102, 114, 101, 115, 104,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 102, 114, 101, 115, 104,
+    47, 45, 47, 102, 114, 101, 115, 104, 45, 48, 46, 53, 46, 50, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 80, 89, 121, 116, 50, 81, 50, 88, 90,
+    87, 110, 54, 103, 49, 113, 120, 43, 79, 83, 121, 79, 104, 66, 87, 66,
+    97, 99, 61, 102, 115, 46, 114, 101, 97, 108, 112, 97, 116, 104, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 102, 115, 46, 114, 101, 97, 108,
+    112, 97, 116, 104, 47, 45, 47, 102, 115, 46, 114, 101, 97, 108, 112, 97,
+    116, 104, 45, 49, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 70, 81, 83, 116, 74, 83, 77, 86, 106, 75, 112, 65, 50, 48, 111,
+    110, 104, 56, 115, 66, 81, 82, 109, 85, 54, 107, 56, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 102, 115, 101, 118, 101, 110, 116, 115,
+    47, 45, 47, 102, 115, 101, 118, 101, 110, 116, 115, 45, 49, 46, 49, 46,
+    51, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 87, 73, 114, 55,
+    105, 68, 107, 100, 109, 100, 98, 120, 117, 47, 71, 104, 54, 101, 75, 69,
+    90, 74, 76, 54, 75, 80, 69, 55, 52, 47, 53, 77, 69, 115, 102, 50,
+    119, 104, 84, 79, 70, 78, 120, 98, 73, 111, 73, 105, 120, 111, 103, 114,
+    111, 76, 100, 75, 89, 113, 66, 54, 70, 68, 97, 118, 52, 87, 97, 118,
+    104, 47, 108, 90, 100, 122, 122, 100, 51, 98, 50, 75, 120, 73, 88, 67,
+    53, 81, 61, 61, 111, 112, 116, 105, 111, 110, 97, 108, 110, 97, 110, 50,
+    46, 56, 46, 48, 110, 111, 100, 101, 45, 112, 114, 101, 45, 103, 121, 112,
+    48, 46, 54, 46, 51, 57, 97, 98, 98, 114, 101, 118, 98, 117, 110, 100,
+    108, 101, 100, 97, 106, 118, 52, 46, 49, 49, 46, 56, 106, 115, 111, 110,
+    45, 115, 116, 97, 98, 108, 101, 45, 115, 116, 114, 105, 110, 103, 105, 102,
+    121, 97, 112, 114, 111, 98, 97, 97, 114, 101, 45, 119, 101, 45, 116, 104,
+    101, 114, 101, 45, 121, 101, 116, 49, 46, 49, 46, 52, 114, 101, 97, 100,
+    97, 98, 108, 101, 45, 115, 116, 114, 101, 97, 109, 50, 46, 50, 46, 57,
+    97, 115, 110, 49, 48, 46, 50, 46, 51, 97, 115, 115, 101, 114, 116, 45,
+    112, 108, 117, 115, 97, 115, 121, 110, 99, 107, 105, 116, 48, 46, 52, 46,
+    48, 97, 119, 115, 45, 115, 105, 103, 110, 50, 48, 46, 54, 46, 48, 97,
+    119, 115, 52, 49, 46, 54, 46, 48, 48, 46, 52, 46, 50, 98, 99, 114,
+    121, 112, 116, 45, 112, 98, 107, 100, 102, 116, 119, 101, 101, 116, 110, 97,
+    99, 108, 48, 46, 49, 52, 46, 53, 98, 108, 111, 99, 107, 45, 115, 116,
+    114, 101, 97, 109, 48, 46, 48, 46, 57, 98, 111, 111, 109, 50, 46, 49,
+    48, 46, 49, 104, 111, 101, 107, 50, 46, 49, 54, 46, 51, 99, 97, 115,
+    101, 108, 101, 115, 115, 48, 46, 49, 50, 46, 48, 99, 111, 100, 101, 45,
+    112, 111, 105, 110, 116, 45, 97, 116, 99, 111, 109, 98, 105, 110, 101, 100,
+    45, 115, 116, 114, 101, 97, 109, 100, 101, 108, 97, 121, 101, 100, 45, 115,
+    116, 114, 101, 97, 109, 99, 111, 110, 115, 111, 108, 101, 45, 99, 111, 110,
+    116, 114, 111, 108, 45, 115, 116, 114, 105, 110, 103, 115, 99, 114, 121, 112,
+    116, 105, 108, 101, 115, 50, 46, 48, 46, 53, 100, 97, 115, 104, 100, 97,
+    115, 104, 49, 46, 49, 52, 46, 49, 50, 46, 54, 46, 56, 100, 101, 101,
+    112, 45, 101, 120, 116, 101, 110, 100, 100, 101, 116, 101, 99, 116, 45, 108,
+    105, 98, 99, 101, 99, 99, 45, 106, 115, 98, 110, 106, 115, 98, 110, 101,
+    120, 116, 115, 112, 114, 105, 110, 116, 102, 102, 111, 114, 101, 118, 101, 114,
+    45, 97, 103, 101, 110, 116, 102, 111, 114, 109, 45, 100, 97, 116, 97, 50,
+    46, 49, 46, 49, 53, 102, 115, 116, 114, 101, 97, 109, 103, 114, 97, 99,
+    101, 102, 117, 108, 45, 102, 115, 52, 46, 49, 46, 49, 49, 109, 107, 100,
+    105, 114, 112, 48, 46, 53, 46, 49, 114, 105, 109, 114, 97, 102, 50, 46,
+    54, 46, 49, 102, 115, 116, 114, 101, 97, 109, 45, 105, 103, 110, 111, 114,
+    101, 109, 105, 110, 105, 109, 97, 116, 99, 104, 51, 46, 48, 46, 52, 103,
+    97, 117, 103, 101, 50, 46, 55, 46, 52, 104, 97, 115, 45, 117, 110, 105,
+    99, 111, 100, 101, 111, 98, 106, 101, 99, 116, 45, 97, 115, 115, 105, 103,
+    110, 52, 46, 49, 46, 49, 115, 105, 103, 110, 97, 108, 45, 101, 120, 105,
+    116, 51, 46, 48, 46, 50, 115, 116, 114, 105, 110, 103, 45, 119, 105, 100,
+    116, 104, 119, 105, 100, 101, 45, 97, 108, 105, 103, 110, 103, 101, 116, 112,
+    97, 115, 115, 48, 46, 49, 46, 55, 103, 108, 111, 98, 55, 46, 49, 46,
+    50, 105, 110, 102, 108, 105, 103, 104, 116, 111, 110, 99, 101, 49, 46, 52,
+    46, 48, 104, 97, 114, 45, 115, 99, 104, 101, 109, 97, 104, 97, 114, 45,
+    118, 97, 108, 105, 100, 97, 116, 111, 114, 52, 46, 50, 46, 49, 104, 97,
+    119, 107, 51, 46, 49, 46, 51, 115, 110, 116, 112, 104, 116, 116, 112, 45,
+    115, 105, 103, 110, 97, 116, 117, 114, 101, 106, 115, 112, 114, 105, 109, 115,
+    115, 104, 112, 107, 49, 46, 49, 51, 46, 48, 119, 114, 97, 112, 112, 121,
+    105, 110, 105, 105, 115, 45, 102, 117, 108, 108, 119, 105, 100, 116, 104, 45,
+    99, 111, 100, 101, 45, 112, 111, 105, 110, 116, 110, 117, 109, 98, 101, 114,
+    45, 105, 115, 45, 110, 97, 110, 105, 115, 45, 116, 121, 112, 101, 100, 97,
+    114, 114, 97, 121, 105, 115, 97, 114, 114, 97, 121, 105, 115, 115, 116, 114,
+    101, 97, 109, 106, 111, 100, 105, 100, 50, 53, 53, 49, 57, 106, 115, 111,
+    110, 45, 115, 99, 104, 101, 109, 97, 106, 115, 111, 110, 105, 102, 121, 48,
+    46, 48, 46, 48, 106, 115, 111, 110, 45, 115, 116, 114, 105, 110, 103, 105,
+    102, 121, 45, 115, 97, 102, 101, 53, 46, 48, 46, 49, 118, 101, 114, 114,
+    111, 114, 49, 46, 51, 46, 54, 109, 105, 109, 101, 45, 100, 98, 49, 46,
+    50, 55, 46, 48, 109, 105, 110, 105, 109, 105, 115, 116, 48, 46, 48, 46,
+    56, 110, 111, 112, 116, 52, 46, 48, 46, 49, 110, 112, 109, 108, 111, 103,
+    52, 46, 49, 46, 48, 114, 99, 114, 101, 113, 117, 101, 115, 116, 50, 46,
+    56, 49, 46, 48, 53, 46, 51, 46, 48, 116, 97, 114, 116, 97, 114, 45,
+    112, 97, 99, 107, 51, 46, 52, 46, 48, 111, 115, 101, 110, 118, 48, 46,
+    49, 46, 52, 115, 101, 116, 45, 98, 108, 111, 99, 107, 105, 110, 103, 111,
+    97, 117, 116, 104, 45, 115, 105, 103, 110, 48, 46, 56, 46, 50, 111, 115,
+    45, 104, 111, 109, 101, 100, 105, 114, 111, 115, 45, 116, 109, 112, 100, 105,
+    114, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 45, 110, 111, 119,
+    112, 114, 111, 99, 101, 115, 115, 45, 110, 101, 120, 116, 105, 99, 107, 45,
+    97, 114, 103, 115, 49, 46, 48, 46, 55, 112, 117, 110, 121, 99, 111, 100,
+    101, 49, 46, 52, 46, 49, 54, 46, 52, 46, 48, 115, 116, 114, 105, 112,
+    45, 106, 115, 111, 110, 45, 99, 111, 109, 109, 101, 110, 116, 115, 115, 116,
+    114, 105, 110, 103, 95, 100, 101, 99, 111, 100, 101, 114, 117, 116, 105, 108,
+    45, 100, 101, 112, 114, 101, 99, 97, 116, 101, 115, 97, 102, 101, 45, 98,
+    117, 102, 102, 101, 114, 115, 116, 114, 105, 110, 103, 115, 116, 114, 101, 97,
+    109, 48, 46, 48, 46, 53, 116, 111, 117, 103, 104, 45, 99, 111, 111, 107,
+    105, 101, 116, 117, 110, 110, 101, 108, 45, 97, 103, 101, 110, 116, 117, 117,
+    105, 100, 117, 105, 100, 45, 110, 117, 109, 98, 101, 114, 48, 46, 48, 46,
+    54, 103, 107, 116, 104, 116, 116, 112, 115, 58, 47, 47, 116, 103, 122, 46,
+    112, 109, 50, 46, 105, 111, 47, 103, 107, 116, 45, 49, 46, 48, 46, 48,
+    46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 122, 114, 54, 81, 81,
+    110, 122, 76, 116, 51, 74, 97, 48, 116, 48, 88, 73, 56, 103, 119, 115,
+    50, 107, 110, 55, 122, 86, 50, 112, 48, 108, 47, 68, 51, 107, 114, 101,
+    78, 118, 83, 54, 104, 70, 90, 104, 86, 85, 53, 103, 43, 117, 89, 47,
+    51, 48, 108, 52, 50, 106, 98, 103, 116, 48, 88, 71, 99, 78, 66, 69,
+    109, 66, 68, 71, 74, 82, 55, 49, 74, 54, 57, 50, 86, 57, 50, 116,
+    65, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 103, 108,
+    111, 98, 47, 45, 47, 103, 108, 111, 98, 45, 55, 46, 49, 46, 50, 46,
+    116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 77, 74, 84, 85, 103, 49,
+    107, 106, 117, 76, 101, 81, 67, 74, 43, 99, 99, 69, 52, 86, 112, 97,
+    54, 107, 75, 86, 88, 107, 80, 89, 74, 50, 109, 79, 67, 81, 121, 85,
+    117, 75, 76, 99, 76, 81, 115, 100, 114, 77, 67, 112, 66, 80, 85, 105,
+    56, 113, 86, 69, 54, 43, 89, 117, 97, 74, 107, 111, 122, 101, 65, 57,
+    78, 117, 115, 84, 65, 119, 51, 104, 76, 114, 56, 88, 101, 53, 69, 81,
+    61, 61, 103, 108, 111, 98, 45, 98, 97, 115, 101, 48, 46, 51, 46, 48,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 103, 108, 111, 98, 45,
+    98, 97, 115, 101, 47, 45, 47, 103, 108, 111, 98, 45, 98, 97, 115, 101,
+    45, 48, 46, 51, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 50,
+    55, 70, 107, 57, 105, 73, 98, 72, 65, 115, 99, 122, 52, 75, 117, 111,
+    121, 105, 48, 108, 57, 56, 79, 111, 56, 81, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 103, 108, 111, 98, 45, 112, 97, 114, 101, 110,
+    116, 47, 45, 47, 103, 108, 111, 98, 45, 112, 97, 114, 101, 110, 116, 45,
+    50, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 103, 84,
+    103, 57, 99, 116, 115, 70, 84, 56, 122, 80, 85, 122, 98, 97, 113, 81,
+    76, 120, 103, 118, 98, 116, 117, 121, 103, 61, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 103, 114, 97, 99, 101, 102, 117, 108, 45, 102, 115,
+    47, 45, 47, 103, 114, 97, 99, 101, 102, 117, 108, 45, 102, 115, 45, 52,
+    46, 49, 46, 49, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 68, 111,
+    118, 102, 53, 78, 72, 100, 117, 73, 86, 78, 90, 79, 66, 79, 112, 56,
+    65, 79, 75, 103, 74, 117, 86, 108, 103, 61, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 104, 97, 115, 45, 97, 110, 115, 105, 47, 45, 47,
+    104, 97, 115, 45, 97, 110, 115, 105, 45, 50, 46, 48, 46, 48, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 78, 80, 85, 69, 110, 79, 72, 115, 51,
+    121, 115, 71, 83, 97, 56, 43, 56, 107, 53, 70, 55, 84, 86, 66, 98,
+    90, 69, 61, 104, 111, 111, 107, 115, 45, 102, 105, 120, 101, 100, 50, 46,
+    48, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 104, 111,
+    111, 107, 115, 45, 102, 105, 120, 101, 100, 47, 45, 47, 104, 111, 111, 107,
+    115, 45, 102, 105, 120, 101, 100, 45, 50, 46, 48, 46, 50, 46, 116, 103,
+    122, 115, 104, 97, 53, 49, 50, 45, 89, 117, 114, 67, 77, 52, 103, 81,
+    83, 101, 116, 99, 114, 104, 119, 69, 116, 112, 81, 72, 104, 81, 52, 77,
+    55, 90, 111, 55, 112, 111, 78, 71, 113, 89, 52, 107, 81, 71, 101, 66,
+    83, 54, 101, 90, 116, 79, 99, 84, 51, 116, 110, 78, 115, 48, 49, 84,
+    104, 70, 97, 48, 106, 89, 66, 66, 121, 65, 105, 89, 116, 49, 77, 106,
+    77, 106, 80, 47, 89, 65, 112, 71, 48, 69, 110, 65, 118, 81, 61, 61,
+    104, 116, 116, 112, 45, 97, 115, 115, 101, 114, 116, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 104, 116, 116, 112, 45, 97, 115, 115, 101, 114,
+    116, 47, 45, 47, 104, 116, 116, 112, 45, 97, 115, 115, 101, 114, 116, 45,
+    49, 46, 51, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 111, 120,
+    112, 99, 43, 73, 121, 72, 80, 115, 117, 49, 101, 87, 107, 72, 49, 78,
+    98, 120, 77, 117, 106, 65, 72, 107, 111, 61, 104, 116, 116, 112, 45, 101,
+    114, 114, 111, 114, 115, 49, 46, 54, 46, 50, 104, 116, 116, 112, 45, 97,
+    117, 116, 104, 51, 46, 50, 46, 51, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 104, 116, 116, 112, 45, 97, 117, 116, 104, 47, 45, 47, 104,
+    116, 116, 112, 45, 97, 117, 116, 104, 45, 51, 46, 50, 46, 51, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 89, 50, 104, 67, 116, 120, 49, 117, 72,
+    121, 121, 89, 50, 54, 67, 97, 57, 85, 81, 88, 111, 102, 55, 52, 116,
+    104, 119, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 104, 116,
+    116, 112, 45, 101, 114, 114, 111, 114, 115, 47, 45, 47, 104, 116, 116, 112,
+    45, 101, 114, 114, 111, 114, 115, 45, 49, 46, 54, 46, 50, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 67, 103, 65, 115, 121, 70, 99, 72, 71, 83,
+    112, 43, 101, 85, 98, 79, 55, 99, 69, 82, 86, 102, 89, 79, 120, 122,
+    89, 61, 115, 101, 116, 112, 114, 111, 116, 111, 116, 121, 112, 101, 111, 102,
+    115, 116, 97, 116, 117, 115, 101, 115, 104, 117, 109, 97, 110, 105, 122, 101,
+    45, 110, 117, 109, 98, 101, 114, 48, 46, 48, 46, 50, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 104, 117, 109, 97, 110, 105, 122, 101, 45,
+    110, 117, 109, 98, 101, 114, 47, 45, 47, 104, 117, 109, 97, 110, 105, 122,
+    101, 45, 110, 117, 109, 98, 101, 114, 45, 48, 46, 48, 46, 50, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 69, 99, 67, 118, 97, 107, 99, 87, 81,
+    50, 77, 49, 105, 70, 105, 65, 83, 80, 70, 53, 108, 85, 70, 73, 110,
+    66, 103, 61, 105, 99, 111, 110, 118, 45, 108, 105, 116, 101, 48, 46, 52,
+    46, 49, 57, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 99,
+    111, 110, 118, 45, 108, 105, 116, 101, 47, 45, 47, 105, 99, 111, 110, 118,
+    45, 108, 105, 116, 101, 45, 48, 46, 52, 46, 49, 57, 46, 116, 103, 122,
+    115, 104, 97, 53, 49, 50, 45, 111, 84, 90, 113, 119, 101, 73, 80, 53,
+    49, 120, 97, 71, 80, 73, 52, 117, 80, 97, 53, 54, 47, 80, 114, 105,
+    47, 52, 56, 48, 82, 43, 109, 111, 55, 83, 101, 85, 43, 89, 69, 84,
+    66, 121, 81, 78, 104, 68, 71, 53, 53, 121, 99, 70, 121, 78, 76, 73,
+    103, 116, 97, 57, 118, 88, 104, 73, 76, 114, 120, 88, 68, 109, 70, 55,
+    90, 71, 104, 113, 90, 73, 99, 117, 78, 48, 103, 74, 81, 61, 61, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 110, 102, 108, 97, 116,
+    105, 111, 110, 47, 45, 47, 105, 110, 102, 108, 97, 116, 105, 111, 110, 45,
+    50, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 105, 48,
+    70, 43, 82, 56, 75, 80, 107, 108, 112, 70, 69, 122, 50, 82, 84, 75,
+    72, 57, 79, 74, 69, 72, 56, 119, 56, 61, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 105, 110, 102, 108, 105, 103, 104, 116, 47, 45, 47,
+    105, 110, 102, 108, 105, 103, 104, 116, 45, 49, 46, 48, 46, 54, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 83, 98, 49, 106, 77, 100, 102, 81, 76,
+    81, 119, 74, 118, 74, 69, 75, 69, 72, 87, 54, 103, 87, 87, 49, 98,
+    102, 107, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 110,
+    104, 101, 114, 105, 116, 115, 47, 45, 47, 105, 110, 104, 101, 114, 105, 116,
+    115, 45, 50, 46, 48, 46, 51, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    89, 122, 119, 115, 103, 43, 80, 97, 81, 113, 85, 67, 57, 83, 82, 109,
+    65, 105, 83, 65, 57, 67, 67, 67, 89, 100, 52, 61, 105, 110, 116, 101,
+    114, 112, 114, 101, 116, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    105, 110, 116, 101, 114, 112, 114, 101, 116, 47, 45, 47, 105, 110, 116, 101,
+    114, 112, 114, 101, 116, 45, 49, 46, 49, 46, 48, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 102, 116, 71, 120, 81, 81, 120, 113, 68, 103, 57, 52,
+    122, 53, 88, 84, 117, 69, 81, 77, 89, 47, 101, 76, 104, 104, 81, 61,
+    105, 115, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 47,
+    45, 47, 105, 115, 45, 51, 46, 50, 46, 49, 46, 116, 103, 122, 115, 104,
+    97, 49, 45, 48, 75, 119, 113, 49, 86, 54, 51, 115, 76, 55, 74, 74,
+    113, 85, 109, 98, 50, 120, 109, 75, 113, 113, 68, 51, 75, 85, 61, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 45, 98, 105, 110,
+    97, 114, 121, 45, 112, 97, 116, 104, 47, 45, 47, 105, 115, 45, 98, 105,
+    110, 97, 114, 121, 45, 112, 97, 116, 104, 45, 49, 46, 48, 46, 49, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 100, 102, 70, 109, 81, 114, 83, 65,
+    56, 89, 101, 110, 69, 99, 103, 85, 70, 104, 47, 84, 112, 75, 100, 108,
+    87, 74, 103, 61, 105, 115, 45, 98, 117, 102, 102, 101, 114, 49, 46, 49,
+    46, 54, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 45,
+    98, 117, 102, 102, 101, 114, 47, 45, 47, 105, 115, 45, 98, 117, 102, 102,
+    101, 114, 45, 49, 46, 49, 46, 54, 46, 116, 103, 122, 115, 104, 97, 53,
+    49, 50, 45, 78, 99, 100, 65, 76, 119, 112, 88, 107, 84, 109, 53, 90,
+    118, 118, 98, 107, 55, 111, 119, 79, 85, 83, 118, 86, 118, 66, 75, 68,
+    103, 75, 80, 53, 47, 101, 119, 102, 88, 69, 122, 110, 109, 81, 70, 102,
+    115, 52, 90, 82, 109, 97, 110, 79, 101, 75, 66, 84, 106, 82, 86, 106,
+    107, 97, 51, 81, 70, 111, 78, 54, 88, 74, 43, 57, 70, 51, 85, 83,
+    113, 102, 72, 113, 84, 97, 85, 53, 119, 61, 61, 105, 115, 45, 100, 111,
+    116, 102, 105, 108, 101, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    105, 115, 45, 100, 111, 116, 102, 105, 108, 101, 47, 45, 47, 105, 115, 45,
+    100, 111, 116, 102, 105, 108, 101, 45, 49, 46, 48, 46, 51, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 112, 113, 76, 122, 76, 47, 48, 116, 43, 119,
+    84, 49, 121, 105, 88, 115, 48, 80, 97, 52, 80, 80, 101, 89, 111, 101,
+    69, 61, 105, 115, 45, 101, 113, 117, 97, 108, 45, 115, 104, 97, 108, 108,
+    111, 119, 48, 46, 49, 46, 51, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 105, 115, 45, 101, 113, 117, 97, 108, 45, 115, 104, 97, 108, 108,
+    111, 119, 47, 45, 47, 105, 115, 45, 101, 113, 117, 97, 108, 45, 115, 104,
+    97, 108, 108, 111, 119, 45, 48, 46, 49, 46, 51, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 73, 106, 103, 74, 106, 56, 73, 104, 51, 103, 118, 80,
+    112, 100, 110, 113, 120, 77, 82, 100, 89, 52, 113, 104, 120, 84, 81, 61,
+    105, 115, 45, 112, 114, 105, 109, 105, 116, 105, 118, 101, 105, 115, 45, 101,
+    120, 116, 101, 110, 100, 97, 98, 108, 101, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 105, 115, 45, 101, 120, 116, 101, 110, 100, 97, 98, 108,
+    101, 47, 45, 47, 105, 115, 45, 101, 120, 116, 101, 110, 100, 97, 98, 108,
+    101, 45, 48, 46, 49, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    89, 114, 69, 81, 52, 111, 109, 107, 99, 85, 71, 79, 80, 115, 78, 113,
+    89, 88, 49, 72, 76, 106, 65, 100, 47, 73, 107, 61, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 105, 115, 45, 101, 120, 116, 103, 108, 111,
+    98, 47, 45, 47, 105, 115, 45, 101, 120, 116, 103, 108, 111, 98, 45, 49,
+    46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 114, 69, 97,
+    66, 100, 56, 83, 85, 78, 65, 87, 103, 107, 118, 121, 80, 75, 88, 89,
+    77, 98, 47, 120, 105, 66, 115, 65, 61, 105, 115, 45, 103, 101, 110, 101,
+    114, 97, 116, 111, 114, 45, 102, 117, 110, 99, 116, 105, 111, 110, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 45, 103, 101, 110, 101,
+    114, 97, 116, 111, 114, 45, 102, 117, 110, 99, 116, 105, 111, 110, 47, 45,
+    47, 105, 115, 45, 103, 101, 110, 101, 114, 97, 116, 111, 114, 45, 102, 117,
+    110, 99, 116, 105, 111, 110, 45, 49, 46, 48, 46, 54, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 110, 110, 70, 108, 80, 78, 70, 102, 47, 122, 81,
+    99, 101, 99, 81, 86, 70, 71, 67, 104, 77, 100, 77, 101, 110, 56, 81,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 45, 103,
+    108, 111, 98, 47, 45, 47, 105, 115, 45, 103, 108, 111, 98, 45, 50, 46,
+    48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 48, 74, 98, 53,
+    74, 113, 80, 101, 49, 87, 65, 80, 80, 57, 47, 90, 69, 90, 106, 76,
+    67, 73, 106, 67, 50, 71, 77, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 105, 115, 45, 110, 117, 109, 98, 101, 114, 47, 45, 47, 105,
+    115, 45, 110, 117, 109, 98, 101, 114, 45, 50, 46, 49, 46, 48, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 65, 102, 121, 55, 115, 53, 78, 71, 79,
+    108, 83, 80, 76, 48, 90, 115, 122, 104, 98, 101, 122, 107, 110, 98, 107,
+    73, 56, 61, 107, 105, 110, 100, 45, 111, 102, 51, 46, 50, 46, 50, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 45, 112, 111, 115,
+    105, 120, 45, 98, 114, 97, 99, 107, 101, 116, 47, 45, 47, 105, 115, 45,
+    112, 111, 115, 105, 120, 45, 98, 114, 97, 99, 107, 101, 116, 45, 48, 46,
+    49, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 77, 122, 84, 99,
+    101, 88, 100, 68, 97, 79, 107, 118, 65, 87, 53, 118, 118, 65, 113, 73,
+    57, 99, 49, 117, 97, 56, 81, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 105, 115, 45, 112, 114, 105, 109, 105, 116, 105, 118, 101, 47,
+    45, 47, 105, 115, 45, 112, 114, 105, 109, 105, 116, 105, 118, 101, 45, 50,
+    46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 73, 72, 117,
+    114, 107, 87, 79, 69, 109, 99, 66, 55, 75, 116, 56, 107, 67, 107, 71,
+    111, 99, 104, 65, 68, 82, 88, 85, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 105, 115, 97, 114, 114, 97, 121, 47, 45, 47, 105, 115,
+    97, 114, 114, 97, 121, 45, 48, 46, 48, 46, 49, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 105, 104, 105, 115, 47, 75, 109, 111, 57, 66, 100, 43,
+    67, 97, 118, 56, 89, 68, 105, 84, 109, 119, 88, 82, 55, 116, 56, 61,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 111, 98, 106,
+    101, 99, 116, 47, 45, 47, 105, 115, 111, 98, 106, 101, 99, 116, 45, 50,
+    46, 49, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 56, 71, 86,
+    87, 69, 74, 97, 106, 56, 100, 111, 117, 57, 71, 74, 121, 43, 66, 88,
+    73, 81, 78, 104, 43, 68, 73, 107, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 105, 115, 97, 114, 114, 97, 121, 47, 45, 47, 105, 115,
+    97, 114, 114, 97, 121, 45, 49, 46, 48, 46, 48, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 117, 53, 78, 100, 83, 70, 103, 115, 117, 104, 97, 77,
+    66, 111, 78, 74, 86, 54, 86, 75, 80, 103, 99, 83, 84, 120, 69, 61,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 115, 116, 114,
+    101, 97, 109, 47, 45, 47, 105, 115, 115, 116, 114, 101, 97, 109, 45, 48,
+    46, 49, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 82, 43, 89,
+    47, 101, 118, 86, 97, 43, 109, 43, 83, 52, 86, 65, 79, 97, 81, 54,
+    52, 117, 70, 75, 99, 67, 90, 111, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 106, 115, 111, 110, 45, 115, 116, 114, 105, 110, 103, 105,
+    102, 121, 45, 115, 97, 102, 101, 47, 45, 47, 106, 115, 111, 110, 45, 115,
+    116, 114, 105, 110, 103, 105, 102, 121, 45, 115, 97, 102, 101, 45, 53, 46,
+    48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 69, 112, 97, 105,
+    49, 89, 47, 85, 88, 120, 109, 103, 57, 115, 52, 66, 49, 108, 99, 66,
+    52, 115, 99, 49, 116, 117, 115, 61, 107, 97, 114, 101, 101, 109, 49, 46,
+    53, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 107, 97,
+    114, 101, 101, 109, 47, 45, 47, 107, 97, 114, 101, 101, 109, 45, 49, 46,
+    53, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 52, 43, 81, 81,
+    72, 90, 51, 80, 51, 105, 109, 88, 97, 100, 114, 48, 116, 78, 116, 107,
+    50, 74, 88, 82, 100, 69, 103, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 107, 101, 121, 103, 114, 105, 112, 47, 45, 47, 107, 101, 121,
+    103, 114, 105, 112, 45, 49, 46, 48, 46, 50, 46, 116, 103, 122, 115, 104,
+    97, 49, 45, 114, 84, 75, 88, 120, 86, 99, 71, 110, 101, 113, 76, 122,
+    43, 101, 107, 43, 107, 107, 98, 100, 99, 88, 100, 54, 53, 69, 61, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 107, 105, 110, 100, 45, 111,
+    102, 47, 45, 47, 107, 105, 110, 100, 45, 111, 102, 45, 51, 46, 50, 46,
+    50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 77, 101, 111, 104, 112, 122,
+    83, 54, 117, 98, 117, 119, 56, 121, 82, 109, 50, 74, 79, 117, 112, 82,
+    53, 75, 80, 71, 81, 61, 107, 111, 97, 50, 46, 52, 46, 49, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 107, 111, 97, 47, 45, 47, 107,
+    111, 97, 45, 50, 46, 52, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53,
+    49, 50, 45, 51, 99, 97, 81, 57, 79, 121, 76, 68, 89, 83, 76, 51,
+    119, 65, 104, 86, 102, 118, 50, 115, 57, 107, 51, 116, 76, 78, 103, 87,
+    49, 56, 81, 120, 110, 75, 73, 80, 97, 82, 106, 122, 71, 57, 117, 88,
+    121, 68, 104, 112, 52, 116, 79, 111, 43, 85, 43, 88, 116, 98, 89, 43,
+    120, 98, 122, 69, 105, 67, 87, 53, 115, 109, 106, 120, 77, 67, 101, 103,
+    112, 90, 113, 67, 106, 109, 106, 77, 119, 61, 61, 107, 111, 97, 45, 99,
+    111, 109, 112, 111, 115, 101, 52, 46, 48, 46, 48, 107, 111, 97, 45, 99,
+    111, 110, 118, 101, 114, 116, 107, 111, 97, 45, 105, 115, 45, 106, 115, 111,
+    110, 111, 110, 45, 102, 105, 110, 105, 115, 104, 101, 100, 50, 46, 51, 46,
+    48, 111, 110, 108, 121, 112, 97, 114, 115, 101, 117, 114, 108, 118, 97, 114,
+    121, 107, 111, 97, 45, 98, 111, 100, 121, 112, 97, 114, 115, 101, 114, 52,
+    46, 50, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 107,
+    111, 97, 45, 98, 111, 100, 121, 112, 97, 114, 115, 101, 114, 47, 45, 47,
+    107, 111, 97, 45, 98, 111, 100, 121, 112, 97, 114, 115, 101, 114, 45, 52,
+    46, 50, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 118, 79, 98,
+    103, 105, 56, 90, 102, 104, 119, 109, 50, 48, 102, 113, 112, 81, 82, 120,
+    47, 68, 89, 107, 52, 113, 108, 81, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 107, 111, 97, 45, 99, 111, 109, 112, 111, 115, 101, 47,
+    45, 47, 107, 111, 97, 45, 99, 111, 109, 112, 111, 115, 101, 45, 52, 46,
+    48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 75, 65, 67, 108,
+    69, 57, 110, 68, 89, 101, 56, 78, 89, 52, 85, 114, 65, 52, 53, 80,
+    98, 121, 49, 97, 100, 122, 119, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 107, 111, 97, 45, 99, 111, 110, 118, 101, 114, 116, 47, 45,
+    47, 107, 111, 97, 45, 99, 111, 110, 118, 101, 114, 116, 45, 49, 46, 50,
+    46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 50, 107, 67, 72, 88,
+    102, 83, 100, 52, 70, 79, 81, 109, 78, 70, 119, 67, 49, 67, 67, 68,
+    79, 118, 78, 73, 100, 65, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 107, 111, 97, 45, 99, 111, 109, 112, 111, 115, 101, 47, 45, 47,
+    107, 111, 97, 45, 99, 111, 109, 112, 111, 115, 101, 45, 51, 46, 50, 46,
+    49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 113, 70, 122, 76, 81, 76,
+    102, 90, 104, 116, 106, 108, 111, 48, 87, 122, 111, 97, 122, 111, 54, 114,
+    122, 49, 84, 101, 99, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 107, 111, 97, 45, 105, 115, 45, 106, 115, 111, 110, 47, 45, 47, 107,
+    111, 97, 45, 105, 115, 45, 106, 115, 111, 110, 45, 49, 46, 48, 46, 48,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 74, 122, 119, 72, 55, 99, 51,
+    76, 106, 102, 97, 105, 119, 97, 116, 57, 87, 101, 53, 50, 83, 82, 82,
+    82, 55, 66, 81, 61, 107, 111, 97, 45, 108, 111, 103, 103, 101, 114, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 107, 111, 97, 45, 108, 111,
+    103, 103, 101, 114, 47, 45, 47, 107, 111, 97, 45, 108, 111, 103, 103, 101,
+    114, 45, 51, 46, 49, 46, 48, 46, 116, 103, 122, 115, 104, 97, 53, 49,
+    50, 45, 43, 82, 81, 108, 69, 52, 71, 98, 80, 98, 99, 86, 105, 117,
+    104, 119, 67, 57, 106, 83, 112, 100, 88, 82, 76, 82, 116, 104, 122, 106,
+    115, 87, 112, 119, 117, 53, 107, 76, 97, 55, 113, 87, 51, 108, 98, 70,
+    47, 109, 66, 122, 86, 115, 106, 113, 100, 98, 104, 66, 47, 88, 111, 115,
+    66, 49, 53, 121, 71, 78, 78, 57, 70, 87, 83, 122, 102, 56, 85, 78,
+    87, 53, 83, 47, 82, 103, 98, 119, 61, 61, 50, 46, 53, 46, 48, 112,
+    97, 115, 115, 116, 104, 114, 111, 117, 103, 104, 45, 99, 111, 117, 110, 116,
+    101, 114, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 98, 121, 116,
+    101, 115, 47, 45, 47, 98, 121, 116, 101, 115, 45, 50, 46, 53, 46, 48,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 84, 74, 81, 106, 54, 105, 48,
+    108, 76, 67, 99, 77, 81, 98, 75, 57, 55, 43, 47, 53, 117, 50, 116,
+    105, 119, 71, 111, 61, 107, 111, 97, 45, 114, 111, 117, 116, 101, 51, 46,
+    50, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 107, 111,
+    97, 45, 114, 111, 117, 116, 101, 47, 45, 47, 107, 111, 97, 45, 114, 111,
+    117, 116, 101, 45, 51, 46, 50, 46, 48, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 100, 105, 109, 76, 109, 97, 97, 56, 43, 112, 52, 52, 121, 114,
+    98, 43, 88, 72, 109, 111, 99, 122, 53, 49, 105, 56, 52, 61, 109, 101,
+    116, 104, 111, 100, 115, 112, 97, 116, 104, 45, 116, 111, 45, 114, 101, 103,
+    101, 120, 112, 108, 97, 122, 121, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 108, 97, 122, 121, 47, 45, 47, 108, 97, 122, 121, 45, 49, 46,
+    48, 46, 49, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 50, 113, 66,
+    111, 73, 71, 75, 67, 86, 67, 119, 73, 103, 111, 106, 112, 100, 99, 75,
+    88, 119, 97, 53, 51, 116, 112, 65, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 108, 111, 100, 97, 115, 104, 47, 45, 47, 108, 111, 100,
+    97, 115, 104, 45, 52, 46, 49, 55, 46, 52, 46, 116, 103, 122, 115, 104,
+    97, 49, 45, 101, 67, 65, 54, 84, 82, 119, 121, 105, 117, 72, 89, 98,
+    99, 112, 107, 89, 79, 78, 112, 116, 88, 57, 65, 86, 97, 52, 61, 108,
+    111, 100, 97, 115, 104, 46, 102, 105, 110, 100, 105, 110, 100, 101, 120, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 108, 111, 100, 97, 115, 104,
+    46, 102, 105, 110, 100, 105, 110, 100, 101, 120, 47, 45, 47, 108, 111, 100,
+    97, 115, 104, 46, 102, 105, 110, 100, 105, 110, 100, 101, 120, 45, 52, 46,
+    54, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 111, 121, 82, 100,
+    55, 109, 72, 55, 109, 50, 52, 71, 74, 76, 85, 49, 69, 108, 89, 107,
+    117, 50, 110, 66, 69, 81, 89, 61, 108, 111, 100, 97, 115, 104, 46, 103,
+    101, 116, 52, 46, 52, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 108, 111, 100, 97, 115, 104, 46, 103, 101, 116, 47, 45, 47, 108,
+    111, 100, 97, 115, 104, 46, 103, 101, 116, 45, 52, 46, 52, 46, 50, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 76, 82, 100, 47, 90, 83, 43, 106,
+    72, 112, 79, 98, 82, 68, 106, 86, 78, 66, 83, 90, 51, 54, 79, 67,
+    88, 112, 107, 61, 108, 111, 100, 97, 115, 104, 46, 105, 115, 101, 113, 117,
+    97, 108, 52, 46, 53, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 108, 111, 100, 97, 115, 104, 46, 105, 115, 101, 113, 117, 97, 108,
+    47, 45, 47, 108, 111, 100, 97, 115, 104, 46, 105, 115, 101, 113, 117, 97,
+    108, 45, 52, 46, 53, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    81, 86, 120, 69, 101, 80, 75, 56, 119, 119, 69, 103, 119, 105, 122, 104,
+    68, 116, 77, 105, 98, 51, 48, 43, 71, 79, 65, 61, 108, 111, 100, 97,
+    115, 104, 46, 109, 101, 114, 103, 101, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 108, 111, 100, 97, 115, 104, 46, 109, 101, 114, 103, 101, 47,
+    45, 47, 108, 111, 100, 97, 115, 104, 46, 109, 101, 114, 103, 101, 45, 52,
+    46, 54, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 97, 89, 104,
+    76, 111, 85, 83, 115, 77, 47, 53, 112, 108, 122, 101, 109, 67, 71, 51,
+    118, 43, 116, 48, 80, 105, 99, 85, 61, 109, 101, 100, 105, 97, 45, 116,
+    121, 112, 101, 114, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109,
+    101, 100, 105, 97, 45, 116, 121, 112, 101, 114, 47, 45, 47, 109, 101, 100,
+    105, 97, 45, 116, 121, 112, 101, 114, 45, 48, 46, 51, 46, 48, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 104, 120, 68, 88, 114, 119, 113, 109, 74,
+    118, 106, 47, 43, 104, 122, 103, 65, 87, 104, 85, 85, 109, 77, 108, 86,
+    48, 103, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 101,
+    116, 104, 111, 100, 115, 47, 45, 47, 109, 101, 116, 104, 111, 100, 115, 45,
+    49, 46, 49, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 86, 83,
+    109, 107, 49, 110, 90, 85, 69, 48, 55, 99, 120, 83, 90, 109, 86, 111,
+    78, 98, 68, 52, 85, 97, 47, 79, 52, 61, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 109, 105, 99, 114, 111, 109, 97, 116, 99, 104, 47,
+    45, 47, 109, 105, 99, 114, 111, 109, 97, 116, 99, 104, 45, 50, 46, 51,
+    46, 49, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 104, 109, 100, 56,
+    108, 57, 70, 121, 67, 122, 89, 48, 77, 100, 66, 78, 68, 82, 85, 112,
+    79, 57, 79, 77, 70, 87, 85, 61, 111, 98, 106, 101, 99, 116, 46, 111,
+    109, 105, 116, 112, 97, 114, 115, 101, 45, 103, 108, 111, 98, 114, 101, 103,
+    101, 120, 45, 99, 97, 99, 104, 101, 48, 46, 52, 46, 52, 49, 46, 51,
+    48, 46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 105,
+    109, 101, 45, 100, 98, 47, 45, 47, 109, 105, 109, 101, 45, 100, 98, 45,
+    49, 46, 51, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 100,
+    77, 90, 68, 50, 105, 51, 90, 49, 113, 82, 84, 109, 90, 89, 48, 90,
+    98, 74, 116, 88, 75, 102, 88, 72, 119, 69, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 109, 105, 109, 101, 45, 116, 121, 112, 101, 115,
+    47, 45, 47, 109, 105, 109, 101, 45, 116, 121, 112, 101, 115, 45, 50, 46,
+    49, 46, 49, 55, 46, 116, 103, 122, 115, 104, 97, 49, 45, 67, 100, 101,
+    106, 107, 47, 65, 43, 109, 86, 112, 53, 43, 75, 43, 70, 101, 51, 67,
+    112, 52, 75, 115, 87, 86, 88, 111, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 109, 105, 110, 105, 109, 97, 116, 99, 104, 47, 45, 47,
+    109, 105, 110, 105, 109, 97, 116, 99, 104, 45, 51, 46, 48, 46, 52, 46,
+    116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 121, 74, 72, 86, 81, 69,
+    104, 121, 113, 80, 76, 85, 84, 103, 116, 57, 66, 56, 51, 80, 88, 117,
+    54, 87, 51, 114, 120, 52, 77, 118, 118, 72, 118, 83, 85, 118, 84, 111,
+    111, 103, 112, 119, 111, 71, 68, 79, 85, 81, 43, 121, 68, 114, 82, 48,
+    72, 82, 111, 116, 43, 121, 79, 67, 100, 67, 79, 55, 117, 52, 104, 88,
+    51, 112, 87, 102, 116, 54, 107, 87, 66, 66, 99, 113, 104, 48, 85, 65,
+    61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 105, 110,
+    105, 109, 105, 115, 116, 47, 45, 47, 109, 105, 110, 105, 109, 105, 115, 116,
+    45, 48, 46, 48, 46, 56, 46, 116, 103, 122, 115, 104, 97, 49, 45, 104,
+    88, 47, 75, 118, 56, 77, 53, 102, 83, 89, 108, 117, 67, 75, 67, 89,
+    117, 104, 113, 112, 54, 65, 82, 115, 70, 48, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 109, 107, 100, 105, 114, 112, 47, 45, 47, 109,
+    107, 100, 105, 114, 112, 45, 48, 46, 53, 46, 49, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 77, 65, 86, 48, 79, 79, 114, 71, 122, 51, 43, 77,
+    82, 50, 102, 122, 104, 107, 106, 87, 97, 88, 49, 49, 121, 81, 77, 61,
+    109, 111, 109, 101, 110, 116, 50, 46, 50, 48, 46, 49, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 109, 111, 109, 101, 110, 116, 47, 45, 47,
+    109, 111, 109, 101, 110, 116, 45, 50, 46, 50, 48, 46, 49, 46, 116, 103,
+    122, 115, 104, 97, 53, 49, 50, 45, 89, 104, 57, 121, 55, 51, 74, 82,
+    108, 106, 120, 87, 53, 81, 120, 78, 48, 56, 70, 110, 101, 114, 54, 56,
+    101, 70, 76, 120, 77, 53, 121, 110, 78, 79, 65, 119, 50, 76, 98, 73,
+    66, 49, 89, 65, 71, 101, 81, 122, 90, 84, 56, 81, 70, 83, 85, 118,
+    107, 65, 122, 54, 48, 57, 90, 102, 43, 73, 72, 104, 104, 97, 85, 120,
+    113, 90, 75, 56, 100, 71, 51, 87, 47, 43, 72, 69, 118, 103, 61, 61,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 111, 109, 101, 110,
+    116, 45, 116, 105, 109, 101, 122, 111, 110, 101, 47, 45, 47, 109, 111, 109,
+    101, 110, 116, 45, 116, 105, 109, 101, 122, 111, 110, 101, 45, 48, 46, 53,
+    46, 49, 52, 46, 116, 103, 122, 115, 104, 97, 49, 45, 84, 114, 79, 80,
+    43, 86, 79, 76, 103, 66, 67, 76, 112, 71, 101, 107, 87, 80, 80, 116,
+    81, 109, 106, 77, 47, 76, 69, 61, 109, 111, 110, 103, 111, 100, 98, 50,
+    46, 50, 46, 51, 51, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    109, 111, 110, 103, 111, 100, 98, 47, 45, 47, 109, 111, 110, 103, 111, 100,
+    98, 45, 50, 46, 50, 46, 51, 51, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 116, 84, 102, 69, 99, 100, 78, 75, 90, 108, 71, 48, 106, 122, 98,
+    57, 118, 121, 108, 49, 65, 48, 68, 103, 105, 49, 65, 61, 109, 111, 110,
+    103, 111, 100, 98, 45, 99, 111, 114, 101, 50, 46, 50, 46, 55, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 111, 110, 103, 111, 100, 98,
+    45, 99, 111, 114, 101, 47, 45, 47, 109, 111, 110, 103, 111, 100, 98, 45,
+    99, 111, 114, 101, 45, 50, 46, 49, 46, 49, 55, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 112, 66, 105, 122, 78, 54, 70, 75, 70, 74, 107, 80,
+    116, 82, 67, 53, 73, 57, 55, 109, 113, 66, 77, 88, 80, 102, 103, 61,
+    114, 101, 113, 117, 105, 114, 101, 95, 111, 112, 116, 105, 111, 110, 97, 108,
+    109, 111, 110, 103, 111, 111, 115, 101, 52, 46, 49, 51, 46, 55, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 111, 110, 103, 111, 111, 115,
+    101, 47, 45, 47, 109, 111, 110, 103, 111, 111, 115, 101, 45, 52, 46, 49,
+    51, 46, 55, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 51, 86,
+    80, 99, 71, 81, 87, 97, 84, 122, 84, 47, 79, 86, 75, 43, 84, 112,
+    69, 57, 100, 71, 112, 78, 72, 66, 110, 69, 113, 70, 88, 50, 82, 109,
+    98, 70, 114, 49, 88, 118, 98, 115, 75, 109, 120, 80, 115, 76, 57, 107,
+    97, 82, 66, 83, 72, 113, 97, 81, 56, 81, 69, 77, 100, 54, 67, 85,
+    101, 79, 89, 77, 82, 100, 72, 49, 112, 75, 82, 114, 108, 110, 67, 101,
+    110, 82, 115, 103, 61, 61, 109, 112, 97, 116, 104, 109, 112, 114, 111, 109,
+    105, 115, 101, 48, 46, 53, 46, 53, 109, 113, 117, 101, 114, 121, 50, 46,
+    51, 46, 51, 109, 117, 114, 105, 114, 101, 103, 101, 120, 112, 45, 99, 108,
+    111, 110, 101, 115, 108, 105, 99, 101, 100, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 109, 112, 97, 116, 104, 47, 45, 47, 109, 112, 97, 116,
+    104, 45, 48, 46, 51, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    101, 108, 106, 51, 105, 101, 109, 49, 47, 84, 121, 85, 85, 103, 89, 48,
+    70, 88, 108, 103, 56, 109, 118, 86, 55, 48, 81, 61, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 109, 112, 114, 111, 109, 105, 115, 101, 47,
+    45, 47, 109, 112, 114, 111, 109, 105, 115, 101, 45, 48, 46, 53, 46, 53,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 57, 98, 74, 67, 87, 100, 100,
+    106, 114, 77, 73, 108, 101, 119, 111, 77, 106, 71, 50, 71, 98, 57, 85,
+    88, 77, 117, 89, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    109, 113, 117, 101, 114, 121, 47, 45, 47, 109, 113, 117, 101, 114, 121, 45,
+    50, 46, 51, 46, 51, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45,
+    78, 67, 56, 76, 49, 52, 107, 110, 43, 113, 120, 74, 98, 98, 74, 49,
+    103, 98, 99, 69, 77, 68, 120, 70, 48, 115, 67, 51, 115, 118, 43, 49,
+    99, 98, 82, 82, 101, 88, 88, 119, 86, 118, 111, 119, 99, 119, 89, 49,
+    121, 57, 75, 111, 86, 90, 70, 113, 48, 101, 98, 119, 65, 82, 105, 98,
+    115, 97, 100, 117, 56, 108, 120, 56, 110, 87, 71, 118, 109, 51, 86, 48,
+    80, 102, 48, 90, 87, 81, 61, 61, 50, 46, 54, 46, 57, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 100, 101, 98, 117, 103, 47, 45, 47,
+    100, 101, 98, 117, 103, 45, 50, 46, 54, 46, 57, 46, 116, 103, 122, 115,
+    104, 97, 53, 49, 50, 45, 98, 67, 55, 69, 108, 114, 100, 74, 97, 74,
+    110, 80, 98, 65, 80, 43, 49, 69, 111, 116, 89, 118, 113, 90, 115, 98,
+    51, 101, 99, 108, 53, 119, 105, 54, 66, 102, 105, 54, 66, 74, 84, 85,
+    99, 78, 111, 119, 112, 54, 99, 118, 115, 112, 103, 48, 106, 88, 122, 110,
+    82, 84, 75, 68, 106, 109, 47, 69, 55, 65, 100, 103, 70, 66, 86, 101,
+    65, 80, 86, 77, 78, 99, 75, 71, 115, 72, 77, 65, 61, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 115, 108, 105, 99, 101, 100, 47,
+    45, 47, 115, 108, 105, 99, 101, 100, 45, 48, 46, 48, 46, 53, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 88, 116, 119, 69, 84, 75, 84, 114, 98,
+    51, 103, 87, 49, 81, 117, 105, 47, 71, 80, 105, 88, 89, 47, 107, 99,
+    72, 56, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 115,
+    47, 45, 47, 109, 115, 45, 50, 46, 48, 46, 48, 46, 116, 103, 122, 115,
+    104, 97, 49, 45, 86, 103, 105, 117, 114, 102, 119, 65, 118, 109, 119, 112,
+    65, 100, 57, 102, 109, 71, 70, 52, 106, 101, 68, 86, 108, 56, 103, 61,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 117, 114, 105, 47,
+    45, 47, 109, 117, 114, 105, 45, 49, 46, 51, 46, 48, 46, 116, 103, 122,
+    115, 104, 97, 53, 49, 50, 45, 70, 105, 97, 70, 119, 75, 108, 56, 54,
+    52, 111, 110, 72, 70, 70, 85, 86, 47, 97, 50, 115, 122, 65, 108, 55,
+    88, 48, 102, 120, 86, 108, 83, 75, 78, 100, 104, 84, 102, 43, 66, 77,
+    56, 105, 56, 103, 111, 69, 103, 89, 117, 116, 56, 117, 53, 80, 57, 77,
+    113, 81, 113, 73, 89, 119, 118, 97, 77, 120, 106, 122, 86, 69, 83, 115,
+    111, 69, 109, 47, 50, 107, 102, 107, 70, 72, 49, 114, 103, 61, 61, 109,
+    117, 116, 101, 45, 115, 116, 114, 101, 97, 109, 48, 46, 48, 46, 55, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 109, 117, 116, 101, 45, 115,
+    116, 114, 101, 97, 109, 47, 45, 47, 109, 117, 116, 101, 45, 115, 116, 114,
+    101, 97, 109, 45, 48, 46, 48, 46, 55, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 77, 72, 88, 79, 107, 55, 119, 104, 117, 80, 113, 48, 80, 104,
+    118, 69, 50, 110, 54, 66, 70, 101, 48, 101, 101, 54, 115, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 110, 97, 110, 47, 45, 47, 110,
+    97, 110, 45, 50, 46, 56, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 55, 88, 70, 102, 80, 43, 110, 101, 65, 114, 86, 54, 88, 109, 74,
+    83, 50, 81, 113, 87, 90, 49, 52, 102, 67, 70, 111, 61, 110, 101, 101,
+    100, 108, 101, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 110, 101,
+    101, 100, 108, 101, 47, 45, 47, 110, 101, 101, 100, 108, 101, 45, 49, 46,
+    54, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 57, 83, 112, 89,
+    87, 74, 99, 104, 73, 87, 71, 79, 65, 67, 43, 79, 89, 52, 84, 75,
+    50, 115, 73, 116, 89, 107, 56, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 110, 101, 103, 111, 116, 105, 97, 116, 111, 114, 47, 45, 47,
+    110, 101, 103, 111, 116, 105, 97, 116, 111, 114, 45, 48, 46, 54, 46, 49,
+    46, 116, 103, 122, 115, 104, 97, 49, 45, 75, 122, 74, 120, 104, 79, 105,
+    90, 73, 81, 69, 88, 101, 121, 104, 87, 80, 55, 88, 110, 69, 67, 114,
+    78, 68, 75, 107, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    110, 111, 114, 109, 97, 108, 105, 122, 101, 45, 112, 97, 116, 104, 47, 45,
+    47, 110, 111, 114, 109, 97, 108, 105, 122, 101, 45, 112, 97, 116, 104, 45,
+    50, 46, 49, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 71, 114,
+    75, 76, 86, 87, 52, 90, 103, 50, 79, 111, 119, 97, 98, 51, 53, 118,
+    111, 103, 69, 51, 47, 109, 114, 116, 107, 61, 114, 101, 109, 111, 118, 101,
+    45, 116, 114, 97, 105, 108, 105, 110, 103, 45, 115, 101, 112, 97, 114, 97,
+    116, 111, 114, 110, 115, 115, 111, 99, 107, 101, 116, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 110, 115, 115, 111, 99, 107, 101, 116, 47, 45,
+    47, 110, 115, 115, 111, 99, 107, 101, 116, 45, 48, 46, 54, 46, 48, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 87, 102, 108, 118, 98, 47, 77, 104,
+    86, 109, 56, 122, 120, 119, 57, 57, 118, 117, 55, 78, 47, 99, 66, 120,
+    86, 80, 111, 61, 48, 46, 52, 46, 49, 52, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 101, 118, 101, 110, 116, 101, 109, 105, 116, 116, 101,
+    114, 50, 47, 45, 47, 101, 118, 101, 110, 116, 101, 109, 105, 116, 116, 101,
+    114, 50, 45, 48, 46, 52, 46, 49, 52, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 106, 50, 71, 51, 88, 78, 52, 66, 75, 121, 54, 101, 115, 111,
+    84, 85, 86, 70, 87, 68, 116, 87, 81, 55, 89, 97, 115, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 111, 98, 106, 101, 99, 116, 46,
+    111, 109, 105, 116, 47, 45, 47, 111, 98, 106, 101, 99, 116, 46, 111, 109,
+    105, 116, 45, 50, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 71, 112, 120, 48, 83, 67, 110, 122, 110, 98, 117, 70, 106, 72, 98,
+    75, 78, 88, 109, 117, 75, 108, 84, 114, 48, 102, 111, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 111, 110, 45, 102, 105, 110, 105, 115,
+    104, 101, 100, 47, 45, 47, 111, 110, 45, 102, 105, 110, 105, 115, 104, 101,
+    100, 45, 50, 46, 51, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    73, 80, 69, 122, 90, 73, 71, 119, 103, 56, 49, 49, 77, 51, 109, 83,
+    111, 87, 108, 120, 113, 105, 50, 81, 97, 85, 99, 61, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 111, 110, 99, 101, 47, 45, 47, 111, 110,
+    99, 101, 45, 49, 46, 52, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 87, 68, 115, 97, 112, 51, 87, 87, 72, 85, 115, 82, 79, 115, 70,
+    57, 110, 70, 67, 54, 55, 53, 51, 88, 97, 57, 69, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 111, 110, 108, 121, 47, 45, 47, 111,
+    110, 108, 121, 45, 48, 46, 48, 46, 50, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 75, 118, 51, 111, 84, 81, 80, 108, 67, 53, 113, 79, 51, 69,
+    82, 79, 77, 71, 69, 75, 99, 67, 108, 101, 51, 55, 81, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 97, 114, 115, 101, 45, 103,
+    108, 111, 98, 47, 45, 47, 112, 97, 114, 115, 101, 45, 103, 108, 111, 98,
+    45, 51, 46, 48, 46, 52, 46, 116, 103, 122, 115, 104, 97, 49, 45, 115,
+    115, 78, 50, 122, 55, 69, 102, 78, 86, 69, 55, 114, 100, 70, 122, 55,
+    119, 117, 50, 52, 54, 79, 73, 79, 82, 119, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 112, 97, 114, 115, 101, 117, 114, 108, 47, 45,
+    47, 112, 97, 114, 115, 101, 117, 114, 108, 45, 49, 46, 51, 46, 50, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 47, 67, 105, 100, 84, 116, 105, 90,
+    77, 82, 108, 71, 68, 66, 86, 105, 85, 121, 89, 115, 51, 73, 51, 109,
+    87, 47, 77, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112,
+    97, 115, 115, 116, 104, 114, 111, 117, 103, 104, 45, 99, 111, 117, 110, 116,
+    101, 114, 47, 45, 47, 112, 97, 115, 115, 116, 104, 114, 111, 117, 103, 104,
+    45, 99, 111, 117, 110, 116, 101, 114, 45, 49, 46, 48, 46, 48, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 71, 87, 102, 90, 53, 109, 50, 108, 99,
+    114, 88, 65, 73, 56, 101, 72, 50, 120, 69, 113, 79, 72, 113, 120, 90,
+    118, 111, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 97,
+    116, 104, 45, 105, 115, 45, 97, 98, 115, 111, 108, 117, 116, 101, 47, 45,
+    47, 112, 97, 116, 104, 45, 105, 115, 45, 97, 98, 115, 111, 108, 117, 116,
+    101, 45, 49, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    70, 48, 117, 83, 97, 72, 78, 86, 78, 80, 43, 56, 101, 115, 53, 114,
+    57, 84, 112, 97, 110, 104, 116, 99, 88, 49, 56, 61, 112, 97, 116, 104,
+    45, 112, 97, 114, 115, 101, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 112, 97, 116, 104, 45, 112, 97, 114, 115, 101, 47, 45, 47, 112, 97,
+    116, 104, 45, 112, 97, 114, 115, 101, 45, 49, 46, 48, 46, 53, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 80, 66, 114, 102, 104, 120, 54, 112, 122,
+    87, 121, 85, 77, 98, 98, 113, 75, 57, 100, 75, 68, 47, 66, 86, 120,
+    77, 69, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 97,
+    116, 104, 45, 116, 111, 45, 114, 101, 103, 101, 120, 112, 47, 45, 47, 112,
+    97, 116, 104, 45, 116, 111, 45, 114, 101, 103, 101, 120, 112, 45, 49, 46,
+    55, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 87, 102, 51, 103,
+    57, 68, 87, 54, 50, 115, 117, 104, 65, 54, 104, 79, 110, 84, 118, 71,
+    84, 112, 97, 53, 107, 51, 48, 61, 112, 105, 100, 117, 115, 97, 103, 101,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 105, 100, 117, 115,
+    97, 103, 101, 47, 45, 47, 112, 105, 100, 117, 115, 97, 103, 101, 45, 49,
+    46, 50, 46, 48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 79,
+    71, 111, 43, 105, 83, 79, 107, 52, 52, 72, 82, 74, 56, 113, 49, 53,
+    65, 121, 71, 53, 55, 48, 85, 89, 120, 99, 109, 53, 117, 43, 82, 57,
+    57, 68, 73, 56, 75, 104, 117, 56, 80, 51, 116, 75, 71, 107, 86, 117,
+    53, 69, 90, 88, 52, 121, 119, 72, 103, 108, 87, 83, 84, 77, 78, 78,
+    88, 81, 50, 55, 52, 111, 101, 71, 112, 89, 114, 118, 70, 69, 104, 68,
+    73, 70, 71, 80, 103, 61, 61, 112, 109, 50, 50, 46, 57, 46, 49, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 109, 50, 47, 45, 47,
+    112, 109, 50, 45, 50, 46, 57, 46, 49, 46, 116, 103, 122, 115, 104, 97,
+    53, 49, 50, 45, 121, 54, 87, 119, 111, 47, 106, 100, 66, 120, 73, 87,
+    80, 122, 90, 81, 70, 109, 117, 119, 120, 115, 114, 67, 71, 52, 110, 104,
+    97, 113, 43, 121, 69, 65, 114, 85, 76, 77, 68, 68, 56, 78, 54, 56,
+    113, 47, 70, 69, 114, 118, 77, 103, 110, 50, 53, 80, 53, 67, 109, 122,
+    111, 89, 122, 47, 90, 101, 84, 55, 108, 73, 121, 85, 49, 103, 72, 84,
+    100, 120, 51, 117, 78, 70, 70, 49, 86, 65, 61, 61, 50, 46, 54, 46,
+    48, 112, 109, 50, 45, 97, 120, 111, 110, 112, 109, 50, 45, 97, 120, 111,
+    110, 45, 114, 112, 99, 48, 46, 53, 46, 48, 112, 109, 50, 45, 100, 101,
+    112, 108, 111, 121, 48, 46, 51, 46, 57, 112, 109, 50, 45, 109, 117, 108,
+    116, 105, 109, 101, 116, 101, 114, 112, 109, 120, 49, 46, 53, 46, 53, 112,
+    114, 111, 109, 112, 116, 108, 121, 50, 46, 50, 46, 48, 115, 104, 101, 108,
+    108, 106, 115, 48, 46, 55, 46, 56, 115, 111, 117, 114, 99, 101, 45, 109,
+    97, 112, 45, 115, 117, 112, 112, 111, 114, 116, 118, 105, 122, 105, 111, 110,
+    48, 46, 50, 46, 49, 51, 121, 97, 109, 108, 106, 115, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 97, 115, 121, 110, 99, 47, 45, 47, 97,
+    115, 121, 110, 99, 45, 50, 46, 54, 46, 48, 46, 116, 103, 122, 115, 104,
+    97, 53, 49, 50, 45, 120, 65, 102, 71, 103, 49, 47, 78, 84, 76, 66,
+    66, 75, 108, 72, 70, 109, 110, 100, 55, 80, 108, 109, 85, 87, 57, 75,
+    104, 86, 81, 73, 85, 117, 83, 114, 89, 101, 109, 57, 120, 122, 70, 85,
+    90, 121, 49, 51, 83, 99, 118, 116, 121, 71, 71, 101, 106, 97, 97, 101,
+    57, 105, 65, 86, 82, 105, 82, 113, 57, 43, 67, 120, 55, 68, 80, 70,
+    97, 65, 65, 104, 67, 112, 121, 120, 121, 80, 119, 61, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 112, 109, 50, 45, 97, 120, 111, 110,
+    47, 45, 47, 112, 109, 50, 45, 97, 120, 111, 110, 45, 51, 46, 49, 46,
+    48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 53, 115, 66, 77,
+    43, 118, 72, 119, 48, 67, 112, 50, 75, 57, 67, 74, 57, 90, 79, 89,
+    104, 75, 116, 78, 67, 67, 99, 103, 81, 48, 101, 75, 79, 121, 70, 114,
+    83, 111, 53, 74, 117, 115, 98, 113, 57, 70, 102, 118, 117, 101, 108, 115,
+    77, 71, 52, 87, 68, 97, 120, 107, 113, 111, 115, 97, 81, 98, 102, 56,
+    78, 53, 89, 102, 121, 72, 104, 68, 55, 101, 79, 85, 99, 110, 109, 53,
+    114, 81, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112,
+    109, 50, 45, 97, 120, 111, 110, 45, 114, 112, 99, 47, 45, 47, 112, 109,
+    50, 45, 97, 120, 111, 110, 45, 114, 112, 99, 45, 48, 46, 53, 46, 48,
+    46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 106, 75, 105, 65, 108,
+    110, 73, 105, 116, 120, 43, 84, 116, 74, 49, 43, 43, 106, 84, 104, 109,
+    78, 52, 57, 103, 77, 48, 68, 116, 101, 52, 103, 109, 50, 55, 75, 113,
+    117, 50, 120, 65, 85, 81, 110, 51, 51, 82, 104, 57, 43, 53, 108, 79,
+    79, 113, 83, 104, 83, 53, 88, 98, 112, 48, 82, 80, 90, 76, 52, 50,
+    104, 75, 78, 69, 103, 97, 86, 86, 79, 83, 113, 109, 51, 115, 74, 67,
+    103, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 109,
+    50, 45, 100, 101, 112, 108, 111, 121, 47, 45, 47, 112, 109, 50, 45, 100,
+    101, 112, 108, 111, 121, 45, 48, 46, 51, 46, 57, 46, 116, 103, 122, 115,
+    104, 97, 53, 49, 50, 45, 73, 89, 70, 52, 53, 102, 80, 119, 102, 76,
+    69, 50, 55, 66, 105, 118, 114, 116, 111, 100, 75, 55, 122, 122, 78, 53,
+    54, 66, 78, 68, 69, 114, 75, 55, 98, 114, 99, 108, 100, 73, 72, 106,
+    86, 73, 72, 76, 108, 107, 43, 99, 100, 104, 105, 106, 113, 51, 107, 119,
+    84, 107, 80, 80, 80, 51, 84, 112, 99, 51, 72, 50, 67, 57, 52, 50,
+    81, 71, 82, 103, 106, 103, 48, 104, 72, 97, 106, 65, 61, 61, 49, 46,
+    53, 46, 50, 116, 118, 52, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 97, 115, 121, 110, 99, 47, 45, 47, 97, 115, 121, 110, 99, 45, 49,
+    46, 53, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 55, 71, 112,
+    104, 114, 108, 90, 73, 68, 65, 119, 56, 115, 107, 72, 74, 86, 104, 106,
+    105, 67, 74, 76, 53, 90, 121, 111, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 112, 109, 50, 45, 109, 117, 108, 116, 105, 109, 101, 116,
+    101, 114, 47, 45, 47, 112, 109, 50, 45, 109, 117, 108, 116, 105, 109, 101,
+    116, 101, 114, 45, 48, 46, 49, 46, 50, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 71, 104, 53, 86, 70, 84, 49, 66, 111, 70, 85, 48, 122, 113,
+    73, 56, 47, 111, 89, 75, 117, 113, 68, 114, 83, 115, 52, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 109, 120, 47, 45, 47, 112,
+    109, 120, 45, 49, 46, 53, 46, 53, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 116, 117, 67, 52, 86, 50, 55, 99, 57, 89, 49, 47, 81, 71, 108,
+    110, 116, 69, 50, 122, 50, 110, 102, 106, 86, 47, 65, 61, 118, 120, 120,
+    49, 46, 50, 46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    112, 114, 101, 115, 101, 114, 118, 101, 47, 45, 47, 112, 114, 101, 115, 101,
+    114, 118, 101, 45, 48, 46, 50, 46, 48, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 103, 86, 55, 82, 57, 117, 118, 71, 87, 83, 98, 52, 90, 98,
+    77, 81, 119, 72, 69, 55, 121, 122, 77, 86, 122, 107, 115, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 114, 111, 99, 101, 115, 115,
+    45, 110, 101, 120, 116, 105, 99, 107, 45, 97, 114, 103, 115, 47, 45, 47,
+    112, 114, 111, 99, 101, 115, 115, 45, 110, 101, 120, 116, 105, 99, 107, 45,
+    97, 114, 103, 115, 45, 49, 46, 48, 46, 55, 46, 116, 103, 122, 115, 104,
+    97, 49, 45, 70, 81, 52, 103, 116, 49, 90, 90, 67, 116, 80, 53, 69,
+    74, 80, 121, 87, 107, 56, 113, 50, 76, 47, 122, 67, 54, 77, 61, 104,
+    116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46,
+    110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 112, 114, 111, 109, 112, 116,
+    108, 121, 47, 45, 47, 112, 114, 111, 109, 112, 116, 108, 121, 45, 50, 46,
+    50, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 75, 104, 80, 54,
+    66, 106, 97, 73, 111, 113, 87, 89, 79, 120, 89, 102, 47, 119, 69, 73,
+    111, 72, 48, 109, 47, 72, 81, 61, 114, 101, 97, 100, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 113, 115, 47, 45, 47, 113, 115, 45, 54,
+    46, 53, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 101,
+    82, 122, 104, 114, 78, 49, 87, 83, 73, 78, 89, 67, 68, 67, 98, 114,
+    122, 55, 57, 54, 122, 51, 55, 76, 79, 101, 51, 109, 53, 116, 109, 87,
+    55, 82, 81, 102, 54, 111, 66, 110, 116, 117, 107, 65, 71, 49, 110, 109,
+    111, 118, 74, 118, 104, 110, 119, 72, 72, 82, 77, 65, 102, 101, 111, 73,
+    116, 99, 49, 109, 50, 72, 107, 48, 50, 87, 69, 82, 50, 97, 81, 47,
+    105, 113, 115, 43, 65, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 114, 97, 110, 100, 111, 109, 97, 116, 105, 99, 47, 45, 47, 114,
+    97, 110, 100, 111, 109, 97, 116, 105, 99, 45, 49, 46, 49, 46, 55, 46,
+    116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 68, 53, 74, 85, 106, 80,
+    121, 74, 98, 97, 74, 68, 107, 117, 65, 97, 122, 112, 86, 110, 83, 102,
+    86, 107, 76, 108, 112, 101, 79, 51, 119, 68, 108, 80, 82, 79, 84, 77,
+    76, 71, 75, 71, 49, 122, 77, 70, 78, 70, 82, 103, 114, 99, 105, 75,
+    111, 49, 108, 116, 122, 47, 65, 122, 78, 84, 107, 113, 69, 48, 72, 122,
+    68, 120, 54, 53, 53, 81, 79, 76, 53, 49, 78, 48, 54, 104, 111, 119,
+    61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 105, 115, 45,
+    110, 117, 109, 98, 101, 114, 47, 45, 47, 105, 115, 45, 110, 117, 109, 98,
+    101, 114, 45, 51, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 74, 80, 49, 105, 65, 97, 82, 52, 76, 80, 85, 70, 89, 99, 103,
+    81, 74, 50, 114, 56, 102, 82, 76, 88, 69, 90, 85, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 107, 105, 110, 100, 45, 111, 102, 47,
+    45, 47, 107, 105, 110, 100, 45, 111, 102, 45, 52, 46, 48, 46, 48, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 73, 73, 69, 57, 56, 57, 99, 83,
+    107, 111, 115, 103, 99, 51, 104, 112, 71, 107, 85, 71, 98, 54, 53, 121,
+    51, 86, 99, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114,
+    97, 119, 45, 98, 111, 100, 121, 47, 45, 47, 114, 97, 119, 45, 98, 111,
+    100, 121, 45, 50, 46, 51, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 118, 78, 89, 77, 100, 57, 80, 114, 107, 56, 51, 103, 66, 81, 75,
+    86, 119, 47, 78, 53, 79, 74, 118, 73, 106, 52, 107, 61, 117, 110, 112,
+    105, 112, 101, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114, 101,
+    97, 100, 47, 45, 47, 114, 101, 97, 100, 45, 49, 46, 48, 46, 55, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 115, 57, 111, 90, 118, 81, 85, 107,
+    77, 97, 108, 50, 99, 100, 82, 75, 81, 109, 78, 75, 51, 51, 69, 76,
+    81, 77, 81, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114,
+    101, 97, 100, 97, 98, 108, 101, 45, 115, 116, 114, 101, 97, 109, 47, 45,
+    47, 114, 101, 97, 100, 97, 98, 108, 101, 45, 115, 116, 114, 101, 97, 109,
+    45, 50, 46, 50, 46, 55, 46, 116, 103, 122, 115, 104, 97, 49, 45, 66,
+    119, 86, 54, 121, 43, 74, 71, 101, 121, 73, 69, 76, 84, 98, 53, 106,
+    70, 114, 86, 66, 119, 86, 79, 108, 98, 69, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 114, 101, 97, 100, 100, 105, 114, 112, 47, 45,
+    47, 114, 101, 97, 100, 100, 105, 114, 112, 45, 50, 46, 49, 46, 48, 46,
+    116, 103, 122, 115, 104, 97, 49, 45, 84, 116, 67, 116, 66, 103, 51, 122,
+    66, 122, 77, 65, 120, 73, 82, 65, 78, 122, 57, 121, 48, 99, 120, 107,
+    76, 88, 103, 61, 115, 101, 116, 45, 105, 109, 109, 101, 100, 105, 97, 116,
+    101, 45, 115, 104, 105, 109, 114, 101, 99, 104, 111, 105, 114, 48, 46, 54,
+    46, 50, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114, 101, 99,
+    104, 111, 105, 114, 47, 45, 47, 114, 101, 99, 104, 111, 105, 114, 45, 48,
+    46, 54, 46, 50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 104, 83, 66,
+    76, 86, 78, 117, 111, 76, 86, 100, 67, 52, 111, 121, 87, 100, 87, 55,
+    48, 79, 118, 85, 79, 77, 52, 81, 61, 114, 101, 115, 111, 108, 118, 101,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114, 101, 103, 101, 120,
+    45, 99, 97, 99, 104, 101, 47, 45, 47, 114, 101, 103, 101, 120, 45, 99,
+    97, 99, 104, 101, 45, 48, 46, 52, 46, 52, 46, 116, 103, 122, 115, 104,
+    97, 53, 49, 50, 45, 110, 86, 73, 90, 119, 116, 67, 106, 107, 67, 57,
+    89, 103, 118, 87, 107, 112, 77, 53, 53, 66, 53, 114, 66, 104, 66, 89,
+    82, 90, 104, 65, 97, 74, 98, 103, 99, 70, 89, 88, 88, 115, 72, 110,
+    98, 90, 57, 85, 90, 73, 57, 110, 110, 86, 87, 89, 90, 112, 66, 108,
+    67, 113, 118, 57, 104, 111, 50, 101, 90, 114, 121, 80, 110, 87, 114, 90,
+    71, 115, 79, 100, 80, 119, 86, 87, 88, 87, 81, 61, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 114, 101, 103, 101, 120, 112, 45, 99,
+    108, 111, 110, 101, 47, 45, 47, 114, 101, 103, 101, 120, 112, 45, 99, 108,
+    111, 110, 101, 45, 48, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 112, 56, 76, 103, 109, 74, 72, 57, 118, 122, 106, 55, 115, 81,
+    48, 51, 98, 55, 99, 119, 65, 43, 97, 75, 120, 89, 107, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 114, 101, 109, 111, 118, 101, 45,
+    116, 114, 97, 105, 108, 105, 110, 103, 45, 115, 101, 112, 97, 114, 97, 116,
+    111, 114, 47, 45, 47, 114, 101, 109, 111, 118, 101, 45, 116, 114, 97, 105,
+    108, 105, 110, 103, 45, 115, 101, 112, 97, 114, 97, 116, 111, 114, 45, 49,
+    46, 49, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 119, 107, 118,
+    79, 75, 105, 103, 54, 50, 116, 87, 56, 80, 49, 106, 103, 49, 73, 74,
+    74, 117, 83, 78, 53, 50, 79, 56, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 114, 101, 112, 101, 97, 116, 45, 101, 108, 101, 109, 101,
+    110, 116, 47, 45, 47, 114, 101, 112, 101, 97, 116, 45, 101, 108, 101, 109,
+    101, 110, 116, 45, 49, 46, 49, 46, 50, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 55, 119, 105, 97, 70, 52, 48, 85, 103, 55, 113, 117, 84, 90,
+    80, 114, 109, 76, 84, 53, 53, 79, 69, 100, 109, 81, 111, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 114, 101, 112, 101, 97, 116, 45,
+    115, 116, 114, 105, 110, 103, 47, 45, 47, 114, 101, 112, 101, 97, 116, 45,
+    115, 116, 114, 105, 110, 103, 45, 49, 46, 54, 46, 49, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 106, 99, 114, 107, 99, 79, 72, 73, 105, 114, 119,
+    116, 89, 65, 47, 47, 83, 110, 100, 105, 104, 116, 112, 49, 53, 106, 99,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114, 101, 113, 117,
+    105, 114, 101, 95, 111, 112, 116, 105, 111, 110, 97, 108, 47, 45, 47, 114,
+    101, 113, 117, 105, 114, 101, 95, 111, 112, 116, 105, 111, 110, 97, 108, 45,
+    49, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45,
+    113, 104, 77, 47, 121, 53, 55, 101, 110, 71, 87, 72, 65, 101, 51, 118,
+    47, 78, 99, 119, 77, 76, 54, 97, 51, 47, 118, 102, 69, 83, 76, 101,
+    47, 115, 71, 77, 50, 100, 73, 73, 43, 103, 69, 79, 48, 66, 112, 75,
+    82, 85, 107, 87, 90, 111, 119, 47, 116, 121, 108, 111, 78, 113, 74, 121,
+    78, 54, 107, 88, 83, 108, 51, 82, 121, 121, 77, 56, 76, 108, 53, 68,
+    47, 115, 74, 80, 56, 103, 61, 61, 114, 101, 115, 111, 108, 118, 101, 45,
+    102, 114, 111, 109, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105,
+    115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 114,
+    101, 115, 111, 108, 118, 101, 47, 45, 47, 114, 101, 115, 111, 108, 118, 101,
+    45, 49, 46, 53, 46, 48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50,
+    45, 104, 103, 111, 83, 71, 114, 99, 51, 112, 106, 122, 65, 80, 72, 78,
+    66, 103, 43, 75, 110, 70, 99, 75, 50, 72, 119, 108, 72, 84, 115, 47,
+    89, 114, 65, 71, 85, 114, 54, 113, 103, 84, 86, 85, 90, 109, 88, 118,
+    49, 85, 69, 88, 88, 108, 48, 98, 90, 78, 66, 75, 77, 65, 57, 102,
+    117, 100, 54, 108, 82, 89, 70, 100, 80, 71, 122, 48, 120, 88, 120, 121,
+    99, 80, 122, 109, 109, 105, 119, 61, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 114, 101, 115, 111, 108, 118, 101, 45, 102, 114, 111, 109,
+    47, 45, 47, 114, 101, 115, 111, 108, 118, 101, 45, 102, 114, 111, 109, 45,
+    50, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 108, 73,
+    67, 114, 73, 79, 108, 80, 43, 104, 50, 101, 103, 75, 103, 69, 120, 43,
+    111, 85, 100, 104, 71, 87, 97, 49, 99, 61, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 115, 97, 102, 101, 45, 98, 117, 102, 102, 101, 114,
+    47, 45, 47, 115, 97, 102, 101, 45, 98, 117, 102, 102, 101, 114, 45, 53,
+    46, 49, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 107,
+    75, 118, 78, 74, 110, 54, 77, 109, 57, 51, 103, 65, 99, 122, 87, 86,
+    74, 103, 55, 119, 72, 43, 119, 71, 89, 87, 78, 114, 68, 72, 100, 87,
+    118, 112, 85, 109, 72, 121, 69, 115, 103, 67, 116, 73, 119, 119, 111, 51,
+    98, 113, 80, 116, 86, 52, 116, 82, 53, 116, 117, 80, 97, 85, 104, 84,
+    79, 111, 47, 107, 118, 104, 86, 119, 100, 56, 88, 119, 119, 79, 108, 108,
+    71, 89, 107, 98, 103, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 115, 101, 109, 118, 101, 114, 47, 45, 47, 115, 101, 109, 118, 101,
+    114, 45, 53, 46, 52, 46, 49, 46, 116, 103, 122, 115, 104, 97, 53, 49,
+    50, 45, 87, 102, 71, 47, 88, 57, 43, 111, 65, 84, 104, 56, 49, 88,
+    116, 108, 108, 73, 111, 47, 73, 56, 103, 79, 105, 89, 57, 69, 88, 82,
+    100, 118, 49, 99, 81, 100, 121, 121, 107, 101, 88, 75, 49, 55, 89, 99,
+    85, 87, 51, 69, 88, 85, 65, 105, 50, 84, 111, 52, 112, 99, 72, 54,
+    110, 90, 116, 74, 80, 114, 55, 90, 79, 112, 77, 53, 79, 77, 121, 87,
+    74, 90, 109, 43, 56, 82, 115, 103, 61, 61, 104, 116, 116, 112, 115, 58,
+    47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115,
+    46, 111, 114, 103, 47, 115, 101, 116, 45, 105, 109, 109, 101, 100, 105, 97,
+    116, 101, 45, 115, 104, 105, 109, 47, 45, 47, 115, 101, 116, 45, 105, 109,
+    109, 101, 100, 105, 97, 116, 101, 45, 115, 104, 105, 109, 45, 49, 46, 48,
+    46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 83, 121, 115, 98, 74,
+    43, 117, 65, 105, 112, 43, 78, 122, 69, 103, 97, 87, 79, 88, 108, 98,
+    49, 109, 102, 80, 50, 69, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 115, 101, 116, 112, 114, 111, 116, 111, 116, 121, 112, 101, 111, 102,
+    47, 45, 47, 115, 101, 116, 112, 114, 111, 116, 111, 116, 121, 112, 101, 111,
+    102, 45, 49, 46, 48, 46, 51, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    90, 108, 90, 43, 78, 119, 81, 43, 54, 48, 56, 69, 50, 82, 118, 87,
+    87, 77, 68, 76, 55, 55, 86, 98, 106, 103, 81, 61, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 115, 104, 101, 108, 108, 106, 115, 47, 45,
+    47, 115, 104, 101, 108, 108, 106, 115, 45, 48, 46, 55, 46, 56, 46, 116,
+    103, 122, 115, 104, 97, 49, 45, 51, 115, 118, 80, 104, 48, 115, 78, 72,
+    108, 43, 51, 76, 104, 83, 120, 90, 75, 108, 111, 77, 69, 106, 112, 114,
+    76, 77, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115,
+    116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 115, 104,
+    105, 109, 109, 101, 114, 47, 45, 47, 115, 104, 105, 109, 109, 101, 114, 45,
+    49, 46, 50, 46, 48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45,
+    120, 84, 67, 120, 50, 118, 111, 104, 88, 67, 50, 69, 87, 87, 68, 113,
+    89, 47, 122, 98, 52, 43, 53, 77, 117, 50, 56, 68, 43, 72, 89, 78,
+    83, 79, 117, 70, 122, 115, 121, 82, 68, 82, 118, 73, 47, 101, 49, 73,
+    67, 98, 54, 57, 97, 102, 119, 97, 85, 119, 102, 106, 114, 43, 50, 53,
+    90, 88, 108, 100, 98, 79, 76, 121, 112, 43, 105, 68, 85, 90, 72, 113,
+    56, 85, 110, 84, 97, 103, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47,
+    114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111,
+    114, 103, 47, 115, 108, 105, 99, 101, 100, 47, 45, 47, 115, 108, 105, 99,
+    101, 100, 45, 49, 46, 48, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49,
+    45, 67, 122, 112, 109, 75, 49, 48, 69, 119, 120, 100, 55, 71, 83, 97,
+    43, 113, 67, 115, 68, 43, 68, 101, 105, 55, 48, 69, 61, 115, 111, 117,
+    114, 99, 101, 45, 109, 97, 112, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 115, 111, 117, 114, 99, 101, 45, 109, 97, 112, 47, 45, 47, 115,
+    111, 117, 114, 99, 101, 45, 109, 97, 112, 45, 48, 46, 54, 46, 49, 46,
+    116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 85, 106, 103, 97, 112, 117,
+    109, 87, 108, 98, 77, 104, 107, 66, 103, 122, 84, 55, 89, 107, 99, 53,
+    89, 88, 85, 84, 52, 54, 70, 48, 105, 75, 117, 56, 83, 71, 88, 113,
+    48, 98, 99, 119, 80, 53, 100, 122, 47, 104, 48, 80, 108, 106, 54, 101,
+    110, 74, 113, 106, 122, 49, 90, 98, 113, 50, 108, 53, 87, 97, 113, 89,
+    110, 114, 86, 98, 119, 87, 79, 87, 77, 121, 70, 51, 70, 52, 55, 103,
+    61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 115, 111, 117,
+    114, 99, 101, 45, 109, 97, 112, 45, 115, 117, 112, 112, 111, 114, 116, 47,
+    45, 47, 115, 111, 117, 114, 99, 101, 45, 109, 97, 112, 45, 115, 117, 112,
+    112, 111, 114, 116, 45, 48, 46, 53, 46, 48, 46, 116, 103, 122, 115, 104,
+    97, 53, 49, 50, 45, 118, 85, 111, 78, 51, 73, 55, 102, 72, 81, 101,
+    48, 82, 47, 83, 74, 76, 75, 82, 100, 75, 89, 117, 69, 100, 82, 71,
+    111, 103, 115, 118, 105, 88, 70, 107, 72, 72, 111, 49, 55, 65, 87, 97,
+    84, 71, 118, 49, 55, 86, 76, 110, 120, 119, 43, 67, 70, 88, 118, 113,
+    121, 43, 121, 52, 79, 82, 90, 51, 100, 111, 87, 76, 81, 99, 120, 82,
+    89, 102, 119, 75, 114, 115, 100, 47, 72, 55, 81, 61, 61, 104, 116, 116,
+    112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112,
+    109, 106, 115, 46, 111, 114, 103, 47, 115, 112, 114, 105, 110, 116, 102, 45,
+    106, 115, 47, 45, 47, 115, 112, 114, 105, 110, 116, 102, 45, 106, 115, 45,
+    49, 46, 49, 46, 49, 46, 116, 103, 122, 115, 104, 97, 49, 45, 78, 114,
+    53, 52, 77, 103, 114, 43, 87, 65, 72, 50, 122, 113, 80, 117, 101, 76,
+    98, 108, 113, 114, 108, 65, 54, 103, 119, 61, 115, 116, 97, 99, 107, 45,
+    116, 114, 97, 99, 101, 48, 46, 48, 46, 49, 48, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 115, 116, 97, 99, 107, 45, 116, 114, 97, 99,
+    101, 47, 45, 47, 115, 116, 97, 99, 107, 45, 116, 114, 97, 99, 101, 45,
+    48, 46, 48, 46, 49, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 86,
+    72, 120, 119, 115, 48, 102, 111, 48, 121, 116, 79, 69, 73, 54, 104, 111,
+    113, 70, 90, 53, 102, 51, 101, 71, 99, 65, 61, 104, 116, 116, 112, 115,
+    58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106,
+    115, 46, 111, 114, 103, 47, 115, 116, 97, 116, 117, 115, 101, 115, 47, 45,
+    47, 115, 116, 97, 116, 117, 115, 101, 115, 45, 49, 46, 52, 46, 48, 46,
+    116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 122, 104, 83, 67, 116, 116,
+    56, 118, 50, 78, 68, 114, 82, 108, 80, 81, 112, 67, 78, 116, 119, 47,
+    104, 101, 90, 76, 116, 102, 85, 68, 113, 120, 66, 77, 49, 117, 100, 113,
+    105, 107, 98, 47, 72, 98, 107, 53, 50, 76, 75, 52, 110, 81, 83, 119,
+    114, 49, 48, 117, 55, 55, 105, 111, 112, 67, 87, 53, 76, 115, 121, 72,
+    112, 117, 88, 83, 48, 71, 110, 69, 99, 52, 56, 109, 76, 101, 101, 119,
+    61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 115, 116, 114,
+    105, 110, 103, 95, 100, 101, 99, 111, 100, 101, 114, 47, 45, 47, 115, 116,
+    114, 105, 110, 103, 95, 100, 101, 99, 111, 100, 101, 114, 45, 49, 46, 48,
+    46, 51, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 52, 65, 72,
+    54, 90, 53, 102, 122, 78, 78, 66, 99, 72, 43, 54, 88, 68, 77, 102,
+    65, 47, 66, 84, 116, 56, 55, 115, 107, 120, 113, 74, 108, 79, 48, 108,
+    65, 104, 51, 68, 107, 101, 114, 53, 122, 84, 104, 99, 65, 120, 71, 54,
+    109, 75, 122, 43, 105, 71, 117, 51, 48, 56, 85, 75, 111, 80, 80, 81,
+    56, 68, 99, 113, 120, 47, 52, 74, 104, 117, 106, 122, 108, 116, 82, 97,
+    43, 104, 81, 61, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103,
+    105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47,
+    115, 116, 114, 105, 112, 45, 97, 110, 115, 105, 47, 45, 47, 115, 116, 114,
+    105, 112, 45, 97, 110, 115, 105, 45, 51, 46, 48, 46, 49, 46, 116, 103,
+    122, 115, 104, 97, 49, 45, 97, 106, 104, 102, 117, 73, 85, 57, 108, 83,
+    49, 102, 56, 70, 48, 79, 105, 113, 43, 85, 74, 52, 51, 71, 80, 99,
+    56, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 115, 117, 112,
+    112, 111, 114, 116, 115, 45, 99, 111, 108, 111, 114, 47, 45, 47, 115, 117,
+    112, 112, 111, 114, 116, 115, 45, 99, 111, 108, 111, 114, 45, 50, 46, 48,
+    46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 85, 49, 48, 69, 88,
+    79, 97, 50, 78, 106, 43, 107, 65, 82, 99, 73, 82, 105, 109, 90, 88,
+    112, 51, 122, 74, 77, 99, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 116, 118, 52, 47, 45, 47, 116, 118, 52, 45, 49, 46, 51, 46,
+    48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 48, 67, 68, 73, 82, 118,
+    114, 100, 85, 77, 104, 86, 113, 55, 74, 101, 117, 117, 122, 71, 106, 56,
+    69, 80, 101, 87, 77, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101,
+    103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103,
+    47, 116, 121, 112, 101, 45, 105, 115, 47, 45, 47, 116, 121, 112, 101, 45,
+    105, 115, 45, 49, 46, 54, 46, 49, 53, 46, 116, 103, 122, 115, 104, 97,
+    49, 45, 121, 114, 69, 80, 116, 74, 67, 101, 82, 66, 121, 67, 104, 67,
+    54, 118, 52, 97, 49, 107, 98, 73, 71, 65, 82, 66, 65, 61, 104, 116,
+    116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110,
+    112, 109, 106, 115, 46, 111, 114, 103, 47, 117, 110, 105, 120, 45, 99, 114,
+    121, 112, 116, 45, 116, 100, 45, 106, 115, 47, 45, 47, 117, 110, 105, 120,
+    45, 99, 114, 121, 112, 116, 45, 116, 100, 45, 106, 115, 45, 49, 46, 48,
+    46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 72, 65, 103, 107, 70,
+    81, 83, 66, 118, 72, 111, 66, 49, 74, 54, 89, 56, 101, 120, 109, 106,
+    89, 74, 66, 76, 122, 115, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 117, 110, 112, 105, 112, 101, 47, 45, 47, 117, 110, 112, 105, 112,
+    101, 45, 49, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    115, 114, 57, 79, 54, 70, 70, 75, 114, 109, 70, 108, 116, 73, 70, 52,
+    75, 100, 73, 98, 76, 118, 83, 90, 66, 79, 119, 61, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 117, 116, 105, 108, 45, 100, 101, 112, 114,
+    101, 99, 97, 116, 101, 47, 45, 47, 117, 116, 105, 108, 45, 100, 101, 112,
+    114, 101, 99, 97, 116, 101, 45, 49, 46, 48, 46, 50, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 82, 81, 49, 78, 121, 102, 112, 119, 51, 110, 77,
+    110, 89, 118, 118, 83, 49, 75, 75, 74, 103, 85, 71, 97, 68, 77, 56,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 117, 117, 105, 100,
+    47, 45, 47, 117, 117, 105, 100, 45, 51, 46, 49, 46, 48, 46, 116, 103,
+    122, 115, 104, 97, 53, 49, 50, 45, 68, 73, 87, 116, 122, 85, 107, 119,
+    48, 52, 77, 52, 107, 51, 98, 102, 49, 73, 99, 112, 83, 50, 116, 110,
+    103, 88, 69, 76, 50, 54, 89, 85, 68, 50, 77, 48, 116, 77, 68, 85,
+    112, 110, 85, 114, 122, 50, 104, 103, 122, 85, 66, 108, 68, 53, 53, 97,
+    52, 70, 106, 100, 76, 71, 80, 118, 102, 72, 120, 83, 54, 117, 108, 117,
+    71, 87, 118, 97, 86, 69, 113, 103, 66, 99, 86, 97, 43, 103, 61, 61,
+    104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121,
+    46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 118, 97, 114, 121, 47,
+    45, 47, 118, 97, 114, 121, 45, 49, 46, 49, 46, 50, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 73, 112, 110, 119, 76, 71, 51, 116, 77, 78, 83,
+    108, 108, 104, 115, 76, 110, 51, 82, 83, 83, 104, 106, 50, 78, 80, 119,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 118, 105, 122, 105,
+    111, 110, 47, 45, 47, 118, 105, 122, 105, 111, 110, 45, 48, 46, 50, 46,
+    49, 51, 46, 116, 103, 122, 115, 104, 97, 49, 45, 69, 120, 84, 78, 55,
+    105, 115, 48, 69, 87, 43, 102, 87, 120, 74, 73, 85, 50, 43, 86, 50,
+    47, 122, 87, 55, 49, 56, 61, 104, 116, 116, 112, 115, 58, 47, 47, 114,
+    101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114,
+    103, 47, 118, 120, 120, 47, 45, 47, 118, 120, 120, 45, 49, 46, 50, 46,
+    50, 46, 116, 103, 122, 115, 104, 97, 49, 45, 100, 66, 43, 49, 72, 71,
+    56, 82, 48, 122, 103, 57, 112, 118, 109, 53, 73, 66, 105, 108, 49, 55,
+    113, 65, 100, 104, 69, 61, 119, 105, 110, 115, 116, 111, 110, 50, 46, 52,
+    46, 48, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116,
+    114, 121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 119, 105, 110,
+    115, 116, 111, 110, 47, 45, 47, 119, 105, 110, 115, 116, 111, 110, 45, 50,
+    46, 52, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45, 103, 73, 66,
+    81, 117, 84, 49, 83, 90, 104, 55, 90, 43, 50, 119, 109, 115, 47, 68,
+    73, 74, 110, 67, 76, 67, 117, 52, 61, 104, 116, 116, 112, 115, 58, 47,
+    47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109, 106, 115, 46,
+    111, 114, 103, 47, 97, 115, 121, 110, 99, 47, 45, 47, 97, 115, 121, 110,
+    99, 45, 49, 46, 48, 46, 48, 46, 116, 103, 122, 115, 104, 97, 49, 45,
+    43, 80, 119, 69, 121, 106, 111, 84, 101, 69, 114, 101, 110, 104, 90, 66,
+    114, 53, 104, 88, 106, 80, 118, 87, 82, 54, 107, 61, 104, 116, 116, 112,
+    115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114, 121, 46, 110, 112, 109,
+    106, 115, 46, 111, 114, 103, 47, 119, 114, 97, 112, 112, 121, 47, 45, 47,
+    119, 114, 97, 112, 112, 121, 45, 49, 46, 48, 46, 50, 46, 116, 103, 122,
+    115, 104, 97, 49, 45, 116, 83, 81, 57, 106, 122, 55, 66, 113, 106, 88,
+    120, 78, 107, 89, 70, 118, 65, 48, 81, 78, 117, 77, 75, 116, 112, 56,
+    61, 104, 116, 116, 112, 115, 58, 47, 47, 114, 101, 103, 105, 115, 116, 114,
+    121, 46, 110, 112, 109, 106, 115, 46, 111, 114, 103, 47, 121, 97, 109, 108,
+    106, 115, 47, 45, 47, 121, 97, 109, 108, 106, 115, 45, 48, 46, 51, 46,
+    48, 46, 116, 103, 122, 115, 104, 97, 53, 49, 50, 45, 67, 47, 70, 115,
+    86, 86, 104, 104, 116, 52, 105, 80, 81, 89, 88, 79, 73, 110, 111, 120,
+    85, 77, 47, 49, 69, 76, 83, 102, 57, 69, 115, 103, 75, 72, 51, 52,
+    70, 111, 102, 81, 79, 112, 54, 104, 119, 67, 80, 114, 87, 52, 118, 71,
+    52, 119, 53, 43, 43, 84, 69, 68, 51, 120, 82, 85, 111, 56, 103, 68,
+    55, 108, 48, 80, 49, 74, 49, 100, 76, 108, 68, 89, 122, 79, 68, 115,
+    84, 81, 61, 61,
+};
+
+static const ARGO_VALUE values[2419];
+
+#define V(i) ((ARGO_VALUE *)values + (i))
+#define S(offset, length) ARGO_EMBED_STRING(text, offset, length)
+
+static const ARGO_VALUE values[2419] = {
+    {ARGO_OBJECT_TYPE, NULL, NULL, {0}, .content.object = {V(1)}},
+    {ARGO_NO_TYPE, V(2), V(6), {0}},
+    {ARGO_STRING_TYPE, V(3), V(1), S(0, 4), .content.string = S(4, 9)},
+    {ARGO_STRING_TYPE, V(4), V(2), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_NUMBER_TYPE, V(5), V(3), S(25, 15), .content.number = {S(40, 1), 1L, 1, 2, 1, 1}},
+    {ARGO_BASIC_TYPE, V(6), V(4), S(41, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1), V(5), S(49, 12), .content.object = {V(7)}},
+    {ARGO_NO_TYPE, V(8), V(2410), {0}},
+    {ARGO_OBJECT_TYPE, V(17), V(7), S(61, 11), .content.object = {V(9)}},
+    {ARGO_NO_TYPE, V(10), V(14), {0}},
+    {ARGO_STRING_TYPE, V(11), V(9), S(13, 7), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(12), V(10), S(77, 8), .content.string = S(85, 55)},
+    {ARGO_STRING_TYPE, V(13), V(11), S(140, 9), .content.string = S(149, 95)},
+    {ARGO_BASIC_TYPE, V(14), V(12), S(244, 3), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(9), V(13), S(41, 8), .content.object = {V(15)}},
+    {ARGO_NO_TYPE, V(16), V(16), {0}},
+    {ARGO_STRING_TYPE, V(15), V(15), S(247, 11), .content.string = S(258, 5)},
+    {ARGO_OBJECT_TYPE, V(23), V(8), S(263, 13), .content.object = {V(18)}},
+    {ARGO_NO_TYPE, V(19), V(22), {0}},
+    {ARGO_STRING_TYPE, V(20), V(18), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(21), V(19), S(77, 8), .content.string = S(281, 59)},
+    {ARGO_STRING_TYPE, V(22), V(20), S(140, 9), .content.string = S(340, 95)},
+    {ARGO_BASIC_TYPE, V(18), V(21), S(244, 3), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(34), V(17), S(435, 14), .content.object = {V(24)}},
+    {ARGO_NO_TYPE, V(25), V(29), {0}},
+    {ARGO_STRING_TYPE, V(26), V(24), S(13, 7), .content.string = S(449, 6)},
+    {ARGO_STRING_TYPE, V(27), V(25), S(77, 8), .content.string = S(455, 62)},
+    {ARGO_STRING_TYPE, V(28), V(26), S(140, 9), .content.string = S(517, 95)},
+    {ARGO_BASIC_TYPE, V(29), V(27), S(244, 3), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(24), V(28), S(41, 8), .content.object = {V(30)}},
+    {ARGO_NO_TYPE, V(31), V(33), {0}},
+    {ARGO_STRING_TYPE, V(32), V(30), S(61, 11), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(33), V(31), S(263, 13), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(30), V(32), S(247, 11), .content.string = S(258, 5)},
+    {ARGO_OBJECT_TYPE, V(45), V(23), S(612, 15), .content.object = {V(35)}},
+    {ARGO_NO_TYPE, V(36), V(40), {0}},
+    {ARGO_STRING_TYPE, V(37), V(35), S(13, 7), .content.string = S(627, 6)},
+    {ARGO_STRING_TYPE, V(38), V(36), S(77, 8), .content.string = S(633, 64)},
+    {ARGO_STRING_TYPE, V(39), V(37), S(140, 9), .content.string = S(697, 95)},
+    {ARGO_BASIC_TYPE, V(40), V(38), S(244, 3), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(35), V(39), S(41, 8), .content.object = {V(41)}},
+    {ARGO_NO_TYPE, V(42), V(44), {0}},
+    {ARGO_STRING_TYPE, V(43), V(41), S(263, 13), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(44), V(42), S(435, 14), .content.string = S(449, 6)},
+    {ARGO_STRING_TYPE, V(41), V(43), S(247, 11), .content.string = S(258, 5)},
+    {ARGO_OBJECT_TYPE, V(51), V(34), S(247, 11), .content.object = {V(46)}},
+    {ARGO_NO_TYPE, V(47), V(50), {0}},
+    {ARGO_STRING_TYPE, V(48), V(46), S(13, 7), .content.string = S(258, 5)},
+    {ARGO_STRING_TYPE, V(49), V(47), S(77, 8), .content.string = S(792, 55)},
+    {ARGO_STRING_TYPE, V(50), V(48), S(140, 9), .content.string = S(847, 95)},
+    {ARGO_BASIC_TYPE, V(46), V(49), S(244, 3), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(60), V(45), S(942, 7), .content.object = {V(52)}},
+    {ARGO_NO_TYPE, V(53), V(56), {0}},
+    {ARGO_STRING_TYPE, V(54), V(52), S(13, 7), .content.string = S(949, 5)},
+    {ARGO_STRING_TYPE, V(55), V(53), S(77, 8), .content.string = S(954, 54)},
+    {ARGO_STRING_TYPE, V(56), V(54), S(140, 9), .content.string = S(1008, 33)},
+    {ARGO_OBJECT_TYPE, V(52), V(55), S(41, 8), .content.object = {V(57)}},
+    {ARGO_NO_TYPE, V(58), V(59), {0}},
+    {ARGO_STRING_TYPE, V(59), V(57), S(1041, 10), .content.string = S(1051, 6)},
+    {ARGO_STRING_TYPE, V(57), V(58), S(1057, 10), .content.string = S(1067, 5)},
+    {ARGO_OBJECT_TYPE, V(65), V(51), S(1072, 3), .content.object = {V(61)}},
+    {ARGO_NO_TYPE, V(62), V(64), {0}},
+    {ARGO_STRING_TYPE, V(63), V(61), S(13, 7), .content.string = S(1075, 5)},
+    {ARGO_STRING_TYPE, V(64), V(62), S(77, 8), .content.string = S(1080, 46)},
+    {ARGO_STRING_TYPE, V(61), V(63), S(140, 9), .content.string = S(1126, 33)},
+    {ARGO_OBJECT_TYPE, V(73), V(60), S(1159, 11), .content.object = {V(66)}},
+    {ARGO_NO_TYPE, V(67), V(70), {0}},
+    {ARGO_STRING_TYPE, V(68), V(66), S(13, 7), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(69), V(67), S(77, 8), .content.string = S(1175, 62)},
+    {ARGO_STRING_TYPE, V(70), V(68), S(140, 9), .content.string = S(1237, 33)},
+    {ARGO_OBJECT_TYPE, V(66), V(69), S(41, 8), .content.object = {V(71)}},
+    {ARGO_NO_TYPE, V(72), V(72), {0}},
+    {ARGO_STRING_TYPE, V(71), V(71), S(1072, 3), .content.string = S(1075, 5)},
+    {ARGO_OBJECT_TYPE, V(78), V(65), S(1270, 10), .content.object = {V(74)}},
+    {ARGO_NO_TYPE, V(75), V(77), {0}},
+    {ARGO_STRING_TYPE, V(76), V(74), S(13, 7), .content.string = S(1280, 5)},
+    {ARGO_STRING_TYPE, V(77), V(75), S(77, 8), .content.string = S(1285, 60)},
+    {ARGO_STRING_TYPE, V(74), V(76), S(140, 9), .content.string = S(1345, 33)},
+    {ARGO_OBJECT_TYPE, V(83), V(73), S(1378, 11), .content.object = {V(79)}},
+    {ARGO_NO_TYPE, V(80), V(82), {0}},
+    {ARGO_STRING_TYPE, V(81), V(79), S(13, 7), .content.string = S(1389, 5)},
+    {ARGO_STRING_TYPE, V(82), V(80), S(77, 8), .content.string = S(1394, 62)},
+    {ARGO_STRING_TYPE, V(79), V(81), S(140, 9), .content.string = S(1456, 33)},
+    {ARGO_OBJECT_TYPE, V(88), V(78), S(1489, 11), .content.object = {V(84)}},
+    {ARGO_NO_TYPE, V(85), V(87), {0}},
+    {ARGO_STRING_TYPE, V(86), V(84), S(13, 7), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(87), V(85), S(77, 8), .content.string = S(1505, 62)},
+    {ARGO_STRING_TYPE, V(84), V(86), S(140, 9), .content.string = S(1567, 33)},
+    {ARGO_OBJECT_TYPE, V(97), V(83), S(1600, 8), .content.object = {V(89)}},
+    {ARGO_NO_TYPE, V(90), V(93), {0}},
+    {ARGO_STRING_TYPE, V(91), V(89), S(13, 7), .content.string = S(1608, 5)},
+    {ARGO_STRING_TYPE, V(92), V(90), S(77, 8), .content.string = S(1613, 56)},
+    {ARGO_STRING_TYPE, V(93), V(91), S(140, 9), .content.string = S(1669, 95)},
+    {ARGO_OBJECT_TYPE, V(89), V(92), S(41, 8), .content.object = {V(94)}},
+    {ARGO_NO_TYPE, V(95), V(96), {0}},
+    {ARGO_STRING_TYPE, V(96), V(94), S(1764, 10), .content.string = S(1774, 6)},
+    {ARGO_STRING_TYPE, V(94), V(95), S(1780, 14), .content.string = S(1280, 5)},
+    {ARGO_OBJECT_TYPE, V(105), V(88), S(1794, 12), .content.object = {V(98)}},
+    {ARGO_NO_TYPE, V(99), V(102), {0}},
+    {ARGO_STRING_TYPE, V(100), V(98), S(13, 7), .content.string = S(1806, 5)},
+    {ARGO_STRING_TYPE, V(101), V(99), S(77, 8), .content.string = S(1811, 64)},
+    {ARGO_STRING_TYPE, V(102), V(100), S(140, 9), .content.string = S(1875, 33)},
+    {ARGO_OBJECT_TYPE, V(98), V(101), S(41, 8), .content.object = {V(103)}},
+    {ARGO_NO_TYPE, V(104), V(104), {0}},
+    {ARGO_STRING_TYPE, V(103), V(103), S(1908, 16), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(110), V(97), S(1924, 10), .content.object = {V(106)}},
+    {ARGO_NO_TYPE, V(107), V(109), {0}},
+    {ARGO_STRING_TYPE, V(108), V(106), S(13, 7), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(109), V(107), S(77, 8), .content.string = S(1939, 60)},
+    {ARGO_STRING_TYPE, V(106), V(108), S(140, 9), .content.string = S(1999, 33)},
+    {ARGO_OBJECT_TYPE, V(125), V(105), S(2032, 8), .content.object = {V(111)}},
+    {ARGO_NO_TYPE, V(112), V(118), {0}},
+    {ARGO_STRING_TYPE, V(113), V(111), S(13, 7), .content.string = S(2040, 5)},
+    {ARGO_STRING_TYPE, V(114), V(112), S(77, 8), .content.string = S(2045, 56)},
+    {ARGO_STRING_TYPE, V(115), V(113), S(140, 9), .content.string = S(2101, 33)},
+    {ARGO_OBJECT_TYPE, V(118), V(114), S(41, 8), .content.object = {V(116)}},
+    {ARGO_NO_TYPE, V(117), V(117), {0}},
+    {ARGO_STRING_TYPE, V(116), V(116), S(2134, 10), .content.string = S(2144, 5)},
+    {ARGO_OBJECT_TYPE, V(111), V(115), S(49, 12), .content.object = {V(119)}},
+    {ARGO_NO_TYPE, V(120), V(120), {0}},
+    {ARGO_OBJECT_TYPE, V(119), V(119), S(2134, 10), .content.object = {V(121)}},
+    {ARGO_NO_TYPE, V(122), V(124), {0}},
+    {ARGO_STRING_TYPE, V(123), V(121), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(124), V(122), S(77, 8), .content.string = S(2149, 60)},
+    {ARGO_STRING_TYPE, V(121), V(123), S(140, 9), .content.string = S(2209, 33)},
+    {ARGO_OBJECT_TYPE, V(133), V(110), S(2242, 8), .content.object = {V(126)}},
+    {ARGO_NO_TYPE, V(127), V(130), {0}},
+    {ARGO_STRING_TYPE, V(128), V(126), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(129), V(127), S(77, 8), .content.string = S(2255, 56)},
+    {ARGO_STRING_TYPE, V(130), V(128), S(140, 9), .content.string = S(2311, 33)},
+    {ARGO_OBJECT_TYPE, V(126), V(129), S(41, 8), .content.object = {V(131)}},
+    {ARGO_NO_TYPE, V(132), V(132), {0}},
+    {ARGO_STRING_TYPE, V(131), V(131), S(2344, 11), .content.string = S(276, 5)},
+    {ARGO_OBJECT_TYPE, V(138), V(125), S(2344, 11), .content.object = {V(134)}},
+    {ARGO_NO_TYPE, V(135), V(137), {0}},
+    {ARGO_STRING_TYPE, V(136), V(134), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(137), V(135), S(77, 8), .content.string = S(2355, 62)},
+    {ARGO_STRING_TYPE, V(134), V(136), S(140, 9), .content.string = S(2417, 95)},
+    {ARGO_OBJECT_TYPE, V(143), V(133), S(2512, 12), .content.object = {V(139)}},
+    {ARGO_NO_TYPE, V(140), V(142), {0}},
+    {ARGO_STRING_TYPE, V(141), V(139), S(13, 7), .content.string = S(2524, 5)},
+    {ARGO_STRING_TYPE, V(142), V(140), S(77, 8), .content.string = S(2529, 64)},
+    {ARGO_STRING_TYPE, V(139), V(141), S(140, 9), .content.string = S(2593, 33)},
+    {ARGO_OBJECT_TYPE, V(151), V(138), S(2626, 5), .content.object = {V(144)}},
+    {ARGO_NO_TYPE, V(145), V(148), {0}},
+    {ARGO_STRING_TYPE, V(146), V(144), S(13, 7), .content.string = S(2631, 5)},
+    {ARGO_STRING_TYPE, V(147), V(145), S(77, 8), .content.string = S(2636, 50)},
+    {ARGO_STRING_TYPE, V(148), V(146), S(140, 9), .content.string = S(2686, 33)},
+    {ARGO_OBJECT_TYPE, V(144), V(147), S(41, 8), .content.object = {V(149)}},
+    {ARGO_NO_TYPE, V(150), V(150), {0}},
+    {ARGO_STRING_TYPE, V(149), V(149), S(2719, 6), .content.string = S(2725, 6)},
+    {ARGO_OBJECT_TYPE, V(156), V(143), S(2731, 10), .content.object = {V(152)}},
+    {ARGO_NO_TYPE, V(153), V(155), {0}},
+    {ARGO_STRING_TYPE, V(154), V(152), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(155), V(153), S(77, 8), .content.string = S(2746, 60)},
+    {ARGO_STRING_TYPE, V(152), V(154), S(140, 9), .content.string = S(2806, 33)},
+    {ARGO_OBJECT_TYPE, V(165), V(151), S(2839, 14), .content.object = {V(157)}},
+    {ARGO_NO_TYPE, V(158), V(161), {0}},
+    {ARGO_STRING_TYPE, V(159), V(157), S(13, 7), .content.string = S(2853, 5)},
+    {ARGO_STRING_TYPE, V(160), V(158), S(77, 8), .content.string = S(2858, 68)},
+    {ARGO_STRING_TYPE, V(161), V(159), S(140, 9), .content.string = S(2926, 95)},
+    {ARGO_OBJECT_TYPE, V(157), V(160), S(41, 8), .content.object = {V(162)}},
+    {ARGO_NO_TYPE, V(163), V(164), {0}},
+    {ARGO_STRING_TYPE, V(164), V(162), S(3021, 6), .content.string = S(3027, 5)},
+    {ARGO_STRING_TYPE, V(162), V(163), S(3032, 7), .content.string = S(3039, 5)},
+    {ARGO_OBJECT_TYPE, V(170), V(156), S(3044, 14), .content.object = {V(166)}},
+    {ARGO_NO_TYPE, V(167), V(169), {0}},
+    {ARGO_STRING_TYPE, V(168), V(166), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(169), V(167), S(77, 8), .content.string = S(3058, 68)},
+    {ARGO_STRING_TYPE, V(166), V(168), S(140, 9), .content.string = S(3126, 33)},
+    {ARGO_OBJECT_TYPE, V(175), V(165), S(3159, 8), .content.object = {V(171)}},
+    {ARGO_NO_TYPE, V(172), V(174), {0}},
+    {ARGO_STRING_TYPE, V(173), V(171), S(13, 7), .content.string = S(3167, 5)},
+    {ARGO_STRING_TYPE, V(174), V(172), S(77, 8), .content.string = S(3172, 56)},
+    {ARGO_STRING_TYPE, V(171), V(173), S(140, 9), .content.string = S(3228, 33)},
+    {ARGO_OBJECT_TYPE, V(180), V(170), S(3261, 17), .content.object = {V(176)}},
+    {ARGO_NO_TYPE, V(177), V(179), {0}},
+    {ARGO_STRING_TYPE, V(178), V(176), S(13, 7), .content.string = S(3278, 6)},
+    {ARGO_STRING_TYPE, V(179), V(177), S(77, 8), .content.string = S(3284, 75)},
+    {ARGO_STRING_TYPE, V(176), V(178), S(140, 9), .content.string = S(3359, 33)},
+    {ARGO_OBJECT_TYPE, V(185), V(175), S(3392, 7), .content.object = {V(181)}},
+    {ARGO_NO_TYPE, V(182), V(184), {0}},
+    {ARGO_STRING_TYPE, V(183), V(181), S(13, 7), .content.string = S(3399, 6)},
+    {ARGO_STRING_TYPE, V(184), V(182), S(77, 8), .content.string = S(3405, 55)},
+    {ARGO_STRING_TYPE, V(181), V(183), S(140, 9), .content.string = S(3460, 33)},
+    {ARGO_OBJECT_TYPE, V(190), V(180), S(3493, 8), .content.object = {V(186)}},
+    {ARGO_NO_TYPE, V(187), V(189), {0}},
+    {ARGO_STRING_TYPE, V(188), V(186), S(13, 7), .content.string = S(3501, 5)},
+    {ARGO_STRING_TYPE, V(189), V(187), S(77, 8), .content.string = S(3506, 56)},
+    {ARGO_STRING_TYPE, V(186), V(188), S(140, 9), .content.string = S(3562, 33)},
+    {ARGO_OBJECT_TYPE, V(199), V(185), S(3595, 15), .content.object = {V(191)}},
+    {ARGO_NO_TYPE, V(192), V(195), {0}},
+    {ARGO_STRING_TYPE, V(193), V(191), S(13, 7), .content.string = S(3610, 5)},
+    {ARGO_STRING_TYPE, V(194), V(192), S(77, 8), .content.string = S(3615, 70)},
+    {ARGO_STRING_TYPE, V(195), V(193), S(140, 9), .content.string = S(3685, 33)},
+    {ARGO_OBJECT_TYPE, V(191), V(194), S(41, 8), .content.object = {V(196)}},
+    {ARGO_NO_TYPE, V(197), V(198), {0}},
+    {ARGO_STRING_TYPE, V(198), V(196), S(3044, 14), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(196), V(197), S(3718, 10), .content.string = S(3728, 5)},
+    {ARGO_OBJECT_TYPE, V(209), V(190), S(3733, 6), .content.object = {V(200)}},
+    {ARGO_NO_TYPE, V(201), V(204), {0}},
+    {ARGO_STRING_TYPE, V(202), V(200), S(13, 7), .content.string = S(3739, 5)},
+    {ARGO_STRING_TYPE, V(203), V(201), S(77, 8), .content.string = S(3744, 52)},
+    {ARGO_STRING_TYPE, V(204), V(202), S(140, 9), .content.string = S(3796, 33)},
+    {ARGO_OBJECT_TYPE, V(200), V(203), S(41, 8), .content.object = {V(205)}},
+    {ARGO_NO_TYPE, V(206), V(208), {0}},
+    {ARGO_STRING_TYPE, V(207), V(205), S(3829, 12), .content.string = S(3841, 5)},
+    {ARGO_STRING_TYPE, V(208), V(206), S(3846, 8), .content.string = S(3854, 5)},
+    {ARGO_STRING_TYPE, V(205), V(207), S(3859, 14), .content.string = S(1934, 5)},
+    {ARGO_OBJECT_TYPE, V(214), V(199), S(3873, 4), .content.object = {V(210)}},
+    {ARGO_NO_TYPE, V(211), V(213), {0}},
+    {ARGO_STRING_TYPE, V(212), V(210), S(13, 7), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(213), V(211), S(77, 8), .content.string = S(3882, 48)},
+    {ARGO_STRING_TYPE, V(210), V(212), S(140, 9), .content.string = S(3930, 33)},
+    {ARGO_OBJECT_TYPE, V(219), V(209), S(3963, 12), .content.object = {V(215)}},
+    {ARGO_NO_TYPE, V(216), V(218), {0}},
+    {ARGO_STRING_TYPE, V(217), V(215), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(218), V(216), S(77, 8), .content.string = S(3975, 64)},
+    {ARGO_STRING_TYPE, V(215), V(217), S(140, 9), .content.string = S(4039, 33)},
+    {ARGO_OBJECT_TYPE, V(224), V(214), S(4072, 5), .content.object = {V(220)}},
+    {ARGO_NO_TYPE, V(221), V(223), {0}},
+    {ARGO_STRING_TYPE, V(222), V(220), S(13, 7), .content.string = S(4077, 5)},
+    {ARGO_STRING_TYPE, V(223), V(221), S(77, 8), .content.string = S(4082, 50)},
+    {ARGO_STRING_TYPE, V(220), V(222), S(140, 9), .content.string = S(4132, 33)},
+    {ARGO_OBJECT_TYPE, V(236), V(219), S(4165, 5), .content.object = {V(225)}},
+    {ARGO_NO_TYPE, V(226), V(229), {0}},
+    {ARGO_STRING_TYPE, V(227), V(225), S(13, 7), .content.string = S(4170, 5)},
+    {ARGO_STRING_TYPE, V(228), V(226), S(77, 8), .content.string = S(4175, 50)},
+    {ARGO_STRING_TYPE, V(229), V(227), S(140, 9), .content.string = S(4225, 33)},
+    {ARGO_OBJECT_TYPE, V(225), V(228), S(41, 8), .content.object = {V(230)}},
+    {ARGO_NO_TYPE, V(231), V(235), {0}},
+    {ARGO_STRING_TYPE, V(232), V(230), S(1378, 11), .content.string = S(1389, 5)},
+    {ARGO_STRING_TYPE, V(233), V(231), S(4258, 20), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(234), V(232), S(4283, 8), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(235), V(233), S(4291, 10), .content.string = S(4301, 5)},
+    {ARGO_STRING_TYPE, V(230), V(234), S(4306, 14), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(241), V(224), S(4320, 5), .content.object = {V(237)}},
+    {ARGO_NO_TYPE, V(238), V(240), {0}},
+    {ARGO_STRING_TYPE, V(239), V(237), S(13, 7), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(240), V(238), S(77, 8), .content.string = S(4325, 50)},
+    {ARGO_STRING_TYPE, V(237), V(239), S(140, 9), .content.string = S(4375, 33)},
+    {ARGO_OBJECT_TYPE, V(257), V(236), S(4408, 8), .content.object = {V(242)}},
+    {ARGO_NO_TYPE, V(243), V(246), {0}},
+    {ARGO_STRING_TYPE, V(244), V(242), S(13, 7), .content.string = S(4416, 5)},
+    {ARGO_STRING_TYPE, V(245), V(243), S(77, 8), .content.string = S(4421, 56)},
+    {ARGO_STRING_TYPE, V(246), V(244), S(140, 9), .content.string = S(4477, 33)},
+    {ARGO_OBJECT_TYPE, V(242), V(245), S(41, 8), .content.object = {V(247)}},
+    {ARGO_NO_TYPE, V(248), V(256), {0}},
+    {ARGO_STRING_TYPE, V(249), V(247), S(1600, 8), .content.string = S(1608, 5)},
+    {ARGO_STRING_TYPE, V(250), V(248), S(2731, 10), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(251), V(249), S(4510, 8), .content.string = S(4170, 5)},
+    {ARGO_STRING_TYPE, V(252), V(250), S(4518, 11), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(253), V(251), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(254), V(252), S(4542, 14), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(255), V(253), S(4556, 7), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(256), V(254), S(4568, 16), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(247), V(255), S(4584, 8), .content.string = S(4592, 5)},
+    {ARGO_OBJECT_TYPE, V(265), V(241), S(4597, 20), .content.object = {V(258)}},
+    {ARGO_NO_TYPE, V(259), V(262), {0}},
+    {ARGO_STRING_TYPE, V(260), V(258), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(261), V(259), S(77, 8), .content.string = S(4617, 80)},
+    {ARGO_STRING_TYPE, V(262), V(260), S(140, 9), .content.string = S(4697, 95)},
+    {ARGO_OBJECT_TYPE, V(258), V(261), S(41, 8), .content.object = {V(263)}},
+    {ARGO_NO_TYPE, V(264), V(264), {0}},
+    {ARGO_STRING_TYPE, V(263), V(263), S(4165, 5), .content.string = S(4170, 5)},
+    {ARGO_OBJECT_TYPE, V(270), V(257), S(4792, 2), .content.object = {V(266)}},
+    {ARGO_NO_TYPE, V(267), V(269), {0}},
+    {ARGO_STRING_TYPE, V(268), V(266), S(13, 7), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(269), V(267), S(77, 8), .content.string = S(4799, 44)},
+    {ARGO_STRING_TYPE, V(266), V(268), S(140, 9), .content.string = S(4843, 33)},
+    {ARGO_OBJECT_TYPE, V(281), V(265), S(4876, 7), .content.object = {V(271)}},
+    {ARGO_NO_TYPE, V(272), V(275), {0}},
+    {ARGO_STRING_TYPE, V(273), V(271), S(13, 7), .content.string = S(4883, 5)},
+    {ARGO_STRING_TYPE, V(274), V(272), S(77, 8), .content.string = S(4888, 54)},
+    {ARGO_STRING_TYPE, V(275), V(273), S(140, 9), .content.string = S(4942, 33)},
+    {ARGO_OBJECT_TYPE, V(271), V(274), S(41, 8), .content.object = {V(276)}},
+    {ARGO_NO_TYPE, V(277), V(280), {0}},
+    {ARGO_STRING_TYPE, V(278), V(276), S(4975, 9), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(279), V(277), S(4984, 2), .content.string = S(4986, 5)},
+    {ARGO_STRING_TYPE, V(280), V(278), S(4991, 8), .content.string = S(4999, 5)},
+    {ARGO_STRING_TYPE, V(276), V(279), S(5004, 7), .content.string = S(5011, 6)},
+    {ARGO_OBJECT_TYPE, V(286), V(270), S(5017, 6), .content.object = {V(282)}},
+    {ARGO_NO_TYPE, V(283), V(285), {0}},
+    {ARGO_STRING_TYPE, V(284), V(282), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(285), V(283), S(77, 8), .content.string = S(5023, 52)},
+    {ARGO_STRING_TYPE, V(282), V(284), S(140, 9), .content.string = S(5075, 33)},
+    {ARGO_OBJECT_TYPE, V(291), V(281), S(5108, 9), .content.object = {V(287)}},
+    {ARGO_NO_TYPE, V(288), V(290), {0}},
+    {ARGO_STRING_TYPE, V(289), V(287), S(13, 7), .content.string = S(5117, 6)},
+    {ARGO_STRING_TYPE, V(290), V(288), S(77, 8), .content.string = S(5123, 59)},
+    {ARGO_STRING_TYPE, V(287), V(289), S(140, 9), .content.string = S(5182, 95)},
+    {ARGO_OBJECT_TYPE, V(296), V(286), S(3718, 10), .content.object = {V(292)}},
+    {ARGO_NO_TYPE, V(293), V(295), {0}},
+    {ARGO_STRING_TYPE, V(294), V(292), S(13, 7), .content.string = S(3728, 5)},
+    {ARGO_STRING_TYPE, V(295), V(293), S(77, 8), .content.string = S(5277, 60)},
+    {ARGO_STRING_TYPE, V(292), V(294), S(140, 9), .content.string = S(5337, 33)},
+    {ARGO_OBJECT_TYPE, V(301), V(291), S(5370, 19), .content.object = {V(297)}},
+    {ARGO_NO_TYPE, V(298), V(300), {0}},
+    {ARGO_STRING_TYPE, V(299), V(297), S(13, 7), .content.string = S(5389, 5)},
+    {ARGO_STRING_TYPE, V(300), V(298), S(77, 8), .content.string = S(5394, 78)},
+    {ARGO_STRING_TYPE, V(297), V(299), S(140, 9), .content.string = S(5472, 33)},
+    {ARGO_OBJECT_TYPE, V(306), V(296), S(5505, 12), .content.object = {V(302)}},
+    {ARGO_NO_TYPE, V(303), V(305), {0}},
+    {ARGO_STRING_TYPE, V(304), V(302), S(13, 7), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(305), V(303), S(77, 8), .content.string = S(5517, 64)},
+    {ARGO_STRING_TYPE, V(302), V(304), S(140, 9), .content.string = S(5581, 95)},
+    {ARGO_OBJECT_TYPE, V(315), V(301), S(5676, 26), .content.object = {V(307)}},
+    {ARGO_NO_TYPE, V(308), V(311), {0}},
+    {ARGO_STRING_TYPE, V(309), V(307), S(13, 7), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(310), V(308), S(77, 8), .content.string = S(5707, 92)},
+    {ARGO_STRING_TYPE, V(311), V(309), S(140, 9), .content.string = S(5799, 95)},
+    {ARGO_OBJECT_TYPE, V(307), V(310), S(41, 8), .content.object = {V(312)}},
+    {ARGO_NO_TYPE, V(313), V(314), {0}},
+    {ARGO_STRING_TYPE, V(314), V(312), S(2839, 14), .content.string = S(2853, 5)},
+    {ARGO_STRING_TYPE, V(312), V(313), S(5894, 16), .content.string = S(5910, 5)},
+    {ARGO_OBJECT_TYPE, V(324), V(306), S(5915, 7), .content.object = {V(316)}},
+    {ARGO_NO_TYPE, V(317), V(320), {0}},
+    {ARGO_STRING_TYPE, V(318), V(316), S(13, 7), .content.string = S(5922, 5)},
+    {ARGO_STRING_TYPE, V(319), V(317), S(77, 8), .content.string = S(5927, 54)},
+    {ARGO_STRING_TYPE, V(320), V(318), S(140, 9), .content.string = S(5981, 33)},
+    {ARGO_OBJECT_TYPE, V(316), V(319), S(41, 8), .content.object = {V(321)}},
+    {ARGO_NO_TYPE, V(322), V(323), {0}},
+    {ARGO_STRING_TYPE, V(323), V(321), S(6014, 4), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(321), V(322), S(6018, 7), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(329), V(315), S(6030, 7), .content.object = {V(325)}},
+    {ARGO_NO_TYPE, V(326), V(328), {0}},
+    {ARGO_STRING_TYPE, V(327), V(325), S(13, 7), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(328), V(326), S(77, 8), .content.string = S(6037, 54)},
+    {ARGO_STRING_TYPE, V(325), V(327), S(140, 9), .content.string = S(6091, 33)},
+    {ARGO_OBJECT_TYPE, V(334), V(324), S(6124, 12), .content.object = {V(330)}},
+    {ARGO_NO_TYPE, V(331), V(333), {0}},
+    {ARGO_STRING_TYPE, V(332), V(330), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(333), V(331), S(77, 8), .content.string = S(6136, 64)},
+    {ARGO_STRING_TYPE, V(330), V(332), S(140, 9), .content.string = S(6200, 33)},
+    {ARGO_OBJECT_TYPE, V(342), V(329), S(6233, 4), .content.object = {V(335)}},
+    {ARGO_NO_TYPE, V(336), V(339), {0}},
+    {ARGO_STRING_TYPE, V(337), V(335), S(13, 7), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(338), V(336), S(77, 8), .content.string = S(6237, 48)},
+    {ARGO_STRING_TYPE, V(339), V(337), S(140, 9), .content.string = S(6285, 95)},
+    {ARGO_OBJECT_TYPE, V(335), V(338), S(41, 8), .content.object = {V(340)}},
+    {ARGO_NO_TYPE, V(341), V(341), {0}},
+    {ARGO_STRING_TYPE, V(340), V(340), S(6380, 15), .content.string = S(6395, 6)},
+    {ARGO_OBJECT_TYPE, V(347), V(334), S(6401, 5), .content.object = {V(343)}},
+    {ARGO_NO_TYPE, V(344), V(346), {0}},
+    {ARGO_STRING_TYPE, V(345), V(343), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(346), V(344), S(77, 8), .content.string = S(6406, 50)},
+    {ARGO_STRING_TYPE, V(343), V(345), S(140, 9), .content.string = S(6456, 33)},
+    {ARGO_OBJECT_TYPE, V(355), V(342), S(6489, 5), .content.object = {V(348)}},
+    {ARGO_NO_TYPE, V(349), V(352), {0}},
+    {ARGO_STRING_TYPE, V(350), V(348), S(13, 7), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(351), V(349), S(77, 8), .content.string = S(6499, 50)},
+    {ARGO_STRING_TYPE, V(352), V(350), S(140, 9), .content.string = S(6549, 95)},
+    {ARGO_OBJECT_TYPE, V(348), V(351), S(41, 8), .content.object = {V(353)}},
+    {ARGO_NO_TYPE, V(354), V(354), {0}},
+    {ARGO_STRING_TYPE, V(353), V(353), S(6644, 2), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(360), V(347), S(6646, 10), .content.object = {V(356)}},
+    {ARGO_NO_TYPE, V(357), V(359), {0}},
+    {ARGO_STRING_TYPE, V(358), V(356), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(359), V(357), S(77, 8), .content.string = S(6656, 60)},
+    {ARGO_STRING_TYPE, V(356), V(358), S(140, 9), .content.string = S(6716, 33)},
+    {ARGO_OBJECT_TYPE, V(365), V(355), S(6749, 9), .content.object = {V(361)}},
+    {ARGO_NO_TYPE, V(362), V(364), {0}},
+    {ARGO_STRING_TYPE, V(363), V(361), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(364), V(362), S(77, 8), .content.string = S(6758, 58)},
+    {ARGO_STRING_TYPE, V(361), V(363), S(140, 9), .content.string = S(6816, 33)},
+    {ARGO_OBJECT_TYPE, V(370), V(360), S(6014, 4), .content.object = {V(366)}},
+    {ARGO_NO_TYPE, V(367), V(369), {0}},
+    {ARGO_STRING_TYPE, V(368), V(366), S(13, 7), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(369), V(367), S(77, 8), .content.string = S(6849, 48)},
+    {ARGO_STRING_TYPE, V(366), V(368), S(140, 9), .content.string = S(6897, 33)},
+    {ARGO_OBJECT_TYPE, V(375), V(365), S(6930, 7), .content.object = {V(371)}},
+    {ARGO_NO_TYPE, V(372), V(374), {0}},
+    {ARGO_STRING_TYPE, V(373), V(371), S(13, 7), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(374), V(372), S(77, 8), .content.string = S(6937, 54)},
+    {ARGO_STRING_TYPE, V(371), V(373), S(140, 9), .content.string = S(6991, 33)},
+    {ARGO_OBJECT_TYPE, V(380), V(370), S(7024, 8), .content.object = {V(376)}},
+    {ARGO_NO_TYPE, V(377), V(379), {0}},
+    {ARGO_STRING_TYPE, V(378), V(376), S(13, 7), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(379), V(377), S(77, 8), .content.string = S(7032, 56)},
+    {ARGO_STRING_TYPE, V(376), V(378), S(140, 9), .content.string = S(7088, 33)},
+    {ARGO_OBJECT_TYPE, V(388), V(375), S(5894, 16), .content.object = {V(381)}},
+    {ARGO_NO_TYPE, V(382), V(385), {0}},
+    {ARGO_STRING_TYPE, V(383), V(381), S(13, 7), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(384), V(382), S(77, 8), .content.string = S(7121, 72)},
+    {ARGO_STRING_TYPE, V(385), V(383), S(140, 9), .content.string = S(7193, 33)},
+    {ARGO_OBJECT_TYPE, V(381), V(384), S(41, 8), .content.object = {V(386)}},
+    {ARGO_NO_TYPE, V(387), V(387), {0}},
+    {ARGO_STRING_TYPE, V(386), V(386), S(3032, 7), .content.string = S(3039, 5)},
+    {ARGO_OBJECT_TYPE, V(393), V(380), S(7226, 12), .content.object = {V(389)}},
+    {ARGO_NO_TYPE, V(390), V(392), {0}},
+    {ARGO_STRING_TYPE, V(391), V(389), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(392), V(390), S(77, 8), .content.string = S(7238, 64)},
+    {ARGO_STRING_TYPE, V(389), V(391), S(140, 9), .content.string = S(7302, 33)},
+    {ARGO_OBJECT_TYPE, V(398), V(388), S(7335, 11), .content.object = {V(394)}},
+    {ARGO_NO_TYPE, V(395), V(397), {0}},
+    {ARGO_STRING_TYPE, V(396), V(394), S(13, 7), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(397), V(395), S(77, 8), .content.string = S(7346, 62)},
+    {ARGO_STRING_TYPE, V(394), V(396), S(140, 9), .content.string = S(7408, 33)},
+    {ARGO_OBJECT_TYPE, V(403), V(393), S(7441, 11), .content.object = {V(399)}},
+    {ARGO_NO_TYPE, V(400), V(402), {0}},
+    {ARGO_STRING_TYPE, V(401), V(399), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(402), V(400), S(77, 8), .content.string = S(7452, 62)},
+    {ARGO_STRING_TYPE, V(399), V(401), S(140, 9), .content.string = S(7514, 33)},
+    {ARGO_OBJECT_TYPE, V(408), V(398), S(7547, 13), .content.object = {V(404)}},
+    {ARGO_NO_TYPE, V(405), V(407), {0}},
+    {ARGO_STRING_TYPE, V(406), V(404), S(13, 7), .content.string = S(3728, 5)},
+    {ARGO_STRING_TYPE, V(407), V(405), S(77, 8), .content.string = S(7560, 66)},
+    {ARGO_STRING_TYPE, V(404), V(406), S(140, 9), .content.string = S(7626, 33)},
+    {ARGO_OBJECT_TYPE, V(413), V(403), S(4258, 20), .content.object = {V(409)}},
+    {ARGO_NO_TYPE, V(410), V(412), {0}},
+    {ARGO_STRING_TYPE, V(411), V(409), S(13, 7), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(412), V(410), S(77, 8), .content.string = S(7659, 80)},
+    {ARGO_STRING_TYPE, V(409), V(411), S(140, 9), .content.string = S(7739, 33)},
+    {ARGO_OBJECT_TYPE, V(418), V(408), S(7772, 13), .content.object = {V(414)}},
+    {ARGO_NO_TYPE, V(415), V(417), {0}},
+    {ARGO_STRING_TYPE, V(416), V(414), S(13, 7), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(417), V(415), S(77, 8), .content.string = S(7785, 66)},
+    {ARGO_STRING_TYPE, V(414), V(416), S(140, 9), .content.string = S(7851, 33)},
+    {ARGO_OBJECT_TYPE, V(426), V(413), S(7884, 15), .content.object = {V(419)}},
+    {ARGO_NO_TYPE, V(420), V(423), {0}},
+    {ARGO_STRING_TYPE, V(421), V(419), S(13, 7), .content.string = S(7899, 5)},
+    {ARGO_STRING_TYPE, V(422), V(420), S(77, 8), .content.string = S(7904, 70)},
+    {ARGO_STRING_TYPE, V(423), V(421), S(140, 9), .content.string = S(7974, 33)},
+    {ARGO_OBJECT_TYPE, V(419), V(422), S(41, 8), .content.object = {V(424)}},
+    {ARGO_NO_TYPE, V(425), V(425), {0}},
+    {ARGO_STRING_TYPE, V(424), V(424), S(8007, 16), .content.string = S(8023, 5)},
+    {ARGO_OBJECT_TYPE, V(434), V(418), S(3829, 12), .content.object = {V(427)}},
+    {ARGO_NO_TYPE, V(428), V(431), {0}},
+    {ARGO_STRING_TYPE, V(429), V(427), S(13, 7), .content.string = S(3841, 5)},
+    {ARGO_STRING_TYPE, V(430), V(428), S(77, 8), .content.string = S(8028, 64)},
+    {ARGO_STRING_TYPE, V(431), V(429), S(140, 9), .content.string = S(8092, 33)},
+    {ARGO_OBJECT_TYPE, V(427), V(430), S(41, 8), .content.object = {V(432)}},
+    {ARGO_NO_TYPE, V(433), V(433), {0}},
+    {ARGO_STRING_TYPE, V(432), V(432), S(8125, 10), .content.string = S(8135, 5)},
+    {ARGO_OBJECT_TYPE, V(439), V(426), S(8140, 6), .content.object = {V(435)}},
+    {ARGO_NO_TYPE, V(436), V(438), {0}},
+    {ARGO_STRING_TYPE, V(437), V(435), S(13, 7), .content.string = S(4301, 5)},
+    {ARGO_STRING_TYPE, V(438), V(436), S(77, 8), .content.string = S(8146, 52)},
+    {ARGO_STRING_TYPE, V(435), V(437), S(140, 9), .content.string = S(8198, 33)},
+    {ARGO_OBJECT_TYPE, V(447), V(434), S(8231, 7), .content.object = {V(440)}},
+    {ARGO_NO_TYPE, V(441), V(444), {0}},
+    {ARGO_STRING_TYPE, V(442), V(440), S(13, 7), .content.string = S(8238, 5)},
+    {ARGO_STRING_TYPE, V(443), V(441), S(77, 8), .content.string = S(8243, 54)},
+    {ARGO_STRING_TYPE, V(444), V(442), S(140, 9), .content.string = S(8297, 33)},
+    {ARGO_OBJECT_TYPE, V(440), V(443), S(41, 8), .content.object = {V(445)}},
+    {ARGO_NO_TYPE, V(446), V(446), {0}},
+    {ARGO_STRING_TYPE, V(445), V(445), S(8330, 10), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(452), V(439), S(8340, 4), .content.object = {V(448)}},
+    {ARGO_NO_TYPE, V(449), V(451), {0}},
+    {ARGO_STRING_TYPE, V(450), V(448), S(13, 7), .content.string = S(8344, 5)},
+    {ARGO_STRING_TYPE, V(451), V(449), S(77, 8), .content.string = S(8349, 48)},
+    {ARGO_STRING_TYPE, V(448), V(450), S(140, 9), .content.string = S(8397, 33)},
+    {ARGO_OBJECT_TYPE, V(457), V(447), S(8430, 6), .content.object = {V(453)}},
+    {ARGO_NO_TYPE, V(454), V(456), {0}},
+    {ARGO_STRING_TYPE, V(455), V(453), S(13, 7), .content.string = S(8436, 6)},
+    {ARGO_STRING_TYPE, V(456), V(454), S(77, 8), .content.string = S(8442, 53)},
+    {ARGO_STRING_TYPE, V(453), V(455), S(140, 9), .content.string = S(8495, 33)},
+    {ARGO_OBJECT_TYPE, V(462), V(452), S(8528, 14), .content.object = {V(458)}},
+    {ARGO_NO_TYPE, V(459), V(461), {0}},
+    {ARGO_STRING_TYPE, V(460), V(458), S(13, 7), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(461), V(459), S(77, 8), .content.string = S(8542, 68)},
+    {ARGO_STRING_TYPE, V(458), V(460), S(140, 9), .content.string = S(8610, 33)},
+    {ARGO_OBJECT_TYPE, V(474), V(457), S(8125, 10), .content.object = {V(463)}},
+    {ARGO_NO_TYPE, V(464), V(467), {0}},
+    {ARGO_STRING_TYPE, V(465), V(463), S(13, 7), .content.string = S(8135, 5)},
+    {ARGO_STRING_TYPE, V(466), V(464), S(77, 8), .content.string = S(8643, 60)},
+    {ARGO_STRING_TYPE, V(467), V(465), S(140, 9), .content.string = S(8703, 33)},
+    {ARGO_OBJECT_TYPE, V(463), V(466), S(41, 8), .content.object = {V(468)}},
+    {ARGO_NO_TYPE, V(469), V(473), {0}},
+    {ARGO_STRING_TYPE, V(470), V(468), S(8736, 9), .content.string = S(4592, 5)},
+    {ARGO_STRING_TYPE, V(471), V(469), S(8745, 8), .content.string = S(4592, 5)},
+    {ARGO_STRING_TYPE, V(472), V(470), S(8753, 10), .content.string = S(8763, 5)},
+    {ARGO_STRING_TYPE, V(473), V(471), S(3859, 14), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(468), V(472), S(8768, 13), .content.string = S(8781, 5)},
+    {ARGO_OBJECT_TYPE, V(479), V(462), S(8786, 6), .content.object = {V(475)}},
+    {ARGO_NO_TYPE, V(476), V(478), {0}},
+    {ARGO_STRING_TYPE, V(477), V(475), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(478), V(476), S(77, 8), .content.string = S(8792, 52)},
+    {ARGO_STRING_TYPE, V(475), V(477), S(140, 9), .content.string = S(8844, 33)},
+    {ARGO_OBJECT_TYPE, V(487), V(474), S(8877, 7), .content.object = {V(480)}},
+    {ARGO_NO_TYPE, V(481), V(484), {0}},
+    {ARGO_STRING_TYPE, V(482), V(480), S(13, 7), .content.string = S(7899, 5)},
+    {ARGO_STRING_TYPE, V(483), V(481), S(77, 8), .content.string = S(8884, 54)},
+    {ARGO_STRING_TYPE, V(484), V(482), S(140, 9), .content.string = S(8938, 33)},
+    {ARGO_OBJECT_TYPE, V(480), V(483), S(41, 8), .content.object = {V(485)}},
+    {ARGO_NO_TYPE, V(486), V(486), {0}},
+    {ARGO_STRING_TYPE, V(485), V(485), S(8786, 6), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(492), V(479), S(8971, 5), .content.object = {V(488)}},
+    {ARGO_NO_TYPE, V(489), V(491), {0}},
+    {ARGO_STRING_TYPE, V(490), V(488), S(13, 7), .content.string = S(5389, 5)},
+    {ARGO_STRING_TYPE, V(491), V(489), S(77, 8), .content.string = S(8976, 50)},
+    {ARGO_STRING_TYPE, V(488), V(490), S(140, 9), .content.string = S(9026, 33)},
+    {ARGO_OBJECT_TYPE, V(497), V(487), S(9059, 11), .content.object = {V(493)}},
+    {ARGO_NO_TYPE, V(494), V(496), {0}},
+    {ARGO_STRING_TYPE, V(495), V(493), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(496), V(494), S(77, 8), .content.string = S(9070, 62)},
+    {ARGO_STRING_TYPE, V(493), V(495), S(140, 9), .content.string = S(9132, 33)},
+    {ARGO_OBJECT_TYPE, V(1286), V(492), S(4510, 8), .content.object = {V(498)}},
+    {ARGO_NO_TYPE, V(499), V(507), {0}},
+    {ARGO_STRING_TYPE, V(500), V(498), S(13, 7), .content.string = S(4170, 5)},
+    {ARGO_STRING_TYPE, V(501), V(499), S(77, 8), .content.string = S(9165, 56)},
+    {ARGO_STRING_TYPE, V(502), V(500), S(140, 9), .content.string = S(9221, 95)},
+    {ARGO_BASIC_TYPE, V(503), V(501), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(507), V(502), S(41, 8), .content.object = {V(504)}},
+    {ARGO_NO_TYPE, V(505), V(506), {0}},
+    {ARGO_STRING_TYPE, V(506), V(504), S(9324, 3), .content.string = S(9327, 5)},
+    {ARGO_STRING_TYPE, V(504), V(505), S(9332, 12), .content.string = S(9344, 6)},
+    {ARGO_OBJECT_TYPE, V(498), V(503), S(49, 12), .content.object = {V(508)}},
+    {ARGO_NO_TYPE, V(509), V(1282), {0}},
+    {ARGO_OBJECT_TYPE, V(514), V(508), S(9350, 6), .content.object = {V(510)}},
+    {ARGO_NO_TYPE, V(511), V(513), {0}},
+    {ARGO_STRING_TYPE, V(512), V(510), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_BASIC_TYPE, V(513), V(511), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(510), V(512), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(523), V(509), S(9363, 3), .content.object = {V(515)}},
+    {ARGO_NO_TYPE, V(516), V(519), {0}},
+    {ARGO_STRING_TYPE, V(517), V(515), S(13, 7), .content.string = S(9366, 6)},
+    {ARGO_BASIC_TYPE, V(518), V(516), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(519), V(517), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(515), V(518), S(41, 8), .content.object = {V(520)}},
+    {ARGO_NO_TYPE, V(521), V(522), {0}},
+    {ARGO_STRING_TYPE, V(522), V(520), S(4792, 2), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(520), V(521), S(9372, 21), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(527), V(514), S(1270, 10), .content.object = {V(524)}},
+    {ARGO_NO_TYPE, V(525), V(526), {0}},
+    {ARGO_STRING_TYPE, V(526), V(524), S(13, 7), .content.string = S(1280, 5)},
+    {ARGO_BASIC_TYPE, V(524), V(525), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(532), V(523), S(9393, 6), .content.object = {V(528)}},
+    {ARGO_NO_TYPE, V(529), V(531), {0}},
+    {ARGO_STRING_TYPE, V(530), V(528), S(13, 7), .content.string = S(5910, 5)},
+    {ARGO_BASIC_TYPE, V(531), V(529), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(528), V(530), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(541), V(527), S(9399, 16), .content.object = {V(533)}},
+    {ARGO_NO_TYPE, V(534), V(537), {0}},
+    {ARGO_STRING_TYPE, V(535), V(533), S(13, 7), .content.string = S(9415, 5)},
+    {ARGO_BASIC_TYPE, V(536), V(534), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(537), V(535), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(533), V(536), S(41, 8), .content.object = {V(538)}},
+    {ARGO_NO_TYPE, V(539), V(540), {0}},
+    {ARGO_STRING_TYPE, V(540), V(538), S(6749, 9), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(538), V(539), S(9420, 15), .content.string = S(9435, 5)},
+    {ARGO_OBJECT_TYPE, V(546), V(532), S(9440, 4), .content.object = {V(542)}},
+    {ARGO_NO_TYPE, V(543), V(545), {0}},
+    {ARGO_STRING_TYPE, V(544), V(542), S(13, 7), .content.string = S(9444, 5)},
+    {ARGO_BASIC_TYPE, V(545), V(543), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(542), V(544), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(551), V(541), S(9449, 11), .content.object = {V(547)}},
+    {ARGO_NO_TYPE, V(548), V(550), {0}},
+    {ARGO_STRING_TYPE, V(549), V(547), S(13, 7), .content.string = S(3854, 5)},
+    {ARGO_BASIC_TYPE, V(550), V(548), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(547), V(549), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(556), V(546), S(9460, 8), .content.object = {V(552)}},
+    {ARGO_NO_TYPE, V(553), V(555), {0}},
+    {ARGO_STRING_TYPE, V(554), V(552), S(13, 7), .content.string = S(9468, 5)},
+    {ARGO_BASIC_TYPE, V(555), V(553), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(552), V(554), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(561), V(551), S(9473, 9), .content.object = {V(557)}},
+    {ARGO_NO_TYPE, V(558), V(560), {0}},
+    {ARGO_STRING_TYPE, V(559), V(557), S(13, 7), .content.string = S(9482, 5)},
+    {ARGO_BASIC_TYPE, V(560), V(558), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(557), V(559), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(566), V(556), S(9487, 4), .content.object = {V(562)}},
+    {ARGO_NO_TYPE, V(563), V(565), {0}},
+    {ARGO_STRING_TYPE, V(564), V(562), S(13, 7), .content.string = S(9491, 5)},
+    {ARGO_BASIC_TYPE, V(565), V(563), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(562), V(564), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(570), V(561), S(3044, 14), .content.object = {V(567)}},
+    {ARGO_NO_TYPE, V(568), V(569), {0}},
+    {ARGO_STRING_TYPE, V(569), V(567), S(13, 7), .content.string = S(9496, 5)},
+    {ARGO_BASIC_TYPE, V(567), V(568), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(578), V(566), S(9501, 12), .content.object = {V(571)}},
+    {ARGO_NO_TYPE, V(572), V(575), {0}},
+    {ARGO_STRING_TYPE, V(573), V(571), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_BASIC_TYPE, V(574), V(572), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(575), V(573), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(571), V(574), S(41, 8), .content.object = {V(576)}},
+    {ARGO_NO_TYPE, V(577), V(577), {0}},
+    {ARGO_STRING_TYPE, V(576), V(576), S(9513, 9), .content.string = S(9522, 6)},
+    {ARGO_OBJECT_TYPE, V(585), V(570), S(9528, 12), .content.object = {V(579)}},
+    {ARGO_NO_TYPE, V(580), V(582), {0}},
+    {ARGO_STRING_TYPE, V(581), V(579), S(13, 7), .content.string = S(9540, 5)},
+    {ARGO_BASIC_TYPE, V(582), V(580), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(579), V(581), S(41, 8), .content.object = {V(583)}},
+    {ARGO_NO_TYPE, V(584), V(584), {0}},
+    {ARGO_STRING_TYPE, V(583), V(583), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_OBJECT_TYPE, V(592), V(578), S(9545, 4), .content.object = {V(586)}},
+    {ARGO_NO_TYPE, V(587), V(589), {0}},
+    {ARGO_STRING_TYPE, V(588), V(586), S(13, 7), .content.string = S(9549, 6)},
+    {ARGO_BASIC_TYPE, V(589), V(587), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(586), V(588), S(41, 8), .content.object = {V(590)}},
+    {ARGO_NO_TYPE, V(591), V(591), {0}},
+    {ARGO_STRING_TYPE, V(590), V(590), S(9555, 4), .content.string = S(9559, 6)},
+    {ARGO_OBJECT_TYPE, V(600), V(585), S(3595, 15), .content.object = {V(593)}},
+    {ARGO_NO_TYPE, V(594), V(596), {0}},
+    {ARGO_STRING_TYPE, V(595), V(593), S(13, 7), .content.string = S(8763, 5)},
+    {ARGO_BASIC_TYPE, V(596), V(594), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(593), V(595), S(41, 8), .content.object = {V(597)}},
+    {ARGO_NO_TYPE, V(598), V(599), {0}},
+    {ARGO_STRING_TYPE, V(599), V(597), S(3044, 14), .content.string = S(9496, 5)},
+    {ARGO_STRING_TYPE, V(597), V(598), S(3718, 10), .content.string = S(3728, 5)},
+    {ARGO_OBJECT_TYPE, V(604), V(592), S(3963, 12), .content.object = {V(601)}},
+    {ARGO_NO_TYPE, V(602), V(603), {0}},
+    {ARGO_STRING_TYPE, V(603), V(601), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(601), V(602), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(609), V(600), S(9565, 8), .content.object = {V(605)}},
+    {ARGO_NO_TYPE, V(606), V(608), {0}},
+    {ARGO_STRING_TYPE, V(607), V(605), S(13, 7), .content.string = S(9573, 6)},
+    {ARGO_BASIC_TYPE, V(608), V(606), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(605), V(607), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(614), V(604), S(4792, 2), .content.object = {V(610)}},
+    {ARGO_NO_TYPE, V(611), V(613), {0}},
+    {ARGO_STRING_TYPE, V(612), V(610), S(13, 7), .content.string = S(4794, 5)},
+    {ARGO_BASIC_TYPE, V(613), V(611), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(610), V(612), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(618), V(609), S(9579, 13), .content.object = {V(615)}},
+    {ARGO_NO_TYPE, V(616), V(617), {0}},
+    {ARGO_STRING_TYPE, V(617), V(615), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_BASIC_TYPE, V(615), V(616), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(625), V(614), S(9592, 15), .content.object = {V(619)}},
+    {ARGO_NO_TYPE, V(620), V(622), {0}},
+    {ARGO_STRING_TYPE, V(621), V(619), S(13, 7), .content.string = S(4278, 5)},
+    {ARGO_BASIC_TYPE, V(622), V(620), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(619), V(621), S(41, 8), .content.object = {V(623)}},
+    {ARGO_NO_TYPE, V(624), V(624), {0}},
+    {ARGO_STRING_TYPE, V(623), V(623), S(9607, 14), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(629), V(618), S(3718, 10), .content.object = {V(626)}},
+    {ARGO_NO_TYPE, V(627), V(628), {0}},
+    {ARGO_STRING_TYPE, V(628), V(626), S(13, 7), .content.string = S(3728, 5)},
+    {ARGO_BASIC_TYPE, V(626), V(627), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(633), V(625), S(9621, 23), .content.object = {V(630)}},
+    {ARGO_NO_TYPE, V(631), V(632), {0}},
+    {ARGO_STRING_TYPE, V(632), V(630), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_BASIC_TYPE, V(630), V(631), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(637), V(629), S(6124, 12), .content.object = {V(634)}},
+    {ARGO_NO_TYPE, V(635), V(636), {0}},
+    {ARGO_STRING_TYPE, V(636), V(634), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(634), V(635), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(644), V(633), S(9644, 9), .content.object = {V(638)}},
+    {ARGO_NO_TYPE, V(639), V(641), {0}},
+    {ARGO_STRING_TYPE, V(640), V(638), S(13, 7), .content.string = S(9653, 5)},
+    {ARGO_BASIC_TYPE, V(641), V(639), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(638), V(640), S(41, 8), .content.object = {V(642)}},
+    {ARGO_NO_TYPE, V(643), V(643), {0}},
+    {ARGO_STRING_TYPE, V(642), V(642), S(9545, 4), .content.string = S(9549, 6)},
+    {ARGO_OBJECT_TYPE, V(659), V(637), S(9658, 8), .content.object = {V(645)}},
+    {ARGO_NO_TYPE, V(646), V(652), {0}},
+    {ARGO_STRING_TYPE, V(647), V(645), S(13, 7), .content.string = S(9666, 6)},
+    {ARGO_BASIC_TYPE, V(648), V(646), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(649), V(647), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(652), V(648), S(41, 8), .content.object = {V(650)}},
+    {ARGO_NO_TYPE, V(651), V(651), {0}},
+    {ARGO_STRING_TYPE, V(650), V(650), S(9449, 11), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(645), V(649), S(49, 12), .content.object = {V(653)}},
+    {ARGO_NO_TYPE, V(654), V(654), {0}},
+    {ARGO_OBJECT_TYPE, V(653), V(653), S(9449, 11), .content.object = {V(655)}},
+    {ARGO_NO_TYPE, V(656), V(658), {0}},
+    {ARGO_STRING_TYPE, V(657), V(655), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(658), V(656), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(655), V(657), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(667), V(644), S(6489, 5), .content.object = {V(660)}},
+    {ARGO_NO_TYPE, V(661), V(664), {0}},
+    {ARGO_STRING_TYPE, V(662), V(660), S(13, 7), .content.string = S(9672, 5)},
+    {ARGO_BASIC_TYPE, V(663), V(661), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(664), V(662), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(660), V(663), S(41, 8), .content.object = {V(665)}},
+    {ARGO_NO_TYPE, V(666), V(666), {0}},
+    {ARGO_STRING_TYPE, V(665), V(665), S(6644, 2), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(672), V(659), S(9677, 11), .content.object = {V(668)}},
+    {ARGO_NO_TYPE, V(669), V(671), {0}},
+    {ARGO_STRING_TYPE, V(670), V(668), S(13, 7), .content.string = S(9496, 5)},
+    {ARGO_BASIC_TYPE, V(671), V(669), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(668), V(670), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(676), V(667), S(9607, 14), .content.object = {V(673)}},
+    {ARGO_NO_TYPE, V(674), V(675), {0}},
+    {ARGO_STRING_TYPE, V(675), V(673), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(673), V(674), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(681), V(672), S(6749, 9), .content.object = {V(677)}},
+    {ARGO_NO_TYPE, V(678), V(680), {0}},
+    {ARGO_STRING_TYPE, V(679), V(677), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(680), V(678), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(677), V(679), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(686), V(676), S(9688, 11), .content.object = {V(682)}},
+    {ARGO_NO_TYPE, V(683), V(685), {0}},
+    {ARGO_STRING_TYPE, V(684), V(682), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(685), V(683), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(682), V(684), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(694), V(681), S(9699, 8), .content.object = {V(687)}},
+    {ARGO_NO_TYPE, V(688), V(691), {0}},
+    {ARGO_STRING_TYPE, V(689), V(687), S(13, 7), .content.string = S(8023, 5)},
+    {ARGO_BASIC_TYPE, V(690), V(688), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(691), V(689), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(687), V(690), S(41, 8), .content.object = {V(692)}},
+    {ARGO_NO_TYPE, V(693), V(693), {0}},
+    {ARGO_STRING_TYPE, V(692), V(692), S(9707, 4), .content.string = S(8023, 5)},
+    {ARGO_OBJECT_TYPE, V(699), V(686), S(8140, 6), .content.object = {V(695)}},
+    {ARGO_NO_TYPE, V(696), V(698), {0}},
+    {ARGO_STRING_TYPE, V(697), V(695), S(13, 7), .content.string = S(4301, 5)},
+    {ARGO_BASIC_TYPE, V(698), V(696), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(695), V(697), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(703), V(694), S(9711, 10), .content.object = {V(700)}},
+    {ARGO_NO_TYPE, V(701), V(702), {0}},
+    {ARGO_STRING_TYPE, V(702), V(700), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(700), V(701), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(708), V(699), S(9721, 13), .content.object = {V(704)}},
+    {ARGO_NO_TYPE, V(705), V(707), {0}},
+    {ARGO_STRING_TYPE, V(706), V(704), S(13, 7), .content.string = S(1067, 5)},
+    {ARGO_BASIC_TYPE, V(707), V(705), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(704), V(706), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(718), V(703), S(9734, 9), .content.object = {V(709)}},
+    {ARGO_NO_TYPE, V(710), V(713), {0}},
+    {ARGO_STRING_TYPE, V(711), V(709), S(13, 7), .content.string = S(2631, 5)},
+    {ARGO_BASIC_TYPE, V(712), V(710), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(713), V(711), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(709), V(712), S(41, 8), .content.object = {V(714)}},
+    {ARGO_NO_TYPE, V(715), V(717), {0}},
+    {ARGO_STRING_TYPE, V(716), V(714), S(9460, 8), .content.string = S(9468, 5)},
+    {ARGO_STRING_TYPE, V(717), V(715), S(9592, 15), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(714), V(716), S(1041, 10), .content.string = S(9743, 6)},
+    {ARGO_OBJECT_TYPE, V(722), V(708), S(9059, 11), .content.object = {V(719)}},
+    {ARGO_NO_TYPE, V(720), V(721), {0}},
+    {ARGO_STRING_TYPE, V(721), V(719), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(719), V(720), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(732), V(718), S(9749, 7), .content.object = {V(723)}},
+    {ARGO_NO_TYPE, V(724), V(726), {0}},
+    {ARGO_STRING_TYPE, V(725), V(723), S(13, 7), .content.string = S(8436, 6)},
+    {ARGO_BASIC_TYPE, V(726), V(724), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(723), V(725), S(41, 8), .content.object = {V(727)}},
+    {ARGO_NO_TYPE, V(728), V(731), {0}},
+    {ARGO_STRING_TYPE, V(729), V(727), S(9756, 11), .content.string = S(9767, 6)},
+    {ARGO_STRING_TYPE, V(730), V(728), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(731), V(729), S(9773, 6), .content.string = S(9779, 5)},
+    {ARGO_STRING_TYPE, V(727), V(730), S(9784, 6), .content.string = S(9790, 5)},
+    {ARGO_OBJECT_TYPE, V(742), V(722), S(9795, 14), .content.object = {V(733)}},
+    {ARGO_NO_TYPE, V(734), V(737), {0}},
+    {ARGO_STRING_TYPE, V(735), V(733), S(13, 7), .content.string = S(4278, 5)},
+    {ARGO_BASIC_TYPE, V(736), V(734), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(737), V(735), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(733), V(736), S(41, 8), .content.object = {V(738)}},
+    {ARGO_NO_TYPE, V(739), V(741), {0}},
+    {ARGO_STRING_TYPE, V(740), V(738), S(9749, 7), .content.string = S(8436, 6)},
+    {ARGO_STRING_TYPE, V(741), V(739), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(738), V(740), S(9809, 9), .content.string = S(9818, 5)},
+    {ARGO_OBJECT_TYPE, V(757), V(732), S(9823, 5), .content.object = {V(743)}},
+    {ARGO_NO_TYPE, V(744), V(747), {0}},
+    {ARGO_STRING_TYPE, V(745), V(743), S(13, 7), .content.string = S(9828, 5)},
+    {ARGO_BASIC_TYPE, V(746), V(744), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(747), V(745), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(743), V(746), S(41, 8), .content.object = {V(748)}},
+    {ARGO_NO_TYPE, V(749), V(756), {0}},
+    {ARGO_STRING_TYPE, V(750), V(748), S(9393, 6), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(751), V(749), S(9621, 23), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(752), V(750), S(9833, 11), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(753), V(751), S(9844, 13), .content.string = S(9857, 5)},
+    {ARGO_STRING_TYPE, V(754), V(752), S(9862, 11), .content.string = S(9873, 5)},
+    {ARGO_STRING_TYPE, V(755), V(753), S(9878, 12), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(756), V(754), S(4291, 10), .content.string = S(4301, 5)},
+    {ARGO_STRING_TYPE, V(748), V(755), S(9890, 10), .content.string = S(1934, 5)},
+    {ARGO_OBJECT_TYPE, V(772), V(742), S(9900, 7), .content.object = {V(758)}},
+    {ARGO_NO_TYPE, V(759), V(765), {0}},
+    {ARGO_STRING_TYPE, V(760), V(758), S(13, 7), .content.string = S(9907, 5)},
+    {ARGO_BASIC_TYPE, V(761), V(759), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(762), V(760), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(765), V(761), S(41, 8), .content.object = {V(763)}},
+    {ARGO_NO_TYPE, V(764), V(764), {0}},
+    {ARGO_STRING_TYPE, V(763), V(763), S(9449, 11), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(758), V(762), S(49, 12), .content.object = {V(766)}},
+    {ARGO_NO_TYPE, V(767), V(767), {0}},
+    {ARGO_OBJECT_TYPE, V(766), V(766), S(9449, 11), .content.object = {V(768)}},
+    {ARGO_NO_TYPE, V(769), V(771), {0}},
+    {ARGO_STRING_TYPE, V(770), V(768), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(771), V(769), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(768), V(770), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(784), V(757), S(9912, 4), .content.object = {V(773)}},
+    {ARGO_NO_TYPE, V(774), V(776), {0}},
+    {ARGO_STRING_TYPE, V(775), V(773), S(13, 7), .content.string = S(9916, 5)},
+    {ARGO_BASIC_TYPE, V(776), V(774), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(773), V(775), S(41, 8), .content.object = {V(777)}},
+    {ARGO_NO_TYPE, V(778), V(783), {0}},
+    {ARGO_STRING_TYPE, V(779), V(777), S(9059, 11), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(780), V(778), S(9921, 8), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(781), V(779), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(782), V(780), S(9809, 9), .content.string = S(9818, 5)},
+    {ARGO_STRING_TYPE, V(783), V(781), S(9929, 4), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(777), V(782), S(4568, 16), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(788), V(772), S(9756, 11), .content.object = {V(785)}},
+    {ARGO_NO_TYPE, V(786), V(787), {0}},
+    {ARGO_STRING_TYPE, V(787), V(785), S(13, 7), .content.string = S(9767, 6)},
+    {ARGO_BASIC_TYPE, V(785), V(786), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(793), V(784), S(9938, 10), .content.object = {V(789)}},
+    {ARGO_NO_TYPE, V(790), V(792), {0}},
+    {ARGO_STRING_TYPE, V(791), V(789), S(13, 7), .content.string = S(4278, 5)},
+    {ARGO_BASIC_TYPE, V(792), V(790), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(789), V(791), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(802), V(788), S(9948, 13), .content.object = {V(794)}},
+    {ARGO_NO_TYPE, V(795), V(798), {0}},
+    {ARGO_STRING_TYPE, V(796), V(794), S(13, 7), .content.string = S(9961, 5)},
+    {ARGO_BASIC_TYPE, V(797), V(795), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(798), V(796), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(794), V(797), S(41, 8), .content.object = {V(799)}},
+    {ARGO_NO_TYPE, V(800), V(801), {0}},
+    {ARGO_STRING_TYPE, V(801), V(799), S(9363, 3), .content.string = S(9366, 6)},
+    {ARGO_STRING_TYPE, V(799), V(800), S(9938, 10), .content.string = S(4278, 5)},
+    {ARGO_OBJECT_TYPE, V(807), V(793), S(9833, 11), .content.object = {V(803)}},
+    {ARGO_NO_TYPE, V(804), V(806), {0}},
+    {ARGO_STRING_TYPE, V(805), V(803), S(13, 7), .content.string = S(4563, 5)},
+    {ARGO_BASIC_TYPE, V(806), V(804), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(803), V(805), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(817), V(802), S(9966, 4), .content.object = {V(808)}},
+    {ARGO_NO_TYPE, V(809), V(811), {0}},
+    {ARGO_STRING_TYPE, V(810), V(808), S(13, 7), .content.string = S(9970, 5)},
+    {ARGO_BASIC_TYPE, V(811), V(809), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(808), V(810), S(41, 8), .content.object = {V(812)}},
+    {ARGO_NO_TYPE, V(813), V(816), {0}},
+    {ARGO_STRING_TYPE, V(814), V(812), S(9545, 4), .content.string = S(9549, 6)},
+    {ARGO_STRING_TYPE, V(815), V(813), S(9644, 9), .content.string = S(9653, 5)},
+    {ARGO_STRING_TYPE, V(816), V(814), S(9555, 4), .content.string = S(9559, 6)},
+    {ARGO_STRING_TYPE, V(812), V(815), S(9975, 4), .content.string = S(2040, 5)},
+    {ARGO_OBJECT_TYPE, V(821), V(807), S(9555, 4), .content.object = {V(818)}},
+    {ARGO_NO_TYPE, V(819), V(820), {0}},
+    {ARGO_STRING_TYPE, V(820), V(818), S(13, 7), .content.string = S(9559, 6)},
+    {ARGO_BASIC_TYPE, V(818), V(819), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(831), V(817), S(9979, 14), .content.object = {V(822)}},
+    {ARGO_NO_TYPE, V(823), V(826), {0}},
+    {ARGO_STRING_TYPE, V(824), V(822), S(13, 7), .content.string = S(5910, 5)},
+    {ARGO_BASIC_TYPE, V(825), V(823), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(826), V(824), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(822), V(825), S(41, 8), .content.object = {V(827)}},
+    {ARGO_NO_TYPE, V(828), V(830), {0}},
+    {ARGO_STRING_TYPE, V(829), V(827), S(9449, 11), .content.string = S(3854, 5)},
+    {ARGO_STRING_TYPE, V(830), V(828), S(9993, 6), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(827), V(829), S(9999, 5), .content.string = S(10004, 6)},
+    {ARGO_OBJECT_TYPE, V(839), V(821), S(9921, 8), .content.object = {V(832)}},
+    {ARGO_NO_TYPE, V(833), V(835), {0}},
+    {ARGO_STRING_TYPE, V(834), V(832), S(13, 7), .content.string = S(72, 5)},
+    {ARGO_BASIC_TYPE, V(835), V(833), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(832), V(834), S(41, 8), .content.object = {V(836)}},
+    {ARGO_NO_TYPE, V(837), V(838), {0}},
+    {ARGO_STRING_TYPE, V(838), V(836), S(9929, 4), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(836), V(837), S(10010, 6), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(843), V(831), S(4529, 8), .content.object = {V(840)}},
+    {ARGO_NO_TYPE, V(841), V(842), {0}},
+    {ARGO_STRING_TYPE, V(842), V(840), S(13, 7), .content.string = S(4537, 5)},
+    {ARGO_BASIC_TYPE, V(840), V(841), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(848), V(839), S(10016, 3), .content.object = {V(844)}},
+    {ARGO_NO_TYPE, V(845), V(847), {0}},
+    {ARGO_STRING_TYPE, V(846), V(844), S(13, 7), .content.string = S(949, 5)},
+    {ARGO_BASIC_TYPE, V(847), V(845), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(844), V(846), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(855), V(843), S(10019, 23), .content.object = {V(849)}},
+    {ARGO_NO_TYPE, V(850), V(852), {0}},
+    {ARGO_STRING_TYPE, V(851), V(849), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(852), V(850), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(849), V(851), S(41, 8), .content.object = {V(853)}},
+    {ARGO_NO_TYPE, V(854), V(854), {0}},
+    {ARGO_STRING_TYPE, V(853), V(853), S(10042, 13), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(860), V(848), S(10055, 13), .content.object = {V(856)}},
+    {ARGO_NO_TYPE, V(857), V(859), {0}},
+    {ARGO_STRING_TYPE, V(858), V(856), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(859), V(857), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(856), V(858), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(864), V(855), S(10068, 7), .content.object = {V(861)}},
+    {ARGO_NO_TYPE, V(862), V(863), {0}},
+    {ARGO_STRING_TYPE, V(863), V(861), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(861), V(862), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(869), V(860), S(10075, 8), .content.object = {V(865)}},
+    {ARGO_NO_TYPE, V(866), V(868), {0}},
+    {ARGO_STRING_TYPE, V(867), V(865), S(13, 7), .content.string = S(1170, 5)},
+    {ARGO_BASIC_TYPE, V(868), V(866), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(865), V(867), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(877), V(864), S(10083, 10), .content.object = {V(870)}},
+    {ARGO_NO_TYPE, V(871), V(874), {0}},
+    {ARGO_STRING_TYPE, V(872), V(870), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(873), V(871), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(874), V(872), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(870), V(873), S(41, 8), .content.object = {V(875)}},
+    {ARGO_NO_TYPE, V(876), V(876), {0}},
+    {ARGO_STRING_TYPE, V(875), V(875), S(9707, 4), .content.string = S(8023, 5)},
+    {ARGO_OBJECT_TYPE, V(882), V(869), S(9707, 4), .content.object = {V(878)}},
+    {ARGO_NO_TYPE, V(879), V(881), {0}},
+    {ARGO_STRING_TYPE, V(880), V(878), S(13, 7), .content.string = S(8023, 5)},
+    {ARGO_BASIC_TYPE, V(881), V(879), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(878), V(880), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(887), V(877), S(10093, 11), .content.object = {V(883)}},
+    {ARGO_NO_TYPE, V(884), V(886), {0}},
+    {ARGO_STRING_TYPE, V(885), V(883), S(13, 7), .content.string = S(9444, 5)},
+    {ARGO_BASIC_TYPE, V(886), V(884), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(883), V(885), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(895), V(882), S(9372, 21), .content.object = {V(888)}},
+    {ARGO_NO_TYPE, V(889), V(892), {0}},
+    {ARGO_STRING_TYPE, V(890), V(888), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_BASIC_TYPE, V(891), V(889), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(892), V(890), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(888), V(891), S(41, 8), .content.object = {V(893)}},
+    {ARGO_NO_TYPE, V(894), V(894), {0}},
+    {ARGO_STRING_TYPE, V(893), V(893), S(10104, 7), .content.string = S(10111, 5)},
+    {ARGO_OBJECT_TYPE, V(900), V(887), S(10116, 19), .content.object = {V(896)}},
+    {ARGO_NO_TYPE, V(897), V(899), {0}},
+    {ARGO_STRING_TYPE, V(898), V(896), S(13, 7), .content.string = S(10135, 5)},
+    {ARGO_BASIC_TYPE, V(899), V(897), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(896), V(898), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(905), V(895), S(10104, 7), .content.object = {V(901)}},
+    {ARGO_NO_TYPE, V(902), V(904), {0}},
+    {ARGO_STRING_TYPE, V(903), V(901), S(13, 7), .content.string = S(10111, 5)},
+    {ARGO_BASIC_TYPE, V(904), V(902), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(901), V(903), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(923), V(900), S(9993, 6), .content.object = {V(906)}},
+    {ARGO_NO_TYPE, V(907), V(916), {0}},
+    {ARGO_STRING_TYPE, V(908), V(906), S(13, 7), .content.string = S(9933, 5)},
+    {ARGO_BASIC_TYPE, V(909), V(907), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(910), V(908), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(916), V(909), S(41, 8), .content.object = {V(911)}},
+    {ARGO_NO_TYPE, V(912), V(915), {0}},
+    {ARGO_STRING_TYPE, V(913), V(911), S(9449, 11), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(914), V(912), S(9711, 10), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(915), V(913), S(10093, 11), .content.string = S(9444, 5)},
+    {ARGO_STRING_TYPE, V(911), V(914), S(10140, 6), .content.string = S(10146, 5)},
+    {ARGO_OBJECT_TYPE, V(906), V(910), S(49, 12), .content.object = {V(917)}},
+    {ARGO_NO_TYPE, V(918), V(918), {0}},
+    {ARGO_OBJECT_TYPE, V(917), V(917), S(9449, 11), .content.object = {V(919)}},
+    {ARGO_NO_TYPE, V(920), V(922), {0}},
+    {ARGO_STRING_TYPE, V(921), V(919), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(922), V(920), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(919), V(921), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(927), V(905), S(10151, 7), .content.object = {V(924)}},
+    {ARGO_NO_TYPE, V(925), V(926), {0}},
+    {ARGO_STRING_TYPE, V(926), V(924), S(13, 7), .content.string = S(10158, 6)},
+    {ARGO_BASIC_TYPE, V(924), V(925), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(934), V(923), S(1041, 10), .content.object = {V(928)}},
+    {ARGO_NO_TYPE, V(929), V(931), {0}},
+    {ARGO_STRING_TYPE, V(930), V(928), S(13, 7), .content.string = S(9743, 6)},
+    {ARGO_BASIC_TYPE, V(931), V(929), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(928), V(930), S(41, 8), .content.object = {V(932)}},
+    {ARGO_NO_TYPE, V(933), V(933), {0}},
+    {ARGO_STRING_TYPE, V(932), V(932), S(10151, 7), .content.string = S(10158, 6)},
+    {ARGO_OBJECT_TYPE, V(941), V(927), S(9809, 9), .content.object = {V(935)}},
+    {ARGO_NO_TYPE, V(936), V(938), {0}},
+    {ARGO_STRING_TYPE, V(937), V(935), S(13, 7), .content.string = S(9818, 5)},
+    {ARGO_BASIC_TYPE, V(938), V(936), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(935), V(937), S(41, 8), .content.object = {V(939)}},
+    {ARGO_NO_TYPE, V(940), V(940), {0}},
+    {ARGO_STRING_TYPE, V(939), V(939), S(3595, 15), .content.string = S(8763, 5)},
+    {ARGO_OBJECT_TYPE, V(945), V(934), S(10164, 8), .content.object = {V(942)}},
+    {ARGO_NO_TYPE, V(943), V(944), {0}},
+    {ARGO_STRING_TYPE, V(944), V(942), S(13, 7), .content.string = S(10172, 5)},
+    {ARGO_BASIC_TYPE, V(942), V(943), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(952), V(941), S(9773, 6), .content.object = {V(946)}},
+    {ARGO_NO_TYPE, V(947), V(949), {0}},
+    {ARGO_STRING_TYPE, V(948), V(946), S(13, 7), .content.string = S(9779, 5)},
+    {ARGO_BASIC_TYPE, V(949), V(947), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(946), V(948), S(41, 8), .content.object = {V(950)}},
+    {ARGO_NO_TYPE, V(951), V(951), {0}},
+    {ARGO_STRING_TYPE, V(950), V(950), S(10164, 8), .content.string = S(10172, 5)},
+    {ARGO_OBJECT_TYPE, V(957), V(945), S(6644, 2), .content.object = {V(953)}},
+    {ARGO_NO_TYPE, V(954), V(956), {0}},
+    {ARGO_STRING_TYPE, V(955), V(953), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_BASIC_TYPE, V(956), V(954), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(953), V(955), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(975), V(952), S(9332, 12), .content.object = {V(958)}},
+    {ARGO_NO_TYPE, V(959), V(962), {0}},
+    {ARGO_STRING_TYPE, V(960), V(958), S(13, 7), .content.string = S(9344, 6)},
+    {ARGO_BASIC_TYPE, V(961), V(959), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(962), V(960), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(958), V(961), S(41, 8), .content.object = {V(963)}},
+    {ARGO_NO_TYPE, V(964), V(974), {0}},
+    {ARGO_STRING_TYPE, V(965), V(963), S(9688, 11), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(966), V(964), S(9966, 4), .content.string = S(9970, 5)},
+    {ARGO_STRING_TYPE, V(967), V(965), S(9773, 6), .content.string = S(9779, 5)},
+    {ARGO_STRING_TYPE, V(968), V(966), S(10177, 4), .content.string = S(10181, 5)},
+    {ARGO_STRING_TYPE, V(969), V(967), S(10186, 6), .content.string = S(10192, 5)},
+    {ARGO_STRING_TYPE, V(970), V(968), S(10197, 2), .content.string = S(1806, 5)},
+    {ARGO_STRING_TYPE, V(971), V(969), S(10199, 7), .content.string = S(10206, 6)},
+    {ARGO_STRING_TYPE, V(972), V(970), S(9784, 6), .content.string = S(9790, 5)},
+    {ARGO_STRING_TYPE, V(973), V(971), S(3021, 6), .content.string = S(10212, 5)},
+    {ARGO_STRING_TYPE, V(974), V(972), S(10217, 3), .content.string = S(1389, 5)},
+    {ARGO_STRING_TYPE, V(963), V(973), S(10220, 8), .content.string = S(10228, 5)},
+    {ARGO_OBJECT_TYPE, V(984), V(957), S(10177, 4), .content.object = {V(976)}},
+    {ARGO_NO_TYPE, V(977), V(980), {0}},
+    {ARGO_STRING_TYPE, V(978), V(976), S(13, 7), .content.string = S(10181, 5)},
+    {ARGO_BASIC_TYPE, V(979), V(977), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(980), V(978), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(976), V(979), S(41, 8), .content.object = {V(981)}},
+    {ARGO_NO_TYPE, V(982), V(983), {0}},
+    {ARGO_STRING_TYPE, V(983), V(981), S(9350, 6), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(981), V(982), S(10233, 5), .content.string = S(10238, 5)},
+    {ARGO_OBJECT_TYPE, V(995), V(975), S(10186, 6), .content.object = {V(985)}},
+    {ARGO_NO_TYPE, V(986), V(989), {0}},
+    {ARGO_STRING_TYPE, V(987), V(985), S(13, 7), .content.string = S(10192, 5)},
+    {ARGO_BASIC_TYPE, V(988), V(986), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(989), V(987), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(985), V(988), S(41, 8), .content.object = {V(990)}},
+    {ARGO_NO_TYPE, V(991), V(994), {0}},
+    {ARGO_STRING_TYPE, V(992), V(990), S(9399, 16), .content.string = S(9415, 5)},
+    {ARGO_STRING_TYPE, V(993), V(991), S(9621, 23), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(994), V(992), S(9823, 5), .content.string = S(9828, 5)},
+    {ARGO_STRING_TYPE, V(990), V(993), S(10243, 12), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(999), V(984), S(10042, 13), .content.object = {V(996)}},
+    {ARGO_NO_TYPE, V(997), V(998), {0}},
+    {ARGO_STRING_TYPE, V(998), V(996), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_BASIC_TYPE, V(996), V(997), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1004), V(995), S(10255, 10), .content.object = {V(1000)}},
+    {ARGO_NO_TYPE, V(1001), V(1003), {0}},
+    {ARGO_STRING_TYPE, V(1002), V(1000), S(13, 7), .content.string = S(10265, 5)},
+    {ARGO_BASIC_TYPE, V(1003), V(1001), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1000), V(1002), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1009), V(999), S(9844, 13), .content.object = {V(1005)}},
+    {ARGO_NO_TYPE, V(1006), V(1008), {0}},
+    {ARGO_STRING_TYPE, V(1007), V(1005), S(13, 7), .content.string = S(9857, 5)},
+    {ARGO_BASIC_TYPE, V(1008), V(1006), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1005), V(1007), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1016), V(1004), S(9929, 4), .content.object = {V(1010)}},
+    {ARGO_NO_TYPE, V(1011), V(1013), {0}},
+    {ARGO_STRING_TYPE, V(1012), V(1010), S(13, 7), .content.string = S(9933, 5)},
+    {ARGO_BASIC_TYPE, V(1013), V(1011), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1010), V(1012), S(41, 8), .content.object = {V(1014)}},
+    {ARGO_NO_TYPE, V(1015), V(1015), {0}},
+    {ARGO_STRING_TYPE, V(1014), V(1014), S(10010, 6), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(1021), V(1009), S(10270, 10), .content.object = {V(1017)}},
+    {ARGO_NO_TYPE, V(1018), V(1020), {0}},
+    {ARGO_STRING_TYPE, V(1019), V(1017), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(1020), V(1018), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1017), V(1019), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1026), V(1016), S(10280, 9), .content.object = {V(1022)}},
+    {ARGO_NO_TYPE, V(1023), V(1025), {0}},
+    {ARGO_STRING_TYPE, V(1024), V(1022), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(1025), V(1023), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1022), V(1024), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1035), V(1021), S(10233, 5), .content.object = {V(1027)}},
+    {ARGO_NO_TYPE, V(1028), V(1031), {0}},
+    {ARGO_STRING_TYPE, V(1029), V(1027), S(13, 7), .content.string = S(10238, 5)},
+    {ARGO_BASIC_TYPE, V(1030), V(1028), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1031), V(1029), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1027), V(1030), S(41, 8), .content.object = {V(1032)}},
+    {ARGO_NO_TYPE, V(1033), V(1034), {0}},
+    {ARGO_STRING_TYPE, V(1034), V(1032), S(10270, 10), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(1032), V(1033), S(10280, 9), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(1039), V(1026), S(4568, 16), .content.object = {V(1036)}},
+    {ARGO_NO_TYPE, V(1037), V(1038), {0}},
+    {ARGO_STRING_TYPE, V(1038), V(1036), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_BASIC_TYPE, V(1036), V(1037), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1044), V(1035), S(10289, 15), .content.object = {V(1040)}},
+    {ARGO_NO_TYPE, V(1041), V(1043), {0}},
+    {ARGO_STRING_TYPE, V(1042), V(1040), S(13, 7), .content.string = S(3854, 5)},
+    {ARGO_BASIC_TYPE, V(1043), V(1041), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1040), V(1042), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1048), V(1039), S(10304, 20), .content.object = {V(1045)}},
+    {ARGO_NO_TYPE, V(1046), V(1047), {0}},
+    {ARGO_STRING_TYPE, V(1047), V(1045), S(13, 7), .content.string = S(10324, 5)},
+    {ARGO_BASIC_TYPE, V(1045), V(1046), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1053), V(1044), S(10329, 8), .content.object = {V(1049)}},
+    {ARGO_NO_TYPE, V(1050), V(1052), {0}},
+    {ARGO_STRING_TYPE, V(1051), V(1049), S(13, 7), .content.string = S(10337, 5)},
+    {ARGO_BASIC_TYPE, V(1052), V(1050), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1049), V(1051), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1058), V(1048), S(4984, 2), .content.object = {V(1054)}},
+    {ARGO_NO_TYPE, V(1055), V(1057), {0}},
+    {ARGO_STRING_TYPE, V(1056), V(1054), S(13, 7), .content.string = S(10342, 5)},
+    {ARGO_BASIC_TYPE, V(1057), V(1055), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1054), V(1056), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1076), V(1053), S(10197, 2), .content.object = {V(1059)}},
+    {ARGO_NO_TYPE, V(1060), V(1069), {0}},
+    {ARGO_STRING_TYPE, V(1061), V(1059), S(13, 7), .content.string = S(1806, 5)},
+    {ARGO_BASIC_TYPE, V(1062), V(1060), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1063), V(1061), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1069), V(1062), S(41, 8), .content.object = {V(1064)}},
+    {ARGO_NO_TYPE, V(1065), V(1068), {0}},
+    {ARGO_STRING_TYPE, V(1066), V(1064), S(9677, 11), .content.string = S(9496, 5)},
+    {ARGO_STRING_TYPE, V(1067), V(1065), S(10016, 3), .content.string = S(949, 5)},
+    {ARGO_STRING_TYPE, V(1068), V(1066), S(10164, 8), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(1064), V(1067), S(10347, 19), .content.string = S(4563, 5)},
+    {ARGO_OBJECT_TYPE, V(1059), V(1063), S(49, 12), .content.object = {V(1070)}},
+    {ARGO_NO_TYPE, V(1071), V(1071), {0}},
+    {ARGO_OBJECT_TYPE, V(1070), V(1070), S(10164, 8), .content.object = {V(1072)}},
+    {ARGO_NO_TYPE, V(1073), V(1075), {0}},
+    {ARGO_STRING_TYPE, V(1074), V(1072), S(13, 7), .content.string = S(3039, 5)},
+    {ARGO_BASIC_TYPE, V(1075), V(1073), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1072), V(1074), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1089), V(1058), S(9420, 15), .content.object = {V(1077)}},
+    {ARGO_NO_TYPE, V(1078), V(1080), {0}},
+    {ARGO_STRING_TYPE, V(1079), V(1077), S(13, 7), .content.string = S(9435, 5)},
+    {ARGO_BASIC_TYPE, V(1080), V(1078), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1077), V(1079), S(41, 8), .content.object = {V(1081)}},
+    {ARGO_NO_TYPE, V(1082), V(1088), {0}},
+    {ARGO_STRING_TYPE, V(1083), V(1081), S(3963, 12), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1084), V(1082), S(6124, 12), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(1085), V(1083), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(1086), V(1084), S(10068, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1087), V(1085), S(10304, 20), .content.string = S(10324, 5)},
+    {ARGO_STRING_TYPE, V(1088), V(1086), S(10366, 14), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(1081), V(1087), S(10380, 14), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(1118), V(1076), S(10199, 7), .content.object = {V(1090)}},
+    {ARGO_NO_TYPE, V(1091), V(1094), {0}},
+    {ARGO_STRING_TYPE, V(1092), V(1090), S(13, 7), .content.string = S(10206, 6)},
+    {ARGO_BASIC_TYPE, V(1093), V(1091), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1094), V(1092), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1090), V(1093), S(41, 8), .content.object = {V(1095)}},
+    {ARGO_NO_TYPE, V(1096), V(1117), {0}},
+    {ARGO_STRING_TYPE, V(1097), V(1095), S(9473, 9), .content.string = S(9482, 5)},
+    {ARGO_STRING_TYPE, V(1098), V(1096), S(9487, 4), .content.string = S(9491, 5)},
+    {ARGO_STRING_TYPE, V(1099), V(1097), S(9565, 8), .content.string = S(9573, 6)},
+    {ARGO_STRING_TYPE, V(1100), V(1098), S(9592, 15), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(1101), V(1099), S(8140, 6), .content.string = S(4301, 5)},
+    {ARGO_STRING_TYPE, V(1102), V(1100), S(9721, 13), .content.string = S(1067, 5)},
+    {ARGO_STRING_TYPE, V(1103), V(1101), S(9734, 9), .content.string = S(2631, 5)},
+    {ARGO_STRING_TYPE, V(1104), V(1102), S(9948, 13), .content.string = S(9961, 5)},
+    {ARGO_STRING_TYPE, V(1105), V(1103), S(9966, 4), .content.string = S(9970, 5)},
+    {ARGO_STRING_TYPE, V(1106), V(1104), S(9979, 14), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(1107), V(1105), S(10055, 13), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1108), V(1106), S(10075, 8), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(1109), V(1107), S(10116, 19), .content.string = S(10135, 5)},
+    {ARGO_STRING_TYPE, V(1110), V(1108), S(1041, 10), .content.string = S(9743, 6)},
+    {ARGO_STRING_TYPE, V(1111), V(1109), S(10255, 10), .content.string = S(10265, 5)},
+    {ARGO_STRING_TYPE, V(1112), V(1110), S(10289, 15), .content.string = S(3854, 5)},
+    {ARGO_STRING_TYPE, V(1113), V(1111), S(4984, 2), .content.string = S(10342, 5)},
+    {ARGO_STRING_TYPE, V(1114), V(1112), S(10394, 11), .content.string = S(10135, 5)},
+    {ARGO_STRING_TYPE, V(1115), V(1113), S(10405, 12), .content.string = S(10417, 5)},
+    {ARGO_STRING_TYPE, V(1116), V(1114), S(10422, 12), .content.string = S(4999, 5)},
+    {ARGO_STRING_TYPE, V(1117), V(1115), S(10434, 12), .content.string = S(9482, 5)},
+    {ARGO_STRING_TYPE, V(1095), V(1116), S(10446, 4), .content.string = S(4301, 5)},
+    {ARGO_OBJECT_TYPE, V(1125), V(1089), S(9784, 6), .content.object = {V(1119)}},
+    {ARGO_NO_TYPE, V(1120), V(1122), {0}},
+    {ARGO_STRING_TYPE, V(1121), V(1119), S(13, 7), .content.string = S(9790, 5)},
+    {ARGO_BASIC_TYPE, V(1122), V(1120), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1119), V(1121), S(41, 8), .content.object = {V(1123)}},
+    {ARGO_NO_TYPE, V(1124), V(1124), {0}},
+    {ARGO_STRING_TYPE, V(1123), V(1123), S(9912, 4), .content.string = S(9916, 5)},
+    {ARGO_OBJECT_TYPE, V(1129), V(1118), S(10394, 11), .content.object = {V(1126)}},
+    {ARGO_NO_TYPE, V(1127), V(1128), {0}},
+    {ARGO_STRING_TYPE, V(1128), V(1126), S(13, 7), .content.string = S(10135, 5)},
+    {ARGO_BASIC_TYPE, V(1126), V(1127), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1134), V(1125), S(3021, 6), .content.object = {V(1130)}},
+    {ARGO_NO_TYPE, V(1131), V(1133), {0}},
+    {ARGO_STRING_TYPE, V(1132), V(1130), S(13, 7), .content.string = S(10212, 5)},
+    {ARGO_BASIC_TYPE, V(1133), V(1131), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1130), V(1132), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1139), V(1129), S(10243, 12), .content.object = {V(1135)}},
+    {ARGO_NO_TYPE, V(1136), V(1138), {0}},
+    {ARGO_STRING_TYPE, V(1137), V(1135), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_BASIC_TYPE, V(1138), V(1136), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1135), V(1137), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1144), V(1134), S(9862, 11), .content.object = {V(1140)}},
+    {ARGO_NO_TYPE, V(1141), V(1143), {0}},
+    {ARGO_STRING_TYPE, V(1142), V(1140), S(13, 7), .content.string = S(9873, 5)},
+    {ARGO_BASIC_TYPE, V(1143), V(1141), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1140), V(1142), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1151), V(1139), S(9975, 4), .content.object = {V(1145)}},
+    {ARGO_NO_TYPE, V(1146), V(1148), {0}},
+    {ARGO_STRING_TYPE, V(1147), V(1145), S(13, 7), .content.string = S(2040, 5)},
+    {ARGO_BASIC_TYPE, V(1148), V(1146), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1145), V(1147), S(41, 8), .content.object = {V(1149)}},
+    {ARGO_NO_TYPE, V(1150), V(1150), {0}},
+    {ARGO_STRING_TYPE, V(1149), V(1149), S(9555, 4), .content.string = S(9559, 6)},
+    {ARGO_OBJECT_TYPE, V(1174), V(1144), S(9999, 5), .content.object = {V(1152)}},
+    {ARGO_NO_TYPE, V(1153), V(1167), {0}},
+    {ARGO_STRING_TYPE, V(1154), V(1152), S(13, 7), .content.string = S(10004, 6)},
+    {ARGO_BASIC_TYPE, V(1155), V(1153), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1156), V(1154), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1167), V(1155), S(41, 8), .content.object = {V(1157)}},
+    {ARGO_NO_TYPE, V(1158), V(1166), {0}},
+    {ARGO_STRING_TYPE, V(1159), V(1157), S(9440, 4), .content.string = S(9444, 5)},
+    {ARGO_STRING_TYPE, V(1160), V(1158), S(9449, 11), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1161), V(1159), S(9501, 12), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(1162), V(1160), S(9658, 8), .content.string = S(9666, 6)},
+    {ARGO_STRING_TYPE, V(1163), V(1161), S(9699, 8), .content.string = S(8023, 5)},
+    {ARGO_STRING_TYPE, V(1164), V(1162), S(9900, 7), .content.string = S(9907, 5)},
+    {ARGO_STRING_TYPE, V(1165), V(1163), S(10083, 10), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(1166), V(1164), S(9707, 4), .content.string = S(8023, 5)},
+    {ARGO_STRING_TYPE, V(1157), V(1165), S(9513, 9), .content.string = S(9522, 6)},
+    {ARGO_OBJECT_TYPE, V(1152), V(1156), S(49, 12), .content.object = {V(1168)}},
+    {ARGO_NO_TYPE, V(1169), V(1169), {0}},
+    {ARGO_OBJECT_TYPE, V(1168), V(1168), S(9449, 11), .content.object = {V(1170)}},
+    {ARGO_NO_TYPE, V(1171), V(1173), {0}},
+    {ARGO_STRING_TYPE, V(1172), V(1170), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_BASIC_TYPE, V(1173), V(1171), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1170), V(1172), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1183), V(1151), S(9878, 12), .content.object = {V(1175)}},
+    {ARGO_NO_TYPE, V(1176), V(1178), {0}},
+    {ARGO_STRING_TYPE, V(1177), V(1175), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(1178), V(1176), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1175), V(1177), S(41, 8), .content.object = {V(1179)}},
+    {ARGO_NO_TYPE, V(1180), V(1182), {0}},
+    {ARGO_STRING_TYPE, V(1181), V(1179), S(9579, 13), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(1182), V(1180), S(10019, 23), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1179), V(1181), S(4291, 10), .content.string = S(4301, 5)},
+    {ARGO_OBJECT_TYPE, V(1190), V(1174), S(10366, 14), .content.object = {V(1184)}},
+    {ARGO_NO_TYPE, V(1185), V(1187), {0}},
+    {ARGO_STRING_TYPE, V(1186), V(1184), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_BASIC_TYPE, V(1187), V(1185), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1184), V(1186), S(41, 8), .content.object = {V(1188)}},
+    {ARGO_NO_TYPE, V(1189), V(1189), {0}},
+    {ARGO_STRING_TYPE, V(1188), V(1188), S(10394, 11), .content.string = S(10135, 5)},
+    {ARGO_OBJECT_TYPE, V(1195), V(1183), S(10405, 12), .content.object = {V(1191)}},
+    {ARGO_NO_TYPE, V(1192), V(1194), {0}},
+    {ARGO_STRING_TYPE, V(1193), V(1191), S(13, 7), .content.string = S(10417, 5)},
+    {ARGO_BASIC_TYPE, V(1194), V(1192), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1191), V(1193), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1202), V(1190), S(4291, 10), .content.object = {V(1196)}},
+    {ARGO_NO_TYPE, V(1197), V(1199), {0}},
+    {ARGO_STRING_TYPE, V(1198), V(1196), S(13, 7), .content.string = S(4301, 5)},
+    {ARGO_BASIC_TYPE, V(1199), V(1197), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1196), V(1198), S(41, 8), .content.object = {V(1200)}},
+    {ARGO_NO_TYPE, V(1201), V(1201), {0}},
+    {ARGO_STRING_TYPE, V(1200), V(1200), S(1270, 10), .content.string = S(1280, 5)},
+    {ARGO_OBJECT_TYPE, V(1207), V(1195), S(10347, 19), .content.object = {V(1203)}},
+    {ARGO_NO_TYPE, V(1204), V(1206), {0}},
+    {ARGO_STRING_TYPE, V(1205), V(1203), S(13, 7), .content.string = S(4563, 5)},
+    {ARGO_BASIC_TYPE, V(1206), V(1204), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1203), V(1205), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1216), V(1202), S(10217, 3), .content.object = {V(1208)}},
+    {ARGO_NO_TYPE, V(1209), V(1211), {0}},
+    {ARGO_STRING_TYPE, V(1210), V(1208), S(13, 7), .content.string = S(1389, 5)},
+    {ARGO_BASIC_TYPE, V(1211), V(1209), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1208), V(1210), S(41, 8), .content.object = {V(1212)}},
+    {ARGO_NO_TYPE, V(1213), V(1215), {0}},
+    {ARGO_STRING_TYPE, V(1214), V(1212), S(9528, 12), .content.string = S(9540, 5)},
+    {ARGO_STRING_TYPE, V(1215), V(1213), S(9749, 7), .content.string = S(8436, 6)},
+    {ARGO_STRING_TYPE, V(1212), V(1214), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_OBJECT_TYPE, V(1231), V(1207), S(10220, 8), .content.object = {V(1217)}},
+    {ARGO_NO_TYPE, V(1218), V(1221), {0}},
+    {ARGO_STRING_TYPE, V(1219), V(1217), S(13, 7), .content.string = S(10228, 5)},
+    {ARGO_BASIC_TYPE, V(1220), V(1218), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1221), V(1219), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1217), V(1220), S(41, 8), .content.object = {V(1222)}},
+    {ARGO_NO_TYPE, V(1223), V(1230), {0}},
+    {ARGO_STRING_TYPE, V(1224), V(1222), S(6489, 5), .content.string = S(9672, 5)},
+    {ARGO_STRING_TYPE, V(1225), V(1223), S(9749, 7), .content.string = S(8436, 6)},
+    {ARGO_STRING_TYPE, V(1226), V(1224), S(9795, 14), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(1227), V(1225), S(9929, 4), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(1228), V(1226), S(9420, 15), .content.string = S(9435, 5)},
+    {ARGO_STRING_TYPE, V(1229), V(1227), S(9784, 6), .content.string = S(9790, 5)},
+    {ARGO_STRING_TYPE, V(1230), V(1228), S(10217, 3), .content.string = S(1389, 5)},
+    {ARGO_STRING_TYPE, V(1222), V(1229), S(10450, 10), .content.string = S(10460, 5)},
+    {ARGO_OBJECT_TYPE, V(1239), V(1216), S(10422, 12), .content.object = {V(1232)}},
+    {ARGO_NO_TYPE, V(1233), V(1236), {0}},
+    {ARGO_STRING_TYPE, V(1234), V(1232), S(13, 7), .content.string = S(4999, 5)},
+    {ARGO_BASIC_TYPE, V(1235), V(1233), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1236), V(1234), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1232), V(1235), S(41, 8), .content.object = {V(1237)}},
+    {ARGO_NO_TYPE, V(1238), V(1238), {0}},
+    {ARGO_STRING_TYPE, V(1237), V(1237), S(10329, 8), .content.string = S(10337, 5)},
+    {ARGO_OBJECT_TYPE, V(1247), V(1231), S(10434, 12), .content.object = {V(1240)}},
+    {ARGO_NO_TYPE, V(1241), V(1244), {0}},
+    {ARGO_STRING_TYPE, V(1242), V(1240), S(13, 7), .content.string = S(9482, 5)},
+    {ARGO_BASIC_TYPE, V(1243), V(1241), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1244), V(1242), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1240), V(1243), S(41, 8), .content.object = {V(1245)}},
+    {ARGO_NO_TYPE, V(1246), V(1246), {0}},
+    {ARGO_STRING_TYPE, V(1245), V(1245), S(10394, 11), .content.string = S(10135, 5)},
+    {ARGO_OBJECT_TYPE, V(1252), V(1239), S(9513, 9), .content.object = {V(1248)}},
+    {ARGO_NO_TYPE, V(1249), V(1251), {0}},
+    {ARGO_STRING_TYPE, V(1250), V(1248), S(13, 7), .content.string = S(9522, 6)},
+    {ARGO_BASIC_TYPE, V(1251), V(1249), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1248), V(1250), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1257), V(1247), S(10450, 10), .content.object = {V(1253)}},
+    {ARGO_NO_TYPE, V(1254), V(1256), {0}},
+    {ARGO_STRING_TYPE, V(1255), V(1253), S(13, 7), .content.string = S(10460, 5)},
+    {ARGO_BASIC_TYPE, V(1256), V(1254), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1253), V(1255), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1261), V(1252), S(10380, 14), .content.object = {V(1258)}},
+    {ARGO_NO_TYPE, V(1259), V(1260), {0}},
+    {ARGO_STRING_TYPE, V(1260), V(1258), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(1258), V(1259), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1266), V(1257), S(10446, 4), .content.object = {V(1262)}},
+    {ARGO_NO_TYPE, V(1263), V(1265), {0}},
+    {ARGO_STRING_TYPE, V(1264), V(1262), S(13, 7), .content.string = S(4301, 5)},
+    {ARGO_BASIC_TYPE, V(1265), V(1263), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1262), V(1264), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1274), V(1261), S(10140, 6), .content.object = {V(1267)}},
+    {ARGO_NO_TYPE, V(1268), V(1271), {0}},
+    {ARGO_STRING_TYPE, V(1269), V(1267), S(13, 7), .content.string = S(10146, 5)},
+    {ARGO_BASIC_TYPE, V(1270), V(1268), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1271), V(1269), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1267), V(1270), S(41, 8), .content.object = {V(1272)}},
+    {ARGO_NO_TYPE, V(1273), V(1273), {0}},
+    {ARGO_STRING_TYPE, V(1272), V(1272), S(9711, 10), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(1282), V(1266), S(9890, 10), .content.object = {V(1275)}},
+    {ARGO_NO_TYPE, V(1276), V(1279), {0}},
+    {ARGO_STRING_TYPE, V(1277), V(1275), S(13, 7), .content.string = S(1934, 5)},
+    {ARGO_BASIC_TYPE, V(1278), V(1276), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_BASIC_TYPE, V(1279), V(1277), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1275), V(1278), S(41, 8), .content.object = {V(1280)}},
+    {ARGO_NO_TYPE, V(1281), V(1281), {0}},
+    {ARGO_STRING_TYPE, V(1280), V(1280), S(9878, 12), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(508), V(1274), S(10010, 6), .content.object = {V(1283)}},
+    {ARGO_NO_TYPE, V(1284), V(1285), {0}},
+    {ARGO_STRING_TYPE, V(1285), V(1283), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_BASIC_TYPE, V(1283), V(1284), S(9356, 7), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1291), V(497), S(10465, 3), .content.object = {V(1287)}},
+    {ARGO_NO_TYPE, V(1288), V(1290), {0}},
+    {ARGO_STRING_TYPE, V(1289), V(1287), S(13, 7), .content.string = S(10468, 32)},
+    {ARGO_STRING_TYPE, V(1290), V(1288), S(140, 9), .content.string = S(10500, 95)},
+    {ARGO_BASIC_TYPE, V(1287), V(1289), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1304), V(1286), S(9912, 4), .content.object = {V(1292)}},
+    {ARGO_NO_TYPE, V(1293), V(1296), {0}},
+    {ARGO_STRING_TYPE, V(1294), V(1292), S(13, 7), .content.string = S(9916, 5)},
+    {ARGO_STRING_TYPE, V(1295), V(1293), S(77, 8), .content.string = S(10595, 48)},
+    {ARGO_STRING_TYPE, V(1296), V(1294), S(140, 9), .content.string = S(10643, 95)},
+    {ARGO_OBJECT_TYPE, V(1292), V(1295), S(41, 8), .content.object = {V(1297)}},
+    {ARGO_NO_TYPE, V(1298), V(1303), {0}},
+    {ARGO_STRING_TYPE, V(1299), V(1297), S(9059, 11), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1300), V(1298), S(9921, 8), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(1301), V(1299), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(1302), V(1300), S(9809, 9), .content.string = S(9818, 5)},
+    {ARGO_STRING_TYPE, V(1303), V(1301), S(9929, 4), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(1297), V(1302), S(4568, 16), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(1313), V(1291), S(10738, 9), .content.object = {V(1305)}},
+    {ARGO_NO_TYPE, V(1306), V(1309), {0}},
+    {ARGO_STRING_TYPE, V(1307), V(1305), S(13, 7), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(1308), V(1306), S(77, 8), .content.string = S(10752, 58)},
+    {ARGO_STRING_TYPE, V(1309), V(1307), S(140, 9), .content.string = S(10810, 33)},
+    {ARGO_OBJECT_TYPE, V(1305), V(1308), S(41, 8), .content.object = {V(1310)}},
+    {ARGO_NO_TYPE, V(1311), V(1312), {0}},
+    {ARGO_STRING_TYPE, V(1312), V(1310), S(4518, 11), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1310), V(1311), S(4556, 7), .content.string = S(4563, 5)},
+    {ARGO_OBJECT_TYPE, V(1321), V(1304), S(4518, 11), .content.object = {V(1314)}},
+    {ARGO_NO_TYPE, V(1315), V(1318), {0}},
+    {ARGO_STRING_TYPE, V(1316), V(1314), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1317), V(1315), S(77, 8), .content.string = S(10843, 62)},
+    {ARGO_STRING_TYPE, V(1318), V(1316), S(140, 9), .content.string = S(10905, 33)},
+    {ARGO_OBJECT_TYPE, V(1314), V(1317), S(41, 8), .content.object = {V(1319)}},
+    {ARGO_NO_TYPE, V(1320), V(1320), {0}},
+    {ARGO_STRING_TYPE, V(1319), V(1319), S(4556, 7), .content.string = S(4563, 5)},
+    {ARGO_OBJECT_TYPE, V(1326), V(1313), S(9756, 11), .content.object = {V(1322)}},
+    {ARGO_NO_TYPE, V(1323), V(1325), {0}},
+    {ARGO_STRING_TYPE, V(1324), V(1322), S(13, 7), .content.string = S(9767, 6)},
+    {ARGO_STRING_TYPE, V(1325), V(1323), S(77, 8), .content.string = S(10938, 63)},
+    {ARGO_STRING_TYPE, V(1322), V(1324), S(140, 9), .content.string = S(11001, 33)},
+    {ARGO_OBJECT_TYPE, V(1334), V(1321), S(4283, 8), .content.object = {V(1327)}},
+    {ARGO_NO_TYPE, V(1328), V(1331), {0}},
+    {ARGO_STRING_TYPE, V(1329), V(1327), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1330), V(1328), S(77, 8), .content.string = S(11034, 56)},
+    {ARGO_STRING_TYPE, V(1331), V(1329), S(140, 9), .content.string = S(11090, 33)},
+    {ARGO_OBJECT_TYPE, V(1327), V(1330), S(41, 8), .content.object = {V(1332)}},
+    {ARGO_NO_TYPE, V(1333), V(1333), {0}},
+    {ARGO_STRING_TYPE, V(1332), V(1332), S(1270, 10), .content.string = S(1280, 5)},
+    {ARGO_OBJECT_TYPE, V(1339), V(1326), S(11123, 11), .content.object = {V(1335)}},
+    {ARGO_NO_TYPE, V(1336), V(1338), {0}},
+    {ARGO_STRING_TYPE, V(1337), V(1335), S(13, 7), .content.string = S(11134, 5)},
+    {ARGO_STRING_TYPE, V(1338), V(1336), S(77, 8), .content.string = S(11139, 62)},
+    {ARGO_STRING_TYPE, V(1335), V(1337), S(140, 9), .content.string = S(11201, 95)},
+    {ARGO_OBJECT_TYPE, V(1348), V(1334), S(11296, 11), .content.object = {V(1340)}},
+    {ARGO_NO_TYPE, V(1341), V(1344), {0}},
+    {ARGO_STRING_TYPE, V(1342), V(1340), S(13, 7), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(1343), V(1341), S(77, 8), .content.string = S(11307, 62)},
+    {ARGO_STRING_TYPE, V(1344), V(1342), S(140, 9), .content.string = S(11369, 33)},
+    {ARGO_OBJECT_TYPE, V(1340), V(1343), S(41, 8), .content.object = {V(1345)}},
+    {ARGO_NO_TYPE, V(1346), V(1347), {0}},
+    {ARGO_STRING_TYPE, V(1347), V(1345), S(6646, 10), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(1345), V(1346), S(11402, 11), .content.string = S(11413, 5)},
+    {ARGO_OBJECT_TYPE, V(1359), V(1339), S(11418, 9), .content.object = {V(1349)}},
+    {ARGO_NO_TYPE, V(1350), V(1353), {0}},
+    {ARGO_STRING_TYPE, V(1351), V(1349), S(13, 7), .content.string = S(11427, 5)},
+    {ARGO_STRING_TYPE, V(1352), V(1350), S(77, 8), .content.string = S(11432, 58)},
+    {ARGO_STRING_TYPE, V(1353), V(1351), S(140, 9), .content.string = S(11490, 33)},
+    {ARGO_OBJECT_TYPE, V(1349), V(1352), S(41, 8), .content.object = {V(1354)}},
+    {ARGO_NO_TYPE, V(1355), V(1358), {0}},
+    {ARGO_STRING_TYPE, V(1356), V(1354), S(1794, 12), .content.string = S(1806, 5)},
+    {ARGO_STRING_TYPE, V(1357), V(1355), S(1924, 10), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(1358), V(1356), S(3159, 8), .content.string = S(3167, 5)},
+    {ARGO_STRING_TYPE, V(1354), V(1357), S(10446, 4), .content.string = S(6494, 5)},
+    {ARGO_OBJECT_TYPE, V(1370), V(1348), S(11402, 11), .content.object = {V(1360)}},
+    {ARGO_NO_TYPE, V(1361), V(1364), {0}},
+    {ARGO_STRING_TYPE, V(1362), V(1360), S(13, 7), .content.string = S(11413, 5)},
+    {ARGO_STRING_TYPE, V(1363), V(1361), S(77, 8), .content.string = S(11523, 62)},
+    {ARGO_STRING_TYPE, V(1364), V(1362), S(140, 9), .content.string = S(11585, 33)},
+    {ARGO_OBJECT_TYPE, V(1360), V(1363), S(41, 8), .content.object = {V(1365)}},
+    {ARGO_NO_TYPE, V(1366), V(1369), {0}},
+    {ARGO_STRING_TYPE, V(1367), V(1365), S(6014, 4), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(1368), V(1366), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(1369), V(1367), S(11618, 14), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(1365), V(1368), S(11632, 8), .content.string = S(9933, 5)},
+    {ARGO_OBJECT_TYPE, V(1375), V(1359), S(11640, 15), .content.object = {V(1371)}},
+    {ARGO_NO_TYPE, V(1372), V(1374), {0}},
+    {ARGO_STRING_TYPE, V(1373), V(1371), S(13, 7), .content.string = S(11655, 5)},
+    {ARGO_STRING_TYPE, V(1374), V(1372), S(77, 8), .content.string = S(11660, 70)},
+    {ARGO_STRING_TYPE, V(1371), V(1373), S(140, 9), .content.string = S(11730, 33)},
+    {ARGO_OBJECT_TYPE, V(1380), V(1370), S(11763, 10), .content.object = {V(1376)}},
+    {ARGO_NO_TYPE, V(1377), V(1379), {0}},
+    {ARGO_STRING_TYPE, V(1378), V(1376), S(13, 7), .content.string = S(11773, 6)},
+    {ARGO_STRING_TYPE, V(1379), V(1377), S(77, 8), .content.string = S(11779, 61)},
+    {ARGO_STRING_TYPE, V(1376), V(1378), S(140, 9), .content.string = S(11840, 95)},
+    {ARGO_OBJECT_TYPE, V(1385), V(1375), S(4975, 9), .content.object = {V(1381)}},
+    {ARGO_NO_TYPE, V(1382), V(1384), {0}},
+    {ARGO_STRING_TYPE, V(1383), V(1381), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1384), V(1382), S(77, 8), .content.string = S(11935, 58)},
+    {ARGO_STRING_TYPE, V(1381), V(1383), S(140, 9), .content.string = S(11993, 33)},
+    {ARGO_OBJECT_TYPE, V(1394), V(1380), S(9921, 8), .content.object = {V(1386)}},
+    {ARGO_NO_TYPE, V(1387), V(1390), {0}},
+    {ARGO_STRING_TYPE, V(1388), V(1386), S(13, 7), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(1389), V(1387), S(77, 8), .content.string = S(12026, 56)},
+    {ARGO_STRING_TYPE, V(1390), V(1388), S(140, 9), .content.string = S(12082, 33)},
+    {ARGO_OBJECT_TYPE, V(1386), V(1389), S(41, 8), .content.object = {V(1391)}},
+    {ARGO_NO_TYPE, V(1392), V(1393), {0}},
+    {ARGO_STRING_TYPE, V(1393), V(1391), S(9929, 4), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(1391), V(1392), S(10010, 6), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(1399), V(1385), S(4529, 8), .content.object = {V(1395)}},
+    {ARGO_NO_TYPE, V(1396), V(1398), {0}},
+    {ARGO_STRING_TYPE, V(1397), V(1395), S(13, 7), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(1398), V(1396), S(77, 8), .content.string = S(12115, 56)},
+    {ARGO_STRING_TYPE, V(1395), V(1397), S(140, 9), .content.string = S(12171, 33)},
+    {ARGO_OBJECT_TYPE, V(1404), V(1394), S(12204, 9), .content.object = {V(1400)}},
+    {ARGO_NO_TYPE, V(1401), V(1403), {0}},
+    {ARGO_STRING_TYPE, V(1402), V(1400), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(1403), V(1401), S(77, 8), .content.string = S(12213, 58)},
+    {ARGO_STRING_TYPE, V(1400), V(1402), S(140, 9), .content.string = S(12271, 33)},
+    {ARGO_OBJECT_TYPE, V(1409), V(1399), S(12304, 2), .content.object = {V(1405)}},
+    {ARGO_NO_TYPE, V(1406), V(1408), {0}},
+    {ARGO_STRING_TYPE, V(1407), V(1405), S(13, 7), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(1408), V(1406), S(77, 8), .content.string = S(12306, 44)},
+    {ARGO_STRING_TYPE, V(1405), V(1407), S(140, 9), .content.string = S(12350, 33)},
+    {ARGO_OBJECT_TYPE, V(1417), V(1404), S(4542, 14), .content.object = {V(1410)}},
+    {ARGO_NO_TYPE, V(1411), V(1414), {0}},
+    {ARGO_STRING_TYPE, V(1412), V(1410), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(1413), V(1411), S(77, 8), .content.string = S(12383, 68)},
+    {ARGO_STRING_TYPE, V(1414), V(1412), S(140, 9), .content.string = S(12451, 33)},
+    {ARGO_OBJECT_TYPE, V(1410), V(1413), S(41, 8), .content.object = {V(1415)}},
+    {ARGO_NO_TYPE, V(1416), V(1416), {0}},
+    {ARGO_STRING_TYPE, V(1415), V(1415), S(3261, 17), .content.string = S(3278, 6)},
+    {ARGO_OBJECT_TYPE, V(1422), V(1409), S(12484, 9), .content.object = {V(1418)}},
+    {ARGO_NO_TYPE, V(1419), V(1421), {0}},
+    {ARGO_STRING_TYPE, V(1420), V(1418), S(13, 7), .content.string = S(12493, 5)},
+    {ARGO_STRING_TYPE, V(1421), V(1419), S(77, 8), .content.string = S(12498, 58)},
+    {ARGO_STRING_TYPE, V(1418), V(1420), S(140, 9), .content.string = S(12556, 95)},
+    {ARGO_OBJECT_TYPE, V(1427), V(1417), S(12651, 10), .content.object = {V(1423)}},
+    {ARGO_NO_TYPE, V(1424), V(1426), {0}},
+    {ARGO_STRING_TYPE, V(1425), V(1423), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(1426), V(1424), S(77, 8), .content.string = S(12661, 60)},
+    {ARGO_STRING_TYPE, V(1423), V(1425), S(140, 9), .content.string = S(12721, 33)},
+    {ARGO_OBJECT_TYPE, V(1435), V(1422), S(12754, 16), .content.object = {V(1428)}},
+    {ARGO_NO_TYPE, V(1429), V(1432), {0}},
+    {ARGO_STRING_TYPE, V(1430), V(1428), S(13, 7), .content.string = S(12770, 5)},
+    {ARGO_STRING_TYPE, V(1431), V(1429), S(77, 8), .content.string = S(12775, 72)},
+    {ARGO_STRING_TYPE, V(1432), V(1430), S(140, 9), .content.string = S(12847, 33)},
+    {ARGO_OBJECT_TYPE, V(1428), V(1431), S(41, 8), .content.object = {V(1433)}},
+    {ARGO_NO_TYPE, V(1434), V(1434), {0}},
+    {ARGO_STRING_TYPE, V(1433), V(1433), S(12880, 12), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(1440), V(1427), S(12892, 13), .content.object = {V(1436)}},
+    {ARGO_NO_TYPE, V(1437), V(1439), {0}},
+    {ARGO_STRING_TYPE, V(1438), V(1436), S(13, 7), .content.string = S(8023, 5)},
+    {ARGO_STRING_TYPE, V(1439), V(1437), S(77, 8), .content.string = S(12905, 66)},
+    {ARGO_STRING_TYPE, V(1436), V(1438), S(140, 9), .content.string = S(12971, 33)},
+    {ARGO_OBJECT_TYPE, V(1445), V(1435), S(8330, 10), .content.object = {V(1441)}},
+    {ARGO_NO_TYPE, V(1442), V(1444), {0}},
+    {ARGO_STRING_TYPE, V(1443), V(1441), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1444), V(1442), S(77, 8), .content.string = S(13004, 60)},
+    {ARGO_STRING_TYPE, V(1441), V(1443), S(140, 9), .content.string = S(13064, 33)},
+    {ARGO_OBJECT_TYPE, V(1450), V(1440), S(13097, 21), .content.object = {V(1446)}},
+    {ARGO_NO_TYPE, V(1447), V(1449), {0}},
+    {ARGO_STRING_TYPE, V(1448), V(1446), S(13, 7), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(1449), V(1447), S(77, 8), .content.string = S(13118, 82)},
+    {ARGO_STRING_TYPE, V(1446), V(1448), S(140, 9), .content.string = S(13200, 33)},
+    {ARGO_OBJECT_TYPE, V(1458), V(1445), S(4556, 7), .content.object = {V(1451)}},
+    {ARGO_NO_TYPE, V(1452), V(1455), {0}},
+    {ARGO_STRING_TYPE, V(1453), V(1451), S(13, 7), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(1454), V(1452), S(77, 8), .content.string = S(13233, 54)},
+    {ARGO_STRING_TYPE, V(1455), V(1453), S(140, 9), .content.string = S(13287, 33)},
+    {ARGO_OBJECT_TYPE, V(1451), V(1454), S(41, 8), .content.object = {V(1456)}},
+    {ARGO_NO_TYPE, V(1457), V(1457), {0}},
+    {ARGO_STRING_TYPE, V(1456), V(1456), S(8330, 10), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(1466), V(1450), S(8736, 9), .content.object = {V(1459)}},
+    {ARGO_NO_TYPE, V(1460), V(1463), {0}},
+    {ARGO_STRING_TYPE, V(1461), V(1459), S(13, 7), .content.string = S(4592, 5)},
+    {ARGO_STRING_TYPE, V(1462), V(1460), S(77, 8), .content.string = S(13320, 58)},
+    {ARGO_STRING_TYPE, V(1463), V(1461), S(140, 9), .content.string = S(13378, 33)},
+    {ARGO_OBJECT_TYPE, V(1459), V(1462), S(41, 8), .content.object = {V(1464)}},
+    {ARGO_NO_TYPE, V(1465), V(1465), {0}},
+    {ARGO_STRING_TYPE, V(1464), V(1464), S(13411, 7), .content.string = S(13418, 5)},
+    {ARGO_OBJECT_TYPE, V(1471), V(1458), S(8007, 16), .content.object = {V(1467)}},
+    {ARGO_NO_TYPE, V(1468), V(1470), {0}},
+    {ARGO_STRING_TYPE, V(1469), V(1467), S(13, 7), .content.string = S(8023, 5)},
+    {ARGO_STRING_TYPE, V(1470), V(1468), S(77, 8), .content.string = S(13423, 72)},
+    {ARGO_STRING_TYPE, V(1467), V(1469), S(140, 9), .content.string = S(13495, 33)},
+    {ARGO_OBJECT_TYPE, V(1476), V(1466), S(12880, 12), .content.object = {V(1472)}},
+    {ARGO_NO_TYPE, V(1473), V(1475), {0}},
+    {ARGO_STRING_TYPE, V(1474), V(1472), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1475), V(1473), S(77, 8), .content.string = S(13528, 64)},
+    {ARGO_STRING_TYPE, V(1472), V(1474), S(140, 9), .content.string = S(13592, 33)},
+    {ARGO_OBJECT_TYPE, V(1481), V(1471), S(10068, 7), .content.object = {V(1477)}},
+    {ARGO_NO_TYPE, V(1478), V(1480), {0}},
+    {ARGO_STRING_TYPE, V(1479), V(1477), S(13, 7), .content.string = S(3728, 5)},
+    {ARGO_STRING_TYPE, V(1480), V(1478), S(77, 8), .content.string = S(13625, 54)},
+    {ARGO_STRING_TYPE, V(1477), V(1479), S(140, 9), .content.string = S(13679, 33)},
+    {ARGO_OBJECT_TYPE, V(1496), V(1476), S(8745, 8), .content.object = {V(1482)}},
+    {ARGO_NO_TYPE, V(1483), V(1489), {0}},
+    {ARGO_STRING_TYPE, V(1484), V(1482), S(13, 7), .content.string = S(4592, 5)},
+    {ARGO_STRING_TYPE, V(1485), V(1483), S(77, 8), .content.string = S(13712, 56)},
+    {ARGO_STRING_TYPE, V(1486), V(1484), S(140, 9), .content.string = S(13768, 33)},
+    {ARGO_OBJECT_TYPE, V(1489), V(1485), S(41, 8), .content.object = {V(1487)}},
+    {ARGO_NO_TYPE, V(1488), V(1488), {0}},
+    {ARGO_STRING_TYPE, V(1487), V(1487), S(10068, 7), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(1482), V(1486), S(49, 12), .content.object = {V(1490)}},
+    {ARGO_NO_TYPE, V(1491), V(1491), {0}},
+    {ARGO_OBJECT_TYPE, V(1490), V(1490), S(10068, 7), .content.object = {V(1492)}},
+    {ARGO_NO_TYPE, V(1493), V(1495), {0}},
+    {ARGO_STRING_TYPE, V(1494), V(1492), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1495), V(1493), S(77, 8), .content.string = S(13801, 54)},
+    {ARGO_STRING_TYPE, V(1492), V(1494), S(140, 9), .content.string = S(13855, 33)},
+    {ARGO_OBJECT_TYPE, V(1501), V(1481), S(10075, 8), .content.object = {V(1497)}},
+    {ARGO_NO_TYPE, V(1498), V(1500), {0}},
+    {ARGO_STRING_TYPE, V(1499), V(1497), S(13, 7), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(1500), V(1498), S(77, 8), .content.string = S(13888, 56)},
+    {ARGO_STRING_TYPE, V(1497), V(1499), S(140, 9), .content.string = S(13944, 33)},
+    {ARGO_OBJECT_TYPE, V(1506), V(1496), S(10116, 19), .content.object = {V(1502)}},
+    {ARGO_NO_TYPE, V(1503), V(1505), {0}},
+    {ARGO_STRING_TYPE, V(1504), V(1502), S(13, 7), .content.string = S(10135, 5)},
+    {ARGO_STRING_TYPE, V(1505), V(1503), S(77, 8), .content.string = S(13977, 78)},
+    {ARGO_STRING_TYPE, V(1502), V(1504), S(140, 9), .content.string = S(14055, 33)},
+    {ARGO_OBJECT_TYPE, V(1511), V(1501), S(14088, 6), .content.object = {V(1507)}},
+    {ARGO_NO_TYPE, V(1508), V(1510), {0}},
+    {ARGO_STRING_TYPE, V(1509), V(1507), S(13, 7), .content.string = S(14094, 5)},
+    {ARGO_STRING_TYPE, V(1510), V(1508), S(77, 8), .content.string = S(14099, 52)},
+    {ARGO_STRING_TYPE, V(1507), V(1509), S(140, 9), .content.string = S(14151, 33)},
+    {ARGO_OBJECT_TYPE, V(1516), V(1506), S(6018, 7), .content.object = {V(1512)}},
+    {ARGO_NO_TYPE, V(1513), V(1515), {0}},
+    {ARGO_STRING_TYPE, V(1514), V(1512), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(1515), V(1513), S(77, 8), .content.string = S(14184, 54)},
+    {ARGO_STRING_TYPE, V(1512), V(1514), S(140, 9), .content.string = S(14238, 33)},
+    {ARGO_OBJECT_TYPE, V(1524), V(1511), S(13411, 7), .content.object = {V(1517)}},
+    {ARGO_NO_TYPE, V(1518), V(1521), {0}},
+    {ARGO_STRING_TYPE, V(1519), V(1517), S(13, 7), .content.string = S(13418, 5)},
+    {ARGO_STRING_TYPE, V(1520), V(1518), S(77, 8), .content.string = S(14271, 54)},
+    {ARGO_STRING_TYPE, V(1521), V(1519), S(140, 9), .content.string = S(14325, 33)},
+    {ARGO_OBJECT_TYPE, V(1517), V(1520), S(41, 8), .content.object = {V(1522)}},
+    {ARGO_NO_TYPE, V(1523), V(1523), {0}},
+    {ARGO_STRING_TYPE, V(1522), V(1522), S(12484, 9), .content.string = S(12493, 5)},
+    {ARGO_OBJECT_TYPE, V(1555), V(1516), S(14358, 3), .content.object = {V(1525)}},
+    {ARGO_NO_TYPE, V(1526), V(1529), {0}},
+    {ARGO_STRING_TYPE, V(1527), V(1525), S(13, 7), .content.string = S(14361, 5)},
+    {ARGO_STRING_TYPE, V(1528), V(1526), S(77, 8), .content.string = S(14366, 46)},
+    {ARGO_STRING_TYPE, V(1529), V(1527), S(140, 9), .content.string = S(14412, 95)},
+    {ARGO_OBJECT_TYPE, V(1525), V(1528), S(41, 8), .content.object = {V(1530)}},
+    {ARGO_NO_TYPE, V(1531), V(1554), {0}},
+    {ARGO_STRING_TYPE, V(1532), V(1530), S(942, 7), .content.string = S(949, 5)},
+    {ARGO_STRING_TYPE, V(1533), V(1531), S(5370, 19), .content.string = S(5389, 5)},
+    {ARGO_STRING_TYPE, V(1534), V(1532), S(5505, 12), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(1535), V(1533), S(5915, 7), .content.string = S(5922, 5)},
+    {ARGO_STRING_TYPE, V(1536), V(1534), S(6489, 5), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1537), V(1535), S(6749, 9), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1538), V(1536), S(6014, 4), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(1539), V(1537), S(6930, 7), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(1540), V(1538), S(7226, 12), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1541), V(1539), S(7441, 11), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(1542), V(1540), S(8971, 5), .content.string = S(5389, 5)},
+    {ARGO_STRING_TYPE, V(1543), V(1541), S(11296, 11), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(1544), V(1542), S(11402, 11), .content.string = S(11413, 5)},
+    {ARGO_STRING_TYPE, V(1545), V(1543), S(13097, 21), .content.string = S(72, 5)},
+    {ARGO_STRING_TYPE, V(1546), V(1544), S(14507, 11), .content.string = S(14518, 5)},
+    {ARGO_STRING_TYPE, V(1547), V(1545), S(14523, 11), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(1548), V(1546), S(14534, 11), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1549), V(1547), S(1041, 10), .content.string = S(1051, 6)},
+    {ARGO_STRING_TYPE, V(1550), V(1548), S(14545, 11), .content.string = S(14556, 5)},
+    {ARGO_STRING_TYPE, V(1551), V(1549), S(14561, 4), .content.string = S(11655, 5)},
+    {ARGO_STRING_TYPE, V(1552), V(1550), S(14565, 8), .content.string = S(1608, 5)},
+    {ARGO_STRING_TYPE, V(1553), V(1551), S(11632, 8), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(1554), V(1552), S(5004, 7), .content.string = S(5011, 6)},
+    {ARGO_STRING_TYPE, V(1530), V(1553), S(14573, 4), .content.string = S(1934, 5)},
+    {ARGO_OBJECT_TYPE, V(1564), V(1524), S(14577, 14), .content.object = {V(1556)}},
+    {ARGO_NO_TYPE, V(1557), V(1560), {0}},
+    {ARGO_STRING_TYPE, V(1558), V(1556), S(13, 7), .content.string = S(14591, 5)},
+    {ARGO_STRING_TYPE, V(1559), V(1557), S(77, 8), .content.string = S(14596, 68)},
+    {ARGO_STRING_TYPE, V(1560), V(1558), S(140, 9), .content.string = S(14664, 33)},
+    {ARGO_OBJECT_TYPE, V(1556), V(1559), S(41, 8), .content.object = {V(1561)}},
+    {ARGO_NO_TYPE, V(1562), V(1563), {0}},
+    {ARGO_STRING_TYPE, V(1563), V(1561), S(4876, 7), .content.string = S(4883, 5)},
+    {ARGO_STRING_TYPE, V(1561), V(1562), S(6030, 7), .content.string = S(4563, 5)},
+    {ARGO_OBJECT_TYPE, V(1569), V(1555), S(14507, 11), .content.object = {V(1565)}},
+    {ARGO_NO_TYPE, V(1566), V(1568), {0}},
+    {ARGO_STRING_TYPE, V(1567), V(1565), S(13, 7), .content.string = S(14518, 5)},
+    {ARGO_STRING_TYPE, V(1568), V(1566), S(77, 8), .content.string = S(14697, 62)},
+    {ARGO_STRING_TYPE, V(1565), V(1567), S(140, 9), .content.string = S(14759, 33)},
+    {ARGO_OBJECT_TYPE, V(1588), V(1564), S(14523, 11), .content.object = {V(1570)}},
+    {ARGO_NO_TYPE, V(1571), V(1578), {0}},
+    {ARGO_STRING_TYPE, V(1572), V(1570), S(13, 7), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(1573), V(1571), S(77, 8), .content.string = S(14792, 62)},
+    {ARGO_STRING_TYPE, V(1574), V(1572), S(140, 9), .content.string = S(14854, 33)},
+    {ARGO_OBJECT_TYPE, V(1578), V(1573), S(41, 8), .content.object = {V(1575)}},
+    {ARGO_NO_TYPE, V(1576), V(1577), {0}},
+    {ARGO_STRING_TYPE, V(1577), V(1575), S(4792, 2), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(1575), V(1576), S(14507, 11), .content.string = S(5702, 5)},
+    {ARGO_OBJECT_TYPE, V(1570), V(1574), S(49, 12), .content.object = {V(1579)}},
+    {ARGO_NO_TYPE, V(1580), V(1580), {0}},
+    {ARGO_OBJECT_TYPE, V(1579), V(1579), S(14507, 11), .content.object = {V(1581)}},
+    {ARGO_NO_TYPE, V(1582), V(1585), {0}},
+    {ARGO_STRING_TYPE, V(1583), V(1581), S(13, 7), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(1584), V(1582), S(77, 8), .content.string = S(14887, 62)},
+    {ARGO_STRING_TYPE, V(1585), V(1583), S(140, 9), .content.string = S(14949, 33)},
+    {ARGO_OBJECT_TYPE, V(1581), V(1584), S(41, 8), .content.object = {V(1586)}},
+    {ARGO_NO_TYPE, V(1587), V(1587), {0}},
+    {ARGO_STRING_TYPE, V(1586), V(1586), S(1489, 11), .content.string = S(1500, 5)},
+    {ARGO_OBJECT_TYPE, V(1593), V(1569), S(14534, 11), .content.object = {V(1589)}},
+    {ARGO_NO_TYPE, V(1590), V(1592), {0}},
+    {ARGO_STRING_TYPE, V(1591), V(1589), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1592), V(1590), S(77, 8), .content.string = S(14982, 62)},
+    {ARGO_STRING_TYPE, V(1589), V(1591), S(140, 9), .content.string = S(15044, 33)},
+    {ARGO_OBJECT_TYPE, V(1611), V(1588), S(15077, 10), .content.object = {V(1594)}},
+    {ARGO_NO_TYPE, V(1595), V(1604), {0}},
+    {ARGO_STRING_TYPE, V(1596), V(1594), S(13, 7), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1597), V(1595), S(77, 8), .content.string = S(15087, 60)},
+    {ARGO_STRING_TYPE, V(1598), V(1596), S(140, 9), .content.string = S(15147, 95)},
+    {ARGO_OBJECT_TYPE, V(1604), V(1597), S(41, 8), .content.object = {V(1599)}},
+    {ARGO_NO_TYPE, V(1600), V(1603), {0}},
+    {ARGO_STRING_TYPE, V(1601), V(1599), S(4072, 5), .content.string = S(15242, 5)},
+    {ARGO_STRING_TYPE, V(1602), V(1600), S(4165, 5), .content.string = S(4170, 5)},
+    {ARGO_STRING_TYPE, V(1603), V(1601), S(11640, 15), .content.string = S(11655, 5)},
+    {ARGO_STRING_TYPE, V(1599), V(1602), S(15247, 19), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(1594), V(1598), S(49, 12), .content.object = {V(1605)}},
+    {ARGO_NO_TYPE, V(1606), V(1606), {0}},
+    {ARGO_OBJECT_TYPE, V(1605), V(1605), S(4072, 5), .content.object = {V(1607)}},
+    {ARGO_NO_TYPE, V(1608), V(1610), {0}},
+    {ARGO_STRING_TYPE, V(1609), V(1607), S(13, 7), .content.string = S(15242, 5)},
+    {ARGO_STRING_TYPE, V(1610), V(1608), S(77, 8), .content.string = S(15266, 50)},
+    {ARGO_STRING_TYPE, V(1607), V(1609), S(140, 9), .content.string = S(15316, 33)},
+    {ARGO_OBJECT_TYPE, V(1621), V(1593), S(15349, 9), .content.object = {V(1612)}},
+    {ARGO_NO_TYPE, V(1613), V(1616), {0}},
+    {ARGO_STRING_TYPE, V(1614), V(1612), S(13, 7), .content.string = S(15358, 5)},
+    {ARGO_STRING_TYPE, V(1615), V(1613), S(77, 8), .content.string = S(15363, 58)},
+    {ARGO_STRING_TYPE, V(1616), V(1614), S(140, 9), .content.string = S(15421, 33)},
+    {ARGO_OBJECT_TYPE, V(1612), V(1615), S(41, 8), .content.object = {V(1617)}},
+    {ARGO_NO_TYPE, V(1618), V(1620), {0}},
+    {ARGO_STRING_TYPE, V(1619), V(1617), S(6489, 5), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1620), V(1618), S(15454, 7), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(1617), V(1619), S(15461, 14), .content.string = S(4416, 5)},
+    {ARGO_OBJECT_TYPE, V(1626), V(1611), S(15475, 4), .content.object = {V(1622)}},
+    {ARGO_NO_TYPE, V(1623), V(1625), {0}},
+    {ARGO_STRING_TYPE, V(1624), V(1622), S(13, 7), .content.string = S(8436, 6)},
+    {ARGO_STRING_TYPE, V(1625), V(1623), S(77, 8), .content.string = S(15479, 49)},
+    {ARGO_STRING_TYPE, V(1622), V(1624), S(140, 9), .content.string = S(15528, 33)},
+    {ARGO_OBJECT_TYPE, V(1631), V(1621), S(2719, 6), .content.object = {V(1627)}},
+    {ARGO_NO_TYPE, V(1628), V(1630), {0}},
+    {ARGO_STRING_TYPE, V(1629), V(1627), S(13, 7), .content.string = S(2725, 6)},
+    {ARGO_STRING_TYPE, V(1630), V(1628), S(77, 8), .content.string = S(15561, 53)},
+    {ARGO_STRING_TYPE, V(1627), V(1629), S(140, 9), .content.string = S(15614, 33)},
+    {ARGO_OBJECT_TYPE, V(1636), V(1626), S(15647, 16), .content.object = {V(1632)}},
+    {ARGO_NO_TYPE, V(1633), V(1635), {0}},
+    {ARGO_STRING_TYPE, V(1634), V(1632), S(13, 7), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(1635), V(1633), S(77, 8), .content.string = S(15663, 72)},
+    {ARGO_STRING_TYPE, V(1632), V(1634), S(140, 9), .content.string = S(15735, 33)},
+    {ARGO_OBJECT_TYPE, V(1641), V(1631), S(15768, 10), .content.object = {V(1637)}},
+    {ARGO_NO_TYPE, V(1638), V(1640), {0}},
+    {ARGO_STRING_TYPE, V(1639), V(1637), S(13, 7), .content.string = S(15778, 5)},
+    {ARGO_STRING_TYPE, V(1640), V(1638), S(77, 8), .content.string = S(15783, 60)},
+    {ARGO_STRING_TYPE, V(1637), V(1639), S(140, 9), .content.string = S(15843, 33)},
+    {ARGO_OBJECT_TYPE, V(1646), V(1636), S(15876, 14), .content.object = {V(1642)}},
+    {ARGO_NO_TYPE, V(1643), V(1645), {0}},
+    {ARGO_STRING_TYPE, V(1644), V(1642), S(13, 7), .content.string = S(15890, 5)},
+    {ARGO_STRING_TYPE, V(1645), V(1643), S(77, 8), .content.string = S(15895, 68)},
+    {ARGO_STRING_TYPE, V(1642), V(1644), S(140, 9), .content.string = S(15963, 33)},
+    {ARGO_OBJECT_TYPE, V(1651), V(1641), S(15996, 12), .content.object = {V(1647)}},
+    {ARGO_NO_TYPE, V(1648), V(1650), {0}},
+    {ARGO_STRING_TYPE, V(1649), V(1647), S(13, 7), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(1650), V(1648), S(77, 8), .content.string = S(16008, 64)},
+    {ARGO_STRING_TYPE, V(1647), V(1649), S(140, 9), .content.string = S(16072, 33)},
+    {ARGO_OBJECT_TYPE, V(1656), V(1646), S(16105, 11), .content.object = {V(1652)}},
+    {ARGO_NO_TYPE, V(1653), V(1655), {0}},
+    {ARGO_STRING_TYPE, V(1654), V(1652), S(13, 7), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(1655), V(1653), S(77, 8), .content.string = S(16116, 62)},
+    {ARGO_STRING_TYPE, V(1652), V(1654), S(140, 9), .content.string = S(16178, 33)},
+    {ARGO_OBJECT_TYPE, V(1661), V(1651), S(15454, 7), .content.object = {V(1657)}},
+    {ARGO_NO_TYPE, V(1658), V(1660), {0}},
+    {ARGO_STRING_TYPE, V(1659), V(1657), S(13, 7), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(1660), V(1658), S(77, 8), .content.string = S(16211, 54)},
+    {ARGO_STRING_TYPE, V(1657), V(1659), S(140, 9), .content.string = S(16265, 33)},
+    {ARGO_OBJECT_TYPE, V(1681), V(1656), S(1764, 10), .content.object = {V(1662)}},
+    {ARGO_NO_TYPE, V(1663), V(1666), {0}},
+    {ARGO_STRING_TYPE, V(1664), V(1662), S(13, 7), .content.string = S(1774, 6)},
+    {ARGO_STRING_TYPE, V(1665), V(1663), S(77, 8), .content.string = S(16298, 61)},
+    {ARGO_STRING_TYPE, V(1666), V(1664), S(140, 9), .content.string = S(16359, 33)},
+    {ARGO_OBJECT_TYPE, V(1662), V(1665), S(41, 8), .content.object = {V(1667)}},
+    {ARGO_NO_TYPE, V(1668), V(1680), {0}},
+    {ARGO_STRING_TYPE, V(1669), V(1667), S(2242, 8), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1670), V(1668), S(2512, 12), .content.string = S(2524, 5)},
+    {ARGO_STRING_TYPE, V(1671), V(1669), S(3733, 6), .content.string = S(3739, 5)},
+    {ARGO_STRING_TYPE, V(1672), V(1670), S(7884, 15), .content.string = S(7899, 5)},
+    {ARGO_STRING_TYPE, V(1673), V(1671), S(8231, 7), .content.string = S(8238, 5)},
+    {ARGO_STRING_TYPE, V(1674), V(1672), S(8528, 14), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(1675), V(1673), S(8330, 10), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1676), V(1674), S(4556, 7), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(1677), V(1675), S(13411, 7), .content.string = S(13418, 5)},
+    {ARGO_STRING_TYPE, V(1678), V(1676), S(1780, 14), .content.string = S(1280, 5)},
+    {ARGO_STRING_TYPE, V(1679), V(1677), S(16392, 11), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(1680), V(1678), S(16403, 10), .content.string = S(9818, 5)},
+    {ARGO_STRING_TYPE, V(1667), V(1679), S(16413, 11), .content.string = S(16424, 5)},
+    {ARGO_OBJECT_TYPE, V(1686), V(1661), S(10151, 7), .content.object = {V(1682)}},
+    {ARGO_NO_TYPE, V(1683), V(1685), {0}},
+    {ARGO_STRING_TYPE, V(1684), V(1682), S(13, 7), .content.string = S(16429, 6)},
+    {ARGO_STRING_TYPE, V(1685), V(1683), S(77, 8), .content.string = S(16435, 55)},
+    {ARGO_STRING_TYPE, V(1682), V(1684), S(140, 9), .content.string = S(16490, 33)},
+    {ARGO_OBJECT_TYPE, V(1694), V(1681), S(1041, 10), .content.object = {V(1687)}},
+    {ARGO_NO_TYPE, V(1688), V(1691), {0}},
+    {ARGO_STRING_TYPE, V(1689), V(1687), S(13, 7), .content.string = S(1051, 6)},
+    {ARGO_STRING_TYPE, V(1690), V(1688), S(77, 8), .content.string = S(16523, 61)},
+    {ARGO_STRING_TYPE, V(1691), V(1689), S(140, 9), .content.string = S(16584, 33)},
+    {ARGO_OBJECT_TYPE, V(1687), V(1690), S(41, 8), .content.object = {V(1692)}},
+    {ARGO_NO_TYPE, V(1693), V(1693), {0}},
+    {ARGO_STRING_TYPE, V(1692), V(1692), S(10151, 7), .content.string = S(16429, 6)},
+    {ARGO_OBJECT_TYPE, V(1702), V(1686), S(9809, 9), .content.object = {V(1695)}},
+    {ARGO_NO_TYPE, V(1696), V(1699), {0}},
+    {ARGO_STRING_TYPE, V(1697), V(1695), S(13, 7), .content.string = S(9818, 5)},
+    {ARGO_STRING_TYPE, V(1698), V(1696), S(77, 8), .content.string = S(16617, 58)},
+    {ARGO_STRING_TYPE, V(1699), V(1697), S(140, 9), .content.string = S(16675, 95)},
+    {ARGO_OBJECT_TYPE, V(1695), V(1698), S(41, 8), .content.object = {V(1700)}},
+    {ARGO_NO_TYPE, V(1701), V(1701), {0}},
+    {ARGO_STRING_TYPE, V(1700), V(1700), S(3595, 15), .content.string = S(3610, 5)},
+    {ARGO_OBJECT_TYPE, V(1707), V(1694), S(10164, 8), .content.object = {V(1703)}},
+    {ARGO_NO_TYPE, V(1704), V(1706), {0}},
+    {ARGO_STRING_TYPE, V(1705), V(1703), S(13, 7), .content.string = S(10172, 5)},
+    {ARGO_STRING_TYPE, V(1706), V(1704), S(77, 8), .content.string = S(16770, 56)},
+    {ARGO_STRING_TYPE, V(1703), V(1705), S(140, 9), .content.string = S(16826, 33)},
+    {ARGO_OBJECT_TYPE, V(1715), V(1702), S(9773, 6), .content.object = {V(1708)}},
+    {ARGO_NO_TYPE, V(1709), V(1712), {0}},
+    {ARGO_STRING_TYPE, V(1710), V(1708), S(13, 7), .content.string = S(9779, 5)},
+    {ARGO_STRING_TYPE, V(1711), V(1709), S(77, 8), .content.string = S(16859, 52)},
+    {ARGO_STRING_TYPE, V(1712), V(1710), S(140, 9), .content.string = S(16911, 33)},
+    {ARGO_OBJECT_TYPE, V(1708), V(1711), S(41, 8), .content.object = {V(1713)}},
+    {ARGO_NO_TYPE, V(1714), V(1714), {0}},
+    {ARGO_STRING_TYPE, V(1713), V(1713), S(10164, 8), .content.string = S(10172, 5)},
+    {ARGO_OBJECT_TYPE, V(1720), V(1707), S(16944, 6), .content.object = {V(1716)}},
+    {ARGO_NO_TYPE, V(1717), V(1719), {0}},
+    {ARGO_STRING_TYPE, V(1718), V(1716), S(13, 7), .content.string = S(16950, 6)},
+    {ARGO_STRING_TYPE, V(1719), V(1717), S(77, 8), .content.string = S(16956, 53)},
+    {ARGO_STRING_TYPE, V(1716), V(1718), S(140, 9), .content.string = S(17009, 95)},
+    {ARGO_OBJECT_TYPE, V(1728), V(1715), S(6380, 15), .content.object = {V(1721)}},
+    {ARGO_NO_TYPE, V(1722), V(1725), {0}},
+    {ARGO_STRING_TYPE, V(1723), V(1721), S(13, 7), .content.string = S(6395, 6)},
+    {ARGO_STRING_TYPE, V(1724), V(1722), S(77, 8), .content.string = S(17104, 71)},
+    {ARGO_STRING_TYPE, V(1725), V(1723), S(140, 9), .content.string = S(17175, 33)},
+    {ARGO_OBJECT_TYPE, V(1721), V(1724), S(41, 8), .content.object = {V(1726)}},
+    {ARGO_NO_TYPE, V(1727), V(1727), {0}},
+    {ARGO_STRING_TYPE, V(1726), V(1726), S(16944, 6), .content.string = S(16950, 6)},
+    {ARGO_OBJECT_TYPE, V(1738), V(1720), S(17208, 7), .content.object = {V(1729)}},
+    {ARGO_NO_TYPE, V(1730), V(1733), {0}},
+    {ARGO_STRING_TYPE, V(1731), V(1729), S(13, 7), .content.string = S(17215, 6)},
+    {ARGO_STRING_TYPE, V(1732), V(1730), S(77, 8), .content.string = S(17221, 55)},
+    {ARGO_STRING_TYPE, V(1733), V(1731), S(140, 9), .content.string = S(17276, 33)},
+    {ARGO_OBJECT_TYPE, V(1729), V(1732), S(41, 8), .content.object = {V(1734)}},
+    {ARGO_NO_TYPE, V(1735), V(1737), {0}},
+    {ARGO_STRING_TYPE, V(1736), V(1734), S(7335, 11), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(1737), V(1735), S(17309, 12), .content.string = S(1051, 6)},
+    {ARGO_STRING_TYPE, V(1734), V(1736), S(9420, 15), .content.string = S(17321, 5)},
+    {ARGO_OBJECT_TYPE, V(1747), V(1728), S(17309, 12), .content.object = {V(1739)}},
+    {ARGO_NO_TYPE, V(1740), V(1743), {0}},
+    {ARGO_STRING_TYPE, V(1741), V(1739), S(13, 7), .content.string = S(1051, 6)},
+    {ARGO_STRING_TYPE, V(1742), V(1740), S(77, 8), .content.string = S(17326, 65)},
+    {ARGO_STRING_TYPE, V(1743), V(1741), S(140, 9), .content.string = S(17391, 33)},
+    {ARGO_OBJECT_TYPE, V(1739), V(1742), S(41, 8), .content.object = {V(1744)}},
+    {ARGO_NO_TYPE, V(1745), V(1746), {0}},
+    {ARGO_STRING_TYPE, V(1746), V(1744), S(3873, 4), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(1744), V(1745), S(17424, 16), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(1767), V(1738), S(17440, 8), .content.object = {V(1748)}},
+    {ARGO_NO_TYPE, V(1749), V(1752), {0}},
+    {ARGO_STRING_TYPE, V(1750), V(1748), S(13, 7), .content.string = S(17448, 6)},
+    {ARGO_STRING_TYPE, V(1751), V(1749), S(77, 8), .content.string = S(17454, 57)},
+    {ARGO_STRING_TYPE, V(1752), V(1750), S(140, 9), .content.string = S(17511, 95)},
+    {ARGO_OBJECT_TYPE, V(1748), V(1751), S(41, 8), .content.object = {V(1753)}},
+    {ARGO_NO_TYPE, V(1754), V(1766), {0}},
+    {ARGO_STRING_TYPE, V(1755), V(1753), S(2626, 5), .content.string = S(2631, 5)},
+    {ARGO_STRING_TYPE, V(1756), V(1754), S(3873, 4), .content.string = S(3877, 5)},
+    {ARGO_STRING_TYPE, V(1757), V(1755), S(11123, 11), .content.string = S(11134, 5)},
+    {ARGO_STRING_TYPE, V(1758), V(1756), S(14088, 6), .content.string = S(14094, 5)},
+    {ARGO_STRING_TYPE, V(1759), V(1757), S(15768, 10), .content.string = S(15778, 5)},
+    {ARGO_STRING_TYPE, V(1760), V(1758), S(17208, 7), .content.string = S(17215, 6)},
+    {ARGO_STRING_TYPE, V(1761), V(1759), S(17606, 5), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(1762), V(1760), S(17611, 8), .content.string = S(17619, 5)},
+    {ARGO_STRING_TYPE, V(1763), V(1761), S(17624, 6), .content.string = S(17630, 5)},
+    {ARGO_STRING_TYPE, V(1764), V(1762), S(6644, 2), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1765), V(1763), S(17635, 4), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(1766), V(1764), S(17639, 12), .content.string = S(3728, 5)},
+    {ARGO_STRING_TYPE, V(1753), V(1765), S(17651, 6), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(1772), V(1747), S(17606, 5), .content.object = {V(1768)}},
+    {ARGO_NO_TYPE, V(1769), V(1771), {0}},
+    {ARGO_STRING_TYPE, V(1770), V(1768), S(13, 7), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(1771), V(1769), S(77, 8), .content.string = S(17657, 50)},
+    {ARGO_STRING_TYPE, V(1768), V(1770), S(140, 9), .content.string = S(17707, 33)},
+    {ARGO_OBJECT_TYPE, V(1777), V(1767), S(17611, 8), .content.object = {V(1773)}},
+    {ARGO_NO_TYPE, V(1774), V(1776), {0}},
+    {ARGO_STRING_TYPE, V(1775), V(1773), S(13, 7), .content.string = S(17619, 5)},
+    {ARGO_STRING_TYPE, V(1776), V(1774), S(77, 8), .content.string = S(17740, 56)},
+    {ARGO_STRING_TYPE, V(1773), V(1775), S(140, 9), .content.string = S(17796, 33)},
+    {ARGO_OBJECT_TYPE, V(1803), V(1772), S(17624, 6), .content.object = {V(1778)}},
+    {ARGO_NO_TYPE, V(1779), V(1788), {0}},
+    {ARGO_STRING_TYPE, V(1780), V(1778), S(13, 7), .content.string = S(17630, 5)},
+    {ARGO_STRING_TYPE, V(1781), V(1779), S(77, 8), .content.string = S(17829, 52)},
+    {ARGO_STRING_TYPE, V(1782), V(1780), S(140, 9), .content.string = S(17881, 95)},
+    {ARGO_OBJECT_TYPE, V(1788), V(1781), S(41, 8), .content.object = {V(1783)}},
+    {ARGO_NO_TYPE, V(1784), V(1787), {0}},
+    {ARGO_STRING_TYPE, V(1785), V(1783), S(3493, 8), .content.string = S(3501, 5)},
+    {ARGO_STRING_TYPE, V(1786), V(1784), S(6489, 5), .content.string = S(17976, 5)},
+    {ARGO_STRING_TYPE, V(1787), V(1785), S(17639, 12), .content.string = S(3728, 5)},
+    {ARGO_STRING_TYPE, V(1783), V(1786), S(17651, 6), .content.string = S(10417, 5)},
+    {ARGO_OBJECT_TYPE, V(1778), V(1782), S(49, 12), .content.object = {V(1789)}},
+    {ARGO_NO_TYPE, V(1790), V(1798), {0}},
+    {ARGO_OBJECT_TYPE, V(1798), V(1789), S(6489, 5), .content.object = {V(1791)}},
+    {ARGO_NO_TYPE, V(1792), V(1795), {0}},
+    {ARGO_STRING_TYPE, V(1793), V(1791), S(13, 7), .content.string = S(17976, 5)},
+    {ARGO_STRING_TYPE, V(1794), V(1792), S(77, 8), .content.string = S(17981, 50)},
+    {ARGO_STRING_TYPE, V(1795), V(1793), S(140, 9), .content.string = S(18031, 95)},
+    {ARGO_OBJECT_TYPE, V(1791), V(1794), S(41, 8), .content.object = {V(1796)}},
+    {ARGO_NO_TYPE, V(1797), V(1797), {0}},
+    {ARGO_STRING_TYPE, V(1796), V(1796), S(6644, 2), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(1789), V(1790), S(17651, 6), .content.object = {V(1799)}},
+    {ARGO_NO_TYPE, V(1800), V(1802), {0}},
+    {ARGO_STRING_TYPE, V(1801), V(1799), S(13, 7), .content.string = S(10417, 5)},
+    {ARGO_STRING_TYPE, V(1802), V(1800), S(77, 8), .content.string = S(18126, 52)},
+    {ARGO_STRING_TYPE, V(1799), V(1801), S(140, 9), .content.string = S(18178, 33)},
+    {ARGO_OBJECT_TYPE, V(1808), V(1777), S(6644, 2), .content.object = {V(1804)}},
+    {ARGO_NO_TYPE, V(1805), V(1807), {0}},
+    {ARGO_STRING_TYPE, V(1806), V(1804), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(1807), V(1805), S(77, 8), .content.string = S(18211, 44)},
+    {ARGO_STRING_TYPE, V(1804), V(1806), S(140, 9), .content.string = S(18255, 33)},
+    {ARGO_OBJECT_TYPE, V(1813), V(1803), S(17635, 4), .content.object = {V(1809)}},
+    {ARGO_NO_TYPE, V(1810), V(1812), {0}},
+    {ARGO_STRING_TYPE, V(1811), V(1809), S(13, 7), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(1812), V(1810), S(77, 8), .content.string = S(18288, 48)},
+    {ARGO_STRING_TYPE, V(1809), V(1811), S(140, 9), .content.string = S(18336, 95)},
+    {ARGO_OBJECT_TYPE, V(1818), V(1808), S(18431, 11), .content.object = {V(1814)}},
+    {ARGO_NO_TYPE, V(1815), V(1817), {0}},
+    {ARGO_STRING_TYPE, V(1816), V(1814), S(13, 7), .content.string = S(18442, 5)},
+    {ARGO_STRING_TYPE, V(1817), V(1815), S(77, 8), .content.string = S(18447, 62)},
+    {ARGO_STRING_TYPE, V(1814), V(1816), S(140, 9), .content.string = S(18509, 33)},
+    {ARGO_OBJECT_TYPE, V(1824), V(1813), S(9324, 3), .content.object = {V(1819)}},
+    {ARGO_NO_TYPE, V(1820), V(1823), {0}},
+    {ARGO_STRING_TYPE, V(1821), V(1819), S(13, 7), .content.string = S(9327, 5)},
+    {ARGO_STRING_TYPE, V(1822), V(1820), S(77, 8), .content.string = S(18542, 46)},
+    {ARGO_STRING_TYPE, V(1823), V(1821), S(140, 9), .content.string = S(18588, 33)},
+    {ARGO_BASIC_TYPE, V(1819), V(1822), S(9316, 8), .content.basic = ARGO_TRUE},
+    {ARGO_OBJECT_TYPE, V(1843), V(1818), S(18621, 6), .content.object = {V(1825)}},
+    {ARGO_NO_TYPE, V(1826), V(1833), {0}},
+    {ARGO_STRING_TYPE, V(1827), V(1825), S(13, 7), .content.string = S(9491, 5)},
+    {ARGO_STRING_TYPE, V(1828), V(1826), S(77, 8), .content.string = S(18627, 52)},
+    {ARGO_STRING_TYPE, V(1829), V(1827), S(140, 9), .content.string = S(18679, 33)},
+    {ARGO_OBJECT_TYPE, V(1833), V(1828), S(41, 8), .content.object = {V(1830)}},
+    {ARGO_NO_TYPE, V(1831), V(1832), {0}},
+    {ARGO_STRING_TYPE, V(1832), V(1830), S(6489, 5), .content.string = S(17976, 5)},
+    {ARGO_STRING_TYPE, V(1830), V(1831), S(11763, 10), .content.string = S(11773, 6)},
+    {ARGO_OBJECT_TYPE, V(1825), V(1829), S(49, 12), .content.object = {V(1834)}},
+    {ARGO_NO_TYPE, V(1835), V(1835), {0}},
+    {ARGO_OBJECT_TYPE, V(1834), V(1834), S(6489, 5), .content.object = {V(1836)}},
+    {ARGO_NO_TYPE, V(1837), V(1840), {0}},
+    {ARGO_STRING_TYPE, V(1838), V(1836), S(13, 7), .content.string = S(17976, 5)},
+    {ARGO_STRING_TYPE, V(1839), V(1837), S(77, 8), .content.string = S(17981, 50)},
+    {ARGO_STRING_TYPE, V(1840), V(1838), S(140, 9), .content.string = S(18031, 95)},
+    {ARGO_OBJECT_TYPE, V(1836), V(1839), S(41, 8), .content.object = {V(1841)}},
+    {ARGO_NO_TYPE, V(1842), V(1842), {0}},
+    {ARGO_STRING_TYPE, V(1841), V(1841), S(6644, 2), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(1848), V(1824), S(1057, 10), .content.object = {V(1844)}},
+    {ARGO_NO_TYPE, V(1845), V(1847), {0}},
+    {ARGO_STRING_TYPE, V(1846), V(1844), S(13, 7), .content.string = S(1067, 5)},
+    {ARGO_STRING_TYPE, V(1847), V(1845), S(77, 8), .content.string = S(18712, 60)},
+    {ARGO_STRING_TYPE, V(1844), V(1846), S(140, 9), .content.string = S(18772, 33)},
+    {ARGO_OBJECT_TYPE, V(1856), V(1843), S(1780, 14), .content.object = {V(1849)}},
+    {ARGO_NO_TYPE, V(1850), V(1853), {0}},
+    {ARGO_STRING_TYPE, V(1851), V(1849), S(13, 7), .content.string = S(1280, 5)},
+    {ARGO_STRING_TYPE, V(1852), V(1850), S(77, 8), .content.string = S(18805, 68)},
+    {ARGO_STRING_TYPE, V(1853), V(1851), S(140, 9), .content.string = S(18873, 33)},
+    {ARGO_OBJECT_TYPE, V(1849), V(1852), S(41, 8), .content.object = {V(1854)}},
+    {ARGO_NO_TYPE, V(1855), V(1855), {0}},
+    {ARGO_STRING_TYPE, V(1854), V(1854), S(18906, 25), .content.string = S(276, 5)},
+    {ARGO_OBJECT_TYPE, V(1872), V(1848), S(18931, 8), .content.object = {V(1857)}},
+    {ARGO_NO_TYPE, V(1858), V(1865), {0}},
+    {ARGO_STRING_TYPE, V(1859), V(1857), S(13, 7), .content.string = S(9482, 5)},
+    {ARGO_STRING_TYPE, V(1860), V(1858), S(77, 8), .content.string = S(18939, 56)},
+    {ARGO_STRING_TYPE, V(1861), V(1859), S(140, 9), .content.string = S(18995, 33)},
+    {ARGO_OBJECT_TYPE, V(1865), V(1860), S(41, 8), .content.object = {V(1862)}},
+    {ARGO_NO_TYPE, V(1863), V(1864), {0}},
+    {ARGO_STRING_TYPE, V(1864), V(1862), S(7772, 13), .content.string = S(19028, 6)},
+    {ARGO_STRING_TYPE, V(1862), V(1863), S(15475, 4), .content.string = S(8436, 6)},
+    {ARGO_OBJECT_TYPE, V(1857), V(1861), S(49, 12), .content.object = {V(1866)}},
+    {ARGO_NO_TYPE, V(1867), V(1867), {0}},
+    {ARGO_OBJECT_TYPE, V(1866), V(1866), S(7772, 13), .content.object = {V(1868)}},
+    {ARGO_NO_TYPE, V(1869), V(1871), {0}},
+    {ARGO_STRING_TYPE, V(1870), V(1868), S(13, 7), .content.string = S(19028, 6)},
+    {ARGO_STRING_TYPE, V(1871), V(1869), S(77, 8), .content.string = S(19034, 67)},
+    {ARGO_STRING_TYPE, V(1868), V(1870), S(140, 9), .content.string = S(19101, 33)},
+    {ARGO_OBJECT_TYPE, V(1881), V(1856), S(16392, 11), .content.object = {V(1873)}},
+    {ARGO_NO_TYPE, V(1874), V(1877), {0}},
+    {ARGO_STRING_TYPE, V(1875), V(1873), S(13, 7), .content.string = S(4563, 5)},
+    {ARGO_STRING_TYPE, V(1876), V(1874), S(77, 8), .content.string = S(19134, 62)},
+    {ARGO_STRING_TYPE, V(1877), V(1875), S(140, 9), .content.string = S(19196, 33)},
+    {ARGO_OBJECT_TYPE, V(1873), V(1876), S(41, 8), .content.object = {V(1878)}},
+    {ARGO_NO_TYPE, V(1879), V(1880), {0}},
+    {ARGO_STRING_TYPE, V(1880), V(1878), S(8877, 7), .content.string = S(7899, 5)},
+    {ARGO_STRING_TYPE, V(1878), V(1879), S(12892, 13), .content.string = S(8023, 5)},
+    {ARGO_OBJECT_TYPE, V(1889), V(1872), S(14545, 11), .content.object = {V(1882)}},
+    {ARGO_NO_TYPE, V(1883), V(1886), {0}},
+    {ARGO_STRING_TYPE, V(1884), V(1882), S(13, 7), .content.string = S(14556, 5)},
+    {ARGO_STRING_TYPE, V(1885), V(1883), S(77, 8), .content.string = S(19229, 62)},
+    {ARGO_STRING_TYPE, V(1886), V(1884), S(140, 9), .content.string = S(19291, 33)},
+    {ARGO_OBJECT_TYPE, V(1882), V(1885), S(41, 8), .content.object = {V(1887)}},
+    {ARGO_NO_TYPE, V(1888), V(1888), {0}},
+    {ARGO_STRING_TYPE, V(1887), V(1887), S(7024, 8), .content.string = S(5910, 5)},
+    {ARGO_OBJECT_TYPE, V(1897), V(1881), S(9929, 4), .content.object = {V(1890)}},
+    {ARGO_NO_TYPE, V(1891), V(1894), {0}},
+    {ARGO_STRING_TYPE, V(1892), V(1890), S(13, 7), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(1893), V(1891), S(77, 8), .content.string = S(19324, 48)},
+    {ARGO_STRING_TYPE, V(1894), V(1892), S(140, 9), .content.string = S(19372, 33)},
+    {ARGO_OBJECT_TYPE, V(1890), V(1893), S(41, 8), .content.object = {V(1895)}},
+    {ARGO_NO_TYPE, V(1896), V(1896), {0}},
+    {ARGO_STRING_TYPE, V(1895), V(1895), S(10010, 6), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(1902), V(1889), S(14561, 4), .content.object = {V(1898)}},
+    {ARGO_NO_TYPE, V(1899), V(1901), {0}},
+    {ARGO_STRING_TYPE, V(1900), V(1898), S(13, 7), .content.string = S(11655, 5)},
+    {ARGO_STRING_TYPE, V(1901), V(1899), S(77, 8), .content.string = S(19405, 48)},
+    {ARGO_STRING_TYPE, V(1898), V(1900), S(140, 9), .content.string = S(19453, 33)},
+    {ARGO_OBJECT_TYPE, V(1913), V(1897), S(16403, 10), .content.object = {V(1903)}},
+    {ARGO_NO_TYPE, V(1904), V(1907), {0}},
+    {ARGO_STRING_TYPE, V(1905), V(1903), S(13, 7), .content.string = S(9818, 5)},
+    {ARGO_STRING_TYPE, V(1906), V(1904), S(77, 8), .content.string = S(19486, 60)},
+    {ARGO_STRING_TYPE, V(1907), V(1905), S(140, 9), .content.string = S(19546, 33)},
+    {ARGO_OBJECT_TYPE, V(1903), V(1906), S(41, 8), .content.object = {V(1908)}},
+    {ARGO_NO_TYPE, V(1909), V(1912), {0}},
+    {ARGO_STRING_TYPE, V(1910), V(1908), S(10738, 9), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(1911), V(1909), S(12651, 10), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(1912), V(1910), S(8330, 10), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1908), V(1911), S(4556, 7), .content.string = S(4563, 5)},
+    {ARGO_OBJECT_TYPE, V(1918), V(1902), S(14565, 8), .content.object = {V(1914)}},
+    {ARGO_NO_TYPE, V(1915), V(1917), {0}},
+    {ARGO_STRING_TYPE, V(1916), V(1914), S(13, 7), .content.string = S(1608, 5)},
+    {ARGO_STRING_TYPE, V(1917), V(1915), S(77, 8), .content.string = S(19579, 56)},
+    {ARGO_STRING_TYPE, V(1914), V(1916), S(140, 9), .content.string = S(19635, 33)},
+    {ARGO_OBJECT_TYPE, V(1923), V(1913), S(15247, 19), .content.object = {V(1919)}},
+    {ARGO_NO_TYPE, V(1920), V(1922), {0}},
+    {ARGO_STRING_TYPE, V(1921), V(1919), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(1922), V(1920), S(77, 8), .content.string = S(19668, 78)},
+    {ARGO_STRING_TYPE, V(1919), V(1921), S(140, 9), .content.string = S(19746, 33)},
+    {ARGO_OBJECT_TYPE, V(1928), V(1918), S(4568, 16), .content.object = {V(1924)}},
+    {ARGO_NO_TYPE, V(1925), V(1927), {0}},
+    {ARGO_STRING_TYPE, V(1926), V(1924), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(1927), V(1925), S(77, 8), .content.string = S(19779, 72)},
+    {ARGO_STRING_TYPE, V(1924), V(1926), S(140, 9), .content.string = S(19851, 33)},
+    {ARGO_OBJECT_TYPE, V(1933), V(1923), S(19884, 10), .content.object = {V(1929)}},
+    {ARGO_NO_TYPE, V(1930), V(1932), {0}},
+    {ARGO_STRING_TYPE, V(1931), V(1929), S(13, 7), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(1932), V(1930), S(77, 8), .content.string = S(19894, 60)},
+    {ARGO_STRING_TYPE, V(1929), V(1931), S(140, 9), .content.string = S(19954, 33)},
+    {ARGO_OBJECT_TYPE, V(1941), V(1928), S(15461, 14), .content.object = {V(1934)}},
+    {ARGO_NO_TYPE, V(1935), V(1938), {0}},
+    {ARGO_STRING_TYPE, V(1936), V(1934), S(13, 7), .content.string = S(4416, 5)},
+    {ARGO_STRING_TYPE, V(1937), V(1935), S(77, 8), .content.string = S(19987, 68)},
+    {ARGO_STRING_TYPE, V(1938), V(1936), S(140, 9), .content.string = S(20055, 33)},
+    {ARGO_OBJECT_TYPE, V(1934), V(1937), S(41, 8), .content.object = {V(1939)}},
+    {ARGO_NO_TYPE, V(1940), V(1940), {0}},
+    {ARGO_STRING_TYPE, V(1939), V(1939), S(10068, 7), .content.string = S(3728, 5)},
+    {ARGO_OBJECT_TYPE, V(1946), V(1933), S(20088, 8), .content.object = {V(1942)}},
+    {ARGO_NO_TYPE, V(1943), V(1945), {0}},
+    {ARGO_STRING_TYPE, V(1944), V(1942), S(13, 7), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(1945), V(1943), S(77, 8), .content.string = S(20096, 56)},
+    {ARGO_STRING_TYPE, V(1942), V(1944), S(140, 9), .content.string = S(20152, 95)},
+    {ARGO_OBJECT_TYPE, V(1991), V(1941), S(20247, 3), .content.object = {V(1947)}},
+    {ARGO_NO_TYPE, V(1948), V(1981), {0}},
+    {ARGO_STRING_TYPE, V(1949), V(1947), S(13, 7), .content.string = S(20250, 5)},
+    {ARGO_STRING_TYPE, V(1950), V(1948), S(77, 8), .content.string = S(20255, 46)},
+    {ARGO_STRING_TYPE, V(1951), V(1949), S(140, 9), .content.string = S(20301, 95)},
+    {ARGO_OBJECT_TYPE, V(1981), V(1950), S(41, 8), .content.object = {V(1952)}},
+    {ARGO_NO_TYPE, V(1953), V(1980), {0}},
+    {ARGO_STRING_TYPE, V(1954), V(1952), S(2626, 5), .content.string = S(20396, 5)},
+    {ARGO_STRING_TYPE, V(1955), V(1953), S(3392, 7), .content.string = S(3399, 6)},
+    {ARGO_STRING_TYPE, V(1956), V(1954), S(4165, 5), .content.string = S(4170, 5)},
+    {ARGO_STRING_TYPE, V(1957), V(1955), S(4408, 8), .content.string = S(4416, 5)},
+    {ARGO_STRING_TYPE, V(1958), V(1956), S(4597, 20), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(1959), V(1957), S(5108, 9), .content.string = S(5117, 6)},
+    {ARGO_STRING_TYPE, V(1960), V(1958), S(6233, 4), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(1961), V(1959), S(6489, 5), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1962), V(1960), S(7772, 13), .content.string = S(4278, 5)},
+    {ARGO_STRING_TYPE, V(1963), V(1961), S(8430, 6), .content.string = S(8436, 6)},
+    {ARGO_STRING_TYPE, V(1964), V(1962), S(10465, 3), .content.string = S(10468, 32)},
+    {ARGO_STRING_TYPE, V(1965), V(1963), S(9773, 6), .content.string = S(9779, 5)},
+    {ARGO_STRING_TYPE, V(1966), V(1964), S(16944, 6), .content.string = S(16950, 6)},
+    {ARGO_STRING_TYPE, V(1967), V(1965), S(18621, 6), .content.string = S(9491, 5)},
+    {ARGO_STRING_TYPE, V(1968), V(1966), S(18931, 8), .content.string = S(9482, 5)},
+    {ARGO_STRING_TYPE, V(1969), V(1967), S(20088, 8), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(1970), V(1968), S(20401, 8), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1971), V(1969), S(20409, 12), .content.string = S(20421, 5)},
+    {ARGO_STRING_TYPE, V(1972), V(1970), S(20426, 10), .content.string = S(20436, 5)},
+    {ARGO_STRING_TYPE, V(1973), V(1971), S(20441, 14), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(1974), V(1972), S(20455, 3), .content.string = S(20458, 5)},
+    {ARGO_STRING_TYPE, V(1975), V(1973), S(20463, 8), .content.string = S(20471, 5)},
+    {ARGO_STRING_TYPE, V(1976), V(1974), S(3021, 6), .content.string = S(3027, 5)},
+    {ARGO_STRING_TYPE, V(1977), V(1975), S(20476, 7), .content.string = S(20483, 5)},
+    {ARGO_STRING_TYPE, V(1978), V(1976), S(20488, 18), .content.string = S(20421, 5)},
+    {ARGO_STRING_TYPE, V(1979), V(1977), S(2134, 10), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(1980), V(1978), S(20506, 6), .content.string = S(20512, 6)},
+    {ARGO_STRING_TYPE, V(1952), V(1979), S(20518, 6), .content.string = S(10747, 5)},
+    {ARGO_OBJECT_TYPE, V(1947), V(1951), S(49, 12), .content.object = {V(1982)}},
+    {ARGO_NO_TYPE, V(1983), V(1983), {0}},
+    {ARGO_OBJECT_TYPE, V(1982), V(1982), S(2626, 5), .content.object = {V(1984)}},
+    {ARGO_NO_TYPE, V(1985), V(1988), {0}},
+    {ARGO_STRING_TYPE, V(1986), V(1984), S(13, 7), .content.string = S(20396, 5)},
+    {ARGO_STRING_TYPE, V(1987), V(1985), S(77, 8), .content.string = S(20524, 50)},
+    {ARGO_STRING_TYPE, V(1988), V(1986), S(140, 9), .content.string = S(20574, 95)},
+    {ARGO_OBJECT_TYPE, V(1984), V(1987), S(41, 8), .content.object = {V(1989)}},
+    {ARGO_NO_TYPE, V(1990), V(1990), {0}},
+    {ARGO_STRING_TYPE, V(1989), V(1989), S(2719, 6), .content.string = S(2725, 6)},
+    {ARGO_OBJECT_TYPE, V(2002), V(1946), S(20401, 8), .content.object = {V(1992)}},
+    {ARGO_NO_TYPE, V(1993), V(1996), {0}},
+    {ARGO_STRING_TYPE, V(1994), V(1992), S(13, 7), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1995), V(1993), S(77, 8), .content.string = S(20669, 56)},
+    {ARGO_STRING_TYPE, V(1996), V(1994), S(140, 9), .content.string = S(20725, 95)},
+    {ARGO_OBJECT_TYPE, V(1992), V(1995), S(41, 8), .content.object = {V(1997)}},
+    {ARGO_NO_TYPE, V(1998), V(2001), {0}},
+    {ARGO_STRING_TYPE, V(1999), V(1997), S(1072, 3), .content.string = S(1075, 5)},
+    {ARGO_STRING_TYPE, V(2000), V(1998), S(1159, 11), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(2001), V(1999), S(6489, 5), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(1997), V(2000), S(7547, 13), .content.string = S(3728, 5)},
+    {ARGO_OBJECT_TYPE, V(2011), V(1991), S(20409, 12), .content.object = {V(2003)}},
+    {ARGO_NO_TYPE, V(2004), V(2007), {0}},
+    {ARGO_STRING_TYPE, V(2005), V(2003), S(13, 7), .content.string = S(20421, 5)},
+    {ARGO_STRING_TYPE, V(2006), V(2004), S(77, 8), .content.string = S(20820, 64)},
+    {ARGO_STRING_TYPE, V(2007), V(2005), S(140, 9), .content.string = S(20884, 95)},
+    {ARGO_OBJECT_TYPE, V(2003), V(2006), S(41, 8), .content.object = {V(2008)}},
+    {ARGO_NO_TYPE, V(2009), V(2010), {0}},
+    {ARGO_STRING_TYPE, V(2010), V(2008), S(6489, 5), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(2008), V(2009), S(8430, 6), .content.string = S(8436, 6)},
+    {ARGO_OBJECT_TYPE, V(2027), V(2002), S(20426, 10), .content.object = {V(2012)}},
+    {ARGO_NO_TYPE, V(2013), V(2020), {0}},
+    {ARGO_STRING_TYPE, V(2014), V(2012), S(13, 7), .content.string = S(20436, 5)},
+    {ARGO_STRING_TYPE, V(2015), V(2013), S(77, 8), .content.string = S(20979, 60)},
+    {ARGO_STRING_TYPE, V(2016), V(2014), S(140, 9), .content.string = S(21039, 95)},
+    {ARGO_OBJECT_TYPE, V(2020), V(2015), S(41, 8), .content.object = {V(2017)}},
+    {ARGO_NO_TYPE, V(2018), V(2019), {0}},
+    {ARGO_STRING_TYPE, V(2019), V(2017), S(2626, 5), .content.string = S(21134, 5)},
+    {ARGO_STRING_TYPE, V(2017), V(2018), S(21139, 3), .content.string = S(1500, 5)},
+    {ARGO_OBJECT_TYPE, V(2012), V(2016), S(49, 12), .content.object = {V(2021)}},
+    {ARGO_NO_TYPE, V(2022), V(2022), {0}},
+    {ARGO_OBJECT_TYPE, V(2021), V(2021), S(2626, 5), .content.object = {V(2023)}},
+    {ARGO_NO_TYPE, V(2024), V(2026), {0}},
+    {ARGO_STRING_TYPE, V(2025), V(2023), S(13, 7), .content.string = S(21134, 5)},
+    {ARGO_STRING_TYPE, V(2026), V(2024), S(77, 8), .content.string = S(21142, 50)},
+    {ARGO_STRING_TYPE, V(2023), V(2025), S(140, 9), .content.string = S(21192, 33)},
+    {ARGO_OBJECT_TYPE, V(2035), V(2011), S(20441, 14), .content.object = {V(2028)}},
+    {ARGO_NO_TYPE, V(2029), V(2032), {0}},
+    {ARGO_STRING_TYPE, V(2030), V(2028), S(13, 7), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(2031), V(2029), S(77, 8), .content.string = S(21225, 68)},
+    {ARGO_STRING_TYPE, V(2032), V(2030), S(140, 9), .content.string = S(21293, 33)},
+    {ARGO_OBJECT_TYPE, V(2028), V(2031), S(41, 8), .content.object = {V(2033)}},
+    {ARGO_NO_TYPE, V(2034), V(2034), {0}},
+    {ARGO_STRING_TYPE, V(2033), V(2033), S(4320, 5), .content.string = S(1170, 5)},
+    {ARGO_OBJECT_TYPE, V(2045), V(2027), S(20455, 3), .content.object = {V(2036)}},
+    {ARGO_NO_TYPE, V(2037), V(2040), {0}},
+    {ARGO_STRING_TYPE, V(2038), V(2036), S(13, 7), .content.string = S(20458, 5)},
+    {ARGO_STRING_TYPE, V(2039), V(2037), S(77, 8), .content.string = S(21326, 46)},
+    {ARGO_STRING_TYPE, V(2040), V(2038), S(140, 9), .content.string = S(21372, 33)},
+    {ARGO_OBJECT_TYPE, V(2036), V(2039), S(41, 8), .content.object = {V(2041)}},
+    {ARGO_NO_TYPE, V(2042), V(2044), {0}},
+    {ARGO_STRING_TYPE, V(2043), V(2041), S(6489, 5), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(2044), V(2042), S(10116, 19), .content.string = S(10135, 5)},
+    {ARGO_STRING_TYPE, V(2041), V(2043), S(21405, 3), .content.string = S(21408, 5)},
+    {ARGO_OBJECT_TYPE, V(2050), V(2035), S(3846, 8), .content.object = {V(2046)}},
+    {ARGO_NO_TYPE, V(2047), V(2049), {0}},
+    {ARGO_STRING_TYPE, V(2048), V(2046), S(13, 7), .content.string = S(3854, 5)},
+    {ARGO_STRING_TYPE, V(2049), V(2047), S(77, 8), .content.string = S(21413, 56)},
+    {ARGO_STRING_TYPE, V(2046), V(2048), S(140, 9), .content.string = S(21469, 33)},
+    {ARGO_OBJECT_TYPE, V(2055), V(2045), S(10304, 20), .content.object = {V(2051)}},
+    {ARGO_NO_TYPE, V(2052), V(2054), {0}},
+    {ARGO_STRING_TYPE, V(2053), V(2051), S(13, 7), .content.string = S(10324, 5)},
+    {ARGO_STRING_TYPE, V(2054), V(2052), S(77, 8), .content.string = S(21502, 80)},
+    {ARGO_STRING_TYPE, V(2051), V(2053), S(140, 9), .content.string = S(21582, 33)},
+    {ARGO_OBJECT_TYPE, V(2063), V(2050), S(20463, 8), .content.object = {V(2056)}},
+    {ARGO_NO_TYPE, V(2057), V(2060), {0}},
+    {ARGO_STRING_TYPE, V(2058), V(2056), S(13, 7), .content.string = S(20471, 5)},
+    {ARGO_STRING_TYPE, V(2059), V(2057), S(77, 8), .content.string = S(21615, 56)},
+    {ARGO_STRING_TYPE, V(2060), V(2058), S(140, 9), .content.string = S(21671, 33)},
+    {ARGO_OBJECT_TYPE, V(2056), V(2059), S(41, 8), .content.object = {V(2061)}},
+    {ARGO_NO_TYPE, V(2062), V(2062), {0}},
+    {ARGO_STRING_TYPE, V(2061), V(2061), S(21704, 4), .content.string = S(10324, 5)},
+    {ARGO_OBJECT_TYPE, V(2068), V(2055), S(4984, 2), .content.object = {V(2064)}},
+    {ARGO_NO_TYPE, V(2065), V(2067), {0}},
+    {ARGO_STRING_TYPE, V(2066), V(2064), S(13, 7), .content.string = S(4986, 5)},
+    {ARGO_STRING_TYPE, V(2067), V(2065), S(77, 8), .content.string = S(21708, 44)},
+    {ARGO_STRING_TYPE, V(2064), V(2066), S(140, 9), .content.string = S(21752, 95)},
+    {ARGO_OBJECT_TYPE, V(2105), V(2063), S(8753, 10), .content.object = {V(2069)}},
+    {ARGO_NO_TYPE, V(2070), V(2077), {0}},
+    {ARGO_STRING_TYPE, V(2071), V(2069), S(13, 7), .content.string = S(8763, 5)},
+    {ARGO_STRING_TYPE, V(2072), V(2070), S(77, 8), .content.string = S(21847, 60)},
+    {ARGO_STRING_TYPE, V(2073), V(2071), S(140, 9), .content.string = S(21907, 95)},
+    {ARGO_OBJECT_TYPE, V(2077), V(2072), S(41, 8), .content.object = {V(2074)}},
+    {ARGO_NO_TYPE, V(2075), V(2076), {0}},
+    {ARGO_STRING_TYPE, V(2076), V(2074), S(8736, 9), .content.string = S(4077, 5)},
+    {ARGO_STRING_TYPE, V(2074), V(2075), S(13411, 7), .content.string = S(14518, 5)},
+    {ARGO_OBJECT_TYPE, V(2069), V(2073), S(49, 12), .content.object = {V(2078)}},
+    {ARGO_NO_TYPE, V(2079), V(2097), {0}},
+    {ARGO_OBJECT_TYPE, V(2097), V(2078), S(8736, 9), .content.object = {V(2080)}},
+    {ARGO_NO_TYPE, V(2081), V(2087), {0}},
+    {ARGO_STRING_TYPE, V(2082), V(2080), S(13, 7), .content.string = S(4077, 5)},
+    {ARGO_STRING_TYPE, V(2083), V(2081), S(77, 8), .content.string = S(22002, 58)},
+    {ARGO_STRING_TYPE, V(2084), V(2082), S(140, 9), .content.string = S(22060, 33)},
+    {ARGO_OBJECT_TYPE, V(2087), V(2083), S(41, 8), .content.object = {V(2085)}},
+    {ARGO_NO_TYPE, V(2086), V(2086), {0}},
+    {ARGO_STRING_TYPE, V(2085), V(2085), S(13411, 7), .content.string = S(13418, 5)},
+    {ARGO_OBJECT_TYPE, V(2080), V(2084), S(49, 12), .content.object = {V(2088)}},
+    {ARGO_NO_TYPE, V(2089), V(2089), {0}},
+    {ARGO_OBJECT_TYPE, V(2088), V(2088), S(13411, 7), .content.object = {V(2090)}},
+    {ARGO_NO_TYPE, V(2091), V(2094), {0}},
+    {ARGO_STRING_TYPE, V(2092), V(2090), S(13, 7), .content.string = S(13418, 5)},
+    {ARGO_STRING_TYPE, V(2093), V(2091), S(77, 8), .content.string = S(14271, 54)},
+    {ARGO_STRING_TYPE, V(2094), V(2092), S(140, 9), .content.string = S(14325, 33)},
+    {ARGO_OBJECT_TYPE, V(2090), V(2093), S(41, 8), .content.object = {V(2095)}},
+    {ARGO_NO_TYPE, V(2096), V(2096), {0}},
+    {ARGO_STRING_TYPE, V(2095), V(2095), S(12484, 9), .content.string = S(12493, 5)},
+    {ARGO_OBJECT_TYPE, V(2078), V(2079), S(13411, 7), .content.object = {V(2098)}},
+    {ARGO_NO_TYPE, V(2099), V(2102), {0}},
+    {ARGO_STRING_TYPE, V(2100), V(2098), S(13, 7), .content.string = S(14518, 5)},
+    {ARGO_STRING_TYPE, V(2101), V(2099), S(77, 8), .content.string = S(22093, 54)},
+    {ARGO_STRING_TYPE, V(2102), V(2100), S(140, 9), .content.string = S(22147, 33)},
+    {ARGO_OBJECT_TYPE, V(2098), V(2101), S(41, 8), .content.object = {V(2103)}},
+    {ARGO_NO_TYPE, V(2104), V(2104), {0}},
+    {ARGO_STRING_TYPE, V(2103), V(2103), S(12484, 9), .content.string = S(12493, 5)},
+    {ARGO_OBJECT_TYPE, V(2116), V(2068), S(4991, 8), .content.object = {V(2106)}},
+    {ARGO_NO_TYPE, V(2107), V(2110), {0}},
+    {ARGO_STRING_TYPE, V(2108), V(2106), S(13, 7), .content.string = S(4999, 5)},
+    {ARGO_STRING_TYPE, V(2109), V(2107), S(77, 8), .content.string = S(22180, 56)},
+    {ARGO_STRING_TYPE, V(2110), V(2108), S(140, 9), .content.string = S(22236, 33)},
+    {ARGO_OBJECT_TYPE, V(2106), V(2109), S(41, 8), .content.object = {V(2111)}},
+    {ARGO_NO_TYPE, V(2112), V(2115), {0}},
+    {ARGO_STRING_TYPE, V(2113), V(2111), S(4072, 5), .content.string = S(4077, 5)},
+    {ARGO_STRING_TYPE, V(2114), V(2112), S(11402, 11), .content.string = S(11413, 5)},
+    {ARGO_STRING_TYPE, V(2115), V(2113), S(11763, 10), .content.string = S(11773, 6)},
+    {ARGO_STRING_TYPE, V(2111), V(2114), S(22269, 6), .content.string = S(20, 5)},
+    {ARGO_OBJECT_TYPE, V(2124), V(2105), S(21704, 4), .content.object = {V(2117)}},
+    {ARGO_NO_TYPE, V(2118), V(2121), {0}},
+    {ARGO_STRING_TYPE, V(2119), V(2117), S(13, 7), .content.string = S(10324, 5)},
+    {ARGO_STRING_TYPE, V(2120), V(2118), S(77, 8), .content.string = S(22275, 48)},
+    {ARGO_STRING_TYPE, V(2121), V(2119), S(140, 9), .content.string = S(22323, 33)},
+    {ARGO_OBJECT_TYPE, V(2117), V(2120), S(41, 8), .content.object = {V(2122)}},
+    {ARGO_NO_TYPE, V(2123), V(2123), {0}},
+    {ARGO_STRING_TYPE, V(2122), V(2122), S(18431, 11), .content.string = S(18442, 5)},
+    {ARGO_OBJECT_TYPE, V(2145), V(2116), S(9420, 15), .content.object = {V(2125)}},
+    {ARGO_NO_TYPE, V(2126), V(2138), {0}},
+    {ARGO_STRING_TYPE, V(2127), V(2125), S(13, 7), .content.string = S(17321, 5)},
+    {ARGO_STRING_TYPE, V(2128), V(2126), S(77, 8), .content.string = S(22356, 70)},
+    {ARGO_STRING_TYPE, V(2129), V(2127), S(140, 9), .content.string = S(22426, 33)},
+    {ARGO_OBJECT_TYPE, V(2138), V(2128), S(41, 8), .content.object = {V(2130)}},
+    {ARGO_NO_TYPE, V(2131), V(2137), {0}},
+    {ARGO_STRING_TYPE, V(2132), V(2130), S(3963, 12), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2133), V(2131), S(6124, 12), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(2134), V(2132), S(4529, 8), .content.string = S(4537, 5)},
+    {ARGO_STRING_TYPE, V(2135), V(2133), S(10068, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2136), V(2134), S(10304, 20), .content.string = S(10324, 5)},
+    {ARGO_STRING_TYPE, V(2137), V(2135), S(10366, 14), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(2130), V(2136), S(10380, 14), .content.string = S(6025, 5)},
+    {ARGO_OBJECT_TYPE, V(2125), V(2129), S(49, 12), .content.object = {V(2139)}},
+    {ARGO_NO_TYPE, V(2140), V(2140), {0}},
+    {ARGO_OBJECT_TYPE, V(2139), V(2139), S(10068, 7), .content.object = {V(2141)}},
+    {ARGO_NO_TYPE, V(2142), V(2144), {0}},
+    {ARGO_STRING_TYPE, V(2143), V(2141), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2144), V(2142), S(77, 8), .content.string = S(13801, 54)},
+    {ARGO_STRING_TYPE, V(2141), V(2143), S(140, 9), .content.string = S(13855, 33)},
+    {ARGO_OBJECT_TYPE, V(2156), V(2124), S(4584, 8), .content.object = {V(2146)}},
+    {ARGO_NO_TYPE, V(2147), V(2150), {0}},
+    {ARGO_STRING_TYPE, V(2148), V(2146), S(13, 7), .content.string = S(4592, 5)},
+    {ARGO_STRING_TYPE, V(2149), V(2147), S(77, 8), .content.string = S(22459, 56)},
+    {ARGO_STRING_TYPE, V(2150), V(2148), S(140, 9), .content.string = S(22515, 33)},
+    {ARGO_OBJECT_TYPE, V(2146), V(2149), S(41, 8), .content.object = {V(2151)}},
+    {ARGO_NO_TYPE, V(2152), V(2155), {0}},
+    {ARGO_STRING_TYPE, V(2153), V(2151), S(9756, 11), .content.string = S(9767, 6)},
+    {ARGO_STRING_TYPE, V(2154), V(2152), S(9809, 9), .content.string = S(9818, 5)},
+    {ARGO_STRING_TYPE, V(2155), V(2153), S(9420, 15), .content.string = S(17321, 5)},
+    {ARGO_STRING_TYPE, V(2151), V(2154), S(22548, 18), .content.string = S(2741, 5)},
+    {ARGO_OBJECT_TYPE, V(2164), V(2145), S(22566, 7), .content.object = {V(2157)}},
+    {ARGO_NO_TYPE, V(2158), V(2161), {0}},
+    {ARGO_STRING_TYPE, V(2159), V(2157), S(13, 7), .content.string = S(22573, 5)},
+    {ARGO_STRING_TYPE, V(2160), V(2158), S(77, 8), .content.string = S(22578, 54)},
+    {ARGO_STRING_TYPE, V(2161), V(2159), S(140, 9), .content.string = S(22632, 33)},
+    {ARGO_OBJECT_TYPE, V(2157), V(2160), S(41, 8), .content.object = {V(2162)}},
+    {ARGO_NO_TYPE, V(2163), V(2163), {0}},
+    {ARGO_STRING_TYPE, V(2162), V(2162), S(22665, 7), .content.string = S(14094, 5)},
+    {ARGO_OBJECT_TYPE, V(2172), V(2156), S(16413, 11), .content.object = {V(2165)}},
+    {ARGO_NO_TYPE, V(2166), V(2169), {0}},
+    {ARGO_STRING_TYPE, V(2167), V(2165), S(13, 7), .content.string = S(16424, 5)},
+    {ARGO_STRING_TYPE, V(2168), V(2166), S(77, 8), .content.string = S(22672, 62)},
+    {ARGO_STRING_TYPE, V(2169), V(2167), S(140, 9), .content.string = S(22734, 95)},
+    {ARGO_OBJECT_TYPE, V(2165), V(2168), S(41, 8), .content.object = {V(2170)}},
+    {ARGO_NO_TYPE, V(2171), V(2171), {0}},
+    {ARGO_STRING_TYPE, V(2170), V(2170), S(12754, 16), .content.string = S(12770, 5)},
+    {ARGO_OBJECT_TYPE, V(2177), V(2164), S(17639, 12), .content.object = {V(2173)}},
+    {ARGO_NO_TYPE, V(2174), V(2176), {0}},
+    {ARGO_STRING_TYPE, V(2175), V(2173), S(13, 7), .content.string = S(3728, 5)},
+    {ARGO_STRING_TYPE, V(2176), V(2174), S(77, 8), .content.string = S(22829, 64)},
+    {ARGO_STRING_TYPE, V(2173), V(2175), S(140, 9), .content.string = S(22893, 33)},
+    {ARGO_OBJECT_TYPE, V(2182), V(2172), S(18906, 25), .content.object = {V(2178)}},
+    {ARGO_NO_TYPE, V(2179), V(2181), {0}},
+    {ARGO_STRING_TYPE, V(2180), V(2178), S(13, 7), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(2181), V(2179), S(77, 8), .content.string = S(22926, 90)},
+    {ARGO_STRING_TYPE, V(2178), V(2180), S(140, 9), .content.string = S(23016, 33)},
+    {ARGO_OBJECT_TYPE, V(2187), V(2177), S(3859, 14), .content.object = {V(2183)}},
+    {ARGO_NO_TYPE, V(2184), V(2186), {0}},
+    {ARGO_STRING_TYPE, V(2185), V(2183), S(13, 7), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(2186), V(2184), S(77, 8), .content.string = S(23049, 68)},
+    {ARGO_STRING_TYPE, V(2183), V(2185), S(140, 9), .content.string = S(23117, 33)},
+    {ARGO_OBJECT_TYPE, V(2192), V(2182), S(8768, 13), .content.object = {V(2188)}},
+    {ARGO_NO_TYPE, V(2189), V(2191), {0}},
+    {ARGO_STRING_TYPE, V(2190), V(2188), S(13, 7), .content.string = S(8781, 5)},
+    {ARGO_STRING_TYPE, V(2191), V(2189), S(77, 8), .content.string = S(23150, 66)},
+    {ARGO_STRING_TYPE, V(2188), V(2190), S(140, 9), .content.string = S(23216, 33)},
+    {ARGO_OBJECT_TYPE, V(2201), V(2187), S(17424, 16), .content.object = {V(2193)}},
+    {ARGO_NO_TYPE, V(2194), V(2197), {0}},
+    {ARGO_STRING_TYPE, V(2195), V(2193), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(2196), V(2194), S(77, 8), .content.string = S(23249, 72)},
+    {ARGO_STRING_TYPE, V(2197), V(2195), S(140, 9), .content.string = S(23321, 95)},
+    {ARGO_OBJECT_TYPE, V(2193), V(2196), S(41, 8), .content.object = {V(2198)}},
+    {ARGO_NO_TYPE, V(2199), V(2200), {0}},
+    {ARGO_STRING_TYPE, V(2200), V(2198), S(23416, 12), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(2198), V(2199), S(3021, 6), .content.string = S(3027, 5)},
+    {ARGO_OBJECT_TYPE, V(2209), V(2192), S(22665, 7), .content.object = {V(2202)}},
+    {ARGO_NO_TYPE, V(2203), V(2206), {0}},
+    {ARGO_STRING_TYPE, V(2204), V(2202), S(13, 7), .content.string = S(14094, 5)},
+    {ARGO_STRING_TYPE, V(2205), V(2203), S(77, 8), .content.string = S(23428, 54)},
+    {ARGO_STRING_TYPE, V(2206), V(2204), S(140, 9), .content.string = S(23482, 95)},
+    {ARGO_OBJECT_TYPE, V(2202), V(2205), S(41, 8), .content.object = {V(2207)}},
+    {ARGO_NO_TYPE, V(2208), V(2208), {0}},
+    {ARGO_STRING_TYPE, V(2207), V(2207), S(19884, 10), .content.string = S(4278, 5)},
+    {ARGO_OBJECT_TYPE, V(2214), V(2201), S(23416, 12), .content.object = {V(2210)}},
+    {ARGO_NO_TYPE, V(2211), V(2213), {0}},
+    {ARGO_STRING_TYPE, V(2212), V(2210), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(2213), V(2211), S(77, 8), .content.string = S(23577, 64)},
+    {ARGO_STRING_TYPE, V(2210), V(2212), S(140, 9), .content.string = S(23641, 33)},
+    {ARGO_OBJECT_TYPE, V(2219), V(2209), S(10394, 11), .content.object = {V(2215)}},
+    {ARGO_NO_TYPE, V(2216), V(2218), {0}},
+    {ARGO_STRING_TYPE, V(2217), V(2215), S(13, 7), .content.string = S(4883, 5)},
+    {ARGO_STRING_TYPE, V(2218), V(2216), S(77, 8), .content.string = S(23674, 62)},
+    {ARGO_STRING_TYPE, V(2215), V(2217), S(140, 9), .content.string = S(23736, 95)},
+    {ARGO_OBJECT_TYPE, V(2224), V(2214), S(3021, 6), .content.object = {V(2220)}},
+    {ARGO_NO_TYPE, V(2221), V(2223), {0}},
+    {ARGO_STRING_TYPE, V(2222), V(2220), S(13, 7), .content.string = S(3027, 5)},
+    {ARGO_STRING_TYPE, V(2223), V(2221), S(77, 8), .content.string = S(23831, 52)},
+    {ARGO_STRING_TYPE, V(2220), V(2222), S(140, 9), .content.string = S(23883, 95)},
+    {ARGO_OBJECT_TYPE, V(2229), V(2219), S(22548, 18), .content.object = {V(2225)}},
+    {ARGO_NO_TYPE, V(2226), V(2228), {0}},
+    {ARGO_STRING_TYPE, V(2227), V(2225), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(2228), V(2226), S(77, 8), .content.string = S(23978, 76)},
+    {ARGO_STRING_TYPE, V(2225), V(2227), S(140, 9), .content.string = S(24054, 33)},
+    {ARGO_OBJECT_TYPE, V(2234), V(2224), S(11618, 14), .content.object = {V(2230)}},
+    {ARGO_NO_TYPE, V(2231), V(2233), {0}},
+    {ARGO_STRING_TYPE, V(2232), V(2230), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(2233), V(2231), S(77, 8), .content.string = S(24087, 68)},
+    {ARGO_STRING_TYPE, V(2230), V(2232), S(140, 9), .content.string = S(24155, 33)},
+    {ARGO_OBJECT_TYPE, V(2244), V(2229), S(20476, 7), .content.object = {V(2235)}},
+    {ARGO_NO_TYPE, V(2236), V(2239), {0}},
+    {ARGO_STRING_TYPE, V(2237), V(2235), S(13, 7), .content.string = S(20483, 5)},
+    {ARGO_STRING_TYPE, V(2238), V(2236), S(77, 8), .content.string = S(24188, 54)},
+    {ARGO_STRING_TYPE, V(2239), V(2237), S(140, 9), .content.string = S(24242, 33)},
+    {ARGO_OBJECT_TYPE, V(2235), V(2238), S(41, 8), .content.object = {V(2240)}},
+    {ARGO_NO_TYPE, V(2241), V(2243), {0}},
+    {ARGO_STRING_TYPE, V(2242), V(2240), S(9912, 4), .content.string = S(9916, 5)},
+    {ARGO_STRING_TYPE, V(2243), V(2241), S(12204, 9), .content.string = S(276, 5)},
+    {ARGO_STRING_TYPE, V(2240), V(2242), S(22566, 7), .content.string = S(22573, 5)},
+    {ARGO_OBJECT_TYPE, V(2249), V(2234), S(3032, 7), .content.object = {V(2245)}},
+    {ARGO_NO_TYPE, V(2246), V(2248), {0}},
+    {ARGO_STRING_TYPE, V(2247), V(2245), S(13, 7), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(2248), V(2246), S(77, 8), .content.string = S(24275, 54)},
+    {ARGO_STRING_TYPE, V(2245), V(2247), S(140, 9), .content.string = S(24329, 95)},
+    {ARGO_OBJECT_TYPE, V(2254), V(2244), S(17651, 6), .content.object = {V(2250)}},
+    {ARGO_NO_TYPE, V(2251), V(2253), {0}},
+    {ARGO_STRING_TYPE, V(2252), V(2250), S(13, 7), .content.string = S(2741, 5)},
+    {ARGO_STRING_TYPE, V(2253), V(2251), S(77, 8), .content.string = S(24424, 52)},
+    {ARGO_STRING_TYPE, V(2250), V(2252), S(140, 9), .content.string = S(24476, 33)},
+    {ARGO_OBJECT_TYPE, V(2259), V(2249), S(24509, 10), .content.object = {V(2255)}},
+    {ARGO_NO_TYPE, V(2256), V(2258), {0}},
+    {ARGO_STRING_TYPE, V(2257), V(2255), S(13, 7), .content.string = S(1067, 5)},
+    {ARGO_STRING_TYPE, V(2258), V(2256), S(77, 8), .content.string = S(24519, 60)},
+    {ARGO_STRING_TYPE, V(2255), V(2257), S(140, 9), .content.string = S(24579, 95)},
+    {ARGO_OBJECT_TYPE, V(2267), V(2254), S(20488, 18), .content.object = {V(2260)}},
+    {ARGO_NO_TYPE, V(2261), V(2264), {0}},
+    {ARGO_STRING_TYPE, V(2262), V(2260), S(13, 7), .content.string = S(20421, 5)},
+    {ARGO_STRING_TYPE, V(2263), V(2261), S(77, 8), .content.string = S(24674, 76)},
+    {ARGO_STRING_TYPE, V(2264), V(2262), S(140, 9), .content.string = S(24750, 95)},
+    {ARGO_OBJECT_TYPE, V(2260), V(2263), S(41, 8), .content.object = {V(2265)}},
+    {ARGO_NO_TYPE, V(2266), V(2266), {0}},
+    {ARGO_STRING_TYPE, V(2265), V(2265), S(24509, 10), .content.string = S(1067, 5)},
+    {ARGO_OBJECT_TYPE, V(2272), V(2259), S(2134, 10), .content.object = {V(2268)}},
+    {ARGO_NO_TYPE, V(2269), V(2271), {0}},
+    {ARGO_STRING_TYPE, V(2270), V(2268), S(13, 7), .content.string = S(5910, 5)},
+    {ARGO_STRING_TYPE, V(2271), V(2269), S(77, 8), .content.string = S(24845, 60)},
+    {ARGO_STRING_TYPE, V(2268), V(2270), S(140, 9), .content.string = S(24905, 33)},
+    {ARGO_OBJECT_TYPE, V(2277), V(2267), S(24938, 11), .content.object = {V(2273)}},
+    {ARGO_NO_TYPE, V(2274), V(2276), {0}},
+    {ARGO_STRING_TYPE, V(2275), V(2273), S(13, 7), .content.string = S(24949, 6)},
+    {ARGO_STRING_TYPE, V(2276), V(2274), S(77, 8), .content.string = S(24955, 63)},
+    {ARGO_STRING_TYPE, V(2273), V(2275), S(140, 9), .content.string = S(25018, 33)},
+    {ARGO_OBJECT_TYPE, V(2282), V(2272), S(11632, 8), .content.object = {V(2278)}},
+    {ARGO_NO_TYPE, V(2279), V(2281), {0}},
+    {ARGO_STRING_TYPE, V(2280), V(2278), S(13, 7), .content.string = S(9933, 5)},
+    {ARGO_STRING_TYPE, V(2281), V(2279), S(77, 8), .content.string = S(25051, 56)},
+    {ARGO_STRING_TYPE, V(2278), V(2280), S(140, 9), .content.string = S(25107, 95)},
+    {ARGO_OBJECT_TYPE, V(2290), V(2277), S(10366, 14), .content.object = {V(2283)}},
+    {ARGO_NO_TYPE, V(2284), V(2287), {0}},
+    {ARGO_STRING_TYPE, V(2285), V(2283), S(13, 7), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(2286), V(2284), S(77, 8), .content.string = S(25202, 68)},
+    {ARGO_STRING_TYPE, V(2287), V(2285), S(140, 9), .content.string = S(25270, 95)},
+    {ARGO_OBJECT_TYPE, V(2283), V(2286), S(41, 8), .content.object = {V(2288)}},
+    {ARGO_NO_TYPE, V(2289), V(2289), {0}},
+    {ARGO_STRING_TYPE, V(2288), V(2288), S(10394, 11), .content.string = S(4883, 5)},
+    {ARGO_OBJECT_TYPE, V(2298), V(2282), S(4291, 10), .content.object = {V(2291)}},
+    {ARGO_NO_TYPE, V(2292), V(2295), {0}},
+    {ARGO_STRING_TYPE, V(2293), V(2291), S(13, 7), .content.string = S(4301, 5)},
+    {ARGO_STRING_TYPE, V(2294), V(2292), S(77, 8), .content.string = S(25365, 60)},
+    {ARGO_STRING_TYPE, V(2295), V(2293), S(140, 9), .content.string = S(25425, 33)},
+    {ARGO_OBJECT_TYPE, V(2291), V(2294), S(41, 8), .content.object = {V(2296)}},
+    {ARGO_NO_TYPE, V(2297), V(2297), {0}},
+    {ARGO_STRING_TYPE, V(2296), V(2296), S(1270, 10), .content.string = S(1280, 5)},
+    {ARGO_OBJECT_TYPE, V(2303), V(2290), S(4306, 14), .content.object = {V(2299)}},
+    {ARGO_NO_TYPE, V(2300), V(2302), {0}},
+    {ARGO_STRING_TYPE, V(2301), V(2299), S(13, 7), .content.string = S(2250, 5)},
+    {ARGO_STRING_TYPE, V(2302), V(2300), S(77, 8), .content.string = S(25458, 68)},
+    {ARGO_STRING_TYPE, V(2299), V(2301), S(140, 9), .content.string = S(25526, 33)},
+    {ARGO_OBJECT_TYPE, V(2308), V(2298), S(21139, 3), .content.object = {V(2304)}},
+    {ARGO_NO_TYPE, V(2305), V(2307), {0}},
+    {ARGO_STRING_TYPE, V(2306), V(2304), S(13, 7), .content.string = S(1500, 5)},
+    {ARGO_STRING_TYPE, V(2307), V(2305), S(77, 8), .content.string = S(25559, 46)},
+    {ARGO_STRING_TYPE, V(2304), V(2306), S(140, 9), .content.string = S(25605, 33)},
+    {ARGO_OBJECT_TYPE, V(2317), V(2303), S(5004, 7), .content.object = {V(2309)}},
+    {ARGO_NO_TYPE, V(2310), V(2313), {0}},
+    {ARGO_STRING_TYPE, V(2311), V(2309), S(13, 7), .content.string = S(5011, 6)},
+    {ARGO_STRING_TYPE, V(2312), V(2310), S(77, 8), .content.string = S(25638, 55)},
+    {ARGO_STRING_TYPE, V(2313), V(2311), S(140, 9), .content.string = S(25693, 33)},
+    {ARGO_OBJECT_TYPE, V(2309), V(2312), S(41, 8), .content.object = {V(2314)}},
+    {ARGO_NO_TYPE, V(2315), V(2316), {0}},
+    {ARGO_STRING_TYPE, V(2316), V(2314), S(16105, 11), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(2314), V(2315), S(1041, 10), .content.string = S(1051, 6)},
+    {ARGO_OBJECT_TYPE, V(2322), V(2308), S(1908, 16), .content.object = {V(2318)}},
+    {ARGO_NO_TYPE, V(2319), V(2321), {0}},
+    {ARGO_STRING_TYPE, V(2320), V(2318), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2321), V(2319), S(77, 8), .content.string = S(25726, 72)},
+    {ARGO_STRING_TYPE, V(2318), V(2320), S(140, 9), .content.string = S(25798, 33)},
+    {ARGO_OBJECT_TYPE, V(2327), V(2317), S(22269, 6), .content.object = {V(2323)}},
+    {ARGO_NO_TYPE, V(2324), V(2326), {0}},
+    {ARGO_STRING_TYPE, V(2325), V(2323), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2326), V(2324), S(77, 8), .content.string = S(25831, 52)},
+    {ARGO_STRING_TYPE, V(2323), V(2325), S(140, 9), .content.string = S(25883, 33)},
+    {ARGO_OBJECT_TYPE, V(2332), V(2322), S(10380, 14), .content.object = {V(2328)}},
+    {ARGO_NO_TYPE, V(2329), V(2331), {0}},
+    {ARGO_STRING_TYPE, V(2330), V(2328), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(2331), V(2329), S(77, 8), .content.string = S(25916, 68)},
+    {ARGO_STRING_TYPE, V(2328), V(2330), S(140, 9), .content.string = S(25984, 33)},
+    {ARGO_OBJECT_TYPE, V(2337), V(2327), S(10446, 4), .content.object = {V(2333)}},
+    {ARGO_NO_TYPE, V(2334), V(2336), {0}},
+    {ARGO_STRING_TYPE, V(2335), V(2333), S(13, 7), .content.string = S(6494, 5)},
+    {ARGO_STRING_TYPE, V(2336), V(2334), S(77, 8), .content.string = S(26017, 48)},
+    {ARGO_STRING_TYPE, V(2333), V(2335), S(140, 9), .content.string = S(26065, 95)},
+    {ARGO_OBJECT_TYPE, V(2342), V(2332), S(14573, 4), .content.object = {V(2338)}},
+    {ARGO_NO_TYPE, V(2339), V(2341), {0}},
+    {ARGO_STRING_TYPE, V(2340), V(2338), S(13, 7), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(2341), V(2339), S(77, 8), .content.string = S(26160, 48)},
+    {ARGO_STRING_TYPE, V(2338), V(2340), S(140, 9), .content.string = S(26208, 33)},
+    {ARGO_OBJECT_TYPE, V(2357), V(2337), S(20506, 6), .content.object = {V(2343)}},
+    {ARGO_NO_TYPE, V(2344), V(2350), {0}},
+    {ARGO_STRING_TYPE, V(2345), V(2343), S(13, 7), .content.string = S(20512, 6)},
+    {ARGO_STRING_TYPE, V(2346), V(2344), S(77, 8), .content.string = S(26241, 53)},
+    {ARGO_STRING_TYPE, V(2347), V(2345), S(140, 9), .content.string = S(26294, 33)},
+    {ARGO_OBJECT_TYPE, V(2350), V(2346), S(41, 8), .content.object = {V(2348)}},
+    {ARGO_NO_TYPE, V(2349), V(2349), {0}},
+    {ARGO_STRING_TYPE, V(2348), V(2348), S(2626, 5), .content.string = S(21134, 5)},
+    {ARGO_OBJECT_TYPE, V(2343), V(2347), S(49, 12), .content.object = {V(2351)}},
+    {ARGO_NO_TYPE, V(2352), V(2352), {0}},
+    {ARGO_OBJECT_TYPE, V(2351), V(2351), S(2626, 5), .content.object = {V(2353)}},
+    {ARGO_NO_TYPE, V(2354), V(2356), {0}},
+    {ARGO_STRING_TYPE, V(2355), V(2353), S(13, 7), .content.string = S(21134, 5)},
+    {ARGO_STRING_TYPE, V(2356), V(2354), S(77, 8), .content.string = S(21142, 50)},
+    {ARGO_STRING_TYPE, V(2353), V(2355), S(140, 9), .content.string = S(21192, 33)},
+    {ARGO_OBJECT_TYPE, V(2385), V(2342), S(21405, 3), .content.object = {V(2358)}},
+    {ARGO_NO_TYPE, V(2359), V(2375), {0}},
+    {ARGO_STRING_TYPE, V(2360), V(2358), S(13, 7), .content.string = S(21408, 5)},
+    {ARGO_STRING_TYPE, V(2361), V(2359), S(77, 8), .content.string = S(26327, 46)},
+    {ARGO_STRING_TYPE, V(2362), V(2360), S(140, 9), .content.string = S(26373, 33)},
+    {ARGO_OBJECT_TYPE, V(2375), V(2361), S(41, 8), .content.object = {V(2363)}},
+    {ARGO_NO_TYPE, V(2364), V(2374), {0}},
+    {ARGO_STRING_TYPE, V(2365), V(2363), S(5676, 26), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(2366), V(2364), S(6489, 5), .content.string = S(17976, 5)},
+    {ARGO_STRING_TYPE, V(2367), V(2365), S(8140, 6), .content.string = S(4301, 5)},
+    {ARGO_STRING_TYPE, V(2368), V(2366), S(12304, 2), .content.string = S(5702, 5)},
+    {ARGO_STRING_TYPE, V(2369), V(2367), S(15647, 16), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(2370), V(2368), S(15876, 14), .content.string = S(15890, 5)},
+    {ARGO_STRING_TYPE, V(2371), V(2369), S(15996, 12), .content.string = S(4794, 5)},
+    {ARGO_STRING_TYPE, V(2372), V(2370), S(15454, 7), .content.string = S(1934, 5)},
+    {ARGO_STRING_TYPE, V(2373), V(2371), S(3021, 6), .content.string = S(3027, 5)},
+    {ARGO_STRING_TYPE, V(2374), V(2372), S(3032, 7), .content.string = S(3039, 5)},
+    {ARGO_STRING_TYPE, V(2363), V(2373), S(10446, 4), .content.string = S(6494, 5)},
+    {ARGO_OBJECT_TYPE, V(2358), V(2362), S(49, 12), .content.object = {V(2376)}},
+    {ARGO_NO_TYPE, V(2377), V(2377), {0}},
+    {ARGO_OBJECT_TYPE, V(2376), V(2376), S(6489, 5), .content.object = {V(2378)}},
+    {ARGO_NO_TYPE, V(2379), V(2382), {0}},
+    {ARGO_STRING_TYPE, V(2380), V(2378), S(13, 7), .content.string = S(17976, 5)},
+    {ARGO_STRING_TYPE, V(2381), V(2379), S(77, 8), .content.string = S(17981, 50)},
+    {ARGO_STRING_TYPE, V(2382), V(2380), S(140, 9), .content.string = S(18031, 95)},
+    {ARGO_OBJECT_TYPE, V(2378), V(2381), S(41, 8), .content.object = {V(2383)}},
+    {ARGO_NO_TYPE, V(2384), V(2384), {0}},
+    {ARGO_STRING_TYPE, V(2383), V(2383), S(6644, 2), .content.string = S(2250, 5)},
+    {ARGO_OBJECT_TYPE, V(2405), V(2357), S(26406, 7), .content.object = {V(2386)}},
+    {ARGO_NO_TYPE, V(2387), V(2398), {0}},
+    {ARGO_STRING_TYPE, V(2388), V(2386), S(13, 7), .content.string = S(26413, 5)},
+    {ARGO_STRING_TYPE, V(2389), V(2387), S(77, 8), .content.string = S(26418, 54)},
+    {ARGO_STRING_TYPE, V(2390), V(2388), S(140, 9), .content.string = S(26472, 33)},
+    {ARGO_OBJECT_TYPE, V(2398), V(2389), S(41, 8), .content.object = {V(2391)}},
+    {ARGO_NO_TYPE, V(2392), V(2397), {0}},
+    {ARGO_STRING_TYPE, V(2393), V(2391), S(2626, 5), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2394), V(2392), S(5017, 6), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(2395), V(2393), S(6401, 5), .content.string = S(2144, 5)},
+    {ARGO_STRING_TYPE, V(2396), V(2394), S(8340, 4), .content.string = S(8344, 5)},
+    {ARGO_STRING_TYPE, V(2397), V(2395), S(10075, 8), .content.string = S(1170, 5)},
+    {ARGO_STRING_TYPE, V(2391), V(2396), S(24938, 11), .content.string = S(24949, 6)},
+    {ARGO_OBJECT_TYPE, V(2386), V(2390), S(49, 12), .content.object = {V(2399)}},
+    {ARGO_NO_TYPE, V(2400), V(2400), {0}},
+    {ARGO_OBJECT_TYPE, V(2399), V(2399), S(2626, 5), .content.object = {V(2401)}},
+    {ARGO_NO_TYPE, V(2402), V(2404), {0}},
+    {ARGO_STRING_TYPE, V(2403), V(2401), S(13, 7), .content.string = S(20, 5)},
+    {ARGO_STRING_TYPE, V(2404), V(2402), S(77, 8), .content.string = S(26505, 50)},
+    {ARGO_STRING_TYPE, V(2401), V(2403), S(140, 9), .content.string = S(26555, 33)},
+    {ARGO_OBJECT_TYPE, V(2410), V(2385), S(10010, 6), .content.object = {V(2406)}},
+    {ARGO_NO_TYPE, V(2407), V(2409), {0}},
+    {ARGO_STRING_TYPE, V(2408), V(2406), S(13, 7), .content.string = S(6025, 5)},
+    {ARGO_STRING_TYPE, V(2409), V(2407), S(77, 8), .content.string = S(26588, 52)},
+    {ARGO_STRING_TYPE, V(2406), V(2408), S(140, 9), .content.string = S(26640, 33)},
+    {ARGO_OBJECT_TYPE, V(7), V(2405), S(20518, 6), .content.object = {V(2411)}},
+    {ARGO_NO_TYPE, V(2412), V(2415), {0}},
+    {ARGO_STRING_TYPE, V(2413), V(2411), S(13, 7), .content.string = S(10747, 5)},
+    {ARGO_STRING_TYPE, V(2414), V(2412), S(77, 8), .content.string = S(26673, 52)},
+    {ARGO_STRING_TYPE, V(2415), V(2413), S(140, 9), .content.string = S(26725, 95)},
+    {ARGO_OBJECT_TYPE, V(2411), V(2414), S(41, 8), .content.object = {V(2416)}},
+    {ARGO_NO_TYPE, V(2417), V(2418), {0}},
+    {ARGO_STRING_TYPE, V(2418), V(2416), S(2032, 8), .content.string = S(2040, 5)},
+    {ARGO_STRING_TYPE, V(2416), V(2417), S(9912, 4), .content.string = S(9916, 5)},
+};
+
+ARGO_VALUE *const argo_embedded_package_lock = (ARGO_VALUE *)values;
@@ -0,0 +1,5 @@
+/* Generated by bin/argo_embed from rsrc/package-lock.json.  Do not edit. */
+#include "argo.h"
+
+/* Read-only: see include/embed.h. */
+extern ARGO_VALUE *const argo_embedded_package_lock;
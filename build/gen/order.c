@@ -0,0 +1,330 @@
+/* Generated by bin/argo_gen.  Do not edit. */
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "reader.h"
+#include "schema.h"
+#include "order.h"
+
+static ARGO_STRING key;
+
+static const ARGO_CHAR KEY_order_fill_venue[] = {'v', 'e', 'n', 'u', 'e'};
+static const ARGO_CHAR KEY_order_fill_time[] = {'t', 'i', 'm', 'e'};
+static const ARGO_CHAR KEY_order_fill_partial[] = {'p', 'a', 'r', 't', 'i', 'a', 'l'};
+static const ARGO_CHAR KEY_order_id[] = {'i', 'd'};
+static const ARGO_CHAR KEY_order_symbol[] = {'s', 'y', 'm', 'b', 'o', 'l'};
+static const ARGO_CHAR KEY_order_price[] = {'p', 'r', 'i', 'c', 'e'};
+static const ARGO_CHAR KEY_order_quantity[] = {'q', 'u', 'a', 'n', 't', 'i', 't', 'y'};
+static const ARGO_CHAR KEY_order_side[] = {'s', 'i', 'd', 'e'};
+static const ARGO_CHAR KEY_order_tags[] = {'t', 'a', 'g', 's'};
+static const ARGO_CHAR KEY_order_fill[] = {'f', 'i', 'l', 'l'};
+
+static int readOrderFill(ORDER_FILL *v, FILE *f);
+static int writeOrderFill(ORDER_FILL *v, FILE *f);
+static void freeOrderFill(ORDER_FILL *v);
+static int readOrder(ORDER *v, FILE *f);
+static int writeOrder(ORDER *v, FILE *f);
+static void freeOrder(ORDER *v);
+
+/*
+ * Read the members of a ORDER_FILL, whose opening brace has been read.
+ */
+static int readOrderFill(ORDER_FILL *v, FILE *f) {
+    (*v).present = 0;
+    int c = argo_getc_nonblank(f);
+    while (c != ARGO_RBRACE) {
+        if (c != ARGO_QUOTE) {
+            argo_schema_error("Expected member name", c);
+            return 1;
+        }
+        if (argo_schema_key(&key, f))
+            return 1;
+        c = argo_getc_nonblank(f);
+        switch (key.length) {
+        case 4:
+            if (__builtin_memcmp(key.content, KEY_order_fill_time, sizeof(KEY_order_fill_time)) == 0) {
+                if (argo_schema_long(&(*v).time, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(1);
+                break;
+            }
+            goto unknown;
+        case 5:
+            if (__builtin_memcmp(key.content, KEY_order_fill_venue, sizeof(KEY_order_fill_venue)) == 0) {
+                if (argo_schema_string(&(*v).venue, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(0);
+                break;
+            }
+            goto unknown;
+        case 7:
+            if (__builtin_memcmp(key.content, KEY_order_fill_partial, sizeof(KEY_order_fill_partial)) == 0) {
+                if (argo_schema_boolean(&(*v).partial, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(2);
+                break;
+            }
+            goto unknown;
+        default:
+        unknown:
+            if (argo_schema_skip(c, f))
+                return 1;
+        }
+        c = argo_getc_nonblank(f);
+        if (c == ARGO_RBRACE)
+            break;
+        if (c != ARGO_COMMA) {
+            argo_schema_error("Expected ',' or '}' in object", c);
+            return 1;
+        }
+        c = argo_getc_nonblank(f);
+        if (c == ARGO_RBRACE) {
+            argo_schema_error("Expected member name", c);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int writeOrderFill(ORDER_FILL *v, FILE *f) {
+    int status = 0;
+    int first = 1;
+    fputc(ARGO_LBRACE, f);
+    if ((*v).present & ARGO_SCHEMA_BIT(0)) {
+        fputs(",\"venue\":" + first, f);
+        first = 0;
+        status |= argo_write_string(&(*v).venue, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(1)) {
+        fputs(",\"time\":" + first, f);
+        first = 0;
+        status |= argo_schema_write_long((*v).time, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(2)) {
+        fputs(",\"partial\":" + first, f);
+        first = 0;
+        fputs((*v).partial ? ARGO_TRUE_TOKEN : ARGO_FALSE_TOKEN, f);
+    }
+    fputc(ARGO_RBRACE, f);
+    return status;
+}
+
+static void freeOrderFill(ORDER_FILL *v) {
+    free((*v).venue.content);
+}
+
+/*
+ * Read the members of a ORDER, whose opening brace has been read.
+ */
+static int readOrder(ORDER *v, FILE *f) {
+    (*v).present = 0;
+    int c = argo_getc_nonblank(f);
+    while (c != ARGO_RBRACE) {
+        if (c != ARGO_QUOTE) {
+            argo_schema_error("Expected member name", c);
+            return 1;
+        }
+        if (argo_schema_key(&key, f))
+            return 1;
+        c = argo_getc_nonblank(f);
+        switch (key.length) {
+        case 2:
+            if (__builtin_memcmp(key.content, KEY_order_id, sizeof(KEY_order_id)) == 0) {
+                if (argo_schema_long(&(*v).id, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(0);
+                break;
+            }
+            goto unknown;
+        case 4:
+            if (__builtin_memcmp(key.content, KEY_order_side, sizeof(KEY_order_side)) == 0) {
+                if (argo_schema_string(&(*v).side, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(4);
+                break;
+            }
+            if (__builtin_memcmp(key.content, KEY_order_tags, sizeof(KEY_order_tags)) == 0) {
+                if (c != ARGO_LBRACK) {
+                    argo_schema_error("Expected '['", c);
+                    return 1;
+                }
+                (*v).tags_count = 0;
+                c = argo_getc_nonblank(f);
+                while (c != ARGO_RBRACK) {
+                    if (argo_schema_grow((void **)&(*v).tags, &(*v).tags_capacity, (*v).tags_count,
+                                           sizeof(*(*v).tags)))
+                        return 1;
+                    if (argo_schema_string((*v).tags + (*v).tags_count++, c, f))
+                        return 1;
+                    c = argo_getc_nonblank(f);
+                    if (c == ARGO_RBRACK)
+                        break;
+                    if (c != ARGO_COMMA) {
+                        argo_schema_error("Expected ',' or ']' in array", c);
+                        return 1;
+                    }
+                    c = argo_getc_nonblank(f);
+                    if (c == ARGO_RBRACK) {
+                        argo_schema_error("Expected a value", c);
+                        return 1;
+                    }
+                }
+                (*v).present |= ARGO_SCHEMA_BIT(5);
+                break;
+            }
+            if (__builtin_memcmp(key.content, KEY_order_fill, sizeof(KEY_order_fill)) == 0) {
+                if (c != ARGO_LBRACE) {
+                    argo_schema_error("Expected '{'", c);
+                    return 1;
+                }
+                if (readOrderFill(&(*v).fill, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(6);
+                break;
+            }
+            goto unknown;
+        case 5:
+            if (__builtin_memcmp(key.content, KEY_order_price, sizeof(KEY_order_price)) == 0) {
+                if (argo_schema_double(&(*v).price, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(2);
+                break;
+            }
+            goto unknown;
+        case 6:
+            if (__builtin_memcmp(key.content, KEY_order_symbol, sizeof(KEY_order_symbol)) == 0) {
+                if (argo_schema_string(&(*v).symbol, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(1);
+                break;
+            }
+            goto unknown;
+        case 8:
+            if (__builtin_memcmp(key.content, KEY_order_quantity, sizeof(KEY_order_quantity)) == 0) {
+                if (argo_schema_long(&(*v).quantity, c, f))
+                    return 1;
+                (*v).present |= ARGO_SCHEMA_BIT(3);
+                break;
+            }
+            goto unknown;
+        default:
+        unknown:
+            if (argo_schema_skip(c, f))
+                return 1;
+        }
+        c = argo_getc_nonblank(f);
+        if (c == ARGO_RBRACE)
+            break;
+        if (c != ARGO_COMMA) {
+            argo_schema_error("Expected ',' or '}' in object", c);
+            return 1;
+        }
+        c = argo_getc_nonblank(f);
+        if (c == ARGO_RBRACE) {
+            argo_schema_error("Expected member name", c);
+            return 1;
+        }
+    }
+    if (((*v).present & 0xfUL) != 0xfUL) {
+        fprintf(stderr, "[%d] Missing required member of order\n", argo_lines_read);
+        return 1;
+    }
+    return 0;
+}
+
+static int writeOrder(ORDER *v, FILE *f) {
+    int status = 0;
+    int first = 1;
+    fputc(ARGO_LBRACE, f);
+    if ((*v).present & ARGO_SCHEMA_BIT(0)) {
+        fputs(",\"id\":" + first, f);
+        first = 0;
+        status |= argo_schema_write_long((*v).id, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(1)) {
+        fputs(",\"symbol\":" + first, f);
+        first = 0;
+        status |= argo_write_string(&(*v).symbol, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(2)) {
+        fputs(",\"price\":" + first, f);
+        first = 0;
+        status |= argo_schema_write_double((*v).price, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(3)) {
+        fputs(",\"quantity\":" + first, f);
+        first = 0;
+        status |= argo_schema_write_long((*v).quantity, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(4)) {
+        fputs(",\"side\":" + first, f);
+        first = 0;
+        status |= argo_write_string(&(*v).side, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(5)) {
+        fputs(",\"tags\":" + first, f);
+        first = 0;
+        fputc(ARGO_LBRACK, f);
+        for (size_t i = 0; i < (*v).tags_count; i++) {
+            if (i > 0)
+                fputc(ARGO_COMMA, f);
+            status |= argo_write_string(&(*((*v).tags + i)), f);
+        }
+        fputc(ARGO_RBRACK, f);
+    }
+    if ((*v).present & ARGO_SCHEMA_BIT(6)) {
+        fputs(",\"fill\":" + first, f);
+        first = 0;
+        status |= writeOrderFill(&(*v).fill, f);
+    }
+    fputc(ARGO_RBRACE, f);
+    return status;
+}
+
+static void freeOrder(ORDER *v) {
+    free((*v).symbol.content);
+    free((*v).side.content);
+    for (size_t i = 0; i < (*v).tags_capacity; i++)
+        free((*((*v).tags + i)).content);
+    free((*v).tags);
+    freeOrderFill(&(*v).fill);
+}
+
+/**
+ * @brief  Read a ORDER from a stream.
+ * @details  The struct must have been zeroed before it is first read into.
+ *
+ * @return  Zero if successful, nonzero if the input is invalid.
+ */
+int order_read(ORDER *v, FILE *f) {
+    argo_reader_enter(f);
+    int c = argo_getc_nonblank(f);
+    int status = 1;
+    if (c == ARGO_LBRACE)
+        status = readOrder(v, f);
+    else
+        argo_schema_error("Expected '{'", c);
+    argo_reader_leave(f);
+    return status;
+}
+
+/**
+ * @brief  Write a ORDER to a stream in canonical form.
+ *
+ * @return  Zero if successful, nonzero on an output error or a number
+ * that cannot be written.
+ */
+int order_write(ORDER *v, FILE *f) {
+    int status = writeOrder(v, f);
+    return status || ferror(f) != 0;
+}
+
+/**
+ * @brief  Free the buffers owned by a ORDER, and zero it.
+ */
+void order_free(ORDER *v) {
+    freeOrder(v);
+    *v = (ORDER){0};
+}
@@ -0,0 +1,35 @@
+/* Generated by bin/argo_gen.  Do not edit. */
+#ifndef ORDER_H
+#define ORDER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+#include "schema.h"
+
+typedef struct order_fill {
+    unsigned long present;
+    ARGO_STRING venue;
+    long time;
+    int partial;
+} ORDER_FILL;
+
+typedef struct order {
+    unsigned long present;
+    long id;
+    ARGO_STRING symbol;
+    double price;
+    long quantity;
+    ARGO_STRING side;
+    ARGO_STRING *tags;
+    size_t tags_count;
+    size_t tags_capacity;
+    ORDER_FILL fill;
+} ORDER;
+
+int order_read(ORDER *v, FILE *f);
+int order_write(ORDER *v, FILE *f);
+void order_free(ORDER *v);
+
+#endif
@@ -0,0 +1,185 @@
+/*
+ * Client for "argo --serve SOCKET".
+ *
+ * Sends each FILE (or standard input, for "-") to the daemon as a request
+ * and writes the body of the response to standard output, or to standard
+ * error if the request failed.  With -n COUNT each document is sent COUNT
+ * times, only the first response being printed, which makes the client a
+ * benchmark as well; a summary of the latencies seen by the client and
+ * reported by the daemon is written to standard error at the end.
+ *
+ * Usage: bin/argo_client SOCKET [-v|-c|-p|-q POINTER] [-n COUNT] FILE...
+ * The default operation is -c.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "server.h"
+
+static void usage(char *program) {
+    fprintf(stderr, "USAGE: %s SOCKET [-v|-c|-p|-q POINTER] [-n COUNT] FILE...\n", program);
+    exit(EXIT_FAILURE);
+}
+
+static char *readAll(char *path, size_t *length) {
+    FILE *in = strcmp(path, "-") == 0 ? stdin : fopen(path, "r");
+    if (in == NULL) {
+        perror(path);
+        return NULL;
+    }
+    size_t capacity = 65536;
+    char *text = malloc(capacity);
+    *length = 0;
+    size_t n;
+    while (text != NULL && (n = fread(text + *length, 1, capacity - *length, in)) > 0) {
+        *length += n;
+        if (*length == capacity)
+            text = realloc(text, capacity *= 2);
+    }
+    if (in != stdin)
+        fclose(in);
+    return text;
+}
+
+static int sendAll(int fd, char *p, size_t length) {
+    while (length > 0) {
+        ssize_t n = write(fd, p, length);
+        if (n <= 0)
+            return 1;
+        p += n;
+        length -= n;
+    }
+    return 0;
+}
+
+static int receiveAll(int fd, char *p, size_t length) {
+    while (length > 0) {
+        ssize_t n = read(fd, p, length);
+        if (n <= 0)
+            return 1;
+        p += n;
+        length -= n;
+    }
+    return 0;
+}
+
+static uint32_t getBig32(unsigned char *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static int compareLong(const void *a, const void *b) {
+    long x = *(const long *)a;
+    long y = *(const long *)b;
+    return x < y ? -1 : x > y;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3)
+        usage(*argv);
+    int op = ARGO_OP_CANONICALIZE;
+    char *pointer = "";
+    long count = 1;
+    int first = 2;
+    while (first < argc && **(argv + first) == '-' && *(*(argv + first) + 1) != '\0') {
+        if (strcmp(*(argv + first), "-v") == 0 || strcmp(*(argv + first), "-c") == 0
+            || strcmp(*(argv + first), "-p") == 0) {
+            op = *(*(argv + first) + 1);
+        } else if (strcmp(*(argv + first), "-q") == 0 && first + 1 < argc) {
+            op = ARGO_OP_QUERY;
+            pointer = *(argv + ++first);
+        } else if (strcmp(*(argv + first), "-n") == 0 && first + 1 < argc) {
+            count = atol(*(argv + ++first));
+        } else {
+            usage(*argv);
+        }
+        first++;
+    }
+    if (first == argc || count < 1)
+        usage(*argv);
+
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    strncpy(address.sun_path, *(argv + 1), sizeof(address.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&address, sizeof(address)) < 0) {
+        perror(*(argv + 1));
+        return EXIT_FAILURE;
+    }
+
+    size_t requests = (size_t)(argc - first) * count;
+    long *latencies = malloc(requests * sizeof(long));
+    double serverTotal = 0;
+    size_t done = 0;
+    int failures = 0;
+    char *response = NULL;
+    size_t responseCapacity = 0;
+    struct timespec start, end, begin, finish;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int file = first; file < argc; file++) {
+        size_t length;
+        char *text = readAll(*(argv + file), &length);
+        if (text == NULL)
+            return EXIT_FAILURE;
+        size_t pointerLength = op == ARGO_OP_QUERY ? strlen(pointer) + 1 : 0;
+        size_t bodyLength = pointerLength + length;
+        char *request = malloc(ARGO_REQUEST_HEADER + bodyLength);
+        request[0] = (char)op;
+        request[1] = (char)(bodyLength >> 24);
+        request[2] = (char)(bodyLength >> 16);
+        request[3] = (char)(bodyLength >> 8);
+        request[4] = (char)bodyLength;
+        memcpy(request + ARGO_REQUEST_HEADER, pointer, pointerLength);
+        memcpy(request + ARGO_REQUEST_HEADER + pointerLength, text, length);
+        for (long i = 0; i < count; i++) {
+            unsigned char header[ARGO_RESPONSE_HEADER];
+            clock_gettime(CLOCK_MONOTONIC, &begin);
+            if (sendAll(fd, request, ARGO_REQUEST_HEADER + bodyLength)
+                || receiveAll(fd, (char *)header, ARGO_RESPONSE_HEADER)) {
+                fprintf(stderr, "Connection to %s failed\n", *(argv + 1));
+                return EXIT_FAILURE;
+            }
+            uint32_t responseLength = getBig32(header + 5);
+            if (responseLength > responseCapacity) {
+                responseCapacity = responseLength;
+                response = realloc(response, responseCapacity);
+            }
+            if (receiveAll(fd, response, responseLength)) {
+                fprintf(stderr, "Connection to %s failed\n", *(argv + 1));
+                return EXIT_FAILURE;
+            }
+            clock_gettime(CLOCK_MONOTONIC, &finish);
+            latencies[done++] = (finish.tv_sec - begin.tv_sec) * 1000000L
+                + (finish.tv_nsec - begin.tv_nsec) / 1000;
+            serverTotal += getBig32(header + 1);
+            if (header[0] != 0)
+                failures++;
+            if (i == 0) {
+                FILE *out = header[0] == 0 ? stdout : stderr;
+                if (header[0] != 0)
+                    fprintf(out, "%s: ", *(argv + file));
+                fwrite(response, 1, responseLength, out);
+                if (header[0] != 0 || op == ARGO_OP_CANONICALIZE || op == ARGO_OP_QUERY)
+                    fputc('\n', out);
+            }
+        }
+        free(request);
+        free(text);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    close(fd);
+
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    qsort(latencies, done, sizeof(long), compareLong);
+    fprintf(stderr, "%zu requests in %.3f s (%.0f requests/s), %d failed\n",
+            done, seconds, done / seconds, failures);
+    fprintf(stderr, "latency (us): p50 %ld, p99 %ld, max %ld; server time %.1f us/request\n",
+            latencies[done / 2], latencies[done * 99 / 100], latencies[done - 1], serverTotal / done);
+    free(latencies);
+    free(response);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/*
+ * Compiler of JSON documents into C data (see include/embed.h).
+ *
+ * Usage: bin/argo_embed INPUT NAME OUTPUT
+ * Parses the JSON file INPUT and writes OUTPUT.c, which defines the
+ * document as "ARGO_VALUE *const NAME", and OUTPUT.h, which declares it.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argo.h"
+#include "global.h"
+#include "reader.h"
+#include "document.h"
+#include "embed.h"
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        fprintf(stderr, "USAGE: %s INPUT NAME OUTPUT\n", *argv);
+        return EXIT_FAILURE;
+    }
+    char *input = *(argv + 1);
+    char *name = *(argv + 2);
+    char *output = *(argv + 3);
+    FILE *in = fopen(input, "r");
+    if (in == NULL) {
+        perror(input);
+        return EXIT_FAILURE;
+    }
+    argo_document_reset();
+    ARGO_VALUE *v = argo_read_value(in);
+    if (v == NULL || argo_read_end(in)) {
+        fprintf(stderr, "%s: invalid JSON\n", input);
+        return EXIT_FAILURE;
+    }
+    fclose(in);
+
+    char *path = malloc(strlen(output) + 3);
+    sprintf(path, "%s.c", output);
+    FILE *c = fopen(path, "w");
+    if (c == NULL) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    if (argo_embed_write(v, name, input, c) || fclose(c) != 0) {
+        fprintf(stderr, "%s: failed to write\n", path);
+        remove(path);
+        return EXIT_FAILURE;
+    }
+    sprintf(path, "%s.h", output);
+    FILE *h = fopen(path, "w");
+    if (h == NULL) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    fprintf(h, "/* Generated by bin/argo_embed from %s.  Do not edit. */\n", input);
+    fprintf(h, "#include \"argo.h\"\n\n");
+    fprintf(h, "/* Read-only: see include/embed.h. */\n");
+    fprintf(h, "extern ARGO_VALUE *const %s;\n", name);
+    if (fclose(h) != 0) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
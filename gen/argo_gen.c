@@ -0,0 +1,609 @@
+/*
+ * Generator of specialized parsers and serializers (see include/schema.h).
+ *
+ * Usage: bin/argo_gen SCHEMA OUTPUT
+ * Reads the JSON Schema in the file SCHEMA and writes OUTPUT.h and OUTPUT.c.
+ *
+ * The schema must describe an object.  The subset of JSON Schema that is
+ * understood is:
+ *   "type"        "object", "array", "string", "integer", "number" or
+ *                 "boolean" (and nothing else: no unions or nulls);
+ *   "title"       for an object, the name of its C type (otherwise the name
+ *                 is made from the names of the enclosing type and member);
+ *   "properties"  for an object, the schema of each member, in order;
+ *   "required"    for an object, the names of the members that must appear;
+ *   "items"       for an array, the schema of its elements, which must not
+ *                 themselves be arrays.
+ * Anything else in the schema is ignored, as are members of the input that
+ * the schema does not mention.
+ *
+ * For an object type named T, the header declares a struct of type T (in
+ * upper case) with a field for each property and a "present" bitmask with
+ * ARGO_SCHEMA_BIT(i) set when the i'th property has been read.  A string
+ * property is an ARGO_STRING, an integer a long, a number a double, a
+ * boolean an int, an object the struct of its type, and an array a pointer
+ * to its elements together with "_count" and "_capacity" fields.  The
+ * outermost type also gets
+ *   int T_read(T *v, FILE *f);     which reads one value from f into v,
+ *   int T_write(T *v, FILE *f);    which writes v to f in canonical form,
+ *   void T_free(T *v);             which frees the buffers v owns.
+ * A struct must be zeroed before it is first read into; after that, it can
+ * be read into again and again, and the buffers of its strings and arrays
+ * are reused.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "argo.h"
+#include "global.h"
+#include "schema.h"
+
+#define KIND_INTEGER 0
+#define KIND_NUMBER 1
+#define KIND_STRING 2
+#define KIND_BOOLEAN 3
+#define KIND_OBJECT 4
+#define KIND_ARRAY 5
+
+static char *kindNames[] = {"integer", "number", "string", "boolean", "object", "array"};
+
+typedef struct type TYPE;
+
+typedef struct field {
+    ARGO_STRING *key;                 // Member name, as read from the schema.
+    char *ident;                      // C identifier for the field.
+    int kind;
+    int item;                         // Kind of the elements of an array.
+    TYPE *object;                     // Type of an object or of array elements.
+    int required;
+} FIELD;
+
+struct type {
+    char *name;                       // Lower case: struct tag and prefix.
+    char *upper;                      // Upper case: typedef name.
+    char *camel;                      // Used in the names of static functions.
+    FIELD fields[ARGO_SCHEMA_FIELDS];
+    int count;
+    TYPE *next;                       // Next in order of declaration.
+};
+
+static TYPE *firstType;
+static TYPE **lastType = &firstType;
+
+static void fail(char *message, char *detail) {
+    fprintf(stderr, "argo_gen: %s%s%s\n", message, detail != NULL ? ": " : "", detail != NULL ? detail : "");
+    exit(EXIT_FAILURE);
+}
+
+static int nameIs(ARGO_STRING *s, char *text) {
+    size_t n = strlen(text);
+    if ((*s).length != n)
+        return 0;
+    for (size_t i = 0; i < n; i++)
+        if (*((*s).content + i) != (unsigned char)*(text + i))
+            return 0;
+    return 1;
+}
+
+static ARGO_VALUE *member(ARGO_VALUE *object, char *name) {
+    if (object == NULL || (*object).type != ARGO_OBJECT_TYPE)
+        return NULL;
+    ARGO_VALUE *sentinel = (*object).content.object.member_list;
+    for (ARGO_VALUE *m = (*sentinel).next; m != sentinel; m = (*m).next)
+        if (nameIs(&(*m).name, name))
+            return m;
+    return NULL;
+}
+
+/*
+ * Make a C identifier out of a string: characters that may not appear in
+ * one become underscores.
+ */
+static char *identifier(ARGO_STRING *s) {
+    static char *keywords[] = {
+        "auto", "break", "case", "char", "const", "continue", "default", "do", "double", "else",
+        "enum", "extern", "float", "for", "goto", "if", "int", "long", "register", "return",
+        "short", "signed", "sizeof", "static", "struct", "switch", "typedef", "union",
+        "unsigned", "void", "volatile", "while", "present", NULL
+    };
+    char *ident = malloc((*s).length + 3);
+    char *p = ident;
+    if ((*s).length == 0 || ((*(*s).content >= '0' && *(*s).content <= '9')))
+        *p++ = '_';
+    for (size_t i = 0; i < (*s).length; i++) {
+        ARGO_CHAR c = *((*s).content + i);
+        int ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        *p++ = ok ? (char)c : '_';
+    }
+    *p = '\0';
+    for (char **k = keywords; *k != NULL; k++) {
+        if (strcmp(ident, *k) == 0) {
+            *p++ = '_';
+            *p = '\0';
+        }
+    }
+    return ident;
+}
+
+static char *joinName(char *a, char *b) {
+    char *s = malloc(strlen(a) + strlen(b) + 2);
+    sprintf(s, "%s_%s", a, b);
+    return s;
+}
+
+static char *stringText(ARGO_VALUE *v, char *what) {
+    if (v == NULL || (*v).type != ARGO_STRING_TYPE)
+        fail("Expected a string for", what);
+    return identifier(&(*v).content.string);
+}
+
+static int kindOf(ARGO_VALUE *schema, char *where) {
+    ARGO_VALUE *type = member(schema, "type");
+    if (type == NULL || (*type).type != ARGO_STRING_TYPE)
+        fail("No \"type\" given for", where);
+    for (int k = 0; k <= KIND_ARRAY; k++)
+        if (nameIs(&(*type).content.string, kindNames[k]))
+            return k;
+    fail("Unsupported type for", where);
+    return -1;
+}
+
+static TYPE *buildType(ARGO_VALUE *schema, char *name) {
+    ARGO_VALUE *title = member(schema, "title");
+    if (title != NULL)
+        name = stringText(title, "title");
+    TYPE *t = calloc(1, sizeof(TYPE));
+    (*t).name = malloc(strlen(name) + 1);
+    (*t).upper = malloc(strlen(name) + 1);
+    (*t).camel = malloc(strlen(name) + 1);
+    char *camel = (*t).camel;
+    int capital = 1;
+    for (size_t i = 0; i <= strlen(name); i++) {
+        char c = *(name + i);
+        char lower = c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+        *((*t).name + i) = lower;
+        *((*t).upper + i) = c >= 'a' && c <= 'z' ? c - 'a' + 'A' : c;
+        if (c == '_') {
+            capital = 1;
+        } else {
+            *camel++ = capital && lower >= 'a' && lower <= 'z' ? lower - 'a' + 'A' : lower;
+            capital = 0;
+        }
+    }
+    ARGO_VALUE *properties = member(schema, "properties");
+    if (properties == NULL || (*properties).type != ARGO_OBJECT_TYPE)
+        fail("No \"properties\" given for", name);
+    ARGO_VALUE *sentinel = (*properties).content.object.member_list;
+    for (ARGO_VALUE *p = (*sentinel).next; p != sentinel; p = (*p).next) {
+        if ((*t).count == ARGO_SCHEMA_FIELDS)
+            fail("Too many properties in", name);
+        FIELD *field = (*t).fields + (*t).count++;
+        (*field).key = &(*p).name;
+        (*field).ident = identifier(&(*p).name);
+        char *where = joinName((*t).name, (*field).ident);
+        (*field).kind = kindOf(p, where);
+        ARGO_VALUE *element = p;
+        if ((*field).kind == KIND_ARRAY) {
+            element = member(p, "items");
+            if (element == NULL)
+                fail("No \"items\" given for", where);
+            (*field).item = kindOf(element, where);
+            if ((*field).item == KIND_ARRAY)
+                fail("Arrays of arrays are not supported", where);
+        }
+        if ((*field).kind == KIND_OBJECT || (*field).item == KIND_OBJECT)
+            (*field).object = buildType(element, where);
+    }
+    ARGO_VALUE *required = member(schema, "required");
+    if (required != NULL && (*required).type == ARGO_ARRAY_TYPE) {
+        ARGO_VALUE *end = (*required).content.array.element_list;
+        for (ARGO_VALUE *r = (*end).next; r != end; r = (*r).next) {
+            int found = 0;
+            for (int i = 0; i < (*t).count && (*r).type == ARGO_STRING_TYPE; i++) {
+                ARGO_STRING *key = (*((*t).fields + i)).key;
+                ARGO_STRING *want = &(*r).content.string;
+                if ((*key).length == (*want).length
+                    && memcmp((*key).content, (*want).content, (*key).length * sizeof(ARGO_CHAR)) == 0) {
+                    (*((*t).fields + i)).required = found = 1;
+                }
+            }
+            if (!found)
+                fail("A required member has no property in", name);
+        }
+    }
+    // Types are declared after the types of their fields.
+    *lastType = t;
+    lastType = &(*t).next;
+    return t;
+}
+
+static char *cType(int kind, TYPE *object) {
+    switch (kind) {
+    case KIND_INTEGER: return "long";
+    case KIND_NUMBER: return "double";
+    case KIND_STRING: return "ARGO_STRING";
+    case KIND_BOOLEAN: return "int";
+    default: return (*object).upper;
+    }
+}
+
+static void emitHeader(FILE *h, char *guard, TYPE *root) {
+    fprintf(h, "/* Generated by bin/argo_gen.  Do not edit. */\n");
+    fprintf(h, "#ifndef %s\n#define %s\n\n", guard, guard);
+    fprintf(h, "#include <stdio.h>\n#include <stddef.h>\n\n#include \"argo.h\"\n#include \"schema.h\"\n");
+    for (TYPE *t = firstType; t != NULL; t = (*t).next) {
+        fprintf(h, "\ntypedef struct %s {\n    unsigned long present;\n", (*t).name);
+        for (int i = 0; i < (*t).count; i++) {
+            FIELD *field = (*t).fields + i;
+            if ((*field).kind == KIND_ARRAY) {
+                fprintf(h, "    %s *%s;\n", cType((*field).item, (*field).object), (*field).ident);
+                fprintf(h, "    size_t %s_count;\n    size_t %s_capacity;\n", (*field).ident, (*field).ident);
+            } else {
+                fprintf(h, "    %s %s;\n", cType((*field).kind, (*field).object), (*field).ident);
+            }
+        }
+        fprintf(h, "} %s;\n", (*t).upper);
+    }
+    fprintf(h, "\nint %s_read(%s *v, FILE *f);\n", (*root).name, (*root).upper);
+    fprintf(h, "int %s_write(%s *v, FILE *f);\n", (*root).name, (*root).upper);
+    fprintf(h, "void %s_free(%s *v);\n", (*root).name, (*root).upper);
+    fprintf(h, "\n#endif\n");
+}
+
+static void indent(FILE *c, int depth) {
+    fprintf(c, "%*s", 4 * depth, "");
+}
+
+/*
+ * Emit code that reads one value of the given kind, whose first character
+ * is in "c", into "target", a pointer expression.
+ */
+static void emitReadScalar(FILE *c, int kind, TYPE *object, char *target, int depth) {
+    indent(c, depth);
+    switch (kind) {
+    case KIND_INTEGER:
+        fprintf(c, "if (argo_schema_long(%s, c, f))\n", target);
+        break;
+    case KIND_NUMBER:
+        fprintf(c, "if (argo_schema_double(%s, c, f))\n", target);
+        break;
+    case KIND_STRING:
+        fprintf(c, "if (argo_schema_string(%s, c, f))\n", target);
+        break;
+    case KIND_BOOLEAN:
+        fprintf(c, "if (argo_schema_boolean(%s, c, f))\n", target);
+        break;
+    default:
+        fprintf(c, "if (c != ARGO_LBRACE) {\n");
+        indent(c, depth + 1);
+        fprintf(c, "argo_schema_error(\"Expected '{'\", c);\n");
+        indent(c, depth + 1);
+        fprintf(c, "return 1;\n");
+        indent(c, depth);
+        fprintf(c, "}\n");
+        indent(c, depth);
+        fprintf(c, "if (read%s(%s, f))\n", (*object).camel, target);
+        break;
+    }
+    indent(c, depth + 1);
+    fprintf(c, "return 1;\n");
+}
+
+static void emitReadField(FILE *c, FIELD *field, int depth) {
+    char target[256];
+    if ((*field).kind != KIND_ARRAY) {
+        snprintf(target, sizeof(target), "&(*v).%s", (*field).ident);
+        emitReadScalar(c, (*field).kind, (*field).object, target, depth);
+        return;
+    }
+    char *id = (*field).ident;
+    fprintf(c, "%*sif (c != ARGO_LBRACK) {\n", 4 * depth, "");
+    fprintf(c, "%*sargo_schema_error(\"Expected '['\", c);\n", 4 * depth + 4, "");
+    fprintf(c, "%*sreturn 1;\n%*s}\n", 4 * depth + 4, "", 4 * depth, "");
+    fprintf(c, "%*s(*v).%s_count = 0;\n", 4 * depth, "", id);
+    fprintf(c, "%*sc = argo_getc_nonblank(f);\n", 4 * depth, "");
+    fprintf(c, "%*swhile (c != ARGO_RBRACK) {\n", 4 * depth, "");
+    fprintf(c, "%*sif (argo_schema_grow((void **)&(*v).%s, &(*v).%s_capacity, (*v).%s_count,\n",
+            4 * depth + 4, "", id, id, id);
+    fprintf(c, "%*ssizeof(*(*v).%s)))\n", 4 * depth + 27, "", id);
+    fprintf(c, "%*sreturn 1;\n", 4 * depth + 8, "");
+    snprintf(target, sizeof(target), "(*v).%s + (*v).%s_count++", id, id);
+    emitReadScalar(c, (*field).item, (*field).object, target, depth + 1);
+    fprintf(c, "%*sc = argo_getc_nonblank(f);\n", 4 * depth + 4, "");
+    fprintf(c, "%*sif (c == ARGO_RBRACK)\n%*sbreak;\n", 4 * depth + 4, "", 4 * depth + 8, "");
+    fprintf(c, "%*sif (c != ARGO_COMMA) {\n", 4 * depth + 4, "");
+    fprintf(c, "%*sargo_schema_error(\"Expected ',' or ']' in array\", c);\n", 4 * depth + 8, "");
+    fprintf(c, "%*sreturn 1;\n%*s}\n", 4 * depth + 8, "", 4 * depth + 4, "");
+    // A comma must be followed by an element, as in argo_read_value().
+    fprintf(c, "%*sc = argo_getc_nonblank(f);\n", 4 * depth + 4, "");
+    fprintf(c, "%*sif (c == ARGO_RBRACK) {\n", 4 * depth + 4, "");
+    fprintf(c, "%*sargo_schema_error(\"Expected a value\", c);\n", 4 * depth + 8, "");
+    fprintf(c, "%*sreturn 1;\n%*s}\n", 4 * depth + 8, "", 4 * depth + 4, "");
+    fprintf(c, "%*s}\n", 4 * depth, "");
+}
+
+static void emitReader(FILE *c, TYPE *t) {
+    unsigned long required = 0;
+    size_t longest = 0;
+    for (int i = 0; i < (*t).count; i++) {
+        FIELD *field = (*t).fields + i;
+        if ((*field).required)
+            required |= 1UL << i;
+        if ((*(*field).key).length > longest)
+            longest = (*(*field).key).length;
+    }
+    fprintf(c, "\n/*\n * Read the members of a %s, whose opening brace has been read.\n */\n", (*t).upper);
+    fprintf(c, "static int read%s(%s *v, FILE *f) {\n", (*t).camel, (*t).upper);
+    fprintf(c, "    (*v).present = 0;\n");
+    fprintf(c, "    int c = argo_getc_nonblank(f);\n");
+    fprintf(c, "    while (c != ARGO_RBRACE) {\n");
+    fprintf(c, "        if (c != ARGO_QUOTE) {\n");
+    fprintf(c, "            argo_schema_error(\"Expected member name\", c);\n");
+    fprintf(c, "            return 1;\n        }\n");
+    fprintf(c, "        if (argo_schema_key(&key, f))\n            return 1;\n");
+    fprintf(c, "        c = argo_getc_nonblank(f);\n");
+    if ((*t).count == 0) {
+        fprintf(c, "        if (argo_schema_skip(c, f))\n            return 1;\n");
+    } else {
+        fprintf(c, "        switch (key.length) {\n");
+        for (size_t length = 0; length <= longest; length++) {
+            int any = 0;
+            for (int i = 0; i < (*t).count; i++) {
+                FIELD *field = (*t).fields + i;
+                if ((*(*field).key).length != length)
+                    continue;
+                if (!any)
+                    fprintf(c, "        case %zu:\n", length);
+                any = 1;
+                fprintf(c, "            if (__builtin_memcmp(key.content, KEY_%s_%s, sizeof(KEY_%s_%s)) == 0) {\n",
+                        (*t).name, (*field).ident, (*t).name, (*field).ident);
+                emitReadField(c, field, 4);
+                fprintf(c, "                (*v).present |= ARGO_SCHEMA_BIT(%d);\n", i);
+                fprintf(c, "                break;\n            }\n");
+            }
+            if (any)
+                fprintf(c, "            goto unknown;\n");
+        }
+        fprintf(c, "        default:\n        unknown:\n");
+        fprintf(c, "            if (argo_schema_skip(c, f))\n                return 1;\n");
+        fprintf(c, "        }\n");
+    }
+    fprintf(c, "        c = argo_getc_nonblank(f);\n");
+    fprintf(c, "        if (c == ARGO_RBRACE)\n            break;\n");
+    fprintf(c, "        if (c != ARGO_COMMA) {\n");
+    fprintf(c, "            argo_schema_error(\"Expected ',' or '}' in object\", c);\n");
+    fprintf(c, "            return 1;\n        }\n");
+    // A comma must be followed by a member, as in argo_read_value().
+    fprintf(c, "        c = argo_getc_nonblank(f);\n");
+    fprintf(c, "        if (c == ARGO_RBRACE) {\n");
+    fprintf(c, "            argo_schema_error(\"Expected member name\", c);\n");
+    fprintf(c, "            return 1;\n        }\n    }\n");
+    if (required != 0) {
+        fprintf(c, "    if (((*v).present & 0x%lxUL) != 0x%lxUL) {\n", required, required);
+        fprintf(c, "        fprintf(stderr, \"[%%d] Missing required member of %s\\n\", argo_lines_read);\n",
+                (*t).name);
+        fprintf(c, "        return 1;\n    }\n");
+    }
+    fprintf(c, "    return 0;\n}\n");
+}
+
+/*
+ * Emit code that writes "value", an lvalue of the given kind, and folds
+ * the status of writing it into "status".
+ */
+static void emitWriteScalar(FILE *c, int kind, TYPE *object, char *value, int depth) {
+    indent(c, depth);
+    switch (kind) {
+    case KIND_INTEGER:
+        fprintf(c, "status |= argo_schema_write_long(%s, f);\n", value);
+        break;
+    case KIND_NUMBER:
+        fprintf(c, "status |= argo_schema_write_double(%s, f);\n", value);
+        break;
+    case KIND_STRING:
+        fprintf(c, "status |= argo_write_string(&%s, f);\n", value);
+        break;
+    case KIND_BOOLEAN:
+        fprintf(c, "fputs(%s ? ARGO_TRUE_TOKEN : ARGO_FALSE_TOKEN, f);\n", value);
+        break;
+    default:
+        fprintf(c, "status |= write%s(&%s, f);\n", (*object).camel, value);
+        break;
+    }
+}
+
+/*
+ * Write the text of a string as a C string literal.
+ */
+static void emitLiteral(FILE *c, char *text, size_t length) {
+    fputc('"', c);
+    for (size_t i = 0; i < length; i++) {
+        unsigned char ch = *(text + i);
+        if (ch == '"' || ch == '\\')
+            fprintf(c, "\\%c", ch);
+        else if (ch < 0x20 || ch >= 0x7F)
+            fprintf(c, "\\%03o", ch);
+        else
+            fputc(ch, c);
+    }
+    fputc('"', c);
+}
+
+static void emitWriter(FILE *c, TYPE *t) {
+    fprintf(c, "\nstatic int write%s(%s *v, FILE *f) {\n", (*t).camel, (*t).upper);
+    fprintf(c, "    int status = 0;\n");
+    if ((*t).count > 0)
+        fprintf(c, "    int first = 1;\n");
+    fprintf(c, "    fputc(ARGO_LBRACE, f);\n");
+    for (int i = 0; i < (*t).count; i++) {
+        FIELD *field = (*t).fields + i;
+        // The member name is written in canonical form, preceded by a comma
+        // that is skipped for the first member written.
+        char *name = NULL;
+        size_t length = 0;
+        FILE *text = open_memstream(&name, &length);
+        fputc(',', text);
+        argo_write_string((*field).key, text);
+        fputc(':', text);
+        fclose(text);
+        fprintf(c, "    if ((*v).present & ARGO_SCHEMA_BIT(%d)) {\n", i);
+        fprintf(c, "        fputs(");
+        emitLiteral(c, name, length);
+        fprintf(c, " + first, f);\n");
+        fprintf(c, "        first = 0;\n");
+        free(name);
+        char value[256];
+        if ((*field).kind == KIND_ARRAY) {
+            fprintf(c, "        fputc(ARGO_LBRACK, f);\n");
+            fprintf(c, "        for (size_t i = 0; i < (*v).%s_count; i++) {\n", (*field).ident);
+            fprintf(c, "            if (i > 0)\n                fputc(ARGO_COMMA, f);\n");
+            snprintf(value, sizeof(value), "(*((*v).%s + i))", (*field).ident);
+            emitWriteScalar(c, (*field).item, (*field).object, value, 3);
+            fprintf(c, "        }\n        fputc(ARGO_RBRACK, f);\n");
+        } else {
+            snprintf(value, sizeof(value), "(*v).%s", (*field).ident);
+            emitWriteScalar(c, (*field).kind, (*field).object, value, 2);
+        }
+        fprintf(c, "    }\n");
+    }
+    fprintf(c, "    fputc(ARGO_RBRACE, f);\n    return status;\n}\n");
+}
+
+static void emitFree(FILE *c, TYPE *t) {
+    fprintf(c, "\nstatic void free%s(%s *v) {\n", (*t).camel, (*t).upper);
+    for (int i = 0; i < (*t).count; i++) {
+        FIELD *field = (*t).fields + i;
+        char *id = (*field).ident;
+        int kind = (*field).kind == KIND_ARRAY ? (*field).item : (*field).kind;
+        char value[256];
+        int depth = 1;
+        if ((*field).kind == KIND_ARRAY && (kind == KIND_STRING || kind == KIND_OBJECT)) {
+            fprintf(c, "    for (size_t i = 0; i < (*v).%s_capacity; i++)\n", id);
+            snprintf(value, sizeof(value), "(*((*v).%s + i))", id);
+            depth = 2;
+        } else {
+            snprintf(value, sizeof(value), "(*v).%s", id);
+        }
+        if (kind == KIND_STRING)
+            fprintf(c, "%*sfree(%s.content);\n", 4 * depth, "", value);
+        else if (kind == KIND_OBJECT)
+            fprintf(c, "%*sfree%s(&%s);\n", 4 * depth, "", (*(*field).object).camel, value);
+        if ((*field).kind == KIND_ARRAY)
+            fprintf(c, "    free((*v).%s);\n", id);
+    }
+    fprintf(c, "}\n");
+}
+
+static void emitSource(FILE *c, char *header, TYPE *root) {
+    fprintf(c, "/* Generated by bin/argo_gen.  Do not edit. */\n");
+    fprintf(c, "#include <stdlib.h>\n#include <stdio.h>\n\n");
+    fprintf(c, "#include \"argo.h\"\n#include \"global.h\"\n#include \"reader.h\"\n#include \"schema.h\"\n");
+    fprintf(c, "#include \"%s\"\n\n", header);
+    fprintf(c, "static ARGO_STRING key;\n\n");
+    for (TYPE *t = firstType; t != NULL; t = (*t).next) {
+        for (int i = 0; i < (*t).count; i++) {
+            FIELD *field = (*t).fields + i;
+            ARGO_STRING *k = (*field).key;
+            fprintf(c, "static const ARGO_CHAR KEY_%s_%s[] = {", (*t).name, (*field).ident);
+            for (size_t j = 0; j < (*k).length; j++) {
+                ARGO_CHAR ch = *((*k).content + j);
+                if (ch >= 0x20 && ch < 0x7F && ch != '\'' && ch != '\\')
+                    fprintf(c, "%s'%c'", j ? ", " : "", ch);
+                else
+                    fprintf(c, "%s0x%x", j ? ", " : "", ch);
+            }
+            fprintf(c, "%s};\n", (*k).length == 0 ? "0" : "");
+        }
+    }
+    fprintf(c, "\n");
+    for (TYPE *t = firstType; t != NULL; t = (*t).next) {
+        fprintf(c, "static int read%s(%s *v, FILE *f);\n", (*t).camel, (*t).upper);
+        fprintf(c, "static int write%s(%s *v, FILE *f);\n", (*t).camel, (*t).upper);
+        fprintf(c, "static void free%s(%s *v);\n", (*t).camel, (*t).upper);
+    }
+    for (TYPE *t = firstType; t != NULL; t = (*t).next) {
+        emitReader(c, t);
+        emitWriter(c, t);
+        emitFree(c, t);
+    }
+    char *n = (*root).name;
+    char *u = (*root).upper;
+    fprintf(c, "\n/**\n * @brief  Read a %s from a stream.\n", u);
+    fprintf(c, " * @details  The struct must have been zeroed before it is first read into.\n");
+    fprintf(c, " *\n * @return  Zero if successful, nonzero if the input is invalid.\n */\n");
+    fprintf(c, "int %s_read(%s *v, FILE *f) {\n", n, u);
+    fprintf(c, "    argo_reader_enter(f);\n");
+    fprintf(c, "    int c = argo_getc_nonblank(f);\n");
+    fprintf(c, "    int status = 1;\n");
+    fprintf(c, "    if (c == ARGO_LBRACE)\n        status = read%s(v, f);\n", (*root).camel);
+    fprintf(c, "    else\n        argo_schema_error(\"Expected '{'\", c);\n");
+    fprintf(c, "    argo_reader_leave(f);\n    return status;\n}\n");
+    fprintf(c, "\n/**\n * @brief  Write a %s to a stream in canonical form.\n", u);
+    fprintf(c, " *\n * @return  Zero if successful, nonzero on an output error or a number\n");
+    fprintf(c, " * that cannot be written.\n */\n");
+    fprintf(c, "int %s_write(%s *v, FILE *f) {\n", n, u);
+    fprintf(c, "    int status = write%s(v, f);\n    return status || ferror(f) != 0;\n}\n", (*root).camel);
+    fprintf(c, "\n/**\n * @brief  Free the buffers owned by a %s, and zero it.\n */\n", u);
+    fprintf(c, "void %s_free(%s *v) {\n", n, u);
+    fprintf(c, "    free%s(v);\n    *v = (%s){0};\n}\n", (*root).camel, u);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "USAGE: %s SCHEMA OUTPUT\n", *argv);
+        return EXIT_FAILURE;
+    }
+    FILE *in = fopen(*(argv + 1), "r");
+    if (in == NULL) {
+        perror(*(argv + 1));
+        return EXIT_FAILURE;
+    }
+    ARGO_VALUE *schema = argo_read_value(in);
+    fclose(in);
+    if (schema == NULL)
+        fail("Invalid schema", *(argv + 1));
+    if (kindOf(schema, "the schema") != KIND_OBJECT)
+        fail("The schema must describe an object", NULL);
+
+    char *output = *(argv + 2);
+    char *base = strrchr(output, '/') != NULL ? strrchr(output, '/') + 1 : output;
+    ARGO_STRING name = {0, strlen(base), malloc(strlen(base) * sizeof(ARGO_CHAR) + 1)};
+    for (size_t i = 0; i < name.length; i++)
+        *(name.content + i) = (unsigned char)*(base + i);
+    TYPE *root = buildType(schema, identifier(&name));
+
+    char *path = malloc(strlen(output) + 3);
+    sprintf(path, "%s.h", output);
+    FILE *h = fopen(path, "w");
+    if (h == NULL) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    char *guard = malloc(strlen(base) + 3);
+    for (size_t i = 0; i <= strlen(base); i++) {
+        char c = *(base + i);
+        *(guard + i) = c >= 'a' && c <= 'z' ? c - 'a' + 'A' : (c == '\0' || (c >= 'A' && c <= 'Z')
+                                                             || (c >= '0' && c <= '9')) ? c : '_';
+    }
+    strcat(guard, "_H");
+    emitHeader(h, guard, root);
+    if (fclose(h) != 0) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    sprintf(path, "%s.c", output);
+    FILE *c = fopen(path, "w");
+    if (c == NULL) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    char *header = malloc(strlen(base) + 3);
+    sprintf(header, "%s.h", base);
+    emitSource(c, header, root);
+    if (fclose(c) != 0) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
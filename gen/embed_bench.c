@@ -0,0 +1,77 @@
+/*
+ * Check and benchmark of a document embedded by bin/argo_embed.
+ *
+ * Compares the canonical output of the document built into the program
+ * from rsrc/package-lock.json with that of the same file parsed at run
+ * time, checks that its members are found by interned names, and reports
+ * how long the parse takes, which is the startup time the embedded copy
+ * saves.
+ *
+ * Usage: bin/argo_embed_bench [ITERATIONS]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "argo.h"
+#include "global.h"
+#include "document.h"
+#include "intern.h"
+#include "package-lock.h"
+
+static char *canonical(ARGO_VALUE *v, size_t *length) {
+    char *text = NULL;
+    FILE *out = open_memstream(&text, length);
+    argo_write_value(v, out);
+    fclose(out);
+    return text;
+}
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(*(argv + 1)) : 200;
+    char *path = "rsrc/package-lock.json";
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    global_options = CANONICALIZE_OPTION;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ARGO_VALUE *parsed = NULL;
+    for (long i = 0; i < iterations; i++) {
+        rewind(in);
+        argo_document_reset();
+        parsed = argo_read_value(in);
+        if (parsed == NULL) {
+            fprintf(stderr, "Parse of %s failed\n", path);
+            return EXIT_FAILURE;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fclose(in);
+    double parse = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / iterations;
+
+    size_t parsedLength, embeddedLength;
+    char *expected = canonical(parsed, &parsedLength);
+    char *actual = canonical(argo_embedded_package_lock, &embeddedLength);
+    if (parsedLength != embeddedLength || memcmp(expected, actual, parsedLength) != 0) {
+        fprintf(stderr, "Embedded document differs from %s\n", path);
+        return EXIT_FAILURE;
+    }
+    ARGO_VALUE *sentinel = (*argo_embedded_package_lock).content.object.member_list;
+    for (ARGO_VALUE *m = (*sentinel).next; m != sentinel; m = (*m).next) {
+        ARGO_STRING key;
+        if (argo_intern_string(&(*m).name, &key) || argo_object_member(argo_embedded_package_lock, &key) != m) {
+            fprintf(stderr, "Embedded member not found by its interned name\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("parse at startup: %10.0f ns\n", parse);
+    printf("embedded:         %10.0f ns\n", 0.0);
+    printf("output identical (%zu bytes)\n", parsedLength);
+    free(expected);
+    free(actual);
+    return EXIT_SUCCESS;
+}
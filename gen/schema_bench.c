@@ -0,0 +1,93 @@
+/*
+ * Benchmark of a generated parser and serializer against the generic ones.
+ *
+ * Reads and writes the same document over and over, first with order_read()
+ * and order_write(), generated by bin/argo_gen from gen/order.schema.json,
+ * and then with argo_read_value() and argo_write_value(), and reports the
+ * time per document for each.
+ *
+ * Usage: bin/argo_schema_bench [ITERATIONS] [FILE]
+ * The default is 1000000 iterations over a small built-in order.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "argo.h"
+#include "global.h"
+#include "document.h"
+#include "order.h"
+
+static char sample[] =
+    "{\"id\": 73519, \"symbol\": \"ACME\", \"price\": 101.25, \"quantity\": 400,\n"
+    " \"side\": \"buy\", \"account\": {\"desk\": \"equities\", \"limits\": [1, 2, 3]},\n"
+    " \"tags\": [\"open\", \"limit\", \"day\"],\n"
+    " \"fill\": {\"venue\": \"XNAS\", \"time\": 1700000000123, \"partial\": false}}\n";
+
+static double elapsed(struct timespec *start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - (*start).tv_sec) + (now.tv_nsec - (*start).tv_nsec) / 1e9;
+}
+
+int main(int argc, char **argv) {
+    long iterations = argc > 1 ? atol(*(argv + 1)) : 1000000;
+    char *text = sample;
+    size_t length = sizeof(sample) - 1;
+    if (argc > 2) {
+        FILE *in = fopen(*(argv + 2), "r");
+        if (in == NULL) {
+            perror(*(argv + 2));
+            return EXIT_FAILURE;
+        }
+        fseek(in, 0, SEEK_END);
+        length = ftell(in);
+        rewind(in);
+        text = malloc(length);
+        if (text == NULL || fread(text, 1, length, in) != length) {
+            fprintf(stderr, "Failed to read %s\n", *(argv + 2));
+            return EXIT_FAILURE;
+        }
+        fclose(in);
+    }
+    FILE *f = fmemopen(text, length, "r");
+    FILE *out = fopen("/dev/null", "w");
+    if (f == NULL || out == NULL) {
+        perror("open");
+        return EXIT_FAILURE;
+    }
+
+    ORDER order = {0};
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long i = 0; i < iterations; i++) {
+        rewind(f);
+        if (order_read(&order, f)) {
+            fprintf(stderr, "Generated parser failed at iteration %ld\n", i);
+            return EXIT_FAILURE;
+        }
+        order_write(&order, out);
+    }
+    double generated = elapsed(&start) / iterations * 1e9;
+    order_free(&order);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long i = 0; i < iterations; i++) {
+        rewind(f);
+        argo_document_reset();
+        ARGO_VALUE *v = argo_read_value(f);
+        if (v == NULL) {
+            fprintf(stderr, "Generic parser failed at iteration %ld\n", i);
+            return EXIT_FAILURE;
+        }
+        argo_write_value(v, out);
+    }
+    double generic = elapsed(&start) / iterations * 1e9;
+
+    printf("generated: %8.0f ns/document\n", generated);
+    printf("generic:   %8.0f ns/document\n", generic);
+    printf("speedup:   %8.2fx\n", generic / generated);
+    fclose(out);
+    fclose(f);
+    return EXIT_SUCCESS;
+}
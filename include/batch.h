@@ -0,0 +1,53 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Batch mode.
+ *
+ * "argo --batch [-c|-v] [-p [INDENT]] [-u] [-k] [-o OUTPUT | -s SUFFIX] [-j JOBS]
+ * PATH..." validates or canonicalizes many documents in one run.  Each PATH
+ * is a file, a directory (searched recursively for files whose names end in
+ * ".json", other than those that end in SUFFIX and so look like earlier
+ * output), or "@LIST", a file naming one path per line.
+ *
+ * The files are shared among JOBS worker processes (one per processor by
+ * default), which claim them one at a time from a shared cursor, so that a
+ * worker that draws small files simply claims more of them.  Each worker
+ * keeps up to ARGO_BATCH_DEPTH files being read ahead through io_uring
+ * (see uring.h), falling back to pread() where io_uring is not available,
+ * and parses each file as its read completes.  The canonical output of
+ * FILE goes to the sibling file FILE followed by SUFFIX (".canonical.json"
+ * by default), or, with -o, to the single file OUTPUT ("-" for standard
+ * output), where the documents appear in the order the files were given,
+ * one per line.  With -v there is no output.
+ *
+ * A summary is written to standard error: the number of files, the rate
+ * in files and megabytes per second, and the slowest files.  The exit
+ * status is a failure if any file could not be read or was invalid.
+ */
+#define ARGO_BATCH_DEPTH 8
+#define ARGO_BATCH_SLOWEST 5
+#define ARGO_BATCH_SUFFIX ".canonical.json"
+
+typedef struct argo_batch {
+    char *output;                     // Combined output file, or NULL.
+    char *suffix;                     // Suffix of sibling output files.
+    int jobs;                         // Worker processes, 0 for one per processor.
+    int path_count;
+    char **paths;                     // Files, directories and @LISTs given.
+} ARGO_BATCH;
+
+/*
+ * Configuration set by argo_batch_args() when --batch is given.
+ */
+extern ARGO_BATCH argo_batch_config;
+
+int argo_batch_args(int argc, char **argv);
+int argo_batch_files(ARGO_BATCH *config, char ***files, size_t *count);
+int argo_batch(ARGO_BATCH *config);
+
+#endif
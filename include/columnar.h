@@ -0,0 +1,115 @@
+#ifndef COLUMNAR_H
+#define COLUMNAR_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argo.h"
+
+/*
+ * Columnar extraction of arrays of flat records.
+ *
+ * argo_columns_read() reads an array of objects, such as
+ * [{"ts": 1, "val": 2.5}, ...], straight from the input into one column per
+ * member name, in a single pass and without building any ARGO_VALUE: each
+ * object is a row, and the value of each member is converted as it is read
+ * (with the primitives of schema.h) and stored at the row's index in the
+ * contiguous array of its column.  A column holds 64-bit integers, doubles,
+ * or strings, which are kept as the UTF-8 text of all of them end to end in
+ * "blob", with the start of row i at offsets[i] and its end at
+ * offsets[i + 1].  Bit i % 64 of validity[i / 64] is set when row i has a
+ * value; a row whose object lacks the member, or has null for it, has none.
+ *
+ * The columns are either declared beforehand with argo_columns_declare(),
+ * with a type or with ARGO_COLUMN_ANY to have it inferred, or, when the set
+ * is created with "infer" set, added as new member names turn up.  An
+ * inferred column takes the type of its first value that is not null, true
+ * and false counting as the integers 1 and 0, and an integer column turns
+ * into a double column when a number that is not an integer comes along.
+ * A value that does not fit the type of its column (a string in a number
+ * column, or any array or object) is taken as null and counted in
+ * "mismatched", and so is every member after the first of the same name in
+ * an object.  Members without a column are skipped.
+ *
+ * argo_column_stats() computes the count, sum, minimum and maximum of the
+ * values of a numeric column.  The rows are taken 64 at a time, by word of
+ * the validity bitmap: a run of words whose rows all have values is summed
+ * as a plain array, two values at a time with SSE2 where it is available,
+ * and only the rows of the other words are picked out bit by bit.
+ *
+ * "argo --columns [-f NAME[:TYPE]]... [FILE...]" reads the array in each
+ * FILE, or in standard input if none is given, into one set of columns,
+ * and writes a JSON summary of them: the number of rows, and for each
+ * column its name, type, number of values, number of mismatched values
+ * and, for a numeric column, the sum, minimum and maximum.  Without -f,
+ * a column is inferred for every member name; with it, only the members
+ * named are extracted, with TYPE int64, double, string or any (the
+ * default).  The exit status is 0 if every array was read and the summary
+ * written, 1 otherwise, as when a sum overflows and has no JSON form.
+ */
+#define ARGO_COLUMN_ANY 0
+#define ARGO_COLUMN_INT64 1
+#define ARGO_COLUMN_DOUBLE 2
+#define ARGO_COLUMN_STRING 3
+
+#define ARGO_COLUMN_VALID(c, row) ((*((*(c)).validity + (row) / 64) >> ((row) % 64)) & 1)
+
+typedef struct argo_column {
+    ARGO_STRING name;                 // Member name.
+    int type;                         // ARGO_COLUMN_INT64, _DOUBLE or _STRING, or _ANY if not yet known.
+    int declared;                     // Nonzero if the type was declared rather than inferred.
+    uint64_t *validity;               // Bit for each row that has a value.
+    int64_t *ints;                    // Values of an integer column.
+    double *doubles;                  // Values of a double column.
+    size_t *offsets;                  // Start of the text of each row of a string column, and the end.
+    char *blob;                       // Text of the strings of a string column.
+    size_t blob_length;               // Number of bytes used in "blob".
+    size_t blob_capacity;             // Number of bytes allocated for "blob".
+    size_t count;                     // Number of rows that have a value.
+    size_t mismatched;                // Number of values taken as null.
+} ARGO_COLUMN;
+
+typedef struct argo_columns {
+    ARGO_COLUMN *columns;             // The columns, in order of declaration or appearance.
+    size_t column_count;              // Number of columns.
+    size_t column_capacity;           // Number of columns allocated.
+    size_t rows;                      // Number of rows read.
+    size_t row_capacity;              // Number of rows the columns have room for.
+    int infer;                        // Nonzero to add a column for each new member name.
+    size_t guess;                     // Column expected to hold the next member read.
+} ARGO_COLUMNS;
+
+typedef struct argo_column_stats {
+    size_t count;                     // Number of rows that have a value.
+    double sum;                       // Sum of the values, as a double.
+    double min;                       // Least value, as a double.
+    double max;                       // Greatest value, as a double.
+    int64_t int_sum;                  // Sum of the values of an integer column, modulo 2^64.
+    int64_t int_min;                  // Least value of an integer column.
+    int64_t int_max;                  // Greatest value of an integer column.
+} ARGO_COLUMN_STATS;
+
+typedef struct argo_columns_config {
+    char **fields;                    // NAME[:TYPE] given with -f.
+    int field_count;                  // Number of them, zero to infer every column.
+    char **paths;                     // Files named on the command line.
+    int path_count;                   // Number of them, zero for standard input.
+} ARGO_COLUMNS_CONFIG;
+
+/*
+ * Configuration set by argo_columns_args() when --columns is given.
+ */
+extern ARGO_COLUMNS_CONFIG argo_columns_config;
+
+int argo_column_type_named(char *name);
+void argo_columns_init(ARGO_COLUMNS *t, int infer);
+int argo_columns_declare(ARGO_COLUMNS *t, char *name, int type);
+ARGO_COLUMN *argo_columns_find(ARGO_COLUMNS *t, char *name);
+int argo_columns_read(ARGO_COLUMNS *t, FILE *f);
+int argo_column_stats(ARGO_COLUMN *c, size_t rows, ARGO_COLUMN_STATS *s);
+void argo_columns_free(ARGO_COLUMNS *t);
+int argo_columns_args(int argc, char **argv);
+int argo_columns_files(ARGO_COLUMNS_CONFIG *config);
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef COMPACT_H
+#define COMPACT_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argo.h"
+
+/*
+ * Compact representation of an Argo value.
+ *
+ * An ARGO_VALUE costs around a hundred bytes whatever it holds.  A compact
+ * document stores each value in a 16-byte ARGO_CNODE instead: the value
+ * itself is NaN-boxed into 64 bits, and the remaining 64 bits link the node
+ * to its next sibling and give its member name.  Anything that does not fit
+ * (string text, member names, integers wider than 48 bits) lives out of line
+ * in arrays owned by the document, and containers refer to their first child.
+ *
+ * Nodes are identified by their index in the document; index 0 is never a
+ * node, so it is used to mean "none".  The layout is private: use the
+ * accessor functions below rather than looking at the bits.
+ */
+typedef struct argo_cnode {
+    uint64_t bits;                    // NaN-boxed value.
+    uint32_t next;                    // Next sibling, or 0.
+    uint32_t name;                    // Offset of member name in the text, or 0.
+} ARGO_CNODE;
+
+typedef struct argo_compact {
+    ARGO_CNODE *nodes;                // Nodes, indexed from 1.
+    size_t node_count;                // Number of slots in use, including slot 0.
+    size_t node_capacity;
+    ARGO_CHAR *text;                  // Length-prefixed strings and names.
+    size_t text_length;
+    size_t text_capacity;
+    long *longs;                      // Integers that do not fit in 48 bits.
+    size_t long_count;
+    size_t long_capacity;
+    void *names;                      // Map from interned name to text offset.
+    size_t names_count;
+    size_t names_capacity;
+} ARGO_COMPACT;
+
+uint32_t argo_compact_build(ARGO_COMPACT *c, ARGO_VALUE *v);
+void argo_compact_free(ARGO_COMPACT *c);
+int argo_compact_write(ARGO_COMPACT *c, uint32_t n, FILE *f);
+
+ARGO_VALUE_TYPE argo_cnode_type(ARGO_COMPACT *c, uint32_t n);
+ARGO_BASIC argo_cnode_basic(ARGO_COMPACT *c, uint32_t n);
+int argo_cnode_is_int(ARGO_COMPACT *c, uint32_t n);
+long argo_cnode_int(ARGO_COMPACT *c, uint32_t n);
+double argo_cnode_float(ARGO_COMPACT *c, uint32_t n);
+ARGO_CHAR *argo_cnode_string(ARGO_COMPACT *c, uint32_t n, size_t *length);
+ARGO_CHAR *argo_cnode_name(ARGO_COMPACT *c, uint32_t n, size_t *length);
+uint32_t argo_cnode_name_id(ARGO_COMPACT *c, uint32_t n);
+uint32_t argo_cnode_first(ARGO_COMPACT *c, uint32_t n);
+uint32_t argo_cnode_next(ARGO_COMPACT *c, uint32_t n);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef COMPRESS_H
+#define COMPRESS_H
+
+#include <stdio.h>
+
+/*
+ * Compressed input and output.
+ *
+ * argo_input_start() looks at the first bytes of a stream and, if they are
+ * the magic number of a gzip or zstd stream, starts a read-ahead pipeline
+ * (see pipeline.h) whose producer thread decompresses the stream straight
+ * into the blocks of the ring that the parser reads, so that decompression
+ * overlaps parsing and the decompressed text is never copied.  Input that
+ * is not compressed but is not a regular file either is read ahead by the
+ * same pipeline without decompression.
+ *
+ * argo_compress_open() returns a stream that compresses whatever is
+ * written to it onto another stream; argo_compress_close() finishes the
+ * compressed stream and closes it.  This is what the -Z FORMAT option uses.
+ *
+ * Gzip is handled by zlib.  There is no zstd development package to build
+ * against, so libzstd is loaded with dlopen() when it is first needed, and
+ * zstd input or output is refused if it cannot be loaded.
+ */
+#define ARGO_FORMAT_NONE 0
+#define ARGO_FORMAT_GZIP 1
+#define ARGO_FORMAT_ZSTD 2
+
+/*
+ * Size of the buffer of compressed bytes on either side.
+ */
+#define ARGO_COMPRESS_BUFFER (128 * 1024)
+
+int argo_input_start(FILE *f);
+int argo_format_named(char *name);
+FILE *argo_compress_open(FILE *out, int format);
+int argo_compress_close(FILE *f);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef CURSOR_H
+#define CURSOR_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Reading a top-level array one element at a time.
+ *
+ * argo_read_value() keeps every element of an array in argo_value_storage
+ * until the whole array has been read, so an array larger than the
+ * storage cannot be read at all.  A cursor reads the elements of an array
+ * one by one instead: argo_cursor_open() reads the '[', and each call of
+ * argo_cursor_next() reads the next element with argo_read_value() and
+ * returns it, as a value that is not part of any array.  Before reading
+ * it, the element returned before is discarded with
+ * argo_document_truncate(), so that each element takes the same slots of
+ * argo_value_storage, starting where the storage stood when the cursor was
+ * opened, and the buffers of its strings become spares for the strings of
+ * the next (see document.h).  However long the array, the slots and string
+ * buffers in use are thus those of the largest element, and "peak" records
+ * the most slots any one element took.
+ *
+ * An element is valid only until the next call of argo_cursor_next() or
+ * argo_cursor_close(), and must be copied out if it is to be kept.  The
+ * cursor keeps the stream's read-ahead (see reader.h) from one element to
+ * the next, so nothing else may read from that stream, or read another
+ * document, while the cursor is open.
+ */
+#define ARGO_CURSOR_FIRST 0           // Before the first element.
+#define ARGO_CURSOR_MORE 1            // After an element, before ',' or ']'.
+#define ARGO_CURSOR_END 2             // After the ']'.
+#define ARGO_CURSOR_ERROR 3           // The input was not a valid array.
+
+typedef struct argo_cursor {
+    FILE *file;                       // Stream the array is read from.
+    int state;                        // One of the ARGO_CURSOR_ states.
+    int mark;                         // Slot of argo_value_storage where each element starts.
+    size_t index;                     // Number of elements returned so far.
+    size_t peak;                      // Most slots taken by one element.
+} ARGO_CURSOR;
+
+int argo_cursor_open(ARGO_CURSOR *c, FILE *f);
+ARGO_VALUE *argo_cursor_next(ARGO_CURSOR *c);
+int argo_cursor_close(ARGO_CURSOR *c);
+
+#endif
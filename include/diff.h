@@ -0,0 +1,55 @@
+#ifndef DIFF_H
+#define DIFF_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Semantic equality and structural difference of documents.
+ *
+ * argo_equal() decides whether two values mean the same thing: members of
+ * objects are matched by name, whatever their order (see the comment on
+ * ARGO_OBJECT in argo.h), elements of arrays are matched in order, and
+ * numbers are compared by value, so that 1, 1.0 and 10e-1 are equal.
+ *
+ * argo_diff() writes an RFC 6902 JSON Patch that turns one value into
+ * another: a JSON array of "add", "remove" and "replace" operations, each
+ * with an RFC 6901 JSON Pointer "path".  Members of objects are matched by
+ * name through a hash table; arrays are compared by trimming the longest
+ * equal prefix and suffix and pairing up what remains, so that one run of
+ * inserted, removed or changed elements yields operations on just that run.
+ *
+ * Both start by computing, in one pass over each tree, a hash of every
+ * subtree that is consistent with argo_equal() (for an object, a sum over
+ * its members, which does not depend on their order), and compare hashes
+ * before anything else, so that unequal subtrees are usually told apart at
+ * once and equal ones are walked once.  The work is close to linear in the
+ * size of the documents.  The hashes of values in argo_value_storage are
+ * kept in an array indexed as that array is; those of other values, such as
+ * embedded documents (see embed.h), are recomputed as needed.
+ *
+ * "argo --diff [-q] [-p [INDENT]] [-u] OLD NEW" reads the documents in the
+ * files OLD and NEW and writes the patch from OLD to NEW to standard
+ * output, in the layout that -p and -u select for canonical output.  With
+ * -q nothing is written.  As with diff(1), the exit status is 0 if the
+ * documents are equal, 1 if they differ and 2 if either could not be read.
+ */
+typedef struct argo_diff_config {
+    char *from;                       // File holding the old document.
+    char *to;                         // File holding the new document.
+    int quiet;                        // Nonzero for -q.
+} ARGO_DIFF_CONFIG;
+
+/*
+ * Configuration set by argo_diff_args() when --diff is given.
+ */
+extern ARGO_DIFF_CONFIG argo_diff_config;
+
+int argo_equal(ARGO_VALUE *a, ARGO_VALUE *b);
+long argo_diff(ARGO_VALUE *from, ARGO_VALUE *to, FILE *f);
+int argo_diff_args(int argc, char **argv);
+int argo_diff_files(ARGO_DIFF_CONFIG *config);
+
+#endif
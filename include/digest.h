@@ -0,0 +1,71 @@
+#ifndef DIGEST_H
+#define DIGEST_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argo.h"
+
+/*
+ * Digests of canonical output.
+ *
+ * An ARGO_DIGEST computes a SHA-256 or XXH64 digest of the bytes given to
+ * argo_digest_update(), a block at a time, in constant memory.
+ * argo_digest_open() returns a stream that feeds whatever is written to it
+ * into a digest, so any of the writers (argo_write_value() and the rest)
+ * can hash their output as they produce it, without it ever being held in
+ * memory as a whole.  argo_digest_value() does this for the canonical
+ * output of a value, in the layout that global_options selects: the digest
+ * is that of exactly the bytes that "argo -c" would write, so that
+ * "argo -c | sha256sum" gives the same result.
+ *
+ * "argo --digest [-a ALGORITHM] [-p [INDENT]] [-u] [-k] [FILE...]" writes
+ * the digest of the canonical form of the document in each FILE, or in
+ * standard input if none is given, in hexadecimal, followed by the name of
+ * the file ("-" for standard input), one per line, as sha256sum(1) does.
+ * ALGORITHM is sha256 (the default) or xxh64; -p, -u and -k select the
+ * canonical form as they do with -c, and -k in particular makes the digest
+ * independent of the order of the members of objects (see sort.h).  The
+ * exit status is 0 if every document was read, 1 otherwise.
+ */
+#define ARGO_DIGEST_SHA256 1
+#define ARGO_DIGEST_XXH64 2
+
+/*
+ * Size in bytes of the largest digest.
+ */
+#define ARGO_DIGEST_MAX 32
+
+typedef struct argo_digest {
+    int algorithm;                    // ARGO_DIGEST_SHA256 or ARGO_DIGEST_XXH64.
+    uint64_t length;                  // Number of bytes hashed so far.
+    unsigned char block[64];          // Bytes not yet making up a whole block.
+    size_t used;                      // Number of bytes in "block".
+    union {
+        uint32_t sha256[8];
+        uint64_t xxh64[4];
+    } state;
+} ARGO_DIGEST;
+
+typedef struct argo_digest_config {
+    int algorithm;                    // Algorithm selected with -a.
+    char **paths;                     // Files named on the command line.
+    int path_count;                   // Number of them, zero for standard input.
+} ARGO_DIGEST_CONFIG;
+
+/*
+ * Configuration set by argo_digest_args() when --digest is given.
+ */
+extern ARGO_DIGEST_CONFIG argo_digest_config;
+
+int argo_digest_named(char *name);
+void argo_digest_init(ARGO_DIGEST *d, int algorithm);
+void argo_digest_update(ARGO_DIGEST *d, const void *data, size_t size);
+size_t argo_digest_final(ARGO_DIGEST *d, unsigned char *out);
+FILE *argo_digest_open(ARGO_DIGEST *d);
+int argo_digest_value(ARGO_VALUE *v, int algorithm, unsigned char *out, size_t *length);
+int argo_digest_args(int argc, char **argv);
+int argo_digest_files(ARGO_DIGEST_CONFIG *config);
+
+#endif
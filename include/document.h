@@ -0,0 +1,30 @@
+#ifndef DOCUMENT_H
+#define DOCUMENT_H
+
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Reuse of the storage belonging to a parsed document.
+ *
+ * argo_document_reset() discards the document held in argo_value_storage so
+ * that the next argo_read_value() starts again from the first slot.  The
+ * string buffers that were allocated for the old document are not freed;
+ * they are kept on a list of spare buffers, and each string read afterwards
+ * takes one from that list (with argo_string_reuse()) before it would
+ * otherwise allocate.  A loop that reads similarly shaped documents and
+ * resets between them therefore reaches a steady state in which reading
+ * makes no calls to malloc() or realloc() at all.
+ */
+void argo_document_reset(void);
+void argo_document_truncate(int mark);
+void argo_string_reuse(ARGO_STRING *s);
+void argo_document_release(void);
+
+/*
+ * Number of spare string buffers currently available for reuse.
+ */
+extern size_t argo_spare_count;
+
+#endif
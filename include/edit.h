@@ -0,0 +1,65 @@
+#ifndef EDIT_H
+#define EDIT_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Changing a document in place, and writing it again cheaply.
+ *
+ * The functions below change a document that has been read into
+ * argo_value_storage.  The place to change is named by an RFC 6901 JSON
+ * Pointer from the root, as in the patches that argo_diff() writes (see
+ * diff.h), whose steps argo_pointer_token() decodes for them and for the
+ * queries of the daemon (see server.h).  They follow the operations of
+ * RFC 6902: argo_edit_add() sets a member of an object or inserts an
+ * element into an array, argo_edit_replace() replaces a value that is
+ * there, argo_edit_remove() removes one, and argo_edit_splice() removes and
+ * inserts a run of elements of an array at once.  A value added to the document must be one that
+ * argo_read_value() returned and that is not yet part of any other value;
+ * it becomes part of the document, and must not be used by itself again.
+ *
+ * Values have no links to the containers that hold them, and a subtree can
+ * be held by several containers at once if the document was read with
+ * hash-consing (see hashcons.h).  Naming the place by its path from the
+ * root gives every function the containers above the change: each of them
+ * is marked as changed on the way down, and a list of members or elements
+ * that is shared is copied first, so that the change is seen in that one
+ * place only.  The cached hash of each of them (see hashcons.h), the
+ * sorted order of the object that is changed (see sort.h), and the source
+ * spans of the values that are added (see zerocopy.h) are forgotten, so
+ * that nothing written later uses them.
+ *
+ * argo_edit_write() writes canonical output for a document, exactly as
+ * argo_write_value() would, and keeps a copy of it, with the position and
+ * length of every value within it.  When the same document is written
+ * again, each value that has not changed since is copied from that output
+ * in one piece, rather than written value by value, and only the values
+ * on the paths to the changes, and the values that were added, are
+ * written afresh.  The work of writing the changed document again is thus
+ * a copy of its bytes and a walk of the paths that changed.  The layout
+ * must be the same each time: if global_options has changed, or another
+ * document is written, everything is written afresh.  argo_document_reset()
+ * forgets the copy.
+ */
+
+/*
+ * Number of values written afresh by the last argo_edit_write(), and
+ * number of bytes that were copied from the output before it.
+ */
+extern size_t argo_edit_encoded;
+extern size_t argo_edit_copied;
+
+char *argo_pointer_token(char *p, char *end, ARGO_STRING *name);
+ARGO_VALUE *argo_edit_find(ARGO_VALUE *root, char *pointer);
+int argo_edit_add(ARGO_VALUE *root, char *pointer, ARGO_VALUE *value);
+int argo_edit_replace(ARGO_VALUE *root, char *pointer, ARGO_VALUE *value);
+int argo_edit_remove(ARGO_VALUE *root, char *pointer);
+int argo_edit_splice(ARGO_VALUE *root, char *pointer, size_t index, size_t remove,
+                     ARGO_VALUE **values, size_t count);
+int argo_edit_write(ARGO_VALUE *root, FILE *f);
+void argo_edit_forget(void);
+
+#endif
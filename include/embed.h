@@ -0,0 +1,38 @@
+#ifndef EMBED_H
+#define EMBED_H
+
+#include <stdio.h>
+
+#include "argo.h"
+
+/*
+ * Documents built into the program at compile time.
+ *
+ * argo_embed_write() writes a C source file that defines a parsed document
+ * as static const data: one array holding every ARGO_VALUE of the document,
+ * with the next, prev and list pointers already resolved to addresses in
+ * that array, and one array of ARGO_CHAR holding the text of every name,
+ * string and number, each distinct text stored once.  A program linked
+ * with that file has the document in memory from the start and never
+ * parses it.  bin/argo_embed (gen/argo_embed.c) runs it on a JSON file, and
+ * the Makefile uses it to build $(BLDD)/embed/NAME.c from rsrc/NAME.json.
+ *
+ * The document lives in read-only memory.  It can be read, walked and
+ * written with argo_write_value(), but must not be modified.  The binary
+ * forms of its numbers are computed at build time, so that writing it never
+ * needs to cache them.  Its strings are never reused or freed, since they
+ * are not in argo_value_storage.
+ */
+
+/*
+ * Initializer of an embedded string of "length" code points at "offset" in
+ * the array "text".  The capacity is the length, as for a string whose
+ * buffer is full, and not zero: a string with content and no capacity is
+ * taken for an interned name (see intern.h), and never compares equal to
+ * another interned name but itself.  An empty string is written as {0}.
+ */
+#define ARGO_EMBED_STRING(text, offset, length) {(length), (length), (ARGO_CHAR *)(text) + (offset)}
+
+int argo_embed_write(ARGO_VALUE *v, char *name, char *origin, FILE *out);
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef HASHCONS_H
+#define HASHCONS_H
+
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Structural hashing and hash-consing of subtrees.
+ *
+ * argo_value_hash() computes a hash of a value from its type and content
+ * and, for an array or object, from the names and hashes of its members or
+ * elements, in order, and argo_subtree_equal() compares values in the same
+ * terms, so that equal values have equal hashes.  Numbers are compared by
+ * their text: 1.0 and 1 are different values here, though canonical
+ * output writes them alike.
+ *
+ * When argo_hashcons_enabled is set, argo_read_value() records the hash of
+ * every value it reads in argo_value_hashes, interns string values as it
+ * interns member names (see intern.h), and, each time it finishes reading
+ * an array or object, looks for an identical one read earlier in the same
+ * document.  If there is one, the new container is made to share its list
+ * of elements or members, and the slots of argo_value_storage that held the
+ * copy are given back for the rest of the document to use.  In a document
+ * that repeats the same subtrees, such as the "requires" maps of a
+ * package-lock.json, every subtree is then stored once, and two subtrees of
+ * the document are equal exactly when they are the same list, which
+ * argo_subtree_equal() checks in constant time.
+ *
+ * A shared subtree is reachable from more than one place and must not be
+ * modified in place: argo_hashcons_is_shared() tells whether a list has
+ * been shared, and the functions of edit.h copy such a list before they
+ * change it, marking the lists of its members or elements as shared in
+ * turn.  Once a document has been changed, the subtrees read so far are
+ * forgotten, and values read afterwards share lists only among themselves.
+ * The table of subtrees read so far is emptied by argo_document_reset().
+ */
+extern int argo_hashcons_enabled;
+
+/*
+ * Hash of the value in each slot of argo_value_storage, recorded while
+ * reading with hash-consing enabled, or 0 if unknown.  NULL until first
+ * needed.
+ */
+extern unsigned long *argo_value_hashes;
+
+/*
+ * Number of subtrees of the current document that were found to be copies
+ * of earlier ones, and number of slots given back as a result.
+ */
+extern size_t argo_hashcons_shared;
+extern size_t argo_hashcons_saved;
+
+unsigned long argo_hash_mix(unsigned long h, unsigned long x);
+int argo_strings_equal(ARGO_STRING *a, ARGO_STRING *b);
+unsigned long argo_value_hash(ARGO_VALUE *v);
+int argo_subtree_equal(ARGO_VALUE *a, ARGO_VALUE *b);
+int argo_hashcons_value(ARGO_VALUE *v);
+int argo_hashcons_mark_shared(ARGO_VALUE *sentinel);
+int argo_hashcons_is_shared(ARGO_VALUE *sentinel);
+void argo_hashcons_forget_subtrees(void);
+void argo_hashcons_clear(void);
+
+#endif
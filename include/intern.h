@@ -0,0 +1,51 @@
+#ifndef INTERN_H
+#define INTERN_H
+
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Interning pool for object member names.
+ *
+ * Documents such as package-lock.json repeat a small set of member names
+ * thousands of times.  When interning is enabled, each distinct name is stored
+ * exactly once in the pool, together with its precomputed hash and length, and
+ * the "name" field of every member refers to that single copy instead of owning
+ * a private buffer.  Two interned names are equal exactly when their content
+ * pointers are equal.
+ *
+ * An interned ARGO_STRING is recognized by a zero "capacity" together with a
+ * non-NULL "content" pointer (a state that argo_append_char() never produces).
+ * Such a string is read-only: it must not be passed to argo_append_char() or
+ * freed by the caller.
+ */
+typedef struct argo_intern_entry {
+    struct argo_intern_entry *next;   // Next entry in the same hash chain.
+    unsigned long hash;               // Precomputed hash of the content.
+    size_t length;                    // Length of the content, in code points.
+    ARGO_CHAR content[];              // The name itself (not null terminated).
+} ARGO_INTERN_ENTRY;
+
+/*
+ * Nonzero if member names read by argo_read_value() are to be interned.
+ * Interning is off by default.
+ */
+extern int argo_intern_enabled;
+
+/*
+ * Number of distinct names currently held in the pool, and the number of
+ * allocations the pool has performed to hold them (entries plus table growth).
+ */
+extern size_t argo_intern_count;
+extern size_t argo_intern_allocs;
+
+unsigned long argo_intern_hash(ARGO_CHAR *content, size_t length);
+int argo_intern_string(ARGO_STRING *src, ARGO_STRING *dst);
+ARGO_INTERN_ENTRY *argo_intern_find(ARGO_CHAR *content, size_t length);
+int argo_is_interned(ARGO_STRING *s);
+int argo_names_equal(ARGO_STRING *a, ARGO_STRING *b);
+ARGO_VALUE *argo_object_member(ARGO_VALUE *v, ARGO_STRING *name);
+void argo_intern_clear(void);
+
+#endif
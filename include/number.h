@@ -0,0 +1,26 @@
+#ifndef NUMBER_H
+#define NUMBER_H
+
+#include "argo.h"
+
+/*
+ * Lazy numbers.
+ *
+ * argo_read_number() keeps only the text of a number, in "string_value",
+ * and leaves "valid_int" and "valid_float" zero.  The binary values are
+ * computed the first time they are asked for, through the functions below,
+ * and then cached in the ARGO_NUMBER.  A number whose text is valid but
+ * whose float representation is not is therefore one that has not been
+ * converted yet.
+ *
+ * When the text read is already in canonical form, "valid_string" is set to
+ * ARGO_CANONICAL_TEXT rather than 1, and argo_write_number() copies the
+ * text straight to the output without converting it at all.
+ */
+#define ARGO_CANONICAL_TEXT 2
+
+int argo_number_materialize(ARGO_NUMBER *n);
+int argo_number_int(ARGO_NUMBER *n, long *value);
+int argo_number_float(ARGO_NUMBER *n, double *value);
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Options beyond those defined in global.h.
+ * These use bits of global_options that global.h leaves unassigned (the
+ * indent occupies the least-significant byte and the original options the
+ * most-significant nibble), and are set by validargs.
+ *   If -u is specified (with -c), then the UTF8_OUTPUT_OPTION bit is set.
+ *   If -z is specified (with -c), then the ZERO_COPY_OPTION bit is set.
+ *   If --serve SOCKET is specified, then the SERVE_OPTION bit is set and
+ *   the path of the socket is stored in argo_serve_path (see server.h).
+ *   If -k is specified (with -c), then the SORT_KEYS_OPTION bit is set
+ *   (see sort.h).
+ *   If -Z gzip or -Z zstd is specified (with -c), then GZIP_OUTPUT_OPTION or
+ *   ZSTD_OUTPUT_OPTION respectively is set (see compress.h).
+ *   If --batch is specified, then the BATCH_OPTION bit is set, together with
+ *   the bits for the operation, indent, -u and -k, and the rest of the
+ *   arguments are stored in argo_batch_config (see batch.h).
+ *   If --diff is specified, then the DIFF_OPTION bit is set, together with
+ *   the bits for canonical output, indent and -u, and the rest of the
+ *   arguments are stored in argo_diff_config (see diff.h).
+ *   If --digest is specified, then the DIGEST_OPTION bit is set, together
+ *   with the bits for canonical output, indent, -u and -k, and the rest of
+ *   the arguments are stored in argo_digest_config (see digest.h).
+ *   If --columns is specified, then the COLUMNS_OPTION bit is set and the
+ *   rest of the arguments are stored in argo_columns_config (see
+ *   columnar.h).
+ */
+#define UTF8_OUTPUT_OPTION (0x08000000)
+#define ZERO_COPY_OPTION (0x04000000)
+#define SERVE_OPTION (0x02000000)
+#define BATCH_OPTION (0x01000000)
+#define GZIP_OUTPUT_OPTION (0x00800000)
+#define ZSTD_OUTPUT_OPTION (0x00400000)
+#define DIFF_OPTION (0x00200000)
+#define SORT_KEYS_OPTION (0x00100000)
+#define DIGEST_OPTION (0x00080000)
+#define COLUMNS_OPTION (0x00040000)
+
+/*
+ * Helpers of validargs, shared by the parsers of the arguments of --batch,
+ * --diff, --digest and --columns.  cmp() compares two strings byte by byte
+ * like strcmp(), validDigit() converts a string of digits (-1 if it is not
+ * one), and argo_indent_option() parses the INDENT after -p.
+ */
+int cmp(char *a, char *b);
+int validDigit(char *indent);
+int argo_indent_option(char *next, int *options);
+
+/*
+ * Help message listing every option.  This repeats the text of USAGE from
+ * argo.h, which cannot be changed, and adds the options defined above.
+ */
+#define ARGO_USAGE(program_name, retcode) do { \
+fprintf(stderr, "USAGE: %s %s\n", program_name, \
+"[-h] [-c|-v] [-p INDENT] [-u] [-k] [-z] [-Z FORMAT] | --serve SOCKET\n" \
+"       | --batch [-c|-v] [-p INDENT] [-u] [-k] [-o OUTPUT | -s SUFFIX] [-j JOBS] PATH...\n" \
+"       | --diff [-q] [-p INDENT] [-u] OLD NEW\n" \
+"       | --digest [-a ALGORITHM] [-p INDENT] [-u] [-k] [FILE...]\n" \
+"       | --columns [-f NAME[:TYPE]]... [FILE...]\n" \
+"   -h       Help: displays this help menu.\n" \
+"   -v       Validate: the program reads from standard input and checks whether\n" \
+"            it is syntactically correct JSON.  If there is any error, then a message\n" \
+"            describing the error is printed to standard error before termination.\n" \
+"            No other output is produced.\n" \
+"   -c       Canonicalize: once the input has been read and validated, it is\n" \
+"            re-emitted to standard output in 'canonical form'.  Unless -p has been\n" \
+"            specified, the canonicalized output contains no whitespace (except within\n" \
+"            strings that contain whitespace characters).\n" \
+"   -p       Pretty-print:  This option is only permissible if -c has also been specified.\n" \
+"            In that case, newlines and spaces are used to format the canonical output\n" \
+"            in a more human-friendly way.  For the precise requirements on where this\n" \
+"            whitespace must appear, see the assignment handout.\n" \
+"            The INDENT is an optional nonnegative integer argument that specifies the\n" \
+"            number of additional spaces to be output at the beginning of a line for each\n" \
+"            for each increase in indentation level.  If no value is specified, then a\n" \
+"            default value of 4 is used.\n" \
+"   -u       UTF-8 output:  This option is only permissible if -c has also been specified.\n" \
+"            Characters beyond U+007F are written as UTF-8 rather than as escapes.\n" \
+"   -k       Sorted keys:  This option is only permissible if -c has also been specified.\n" \
+"            The members of every object are written in order of their names, compared\n" \
+"            as UTF-16 code units (RFC 8785), so that equal objects are written alike.\n" \
+"   -z       Zero-copy output:  This option is only permissible if -c has also been\n" \
+"            specified.  If standard input is a regular file, literals that are already\n" \
+"            canonical are written straight from the input, which is mapped into memory.\n" \
+"            The output is the same as without -z.\n" \
+"   -Z       Compressed output:  This option is only permissible if -c has also been\n" \
+"            specified.  The output is compressed in FORMAT, which is gzip or zstd.\n" \
+"            Input compressed in either format is recognized and decompressed without\n" \
+"            any option.\n" \
+"   --serve  Daemon:  Listen on the Unix domain socket SOCKET and answer requests to\n" \
+"            validate, canonicalize, pretty-print or query documents until interrupted.\n" \
+"            See include/server.h for the protocol; bin/argo_client sends requests.\n" \
+"   --batch  Batch:  Validate or canonicalize each file given, each JSON file under each\n" \
+"            directory given, and each file named in a file @LIST, using JOBS worker\n" \
+"            processes.  Output goes to FILE followed by SUFFIX (default\n" \
+"            .canonical.json), or with -o to OUTPUT ('-' for standard output), one\n" \
+"            document per line in the order given.  A summary is written to standard error.\n" \
+"   --diff   Diff:  Write an RFC 6902 JSON Patch that turns the document in OLD into\n" \
+"            the one in NEW, in the layout -p and -u select.  Members of objects are\n" \
+"            matched by name in any order.  With -q only the exit status is set: 0 if\n" \
+"            the documents are equal, 1 if they differ, 2 on error.\n" \
+"   --digest Digest:  Write the digest of the canonical form of the document in each\n" \
+"            FILE, or in standard input, selected by -p, -u and -k as for -c, in the\n" \
+"            format of sha256sum.  ALGORITHM is sha256 (the default) or xxh64.\n" \
+"   --columns Columns:  Read the array of objects in each FILE, or in standard input,\n" \
+"            into typed columns, one per member name or per NAME given with -f, and\n" \
+"            write the row count and the count, sum, minimum and maximum of each\n" \
+"            column as JSON.  TYPE is int64, double, string or any (the default).\n" \
+); \
+exit(retcode); \
+} while(0)
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Parallel serialization of large documents.
+ *
+ * argo_write_value_parallel() produces exactly the bytes that
+ * argo_write_value() would, but divides the work among threads.  The tree is
+ * split, from the top down, into subtrees of at most ARGO_PARALLEL_GRAIN
+ * units of work (a unit is a value, or sixteen characters of a string); each
+ * such subtree is written by some thread into a buffer of its own, while the
+ * brackets, names, commas and indentation of the containers that were split
+ * are laid out in between by the calling thread.  The pieces are then
+ * emitted in document order with writev().
+ */
+#define ARGO_PARALLEL_GRAIN 16384
+
+int argo_write_value_parallel(ARGO_VALUE *v, FILE *f, int threads);
+
+/*
+ * A function that writes a value nested "depth" levels deep, in one fixed
+ * layout, without the newline that ends pretty output.  The one for the
+ * layout selected by global_options is what argo_write_value() runs on the
+ * whole tree and what the threads above run on subtrees.
+ */
+typedef int (*ARGO_SUBTREE_WRITER)(ARGO_VALUE *v, size_t depth, FILE *f);
+
+ARGO_SUBTREE_WRITER argo_subtree_writer(void);
+
+#endif
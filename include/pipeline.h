@@ -0,0 +1,50 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "reader.h"
+
+/*
+ * Read-ahead pipeline for input that is not a regular file.
+ *
+ * When stdin is a pipe, fread() in argo_reader_fill() stalls the parser
+ * each time the pipe runs dry, and the writer at the other end stalls in
+ * turn while the parser is busy.  argo_pipeline_start() instead hands the
+ * reading to a producer thread, which fills a ring of ARGO_PIPELINE_BLOCKS
+ * blocks while the parser consumes the previous one.  argo_reader_fill()
+ * then takes each block straight from the ring, so the bytes are not copied
+ * again.
+ *
+ * The ring has a single producer and a single consumer, so the handoff is a
+ * pair of counters: the producer publishes a block by advancing "head", and
+ * the consumer gives one back by advancing "tail".  Neither side takes a
+ * lock; a side that finds the ring full or empty sleeps on the other side's
+ * counter with a futex, and the other side wakes it after advancing the
+ * counter.  The consumer keeps the block it is reading until it asks for the
+ * next, and nothing in the parser refers to the bytes of a block once it has
+ * moved past them (argo_ungetc() only backs up over the byte just read), so
+ * a token that straddles two blocks is read correctly.
+ *
+ * The producer gets its bytes from an ARGO_PRODUCER, which is by default
+ * read() on the descriptor of the stream; compress.h plugs in a
+ * decompressor instead.  It returns the number of bytes placed in the
+ * buffer, 0 at end of input, or -1 on error.  The pipeline owns the state
+ * passed to the producer once it has started, and hands it to the
+ * ARGO_RELEASE given with it, if any, when argo_pipeline_stop() has joined
+ * the producer thread.
+ */
+#define ARGO_PIPELINE_BLOCKS 4
+#define ARGO_PIPELINE_BLOCK (256 * 1024)
+
+typedef ssize_t (*ARGO_PRODUCER)(void *state, unsigned char *buffer, size_t size);
+typedef void (*ARGO_RELEASE)(void *state);
+
+int argo_pipeline_wanted(FILE *f);
+int argo_pipeline_start(FILE *f, ARGO_PRODUCER produce, ARGO_RELEASE release, void *state);
+int argo_pipeline_fill(ARGO_READER *r);
+void argo_pipeline_stop(void);
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef READER_H
+#define READER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/*
+ * Block-buffered input for the parser.
+ *
+ * The functions that read Argo input take the bytes of the stream through
+ * argo_reader, which reads the stream a large block at a time, rather than
+ * calling fgetc() for each byte.  Having whole blocks in memory is what lets
+ * whitespace between tokens be skipped in bulk.
+ *
+ * A public reading function calls argo_reader_enter() before it reads from
+ * a stream and argo_reader_leave() when it is done.  When the outermost call
+ * returns, any bytes that were read ahead but not consumed are handed back to
+ * the stream by seeking backwards over them, so that the stream is left
+ * positioned just after the value, as if it had been read with fgetc().  If
+ * the stream cannot seek (a pipe, for example), the bytes are kept instead
+ * and are the first ones returned by the next read from the same stream.
+ */
+typedef struct argo_reader {
+    FILE *file;                       // Stream being read, or NULL.
+    unsigned char *next;              // Next unread byte.
+    unsigned char *end;               // End of the bytes read so far.
+    unsigned char *block;             // Buffer holding the bytes.
+    size_t block_size;                // Size of the buffer.
+    long base;                        // Stream offset of the start of the buffer.
+    int depth;                        // Nesting of reading calls in progress.
+    struct argo_pipeline *pipeline;   // Read-ahead in use, if any (pipeline.h).
+} ARGO_READER;
+
+#define ARGO_READ_BLOCK (64 * 1024)
+
+extern ARGO_READER argo_reader;
+
+void argo_reader_enter(FILE *f);
+void argo_reader_leave(FILE *f);
+int argo_reader_fill(ARGO_READER *r);
+int argo_skip_whitespace(ARGO_READER *r);
+int argo_read_end(FILE *f);
+
+/*
+ * Replacements for fgetc() and ungetc() on the stream passed to the
+ * enclosing argo_reader_enter().  As with ungetc(), only the character
+ * just read may be pushed back, and pushing back EOF does nothing.
+ */
+#define argo_getc(f) \
+    (argo_reader.next < argo_reader.end ? *argo_reader.next++ : argo_reader_fill(&argo_reader))
+#define argo_ungetc(c, f) do { if ((c) != EOF) argo_reader.next--; } while (0)
+#define argo_getc_nonblank(f) argo_skip_whitespace(&argo_reader)
+
+/*
+ * Offset in the stream of the next byte to be read.  This is meaningful
+ * only for a stream that could report its position when reading started.
+ */
+#define argo_reader_offset() (argo_reader.base + (argo_reader.next - argo_reader.block))
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef SCHEMA_H
+#define SCHEMA_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Support for the specialized parsers and serializers written by bin/argo_gen.
+ *
+ * bin/argo_gen reads a JSON Schema (the subset described in gen/argo_gen.c)
+ * and writes a header and a source file that declare a C struct for each
+ * object type in the schema, with a typed field for each property, and
+ * functions NAME_read(), NAME_write() and NAME_free() for the outermost type.
+ * The generated reader goes straight from the input to the fields: member
+ * names are matched by switching on their length and comparing with
+ * __builtin_memcmp(), numbers are converted into "long" or "double" fields
+ * as they are read, and no ARGO_VALUE is built.  The generated writer emits
+ * each member with precomputed name text and no dispatch on type.
+ *
+ * The functions below are the pieces that the generated code has in
+ * common.  They use the same string and number primitives as
+ * argo_read_value() and argo_write_value(), so that the specialized code
+ * accepts the same syntax and writes strings and numbers in the same
+ * canonical form (a "number" property is a double, and so is written as
+ * one even if it was read as "3").  They must be called between
+ * argo_reader_enter() and argo_reader_leave().  Each reading function
+ * returns zero if successful and nonzero, after printing a one-line
+ * message to standard error, if not.
+ */
+
+/*
+ * Bit for each of the (at most 64) properties of a type, set in the
+ * "present" field of its struct when the property has been read.
+ */
+#define ARGO_SCHEMA_FIELDS 64
+#define ARGO_SCHEMA_BIT(i) (1UL << (i))
+
+void argo_schema_error(char *what, int c);
+int argo_schema_key(ARGO_STRING *key, FILE *f);
+int argo_schema_long(long *value, int c, FILE *f);
+int argo_schema_double(double *value, int c, FILE *f);
+int argo_schema_string(ARGO_STRING *value, int c, FILE *f);
+int argo_schema_boolean(int *value, int c, FILE *f);
+int argo_schema_skip(int c, FILE *f);
+int argo_schema_grow(void **items, size_t *capacity, size_t count, size_t size);
+int argo_schema_write_long(long value, FILE *f);
+int argo_schema_write_double(double value, FILE *f);
+
+#endif
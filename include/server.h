@@ -0,0 +1,54 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "argo.h"
+
+/*
+ * Daemon mode.
+ *
+ * "argo --serve SOCKET" listens on a Unix domain socket and answers
+ * requests until it is sent SIGINT or SIGTERM, so that the cost of starting
+ * the program and of faulting in argo_value_storage is paid once rather
+ * than for every document.  The parser keeps its state in globals, so the
+ * pool of workers is a pool of processes: each is forked after the socket
+ * is opened, touches its copy of argo_value_storage once, and then serves
+ * any number of connections from an epoll loop, resetting the document
+ * (see document.h) between requests.
+ *
+ * A request is a header of ARGO_REQUEST_HEADER bytes, an operation code
+ * followed by the length of the body as a 32-bit big-endian integer, and
+ * then the body.  For ARGO_OP_QUERY the body is a JSON pointer (RFC 6901),
+ * a NUL byte, and the document; for the other operations it is just the
+ * document.  A response is a header of ARGO_RESPONSE_HEADER bytes, a
+ * status (0 for success), the time the request took to serve in
+ * microseconds and the length of the body, both as 32-bit big-endian
+ * integers, and then the body: the output, or a one-line error message.
+ * Any number of requests may be sent on one connection; responses come
+ * back in the same order.
+ */
+#define ARGO_OP_VALIDATE 'v'
+#define ARGO_OP_CANONICALIZE 'c'
+#define ARGO_OP_PRETTY 'p'
+#define ARGO_OP_QUERY 'q'
+
+#define ARGO_REQUEST_HEADER 5
+#define ARGO_RESPONSE_HEADER 9
+
+/*
+ * Largest request body that will be accepted.
+ */
+#define ARGO_REQUEST_MAX (64 * 1024 * 1024)
+
+/*
+ * Path of the socket given with --serve.
+ */
+extern char *argo_serve_path;
+
+int argo_serve(char *path, int workers);
+int argo_serve_request(int op, char *body, size_t length, FILE *out);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include "argo.h"
+#include "global.h"
+
+/*
+ * Members of objects in order of their names.
+ *
+ * With -k (SORT_KEYS_OPTION, see options.h), canonical output writes the
+ * members of every object sorted by name, as RFC 8785 (the JSON
+ * Canonicalization Scheme) does, so that equal objects are written as the
+ * same bytes whatever order their members were read in.  Names are compared as sequences of UTF-16 code units, which is
+ * the order RFC 8785 requires; it differs from the order of code points
+ * only for characters beyond U+FFFF.  Members with equal names keep the
+ * order in which they were read.
+ *
+ * The lists themselves are left in input order.  The sorted order is kept
+ * beside them, in argo_sorted_links, which is indexed as argo_value_storage
+ * is: the entry for the sentinel of an object's member list is its first
+ * member in sorted order, and the entry for a member is the member after
+ * it, or the sentinel after the last one.  An object is sorted, by a merge
+ * sort that relinks these entries and allocates nothing, the first time it
+ * is written, and written in the same order from then on without being
+ * sorted again.  argo_read_value() forgets the order of each object it
+ * reads, with argo_sort_forget(), so that nothing is kept from a document
+ * that has been discarded.
+ *
+ * An object outside argo_value_storage, such as one of an embedded document
+ * (see embed.h), has no entries; its members are found in order by a scan
+ * of the list for each one.
+ */
+
+/*
+ * Sorted order of the members of each object, as described above, or NULL
+ * for an object not yet sorted.  NULL until first needed.
+ */
+extern ARGO_VALUE **argo_sorted_links;
+
+#define argo_sort_forget(sentinel) \
+    do { \
+        if (argo_sorted_links != NULL) \
+            *(argo_sorted_links + ((sentinel) - argo_value_storage)) = NULL; \
+    } while (0)
+
+/*
+ * The member after "member" in the sorted order of the object whose member
+ * list is "sentinel", which argo_sorted_first() must already have been
+ * called on; "sentinel" after the last member.
+ */
+#define argo_sorted_next(sentinel, member) \
+    (argo_sorted_links != NULL && (member) >= argo_value_storage \
+     && (member) < argo_value_storage + NUM_ARGO_VALUES \
+     ? *(argo_sorted_links + ((member) - argo_value_storage)) \
+     : argo_sorted_after((sentinel), (member)))
+
+int argo_compare_names(ARGO_STRING *a, ARGO_STRING *b);
+ARGO_VALUE *argo_sorted_first(ARGO_VALUE *sentinel);
+ARGO_VALUE *argo_sorted_after(ARGO_VALUE *sentinel, ARGO_VALUE *member);
+int argo_sort_tree(ARGO_VALUE *v);
+
+#endif
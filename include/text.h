@@ -0,0 +1,16 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Bulk operations on ARGO_STRING, complementing argo_append_char().
+ * Strings grown with these functions remain valid arguments to
+ * argo_append_char(), and vice versa.
+ */
+int argo_append_chars(ARGO_STRING *s, ARGO_CHAR *chars, size_t count, size_t hint);
+int argo_string_reserve(ARGO_STRING *s, size_t capacity);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef URING_H
+#define URING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/*
+ * Minimal io_uring interface for reading files.
+ *
+ * This talks to the kernel with the raw io_uring_setup() and
+ * io_uring_enter() system calls, so it does not depend on liburing.  Only
+ * reads are supported.  argo_uring_init() fails on kernels (or sandboxes)
+ * without io_uring, and a read that the kernel rejects completes with a
+ * negative errno; callers are expected to fall back to pread() in either
+ * case.  A read the kernel has been given may write into its buffer until
+ * it completes, so after argo_uring_wait() has failed, argo_uring_drain()
+ * must succeed before the buffers of the reads in flight are freed.
+ */
+typedef struct argo_uring {
+    int fd;
+    unsigned entries;
+    unsigned *sq_head;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    void *sqes;                       // Array of struct io_uring_sqe.
+    void *cqes;                       // Array of struct io_uring_cqe.
+    void *sq_ring;
+    void *cq_ring;
+    size_t sq_ring_size;
+    size_t cq_ring_size;
+    size_t sqes_size;
+    unsigned pending;                 // Queued but not yet submitted.
+    unsigned inflight;                // Submitted but not yet completed.
+} ARGO_URING;
+
+int argo_uring_init(ARGO_URING *ring, unsigned entries);
+void argo_uring_free(ARGO_URING *ring);
+int argo_uring_read(ARGO_URING *ring, int fd, void *buffer, size_t length, off_t offset, uint64_t tag);
+int argo_uring_wait(ARGO_URING *ring, uint64_t *tag, int *result);
+int argo_uring_drain(ARGO_URING *ring);
+
+#endif
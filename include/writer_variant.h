@@ -0,0 +1,64 @@
+/*
+ * Template for one layout of the writer for arrays and objects.
+ *
+ * This file is included by argo.c once for each layout it supports, with
+ * the following macros defined:
+ *   WRITER_NAME    Name of the function to define.
+ *   WRITER_PRETTY  1 if newlines and indentation are to be written, else 0.
+ *   WRITER_INDENT  Number of spaces per level of indentation (an expression,
+ *                  which is a constant for the common widths).
+ *   WRITER_SORTED  1 if members are to be written in order of their names
+ *                  (see sort.h), else 0.
+ * The function writes a value that is "depth" levels deep.  Because the
+ * layout is fixed when the function is compiled, the loops below contain no
+ * tests of global_options; the compiler drops the code for the other layout.
+ * The macros are undefined again at the end of this file.
+ */
+
+static int WRITER_NAME(ARGO_VALUE *v, size_t depth, FILE *f) {
+    ARGO_VALUE *sentinel;
+    int object;
+    if ((*v).type == ARGO_OBJECT_TYPE) {
+        sentinel = (*v).content.object.member_list;
+        object = 1;
+    } else if ((*v).type == ARGO_ARRAY_TYPE) {
+        sentinel = (*v).content.array.element_list;
+        object = 0;
+    } else {
+        return writeScalar(v, f);
+    }
+    fputc(object ? ARGO_LBRACE : ARGO_LBRACK, f);
+    ARGO_VALUE *node = WRITER_SORTED && object ? argo_sorted_first(sentinel) : (*sentinel).next;
+    if (node != sentinel) {
+        while (1) {
+            if (WRITER_PRETTY) {
+                fputc(ARGO_LF, f);
+                writeIndent((depth + 1) * (WRITER_INDENT), f);
+            }
+            if (object) {
+                if (argo_write_string(&(*node).name, f))
+                    return 1;
+                fputc(ARGO_COLON, f);
+                if (WRITER_PRETTY)
+                    fputc(ARGO_SPACE, f);
+            }
+            if (WRITER_NAME(node, depth + 1, f))
+                return 1;
+            node = WRITER_SORTED && object ? argo_sorted_next(sentinel, node) : (*node).next;
+            if (node == sentinel)
+                break;
+            fputc(ARGO_COMMA, f);
+        }
+        if (WRITER_PRETTY) {
+            fputc(ARGO_LF, f);
+            writeIndent(depth * (WRITER_INDENT), f);
+        }
+    }
+    fputc(object ? ARGO_RBRACE : ARGO_RBRACK, f);
+    return ferror(f) ? 1 : 0;
+}
+
+#undef WRITER_NAME
+#undef WRITER_PRETTY
+#undef WRITER_INDENT
+#undef WRITER_SORTED
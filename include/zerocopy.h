@@ -0,0 +1,43 @@
+#ifndef ZEROCOPY_H
+#define ZEROCOPY_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#include "argo.h"
+
+/*
+ * Canonical output that reuses the bytes of the input.
+ *
+ * Much input is already canonical in the places that cost the most to
+ * write: member names and strings that are plain ASCII without escapes,
+ * and numbers already in canonical form.  When the input is a regular
+ * file, argo_source_map() maps it into memory and asks the parser to note,
+ * for every such name, string and number, where its literal lies in the
+ * file.  argo_write_value_zero_copy() then writes the value with writev(),
+ * from a list of pieces of which those literals point straight into the
+ * mapping; only brackets, commas, indentation and the values that had to be
+ * rewritten are formatted, into a small scratch buffer.  The output is the
+ * same as that of argo_write_value().
+ */
+typedef struct argo_span {
+    size_t offset;                    // Offset of the literal in the source.
+    size_t length;                    // Length of the literal, or 0 if it must be rewritten.
+} ARGO_SPAN;
+
+typedef struct argo_source_spans {
+    ARGO_SPAN name;                   // Span of the member name, if any.
+    ARGO_SPAN value;                  // Span of a string or number value.
+} ARGO_SOURCE_SPANS;
+
+/*
+ * Spans of the values in argo_value_storage, indexed as that array is, or
+ * NULL if the parser is not recording them.
+ */
+extern ARGO_SOURCE_SPANS *argo_spans;
+
+int argo_source_map(FILE *f);
+void argo_source_unmap(void);
+int argo_write_value_zero_copy(ARGO_VALUE *v, FILE *f);
+
+#endif
@@ -1,13 +1,345 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
+#include <float.h>
 
 #include "argo.h"
 #include "global.h"
 #include "debug.h"
+#include "intern.h"
+#include "document.h"
+#include "text.h"
+#include "number.h"
+#include "options.h"
+#include "reader.h"
+#include "parallel.h"
+#include "zerocopy.h"
+#include "hashcons.h"
+#include "sort.h"
+
+static ARGO_STRING stringScratch;
+static int stringPlain;
+
+/*
+ * Append a decoded code point to stringScratch, which keeps its capacity
+ * from one string to the next.
+ */
+#define scratchPut(c) \
+    ((stringScratch.length < stringScratch.capacity) \
+     ? (*(stringScratch.content + stringScratch.length++) = (c), 0) \
+     : argo_append_char(&stringScratch, (c)))
+
+#define argo_is_surrogate(c) ((c) >= 0xD800 && (c) <= 0xDFFF)
+#define argo_is_high_surrogate(c) ((c) >= 0xD800 && (c) <= 0xDBFF)
+#define argo_is_low_surrogate(c) ((c) >= 0xDC00 && (c) <= 0xDFFF)
+
+/*
+ * The tokenizer dispatches on character classes looked up in 256-entry
+ * tables rather than on chains of comparisons.  With GCC and Clang the
+ * dispatch is a computed goto through a table of labels; other compilers
+ * get an equivalent switch.
+ */
+#if defined(__GNUC__) && !defined(ARGO_NO_COMPUTED_GOTO)
+#define ARGO_COMPUTED_GOTO 1
+#endif
+
+/*
+ * Classes of the first character of a value.
+ */
+enum {
+    VC_INVALID, VC_LBRACE, VC_LBRACK, VC_QUOTE, VC_NUMBER, VC_TRUE, VC_FALSE, VC_NULL, VC_EOF
+};
+
+static const unsigned char valueClass[256] = {
+    [ARGO_LBRACE] = VC_LBRACE, [ARGO_LBRACK] = VC_LBRACK, [ARGO_QUOTE] = VC_QUOTE,
+    [ARGO_MINUS] = VC_NUMBER, ['0'] = VC_NUMBER, ['1'] = VC_NUMBER, ['2'] = VC_NUMBER,
+    ['3'] = VC_NUMBER, ['4'] = VC_NUMBER, ['5'] = VC_NUMBER, ['6'] = VC_NUMBER,
+    ['7'] = VC_NUMBER, ['8'] = VC_NUMBER, ['9'] = VC_NUMBER,
+    ['t'] = VC_TRUE, ['f'] = VC_FALSE, ['n'] = VC_NULL
+};
+
+/*
+ * Classes of the bytes inside a string literal.  SC_PLAIN bytes stand for
+ * themselves; a UTF-8 lead byte is followed by the given number of
+ * continuation bytes.
+ */
+enum {
+    SC_INVALID, SC_PLAIN, SC_QUOTE, SC_BSLASH, SC_UTF8
+};
+
+static const unsigned char stringClass[256] = {
+    [0x20 ... 0x7F] = SC_PLAIN,
+    [ARGO_QUOTE] = SC_QUOTE, [ARGO_BSLASH] = SC_BSLASH,
+    [0xC2 ... 0xF4] = SC_UTF8
+};
+
+/*
+ * Code point denoted by each single-character escape; zero if the
+ * character does not form an escape (\u is handled separately).
+ */
+static const unsigned char unescapeTable[256] = {
+    [ARGO_QUOTE] = ARGO_QUOTE, [ARGO_BSLASH] = ARGO_BSLASH, [ARGO_FSLASH] = ARGO_FSLASH,
+    [ARGO_B] = ARGO_BS, [ARGO_F] = ARGO_FF, [ARGO_N] = ARGO_LF,
+    [ARGO_R] = ARGO_CR, [ARGO_T] = ARGO_HT
+};
+
+/*
+ * Deterministic automaton for numeric literals.  The classes of input
+ * characters are NC_*, the states N_*.  A transition to N_END means that
+ * the character is not part of the number; it is accepted only in the
+ * states flagged in numberAccept.
+ */
+enum {
+    NC_OTHER, NC_MINUS, NC_PLUS, NC_ZERO, NC_DIGIT, NC_PERIOD, NC_EXP, NC_COUNT
+};
+
+enum {
+    N_START, N_MINUS, N_ZERO, N_INT, N_PERIOD, N_FRAC, N_EXP, N_EXP_SIGN, N_EXP_DIGITS,
+    N_END, N_ERROR
+};
+
+static const unsigned char numberClass[256] = {
+    [ARGO_MINUS] = NC_MINUS, [ARGO_PLUS] = NC_PLUS, ['0'] = NC_ZERO,
+    ['1'] = NC_DIGIT, ['2'] = NC_DIGIT, ['3'] = NC_DIGIT, ['4'] = NC_DIGIT, ['5'] = NC_DIGIT,
+    ['6'] = NC_DIGIT, ['7'] = NC_DIGIT, ['8'] = NC_DIGIT, ['9'] = NC_DIGIT,
+    [ARGO_PERIOD] = NC_PERIOD, ['e'] = NC_EXP, ['E'] = NC_EXP
+};
+
+static const unsigned char numberNext[N_END][NC_COUNT] = {
+    /*               OTHER    MINUS       PLUS        ZERO          DIGIT         PERIOD    EXP */
+    [N_START]     = {N_ERROR, N_MINUS,    N_ERROR,    N_ZERO,       N_INT,        N_ERROR,  N_ERROR},
+    [N_MINUS]     = {N_ERROR, N_ERROR,    N_ERROR,    N_ZERO,       N_INT,        N_ERROR,  N_ERROR},
+    [N_ZERO]      = {N_END,   N_END,      N_END,      N_ERROR,      N_ERROR,      N_PERIOD, N_EXP},
+    [N_INT]       = {N_END,   N_END,      N_END,      N_INT,        N_INT,        N_PERIOD, N_EXP},
+    [N_PERIOD]    = {N_ERROR, N_ERROR,    N_ERROR,    N_FRAC,       N_FRAC,       N_ERROR,  N_ERROR},
+    [N_FRAC]      = {N_END,   N_END,      N_END,      N_FRAC,       N_FRAC,       N_ERROR,  N_EXP},
+    [N_EXP]       = {N_ERROR, N_EXP_SIGN, N_EXP_SIGN, N_EXP_DIGITS, N_EXP_DIGITS, N_ERROR,  N_ERROR},
+    [N_EXP_SIGN]  = {N_ERROR, N_ERROR,    N_ERROR,    N_EXP_DIGITS, N_EXP_DIGITS, N_ERROR,  N_ERROR},
+    [N_EXP_DIGITS]= {N_END,   N_END,      N_END,      N_EXP_DIGITS, N_EXP_DIGITS, N_END,    N_END}
+};
+
+static const unsigned char numberAccept[N_END] = {
+    [N_ZERO] = 1, [N_INT] = 1, [N_FRAC] = 1, [N_EXP_DIGITS] = 1
+};
+
+static void readError(char *what, int c) {
+    if (c == EOF)
+        fprintf(stderr, "[%d] %s: unexpected end of input\n", argo_lines_read, what);
+    else if (c >= 0x20 && c < 0x7F)
+        fprintf(stderr, "[%d] %s: unexpected character '%c'\n", argo_lines_read, what, c);
+    else
+        fprintf(stderr, "[%d] %s: unexpected byte 0x%02x\n", argo_lines_read, what, c);
+}
+
+/*
+ * Take the next unused element of argo_value_storage.
+ */
+static ARGO_VALUE *newValue(void) {
+    if (argo_next_value >= NUM_ARGO_VALUES) {
+        fprintf(stderr, "[%d] Too many values (limit is %d)\n", argo_lines_read, NUM_ARGO_VALUES);
+        return NULL;
+    }
+    return argo_value_storage + argo_next_value++;
+}
+
+int readStringBody(FILE *f);
+static int readString(ARGO_STRING *s, FILE *f);
+static int readNumber(ARGO_NUMBER *n, FILE *f);
+static int readValueInto(ARGO_VALUE *v, int c, FILE *f);
+
+/*
+ * Note where a literal that started at "start" and ends at the current
+ * position lies in the input, for zero-copy output (see zerocopy.h).
+ */
+static void recordSpan(ARGO_SPAN *span, long start, int clean) {
+    (*span).offset = start;
+    (*span).length = clean ? argo_reader_offset() - start : 0;
+}
+
+#define argo_span_of(v) (argo_spans + ((v) - argo_value_storage))
+
+/*
+ * Read the members of an object, whose opening brace has been read.
+ */
+static int readObject(ARGO_VALUE *v, FILE *f) {
+    ARGO_VALUE *sentinel = newValue();
+    if (sentinel == NULL)
+        return -1;
+    (*sentinel).next = sentinel;
+    (*sentinel).prev = sentinel;
+    (*v).type = ARGO_OBJECT_TYPE;
+    (*v).content.object.member_list = sentinel;
+    argo_sort_forget(sentinel);
+    int c = argo_getc_nonblank(f);
+    if (c == ARGO_RBRACE)
+        return 0;
+    while (1) {
+        if (c != ARGO_QUOTE) {
+            readError("Expected member name", c);
+            return -1;
+        }
+        ARGO_VALUE *member = newValue();
+        if (member == NULL)
+            return -1;
+        long start = argo_reader_offset() - 1;
+        if (argo_intern_enabled) {
+            if (readStringBody(f) == -1 || argo_intern_string(&stringScratch, &(*member).name))
+                return -1;
+        } else {
+            argo_string_reuse(&(*member).name);
+            if (readString(&(*member).name, f) == -1)
+                return -1;
+        }
+        if (argo_spans != NULL)
+            recordSpan(&(*argo_span_of(member)).name, start, stringPlain);
+        c = argo_getc_nonblank(f);
+        if (c != ARGO_COLON) {
+            readError("Expected ':' after member name", c);
+            return -1;
+        }
+        if (readValueInto(member, argo_getc_nonblank(f), f) == -1)
+            return -1;
+        if (argo_hashcons_enabled && argo_hashcons_value(member))
+            return -1;
+        (*member).next = sentinel;
+        (*member).prev = (*sentinel).prev;
+        (*(*sentinel).prev).next = member;
+        (*sentinel).prev = member;
+        c = argo_getc_nonblank(f);
+        if (c == ARGO_RBRACE)
+            return 0;
+        if (c != ARGO_COMMA) {
+            readError("Expected ',' or '}' in object", c);
+            return -1;
+        }
+        c = argo_getc_nonblank(f);
+    }
+}
+
+/*
+ * Read the elements of an array, whose opening bracket has been read.
+ */
+static int readArray(ARGO_VALUE *v, FILE *f) {
+    ARGO_VALUE *sentinel = newValue();
+    if (sentinel == NULL)
+        return -1;
+    (*sentinel).next = sentinel;
+    (*sentinel).prev = sentinel;
+    (*v).type = ARGO_ARRAY_TYPE;
+    (*v).content.array.element_list = sentinel;
+    int c = argo_getc_nonblank(f);
+    if (c == ARGO_RBRACK)
+        return 0;
+    while (1) {
+        ARGO_VALUE *element = newValue();
+        if (element == NULL || readValueInto(element, c, f) == -1)
+            return -1;
+        if (argo_hashcons_enabled && argo_hashcons_value(element))
+            return -1;
+        (*element).next = sentinel;
+        (*element).prev = (*sentinel).prev;
+        (*(*sentinel).prev).next = element;
+        (*sentinel).prev = element;
+        c = argo_getc_nonblank(f);
+        if (c == ARGO_RBRACK)
+            return 0;
+        if (c != ARGO_COMMA) {
+            readError("Expected ',' or ']' in array", c);
+            return -1;
+        }
+        c = argo_getc_nonblank(f);
+    }
+}
+
+/*
+ * Read the rest of the token "true", "false" or "null", whose first
+ * character has been read.
+ */
+static int readLiteral(char *token, FILE *f) {
+    char *p = token + 1;
+    while (*p != '\0') {
+        int c = argo_getc(f);
+        if (c != *p) {
+            readError("Invalid literal", c);
+            return -1;
+        }
+        p++;
+    }
+    return 0;
+}
+
+/*
+ * Read a value into an element of argo_value_storage that has already been
+ * taken; "c" is the first character of the value, already read.
+ */
+static int readValueInto(ARGO_VALUE *v, int c, FILE *f) {
+    long start;
+#ifdef ARGO_COMPUTED_GOTO
+    static void *const targets[] = {
+        [VC_INVALID] = &&invalid, [VC_LBRACE] = &&object, [VC_LBRACK] = &&array,
+        [VC_QUOTE] = &&string, [VC_NUMBER] = &&number, [VC_TRUE] = &&literal_true,
+        [VC_FALSE] = &&literal_false, [VC_NULL] = &&literal_null, [VC_EOF] = &&invalid
+    };
+    goto *targets[c == EOF ? VC_EOF : valueClass[c]];
+#else
+    switch (c == EOF ? VC_EOF : valueClass[c]) {
+    case VC_LBRACE: goto object;
+    case VC_LBRACK: goto array;
+    case VC_QUOTE: goto string;
+    case VC_NUMBER: goto number;
+    case VC_TRUE: goto literal_true;
+    case VC_FALSE: goto literal_false;
+    case VC_NULL: goto literal_null;
+    default: goto invalid;
+    }
+#endif
+object:
+    return readObject(v, f);
+array:
+    return readArray(v, f);
+string:
+    start = argo_reader_offset() - 1;
+    (*v).type = ARGO_STRING_TYPE;
+    if (argo_hashcons_enabled) {
+        // Hash-consing shares equal strings as it shares equal subtrees.
+        if (readStringBody(f) == -1 || argo_intern_string(&stringScratch, &(*v).content.string))
+            return -1;
+    } else {
+        argo_string_reuse(&(*v).content.string);
+        if (readString(&(*v).content.string, f) == -1)
+            return -1;
+    }
+    if (argo_spans != NULL)
+        recordSpan(&(*argo_span_of(v)).value, start, stringPlain);
+    return 0;
+number:
+    (*v).type = ARGO_NUMBER_TYPE;
+    argo_ungetc(c, f);
+    start = argo_reader_offset();
+    argo_string_reuse(&(*v).content.number.string_value);
+    if (readNumber(&(*v).content.number, f) == -1)
+        return -1;
+    if (argo_spans != NULL)
+        recordSpan(&(*argo_span_of(v)).value, start,
+                   (*v).content.number.valid_string == ARGO_CANONICAL_TEXT);
+    return 0;
+literal_true:
+    (*v).type = ARGO_BASIC_TYPE;
+    (*v).content.basic = ARGO_TRUE;
+    return readLiteral(ARGO_TRUE_TOKEN, f);
+literal_false:
+    (*v).type = ARGO_BASIC_TYPE;
+    (*v).content.basic = ARGO_FALSE;
+    return readLiteral(ARGO_FALSE_TOKEN, f);
+literal_null:
+    (*v).type = ARGO_BASIC_TYPE;
+    (*v).content.basic = ARGO_NULL;
+    return readLiteral(ARGO_NULL_TOKEN, f);
+invalid:
+    readError("Expected a value", c);
+    return -1;
+}
 
-static int additionalIndent = 0;
-static int nameOption = -1;
-char intToHex(int x);
 /**
  * @brief  Read JSON input from a specified input stream, parse it,
  * and return a data structure representing the corresponding value.
@@ -29,163 +361,190 @@ char intToHex(int x);
  * @return  A valid pointer if the operation is completely successful,
  * NULL if there is any error.
  */
-int argo_read_object(FILE *f) {
-    int returnValue = argo_next_value;
-    ARGO_VALUE *sentinel = (argo_value_storage + argo_next_value + 1);
-    (*(argo_value_storage + argo_next_value)).content.object.member_list = sentinel;
-    argo_next_value++;
-    ARGO_VALUE *prvNode;
-    ARGO_VALUE *tmpNode;
+ARGO_VALUE *argo_read_value(FILE *f) {
+    argo_reader_enter(f);
+    ARGO_VALUE *v = newValue();
+    if (v != NULL && (readValueInto(v, argo_getc_nonblank(f), f) == -1
+                      || (argo_hashcons_enabled && argo_hashcons_value(v))))
+        v = NULL;
+    argo_reader_leave(f);
+    return v;
+}
+
+int readHex(int x) {
+    if (x >= 48 && x<=57)
+        return x - 48;
+    else if ((x >= 97 && x <= 102))
+        return x - 87;
+     else if (x >= 65 && x <= 70)
+        return x - 55;
+    else
+        return -1;
+}
+
+/*
+ * Read four hex digits following "\u" and return the UTF-16 code unit
+ * they represent, or -1 if they are not all hex digits.
+ */
+int readHexUnit(FILE *f) {
+    int unit = 0;
     int index = 0;
-    char c = fgetc(f);
-    while (c != '}') {
-        argo_next_value++;
-        nameOption = 0;
-        argo_read_value(f);
-        nameOption = -1;
-        if (fgetc(f) != ':')
-            return -1;
-        tmpNode = argo_read_value(f);
-        if (index == 0) {
-            (*sentinel).next = tmpNode;
-            (*tmpNode).prev = sentinel;
-            (*tmpNode).next = sentinel;
-            index = 1;
-        } else {
-            (*tmpNode).prev = prvNode;
-            (*prvNode).next = tmpNode;
-        }
-        c = fgetc(f);
-        prvNode = tmpNode;
-        if (c == '}')
-            break;
-        if (c != ',')
+    while (index < 4) {
+        int digit = readHex(argo_getc(f));
+        if (digit == -1)
             return -1;
+        unit = (unit << 4) | digit;
+        index++;
+    }
+    return unit;
+}
 
+/*
+ * Decode the remainder of a UTF-8 sequence whose first byte is "lead".
+ * Returns the code point, or -1 if the sequence is malformed, overlong,
+ * encodes a surrogate, or lies beyond U+10FFFF.
+ */
+int readUtf8(int lead, FILE *f) {
+    int count;
+    int cp;
+    int min;
+    if (lead <= 0xDF) {
+        count = 1;
+        cp = lead & 0x1F;
+        min = 0x80;
+    } else if (lead <= 0xEF) {
+        count = 2;
+        cp = lead & 0x0F;
+        min = 0x800;
+    } else {
+        count = 3;
+        cp = lead & 0x07;
+        min = 0x10000;
     }
-    argo_next_value++;
-    (*tmpNode).next = sentinel;
-    (*sentinel).prev = tmpNode;
-    return returnValue;
-}
-int argo_read_array(FILE *f) {
-    int returnValue = argo_next_value;
-    ARGO_VALUE *sentinel = (argo_value_storage + argo_next_value + 1);
-    (*(argo_value_storage + argo_next_value)).content.array.element_list = sentinel;
-    argo_next_value++;
-    ARGO_VALUE *prvNode;
-    ARGO_VALUE *tmpNode;
-    int index = 0;
-    char c = fgetc(f);
-    while (c != ']') {
-        argo_next_value++;
-        tmpNode = argo_read_value(f);
-        if (index == 0) {
-            (*sentinel).next = tmpNode;
-            (*tmpNode).prev = sentinel;
-            (*tmpNode).next = sentinel;
-            index = 1;
-        } else {
-            (*tmpNode).prev = prvNode;
-            (*prvNode).next = tmpNode;
-        }
-        c = fgetc(f);
-        prvNode = tmpNode;
-        if (c == ']')
-            break;
-        if (c != ',')
+    while (count > 0) {
+        int c = argo_getc(f);
+        if (c == EOF || (c & 0xC0) != 0x80)
             return -1;
-
+        cp = (cp << 6) | (c & 0x3F);
+        count--;
     }
-    argo_next_value++;
-    (*tmpNode).next = sentinel;
-    (*sentinel).prev = tmpNode;
-    return returnValue;
+    if (cp < min || cp > 0x10FFFF || argo_is_surrogate(cp))
+        return -1;
+    return cp;
 }
-ARGO_VALUE *argo_read_value(FILE *f) {
-    ARGO_VALUE *v;
-    char s = fgetc(f);
-    if (s == '{') {
-        v = (argo_value_storage + argo_next_value);
-        (*v).type = ARGO_OBJECT_TYPE;
-        ungetc(s,f);
-        int x = argo_read_object(f);
-        if (x != -1) {
-            return (argo_value_storage + x);
-        }
-        return NULL;
+
+/*
+ * Decode the body of a string literal, whose opening quote has already been
+ * read, into stringScratch.  Returns 0, or -1 if the literal is malformed.
+ * Runs of plain characters are copied straight out of the input buffer.
+ * stringPlain is left nonzero if there was nothing but such characters.
+ */
+int readStringBody(FILE *f) {
+    stringScratch.length = 0;
+    stringPlain = 1;
+    int pending = -1;
+    int unit;
+    int c;
+#ifdef ARGO_COMPUTED_GOTO
+    static void *const targets[] = {
+        [SC_INVALID] = &&invalid, [SC_PLAIN] = &&plain, [SC_QUOTE] = &&quote,
+        [SC_BSLASH] = &&escape, [SC_UTF8] = &&utf8
+    };
+#define NEXT_CHAR() do { \
+        c = argo_getc(f); \
+        goto *targets[c == EOF ? SC_INVALID : stringClass[c]]; \
+    } while (0)
+#else
+#define NEXT_CHAR() goto next
+next:
+    c = argo_getc(f);
+    switch (c == EOF ? SC_INVALID : stringClass[c]) {
+    case SC_PLAIN: goto plain;
+    case SC_QUOTE: goto quote;
+    case SC_BSLASH: goto escape;
+    case SC_UTF8: goto utf8;
+    default: goto invalid;
     }
-    else if (s == '[') {
-        (v) = (argo_value_storage + argo_next_value);
-        (*v).type = ARGO_ARRAY_TYPE;
-        ungetc(s, f);
-        int x = (argo_read_array(f));
-        if (x != -1) {
-            return argo_value_storage + x;
-        }
-        return NULL;
+#endif
+#ifdef ARGO_COMPUTED_GOTO
+    NEXT_CHAR();
+#endif
+plain:
+    if (pending != -1)
+        goto unpaired;
+    scratchPut(c);
+    while (argo_reader.next < argo_reader.end && stringClass[*argo_reader.next] == SC_PLAIN) {
+        scratchPut(*argo_reader.next);
+        argo_reader.next++;
     }
-    else if (s == '\"') {
-        (v) = (argo_value_storage + argo_next_value);
-        if ((*v).type == 0)
-            (*v).type = ARGO_STRING_TYPE;
-        if (nameOption == -1) {
-            int x = argo_read_string(&(*(argo_value_storage + argo_next_value)).content.string, f);
-            if (x != -1) {
-                if (argo_next_value == 0) {
-                    argo_next_value++;
-                }
-                return (argo_value_storage + x);
-            }
-        } else {
-            argo_read_string(&(*(argo_value_storage + argo_next_value)).name, f);
-        }
-        return NULL;
+    NEXT_CHAR();
+utf8:
+    stringPlain = 0;
+    c = readUtf8(c, f);
+    if (c == -1) {
+        fprintf(stderr, "[%d] Invalid UTF-8 sequence in string\n", argo_lines_read);
+        return -1;
     }
-    else if ((s >= '0' && s <= '9') || s == '-') {
-        ungetc(s, f);
-        (v) = (argo_value_storage + argo_next_value);
-        if ((*v).type == 0)
-            (*v).type = ARGO_NUMBER_TYPE;
-        int x = argo_read_number(&(*(argo_value_storage + argo_next_value)).content.number, f);
-        if (x != -1) {
-            if (argo_next_value == 0) {
-                argo_next_value++;
+    goto code_point;
+escape:
+    stringPlain = 0;
+    c = argo_getc(f);
+    if (c == ARGO_U) {
+        unit = readHexUnit(f);
+        if (unit == -1) {
+            fprintf(stderr, "[%d] Invalid \\u escape in string\n", argo_lines_read);
+            return -1;
+        }
+        if (pending != -1) {
+            if (argo_is_low_surrogate(unit)) {
+                scratchPut(0x10000 + ((pending - 0xD800) << 10) + (unit - 0xDC00));
+                pending = -1;
+                NEXT_CHAR();
             }
-            return (argo_value_storage + x);
+            scratchPut(pending);
+            pending = -1;
         }
-        return NULL;
+        if (argo_is_high_surrogate(unit))
+            pending = unit;
+        else
+            scratchPut(unit);
+        NEXT_CHAR();
     }
-
-
-    return NULL;
-}
-
-int argo_append_special(char c) {
-    if (c == '\"' || c == '\\') {
-        return c;
-    } else if (c==98) {
-        return 8;
-    } else if(c==114){
-        return 13;
-    } else if (c==110) {
-        return 10;
-    } else if(c==102) {
-        return  12;
-    } else if(c==116)
-        return 9;
+    if (c == EOF || unescapeTable[c] == 0) {
+        readError("Invalid escape in string", c);
+        return -1;
+    }
+    c = unescapeTable[c];
+code_point:
+    if (pending != -1) {
+        scratchPut(pending);
+        pending = -1;
+    }
+    scratchPut(c);
+    NEXT_CHAR();
+unpaired:
+    /* A high surrogate that is not followed by a low one stands alone. */
+    scratchPut(pending);
+    pending = -1;
+    goto plain;
+quote:
+    if (pending != -1)
+        scratchPut(pending);
+    return 0;
+invalid:
+    readError("Invalid character in string", c);
     return -1;
+#undef NEXT_CHAR
 }
-int readHex(int x) {
-    if (x >= 48 && x<=57)
-        return x - 48;
-    else if ((x >= 97 && x <= 102))
-        return x - 87;
-     else if (x >= 65 && x <= 70)
-        return x - 55;
-    else
+
+static int readString(ARGO_STRING *s, FILE *f) {
+    if (readStringBody(f) == -1)
+        return -1;
+    if (argo_append_chars(s, stringScratch.content, stringScratch.length, 0))
         return -1;
+    return 0;
 }
+
 /**
  * @brief  Read JSON input from a specified input stream, attempt to
  * parse it as a JSON string literal, and return a data structure
@@ -195,6 +554,13 @@ int readHex(int x) {
  * literal, according to the JSON syntax standard.  If the input can be
  * successfully parsed, then a pointer to a data structure representing
  * the corresponding value is returned.
+ * Bytes outside the ASCII range are decoded as UTF-8, and a "\u" escape
+ * for a high surrogate followed by one for a low surrogate is combined
+ * into the single code point the pair represents.  A surrogate that is
+ * not part of such a pair is kept as its own code point.
+ * The text is first decoded into a scratch buffer that is reused from one
+ * string to the next, so that the content of the string can be allocated
+ * just once, at its final size, when the closing quote has been seen.
  * In case of an error (these include failure of the input to conform
  * to the JSON standard, premature EOF on the input stream, as well as
  * other I/O errors), a one-line error message is output to standard error
@@ -205,44 +571,96 @@ int readHex(int x) {
  * nonzero if there is any error.
  */
 int argo_read_string(ARGO_STRING *s, FILE *f) {
-    char c = fgetc(f);
-    while (c != '\"'){
-        int index = 0;
-        if (c == '\\') {
-            c = fgetc(f);
-            if (argo_append_special(c) !=  -1) {
-                argo_append_char(s, argo_append_special(c));
-            }else if (c == 'u') {
-                char fplace, splace, tplace, foplace;
-                printf("\n");
-                while (index < 4) {
-                    c = fgetc(f);
-                    c = readHex(c);
-                    printf("%x", c);
-                    if (c == -1)
-                        return -1;
-                    else if (index == 0)
-                        fplace = c;
-                    else if (index == 1)
-                        splace = c;
-                    else if (index == 2)
-                        tplace = c;
-                    else if (index == 3)
-                        foplace = c;
-                    index++;
-                }
-                c = (4096 * fplace) +  (256 * splace) + (tplace * 16) + foplace;
-                printf("\n");
-                argo_append_char(s,c);
-            } else
-                return -1;
-        } else if (c > 0x1F && c < 0xFF){
-            argo_append_char(s,c);
-        } else
+    argo_reader_enter(f);
+    int status = readString(s, f);
+    argo_reader_leave(f);
+    return status;
+}
+
+/*
+ * Determine whether the text of a number, whose period and exponent marker
+ * (if any) are at the given offsets, is in canonical form: an integer with
+ * no redundant sign or leading zero, or a fraction in the 0.d...de[-]x form
+ * written by printFloat().
+ */
+static int canonicalNumber(ARGO_CHAR *text, size_t length, size_t period, size_t exp) {
+    size_t sign = *text == ARGO_MINUS;
+    if (period == 0 && exp == 0)
+        return length - sign <= 18 && !(sign && *(text + 1) == ARGO_DIGIT0);
+    if (period != sign + 1 || *(text + sign) != ARGO_DIGIT0 || exp == 0 || *(text + exp) != ARGO_E)
+        return 0;
+    size_t digits = exp - period - 1;
+    if (*(text + period + 1) == ARGO_DIGIT0 || *(text + exp - 1) == ARGO_DIGIT0 || digits > ARGO_PRECISION)
+        return 0;
+    size_t first = exp + 1;
+    if (*(text + first) == ARGO_PLUS)
+        return 0;
+    if (*(text + first) == ARGO_MINUS)
+        first++;
+    return *(text + first) != ARGO_DIGIT0 || (first == exp + 1 && length == first + 1);
+}
+
+/*
+ * Determine whether a number, whose period and exponent marker (if any) are
+ * at the given offsets, might be too large in magnitude for a double.  The
+ * digits before the period and the exponent bound its decimal magnitude
+ * from above, so only the rare number for which that bound is too large
+ * needs to be converted to find out.
+ */
+static int mayOverflow(ARGO_CHAR *text, size_t length, size_t period, size_t exp) {
+    size_t sign = *text == ARGO_MINUS;
+    long magnitude = (long)((period ? period : exp ? exp : length) - sign);
+    if (exp != 0) {
+        size_t i = exp + 1;
+        int negative = *(text + i) == ARGO_MINUS;
+        if (negative || *(text + i) == ARGO_PLUS)
+            i++;
+        long e = 0;
+        for (; i < length && e <= DBL_MAX_10_EXP; i++)
+            e = e * 10 + (*(text + i) - ARGO_DIGIT0);
+        magnitude += negative ? -e : e;
+    }
+    return magnitude > DBL_MAX_10_EXP;
+}
+
+static int readNumber(ARGO_NUMBER *n, FILE *f) {
+    stringScratch.length = 0;
+    size_t period = 0;
+    size_t exp = 0;
+    int state = N_START;
+    int c;
+    while (1) {
+        c = argo_getc(f);
+        int next = numberNext[state][c == EOF ? NC_OTHER : numberClass[c]];
+        if (next == N_END)
+            break;
+        if (next == N_ERROR) {
+            readError("Invalid number", c);
             return -1;
-        c = fgetc(f);
+        }
+        if (next == N_PERIOD)
+            period = stringScratch.length;
+        else if (next == N_EXP)
+            exp = stringScratch.length;
+        scratchPut(c);
+        state = next;
     }
-    return argo_next_value;
+    argo_ungetc(c, f);
+    if (!numberAccept[state]) {
+        readError("Invalid number", c);
+        return -1;
+    }
+    if (argo_append_chars(&(*n).string_value, stringScratch.content, stringScratch.length, 0))
+        return -1;
+    int canonical = canonicalNumber(stringScratch.content, stringScratch.length, period, exp);
+    (*n).valid_string = canonical ? ARGO_CANONICAL_TEXT : 1;
+    (*n).valid_int = 0;
+    (*n).valid_float = 0;
+    if (mayOverflow(stringScratch.content, stringScratch.length, period, exp) && argo_number_materialize(n)) {
+        fprintf(stderr, "[%d] Number out of range\n", argo_lines_read);
+        return -1;
+    }
+    return 0;
 }
 
 /**
@@ -258,6 +676,10 @@ int argo_read_string(ARGO_STRING *s, FILE *f) {
  * the input stream; (2) a floating point representation of the corresponding
  * value; and (3) an integer representation of the corresponding value,
  * in case the input literal did not contain any fraction or exponent parts.
+ * Only (1) is computed here; the binary representations are computed when
+ * they are first needed (see number.h).  If the text is already in canonical
+ * form, "valid_string" is set to ARGO_CANONICAL_TEXT.  A number too large
+ * in magnitude for a double is an error.
  * In case of an error (these include failure of the input to conform
  * to the JSON standard, premature EOF on the input stream, as well as
  * other I/O errors), a one-line error message is output to standard error
@@ -266,233 +688,135 @@ int argo_read_string(ARGO_STRING *s, FILE *f) {
  * @param f  Input stream from which JSON is to be read.
  * @return  Zero if the operation is completely successful,
  * nonzero if there is any error.
-//  */
+ */
 int argo_read_number(ARGO_NUMBER *n, FILE *f) {
-    int negFlag = -1;
-    negFlag = negFlag - 0;
-    int enegFlag = -1;
-    int eposFlag = -1;
-    eposFlag = eposFlag -0;
-    int eFlag = -1;
-    int decFlag = -1;
-    int firstDigFlag = 0;
-    int firstEDigFlag = -1;
-    int leadingZeroFlag = -1;
-    int firstDecDigit = -1;
-    int validInt = 0;
-    validInt = validInt - 0;
-    long int sum = 0;
-    long int decimalPlaces = 0;
-    long int wholeNumber = 0;
-    int exponent = 0;
-    char prev = 'q';
-    char c = fgetc(f);
-    while (1) {
-        if (c == '-' && (prev != 'q' && prev !='e' && prev != 'E')) {
-            break;
-        } else if (c == '-' && !(prev != 'q' && prev !='e' && prev != 'E')) {
-            if (prev == 'q'){
-                negFlag = 0;
-            } else
-                enegFlag = 0;
-        }
-        if (c == '+' && (prev != 'e' && prev!= 'E'))
-            break;
-        else if (c == '+')
-            eposFlag = 0;
+    argo_reader_enter(f);
+    int status = readNumber(n, f);
+    argo_reader_leave(f);
+    return status;
+}
 
-        if (prev == 'q' && c == '0')
-            leadingZeroFlag = 0;
-        if (c >= 48 && c <= 57) {
-            if (firstDigFlag == -1 && decFlag == -1 && leadingZeroFlag == 0)
-                return -1;
-            if (eFlag != 0) {
-                sum= sum * 10;
-                sum = sum + (c - 48);
-            }
-            if (c != '0')
-                firstDigFlag = 0;
-            if (decFlag ==-1 && eFlag == -1)
-                wholeNumber++;
-            if (decFlag == 0 && eFlag == -1) {
-                decimalPlaces++;
-                firstDecDigit = 0;
-            } else if (eFlag == 0) {
-                firstEDigFlag = 0;
-                exponent = exponent * 10;
-                exponent = exponent + (c - 48);
-            }
+int argo_write_basic(int v, FILE *f) {
+    if (v == ARGO_NULL)
+        fputs(ARGO_NULL_TOKEN, f);
+    else if (v == ARGO_FALSE)
+        fputs(ARGO_FALSE_TOKEN, f);
+    else if (v == ARGO_TRUE)
+        fputs(ARGO_TRUE_TOKEN, f);
+    else
+        return 1;
+    return 0;
+}
 
-        }
-        if (c == '.' && decFlag == 0 && firstDecDigit == -1)
-            return -1;
-        else  if (c == '.' && decFlag == 0 && firstDecDigit == 0)
-            break;
-        else if (c == '.') {
-            decFlag = 0;
-            validInt = -1;
-        }
+/*
+ * Write a value that is neither an array nor an object.
+ */
+static int writeScalar(ARGO_VALUE *v, FILE *f) {
+    if ((*v).type == ARGO_BASIC_TYPE)
+        return argo_write_basic((*v).content.basic, f);
+    else if ((*v).type == ARGO_NUMBER_TYPE)
+        return argo_write_number(&(*v).content.number, f);
+    else if ((*v).type == ARGO_STRING_TYPE)
+        return argo_write_string(&(*v).content.string, f);
+    return 1;
+}
 
-        if (c == 'e' || c == 'E') {
-            if (eFlag == -1) {
-                eFlag = 0;
-            } else
-                break;
-        }
-        if (c != '-')
-            prev = c;
-        if (!(c >= 48 && c <= 57) && (c != '.') && (c != '-') && (c != '+') && (c != 'e') && (c != 'E'))
-            break;
-        c = fgetc(f);
-    }
-    ungetc(c, f);
-    if (decFlag == 0 && firstDecDigit == -1)
-        return -1;
-    if (eFlag == 0 && firstEDigFlag == -1)
-        return -1;
-    if (firstDigFlag == -1)
-        return -1;
+/*
+ * A line of spaces from which the indentation at every depth is taken,
+ * filled in once, the first time pretty output is written.
+ */
+#define INDENT_SPACES 256
+static char indentSpaces[INDENT_SPACES];
 
-    if (decFlag == -1 && eFlag == -1) {
-        if (enegFlag == -1) {
-            if (negFlag == 0)
-                sum = sum * -1;
-            (*n).valid_int = 1;
-            (*n).valid_float = 1;
-            (*n).valid_string = 1;
-            (*n).int_value = sum;
-            (*n).float_value = sum;
-        }
-    } else {
-        if (enegFlag == -1) {
-            double float_v = sum;
-            while (decimalPlaces > 0) {
-                float_v = float_v / 10;
-                decimalPlaces--;
-            }
-            while (exponent > 0) {
-                float_v = float_v * 10;
-                exponent--;
-            }
-            if (negFlag == 0)
-                float_v = float_v * -1;
-            (*n).valid_int = 0;
-            (*n).valid_float = 1;
-            (*n).valid_string = 1;
-            (*n).float_value = float_v;
-        } else {
-            double float_v = sum;
-            while (decimalPlaces > 0) {
-                float_v = float_v / 10;
-                decimalPlaces--;
-            }
-            while (exponent > 0) {
-                float_v = float_v / 10;
-                exponent--;
-            }
-            if (negFlag == 0)
-                float_v = float_v * -1;
-            (*n).valid_int = 0;
-            (*n).valid_float = 1;
-            (*n).valid_string = 1;
-            (*n).float_value = float_v;
-        }
+static void writeIndent(size_t count, FILE *f) {
+    while (count > INDENT_SPACES) {
+        fwrite(indentSpaces, 1, INDENT_SPACES, f);
+        count -= INDENT_SPACES;
     }
-    return argo_next_value;
+    fwrite(indentSpaces, 1, count, f);
 }
 
-int argo_write_array(ARGO_VALUE *v, FILE *f) {
-    fputc('[', f);
-    additionalIndent+= (0x0000000F & global_options);
-    if ((global_options & 0x30000000) == 0x30000000)
-        fputc('\n', f);
-    ARGO_ARRAY array = (*v).content.array;
-    ARGO_VALUE sentinel = *array.element_list;
-    ARGO_VALUE *tmpNode = (sentinel).next;
-    do {
-        if ((global_options & 0x30000000) == 0x30000000 && (*tmpNode).next != sentinel.next) {
-            int x = 0;
-            x = x + (additionalIndent);
-            while (x > 0) {
-                fputc(' ', f);
-                x--;
-            }
-        }
-        argo_write_value((tmpNode), f);
-        tmpNode = (*tmpNode).next;
-        if (tmpNode != sentinel.next && (*tmpNode).next != sentinel.next){
-            fputc(',', f);
-            if ((global_options & 0x30000000) == 0x30000000)
-        fputc('\n', f);
-        }
-    } while(tmpNode != sentinel.next);
-    if ((global_options & 0x30000000) == 0x30000000)
-        fputc('\n', f);
-    additionalIndent-= (0x0000000F & global_options);
-    if (additionalIndent > 0) {
-        int tmpIndent = additionalIndent;
-        while (tmpIndent > 0) {
-            fputc(' ', f);
-            tmpIndent--;
-        }
-    }
-    fputc(']', f);
+/*
+ * Indentation width for the layout whose width is not a compile-time
+ * constant.
+ */
+static size_t indentWidth;
 
-    return 1;
-}
+#define WRITER_NAME writeCompact
+#define WRITER_PRETTY 0
+#define WRITER_INDENT 0
+#define WRITER_SORTED 0
+#include "writer_variant.h"
 
-int argo_write_object(ARGO_VALUE *v, FILE *f) {
-    fputc('{', f);
-    additionalIndent+= (0x0000000F & global_options);
-    if ((global_options & 0x30000000) == 0x30000000)
-        fputc('\n', f);
-    ARGO_OBJECT object = (*v).content.object;
-    ARGO_VALUE sentinel = *object.member_list;;
-    ARGO_VALUE *tmpNode = (sentinel).next;
-    do {
-        if ((global_options & 0x30000000) == 0x30000000 && (*tmpNode).next != sentinel.next) {
-            int x =0;
-            x = x + (additionalIndent);
-            while (x > 0) {
-                fputc(' ', f);
-                x--;
-            }
-        }
-        if ((*tmpNode).name.length != 0) {
-            argo_write_string(&((*tmpNode).name), f);
-            fputs(":", f );
-            if ((global_options & 0x30000000) == 0x30000000)
-                fputc(' ', f);
-            argo_write_value(tmpNode, f);
-            if ((*(*tmpNode).next).name.length != 0)
-                fputc(',', f);
-        }
-        if ((global_options & 0x30000000) == 0x30000000 && ((*tmpNode).name.length != 0))
-            fputc('\n', f);
-        tmpNode = (*tmpNode).next;
-    } while(tmpNode != sentinel.next);
-    additionalIndent-= (0x0000000F & global_options);
-    if (additionalIndent > 0) {
-        int tmpIndent = additionalIndent;
-        while (tmpIndent > 0) {
-            fputc(' ', f);
-            tmpIndent--;
+#define WRITER_NAME writePretty2
+#define WRITER_PRETTY 1
+#define WRITER_INDENT 2
+#define WRITER_SORTED 0
+#include "writer_variant.h"
+
+#define WRITER_NAME writePretty4
+#define WRITER_PRETTY 1
+#define WRITER_INDENT 4
+#define WRITER_SORTED 0
+#include "writer_variant.h"
+
+#define WRITER_NAME writePrettyN
+#define WRITER_PRETTY 1
+#define WRITER_INDENT indentWidth
+#define WRITER_SORTED 0
+#include "writer_variant.h"
+
+#define WRITER_NAME writeSortedCompact
+#define WRITER_PRETTY 0
+#define WRITER_INDENT 0
+#define WRITER_SORTED 1
+#include "writer_variant.h"
+
+#define WRITER_NAME writeSortedPretty2
+#define WRITER_PRETTY 1
+#define WRITER_INDENT 2
+#define WRITER_SORTED 1
+#include "writer_variant.h"
+
+#define WRITER_NAME writeSortedPretty4
+#define WRITER_PRETTY 1
+#define WRITER_INDENT 4
+#define WRITER_SORTED 1
+#include "writer_variant.h"
+
+#define WRITER_NAME writeSortedPrettyN
+#define WRITER_PRETTY 1
+#define WRITER_INDENT indentWidth
+#define WRITER_SORTED 1
+#include "writer_variant.h"
+
+/**
+ * @brief  Select the writer for the layout requested by global_options.
+ * @details  This is the only place the writer looks at global_options.
+ * Any shared state the pretty writers need is set up here, so the function
+ * that is returned can then be run by several threads at once.
+ *
+ * @return  One of the writer variants generated from writer_variant.h.
+ */
+ARGO_SUBTREE_WRITER argo_subtree_writer(void) {
+    int sorted = (global_options & SORT_KEYS_OPTION) != 0;
+    if ((global_options & PRETTY_PRINT_OPTION) == 0)
+        return sorted ? writeSortedCompact : writeCompact;
+    if (*indentSpaces != ARGO_SPACE) {
+        size_t index = 0;
+        while (index < INDENT_SPACES) {
+            *(indentSpaces + index) = ARGO_SPACE;
+            index++;
         }
     }
-    fputc('}', f);
-    if (additionalIndent == 0)
-        fputc('\n', f);
-    return 0;
-}
-int argo_write_basic(int v, FILE *f) {
-    if (v == 0)
-        fputs("null", f);
-    else if (v == 2)
-        fputs("false", f);
-    else if (v == 1)
-        fputs("true", f);
-    return 0;
+    indentWidth = global_options & 0xFF;
+    if (indentWidth == 2)
+        return sorted ? writeSortedPretty2 : writePretty2;
+    else if (indentWidth == 4)
+        return sorted ? writeSortedPretty4 : writePretty4;
+    return sorted ? writeSortedPrettyN : writePrettyN;
 }
+
 /**
  * @brief  Write canonical JSON representing a specified value to
  * a specified output stream.
@@ -500,100 +824,184 @@ int argo_write_basic(int v, FILE *f) {
  * to specified output stream.  See the assignment document for a
  * detailed discussion of the data structure and what is meant by
  * canonical JSON.
+ * The layout requested by global_options is examined only once, to select
+ * one of the writer variants generated from writer_variant.h, which then
+ * writes the whole value.  Pretty output ends with a newline.
  *
  * @param v  Data structure representing a value.
  * @param f  Output stream to which JSON is to be written.
  * @return  Zero if the operation is completely successful,
  * nonzero if there is any error.
  */
-
 int argo_write_value(ARGO_VALUE *v, FILE *f) {
-    if ((*v).type == ARGO_NO_TYPE) {
-
-    } else if ((*v).type == ARGO_BASIC_TYPE) {
-        argo_write_basic((*v).content.basic, f);
-    } else if ((*v).type == ARGO_NUMBER_TYPE) {
-        argo_write_number(&(*v).content.number, f);
-    } else if ((*v).type == ARGO_STRING_TYPE) {
-        argo_write_string(&(*v).content.string, f);
-    } else if ((*v).type == ARGO_OBJECT_TYPE) {
-        argo_write_object(v, f);
-    } else if ((*v).type == ARGO_ARRAY_TYPE) {
-        argo_write_array(v, f);
-    }
+    int status = argo_subtree_writer()(v, 0, f);
+    if (status == 0 && (global_options & PRETTY_PRINT_OPTION) != 0)
+        fputc(ARGO_LF, f);
+    return status || ferror(f) ? 1 : 0;
+}
 
-    return -1;
+/*
+ * Escape sequences for the code points below U+0100, indexed by code point.
+ * A zero length means that the code point is written as a single byte.
+ */
+typedef struct argo_escape {
+    unsigned char length;
+    char text[7];
+} ARGO_ESCAPE;
+
+#define ESC(s) { sizeof(s) - 1, s }
+
+static const ARGO_ESCAPE escapeTable[256] = {
+    [0x00] = ESC("\\u0000"), [0x01] = ESC("\\u0001"), [0x02] = ESC("\\u0002"),
+    [0x03] = ESC("\\u0003"), [0x04] = ESC("\\u0004"), [0x05] = ESC("\\u0005"),
+    [0x06] = ESC("\\u0006"), [0x07] = ESC("\\u0007"), [0x08] = ESC("\\b"),
+    [0x09] = ESC("\\t"),     [0x0a] = ESC("\\n"),     [0x0b] = ESC("\\u000b"),
+    [0x0c] = ESC("\\f"),     [0x0d] = ESC("\\r"),     [0x0e] = ESC("\\u000e"),
+    [0x0f] = ESC("\\u000f"), [0x10] = ESC("\\u0010"), [0x11] = ESC("\\u0011"),
+    [0x12] = ESC("\\u0012"), [0x13] = ESC("\\u0013"), [0x14] = ESC("\\u0014"),
+    [0x15] = ESC("\\u0015"), [0x16] = ESC("\\u0016"), [0x17] = ESC("\\u0017"),
+    [0x18] = ESC("\\u0018"), [0x19] = ESC("\\u0019"), [0x1a] = ESC("\\u001a"),
+    [0x1b] = ESC("\\u001b"), [0x1c] = ESC("\\u001c"), [0x1d] = ESC("\\u001d"),
+    [0x1e] = ESC("\\u001e"), [0x1f] = ESC("\\u001f"),
+    [ARGO_QUOTE] = ESC("\\\""), [ARGO_BSLASH] = ESC("\\\\"),
+    [0xff] = ESC("\\u00ff")
+};
+
+static const char hexDigits[16] = "0123456789abcdef";
+
+#define WRITE_BUFFER_SIZE 512
+#define WRITE_ESCAPE_MAX 12
+#define WIDE_SCAN_MIN 16
+
+/*
+ * A code point above "limit" is never copied through as a single byte:
+ * the limit is 0xFF for canonical output and 0x7F when writing UTF-8.
+ */
+#define argo_needs_escape(c, limit) ((unsigned int)(c) > (limit) || escapeTable[(c)].length != 0)
+
+static void flushBuffer(char *buffer, size_t *used, FILE *f) {
+    fwrite(buffer, 1, *used, f);
+    *used = 0;
 }
-char intToHex(int x) {
-    if (x >= 0 && x < 10)
-        return (x + 48);
-    else if (x >= 10 && x <16) {
-        return (x + 87);
+
+/*
+ * Append a \uXXXX escape for a code point.  Code points beyond the Basic
+ * Multilingual Plane are written as an escaped UTF-16 surrogate pair.
+ */
+static size_t writeHex(int x, char *out) {
+    if (x > 0xFFFF) {
+        x = x - 0x10000;
+        size_t n = writeHex(0xD800 + (x >> 10), out);
+        return n + writeHex(0xDC00 + (x & 0x3FF), out + n);
     }
-    return -1;
+    *out = ARGO_BSLASH;
+    *(out + 1) = ARGO_U;
+    *(out + 2) = hexDigits[(x >> 12) & 0xF];
+    *(out + 3) = hexDigits[(x >> 8) & 0xF];
+    *(out + 4) = hexDigits[(x >> 4) & 0xF];
+    *(out + 5) = hexDigits[x & 0xF];
+    return 6;
 }
-void writeHex(int x, FILE *f) {
-    char one = '0';
-    char two = '0';
-    char three = '0';
-    char four = '0';
-    int index = 0;
-    int remainder;
-    do {
-        remainder = x % 16;
-        if (index == 0)
-            four = intToHex(remainder);
-        else if (index == 1)
-            three = intToHex(remainder);
-        else if (index == 2)
-            two = intToHex(remainder);
-        else if (index == 3)
-            one = intToHex(remainder);
-        index = index + 1;
-        x = x /16;
-    } while(x != 0);
-    // if (index > 5)
-    //     return -1;
-    fputc('\\', f);
-    fputc('u', f);
-    fputc(one, f);
-    fputc(two, f);
-    fputc(three, f);
-    fputc(four, f);
-    // return 0;
-}
-
-int specialValue(int x, FILE *f) {
-    if (x == '\"') {
-        fputs("\\", f);
-        fputc('"', f);
-    } else if (x == '\\') {
-        fputs("\\", f);
-        fputc('\\', f);
-    } else if (x == 8) {
-        fputs("\\", f);
-        fputc('b', f);
-    } else if (x == 12) {
-        fputs("\\", f);
-        fputc('f', f);
-    } else if (x == 10) {
-        fputs("\\", f);
-        fputc('n', f);
-    } else if (x == 13) {
-        fputs("\\", f);
-        fputc('r', f);
-    } else if (x == 9) {
-        fputs("\\", f);
-        fputc('t', f);
-    } else if (x <= 0x1F || x > 0xFF) {
-        writeHex(x, f);
-    } else if (x > 0x1F && x < 0xFF) {
+
+/*
+ * Append the UTF-8 encoding of a code point.
+ */
+static size_t writeUtf8(int x, char *out) {
+    if (x < 0x80) {
+        *out = (char)x;
         return 1;
-    } else {
-        return -1;
+    } else if (x < 0x800) {
+        *out = (char)(0xC0 | (x >> 6));
+        *(out + 1) = (char)(0x80 | (x & 0x3F));
+        return 2;
+    } else if (x < 0x10000) {
+        *out = (char)(0xE0 | (x >> 12));
+        *(out + 1) = (char)(0x80 | ((x >> 6) & 0x3F));
+        *(out + 2) = (char)(0x80 | (x & 0x3F));
+        return 3;
     }
-    return x;
+    *out = (char)(0xF0 | (x >> 18));
+    *(out + 1) = (char)(0x80 | ((x >> 12) & 0x3F));
+    *(out + 2) = (char)(0x80 | ((x >> 6) & 0x3F));
+    *(out + 3) = (char)(0x80 | (x & 0x3F));
+    return 4;
 }
+
+/*
+ * Append whatever is to be written in place of a code point that
+ * argo_needs_escape() rejected.  Surrogates that were not part of a pair
+ * stay escaped in UTF-8 mode, since they cannot be encoded, and values that
+ * are not code points at all become U+FFFD.
+ */
+static size_t writeEscape(ARGO_CHAR c, int utf8, char *out) {
+    if ((unsigned int)c <= 0xFF && escapeTable[c].length != 0) {
+        const ARGO_ESCAPE *escape = escapeTable + c;
+        int index = 0;
+        while (index < (*escape).length) {
+            *(out + index) = *((*escape).text + index);
+            index++;
+        }
+        return (*escape).length;
+    }
+    if ((unsigned int)c > 0x10FFFF)
+        c = 0xFFFD;
+    if (utf8 && !argo_is_surrogate(c))
+        return writeUtf8(c, out);
+    return writeHex(c, out);
+}
+
+/*
+ * Copy the run of code points starting at p that need no escaping into the
+ * buffer, one byte per code point, and return a pointer to the first code
+ * point that does (or to end).
+ */
+static ARGO_CHAR *copyClean(ARGO_CHAR *p, ARGO_CHAR *end, unsigned int limit,
+                            char *buffer, size_t *used, FILE *f) {
+    while (p < end && !argo_needs_escape(*p, limit)) {
+        if (*used == WRITE_BUFFER_SIZE)
+            flushBuffer(buffer, used, f);
+        *(buffer + (*used)++) = (char)*p;
+        p++;
+    }
+    return p;
+}
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+/*
+ * SSE2 version of copyClean() for long strings: eight code points are tested
+ * and narrowed to bytes at a time.  Whatever is left over (a short tail, or the
+ * block containing the next character to escape) is finished by copyClean().
+ */
+static ARGO_CHAR *copyCleanWide(ARGO_CHAR *p, ARGO_CHAR *end, unsigned int limit,
+                                char *buffer, size_t *used, FILE *f) {
+    const __m128i low = _mm_set1_epi32(0x20);
+    const __m128i high = _mm_set1_epi32(limit < 0xFF ? limit : 0xFE);
+    const __m128i quote = _mm_set1_epi32(ARGO_QUOTE);
+    const __m128i bslash = _mm_set1_epi32(ARGO_BSLASH);
+    while (end - p >= 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)p);
+        __m128i b = _mm_loadu_si128((const __m128i *)(p + 4));
+        __m128i bad = _mm_or_si128(_mm_cmplt_epi32(a, low), _mm_cmpgt_epi32(a, high));
+        bad = _mm_or_si128(bad, _mm_or_si128(_mm_cmpeq_epi32(a, quote), _mm_cmpeq_epi32(a, bslash)));
+        bad = _mm_or_si128(bad, _mm_or_si128(_mm_cmplt_epi32(b, low), _mm_cmpgt_epi32(b, high)));
+        bad = _mm_or_si128(bad, _mm_or_si128(_mm_cmpeq_epi32(b, quote), _mm_cmpeq_epi32(b, bslash)));
+        if (_mm_movemask_epi8(bad) != 0)
+            break;
+        if (*used > WRITE_BUFFER_SIZE - 8)
+            flushBuffer(buffer, used, f);
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_setzero_si128());
+        _mm_storel_epi64((__m128i *)(buffer + *used), bytes);
+        *used += 8;
+        p += 8;
+    }
+    return copyClean(p, end, limit, buffer, used, f);
+}
+#else
+#define copyCleanWide copyClean
+#endif
+
 /**
  * @brief  Write canonical JSON representing a specified string
  * to a specified output stream.
@@ -604,7 +1012,10 @@ int specialValue(int x, FILE *f) {
  * Unicode code points and the output is a JSON string literal,
  * represented using only 8-bit bytes.  Therefore, any Unicode code
  * with a value greater than or equal to U+00FF cannot appear directly
- * in the output and must be represented by an escape sequence.
+ * in the output and must be represented by an escape sequence (a pair of
+ * them, for a code point beyond U+FFFF).  If UTF8_OUTPUT_OPTION is set,
+ * the output is UTF-8 instead and only the characters that JSON requires
+ * to be escaped are escaped.
  * There are other requirements on the use of escape sequences;
  * see the assignment handout for details.
  *
@@ -615,97 +1026,91 @@ int specialValue(int x, FILE *f) {
  * nonzero if there is any error.
  */
 int argo_write_string(ARGO_STRING *s, FILE *f) {
-    int tmpIndex = 0;
-    ARGO_CHAR *tmpStringArr = (*s).content;
-    fputc('"', f);
-    while(tmpIndex < (*s).length) {
-        int foundSpecial = specialValue(*(tmpStringArr + tmpIndex), f);
-        if (foundSpecial ==  1)
-            fputc(*(tmpStringArr + tmpIndex), f);
-        tmpIndex = tmpIndex + 1;
+    char buffer[WRITE_BUFFER_SIZE];
+    size_t used = 0;
+    int utf8 = (global_options & UTF8_OUTPUT_OPTION) != 0;
+    unsigned int limit = utf8 ? 0x7F : 0xFF;
+    ARGO_CHAR *p = (*s).content;
+    ARGO_CHAR *end = p + (*s).length;
+    *(buffer + used++) = ARGO_QUOTE;
+    while (p < end) {
+        if (end - p >= WIDE_SCAN_MIN)
+            p = copyCleanWide(p, end, limit, buffer, &used, f);
+        else
+            p = copyClean(p, end, limit, buffer, &used, f);
+        if (p == end)
+            break;
+        if (used > WRITE_BUFFER_SIZE - WRITE_ESCAPE_MAX)
+            flushBuffer(buffer, &used, f);
+        used += writeEscape(*p, utf8, buffer + used);
+        p++;
     }
-    fputc('"', f);
-    return 1;
+    if (used == WRITE_BUFFER_SIZE)
+        flushBuffer(buffer, &used, f);
+    *(buffer + used++) = ARGO_QUOTE;
+    flushBuffer(buffer, &used, f);
+    return ferror(f) ? 1 : 0;
 }
 
+/*
+ * Write an integer in decimal.  The magnitude is taken as unsigned, so that
+ * LONG_MIN is written correctly.
+ */
 void printInt(long int x, FILE *f) {
-    if (x / 10 == 0)
-        fputc(x + 48, f);
-    if (x / 10 != 0) {
-        printInt(x / 10, f);
-        fputc((x % 10) + 48, f);
-    }
+    char digits[24];
+    size_t used = sizeof(digits);
+    unsigned long magnitude = x < 0 ? -(unsigned long)x : (unsigned long)x;
+    do {
+        *(digits + --used) = (char)(ARGO_DIGIT0 + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (x < 0)
+        *(digits + --used) = ARGO_MINUS;
+    fwrite(digits + used, 1, sizeof(digits) - used, f);
 }
 
-void printWhole(int x, int zeroFlag, FILE *f) {
-    if (x % 10 != 0)
-        zeroFlag = 0;
-    if (x / 10 == 0)
-        fputc(x + 48, f);
-    if (x / 10 != 0) {
-        printWhole(x / 10, zeroFlag, f);
-        if (zeroFlag == 0)
-            fputc((x % 10) + 48, f);
+/*
+ * Write a floating-point number in the canonical form 0.d...de[-]x, with
+ * at most ARGO_PRECISION significant digits and no trailing zeros.  The
+ * digits are those of the "%e" conversion, which rounds correctly; the
+ * exponent is adjusted by one for the leading "0.".  Infinities and NaNs
+ * have no JSON form: nothing is written for them, and nonzero is returned.
+ */
+int printFloat(double x, FILE *f) {
+    if (!isfinite(x))
+        return 1;
+    if (x == 0) {
+        fputs("0.0", f);
+        return 0;
     }
+    char text[ARGO_PRECISION + 16];
+    int length = snprintf(text, sizeof(text), "%.*e", ARGO_PRECISION - 1, x);
+    if (length <= 0 || (size_t)length >= sizeof(text))
+        return 1;
+    char *end = text + length;
+    char *p = text;
+    if (*p == ARGO_MINUS)
+        p++;
+    char *exp = p;
+    while (exp < end && *exp != 'e')
+        exp++;
+    if (exp == end || exp < p + 1)
+        return 1;
+    if (p > text)
+        fputc(ARGO_MINUS, f);
+    char *last = exp - 1;
+    while (last > p + 1 && *last == ARGO_DIGIT0)
+        last--;
+    fputc(ARGO_DIGIT0, f);
+    fputc(ARGO_PERIOD, f);
+    fputc(*p, f);
+    if (last > p + 1)
+        fwrite(p + 2, 1, last - (p + 1), f);
+    fputc(ARGO_E, f);
+    printInt(strtol(exp + 1, NULL, 10) + 1, f);
+    return 0;
 }
-void printFloat(double x, FILE *f) {
-    // int exponent = 0;
-    // double decimalValue = x - ((int)x);
-    if ( x < 0) {
-        fputc('-', f);
-        x = x * -1;
-    }
-    fputc('0', f);
-    fputc('.', f);
-    int precisionCounter = 0;
-    double copy = x;
-    int exponent = 0;
-    int zeroFlag = -1;
-    if (x < 0)
-        x = x * -1;
-    if (x >= 1) {
-        int whole = (int)x;
-        while (whole != 0) {
-            whole = whole / 10;
-            exponent = exponent + 1;
-            precisionCounter = precisionCounter + 1;
-        }
-        whole = (int)x;
-        printWhole(whole, zeroFlag, f);
-        copy = copy -(int)copy;
-    } else if (copy == 0) {
-        fputc('0', f);
-        return;
-    } else {
-        while (copy < 1) {
-            copy = copy * 10;
-            exponent = exponent - 1;
-        }
-        exponent = exponent + 1;
-        if (copy - (int)copy <= 0) {
-            printInt((int)copy, f);
-        }
-    }
-    int tenthSpot = 0;
-    while (copy - (int)copy > 0 && precisionCounter  <= ARGO_PRECISION) {
-        if (exponent < 0 || tenthSpot == -1)
-            fputc((int)copy + 48, f);
-        copy = copy - (int)copy;
-        copy = copy * 10;
-        precisionCounter = precisionCounter + 1;
-        tenthSpot = -1;
-        }
-    if (exponent >= 0){
-        fputc('e', f);
-        fputc(exponent + 48, f);
-    } else {
-        fputc('e', f);
-        exponent = exponent * -1;
-        fputc('-', f);
-        fputc(exponent + 48, f);
-    }
 
-}
 /**
  * @brief  Write canonical JSON representing a specified number
  * to a specified output stream.
@@ -725,15 +1130,27 @@ void printFloat(double x, FILE *f) {
  * nonzero if there is any error.
 //  */
 int argo_write_number(ARGO_NUMBER *n, FILE *f) {
-    if ((*n).valid_int != 0) {
-        long vint = (*n).int_value;
-        if ((*n).int_value < 0) {
-            vint = vint * -1;
-            fputc('-', f);
+    if ((*n).valid_string == ARGO_CANONICAL_TEXT) {
+        char buffer[WRITE_BUFFER_SIZE];
+        size_t used = 0;
+        size_t index = 0;
+        while (index < (*n).string_value.length) {
+            if (used == WRITE_BUFFER_SIZE)
+                flushBuffer(buffer, &used, f);
+            *(buffer + used++) = (char)*((*n).string_value.content + index);
+            index++;
         }
-        printInt(vint, f);
-    } else if ((*n).valid_float != 0)    {
-        printFloat(((*n).float_value), f);
+        flushBuffer(buffer, &used, f);
+        return ferror(f) ? 1 : 0;
     }
-    return 0;
+    argo_number_materialize(n);
+    if ((*n).valid_int != 0)
+        printInt((*n).int_value, f);
+    else if ((*n).valid_float != 0) {
+        if (printFloat((*n).float_value, f))
+            return 1;
+    } else {
+        return 1;
+    }
+    return ferror(f) ? 1 : 0;
 }
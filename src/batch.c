@@ -0,0 +1,640 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "batch.h"
+#include "document.h"
+#include "intern.h"
+#include "options.h"
+#include "reader.h"
+#include "uring.h"
+
+ARGO_BATCH argo_batch_config = {NULL, ARGO_BATCH_SUFFIX, 0, 0, NULL};
+
+/*
+ * Largest single read submitted to io_uring; longer files take several.
+ */
+#define BATCH_READ_MAX (1 << 30)
+
+/*
+ * What happened to one file.  The table of results is shared between the
+ * workers, each of which fills in the entries for the files it claims,
+ * and the parent, which reads it once they have all exited.
+ */
+typedef struct batch_result {
+    int status;                       // 0 ok, 1 failed, -1 never finished.
+    int worker;                       // Worker whose output holds the document.
+    long offset;                      // Where, with -o, in that output.
+    size_t length;
+    size_t bytes;                     // Size of the input.
+    double seconds;                   // Time to parse and write it.
+} BATCH_RESULT;
+
+typedef struct batch_shared {
+    size_t cursor;                    // Next file to be claimed.
+    BATCH_RESULT results[];
+} BATCH_SHARED;
+
+/*
+ * A file being read ahead by a worker.
+ */
+typedef struct batch_slot {
+    size_t file;
+    int fd;
+    char *buffer;
+    size_t size;
+    size_t done;
+} BATCH_SLOT;
+
+static size_t textLength(char *s) {
+    size_t n = 0;
+    while (*(s + n) != '\0')
+        n++;
+    return n;
+}
+
+static int endsWith(char *s, char *suffix) {
+    size_t n = textLength(s);
+    size_t m = textLength(suffix);
+    return n >= m && cmp(s + n - m, suffix) == 0;
+}
+
+/*
+ * Return a new string holding "a", then "separator" if it is not '\0',
+ * then "b".
+ */
+static char *joinText(char *a, char separator, char *b) {
+    size_t n = textLength(a);
+    size_t m = textLength(b);
+    char *s = malloc(n + m + 2);
+    if (s == NULL)
+        return NULL;
+    char *p = s;
+    while (*a != '\0')
+        *p++ = *a++;
+    if (separator != '\0')
+        *p++ = separator;
+    while (*b != '\0')
+        *p++ = *b++;
+    *p = '\0';
+    return s;
+}
+
+/**
+ * @brief  Parse the arguments that follow --batch.
+ * @details  The operation, indent and -u are encoded in global_options as
+ * for a single document; the rest goes to argo_batch_config.
+ *
+ * @param argc  The number of arguments after --batch.
+ * @param argv  The arguments after --batch.
+ * @return  0 if the arguments are valid, -1 otherwise.
+ */
+int argo_batch_args(int argc, char **argv) {
+    int options = 0;
+    int index = 0;
+    while (index < argc && **(argv + index) == '-' && *(*(argv + index) + 1) != '\0') {
+        char *t = *(argv + index);
+        char *next = index + 1 < argc ? *(argv + index + 1) : NULL;
+        if (cmp(t, "-c") == 0 && (options & (CANONICALIZE_OPTION | VALIDATE_OPTION)) == 0) {
+            options |= CANONICALIZE_OPTION;
+        } else if (cmp(t, "-v") == 0 && (options & (CANONICALIZE_OPTION | VALIDATE_OPTION)) == 0) {
+            options |= VALIDATE_OPTION;
+        } else if (cmp(t, "-p") == 0 && (options & PRETTY_PRINT_OPTION) == 0) {
+            int used = argo_indent_option(next, &options);
+            if (used < 0)
+                return -1;
+            index += used;
+        } else if (cmp(t, "-u") == 0 && (options & UTF8_OUTPUT_OPTION) == 0) {
+            options |= UTF8_OUTPUT_OPTION;
+        } else if (cmp(t, "-k") == 0 && (options & SORT_KEYS_OPTION) == 0) {
+            options |= SORT_KEYS_OPTION;
+        } else if (cmp(t, "-o") == 0 && next != NULL) {
+            argo_batch_config.output = next;
+            index++;
+        } else if (cmp(t, "-s") == 0 && next != NULL && *next != '\0') {
+            argo_batch_config.suffix = next;
+            index++;
+        } else if (cmp(t, "-j") == 0 && next != NULL) {
+            int jobs = validDigit(next);
+            if (jobs < 1 || jobs > 1024)
+                return -1;
+            argo_batch_config.jobs = jobs;
+            index++;
+        } else {
+            return -1;
+        }
+        index++;
+    }
+    if (index == argc)
+        return -1;
+    if ((options & VALIDATE_OPTION) == 0)
+        options |= CANONICALIZE_OPTION;
+    else if ((options & (PRETTY_PRINT_OPTION | UTF8_OUTPUT_OPTION | SORT_KEYS_OPTION)) != 0)
+        return -1;
+    global_options |= options | BATCH_OPTION;
+    argo_batch_config.path_count = argc - index;
+    argo_batch_config.paths = argv + index;
+    return 0;
+}
+
+typedef struct file_list {
+    char **files;
+    size_t count;
+    size_t capacity;
+} FILE_LIST;
+
+static int addFile(FILE_LIST *list, char *path) {
+    if ((*list).count == (*list).capacity) {
+        size_t capacity = (*list).capacity == 0 ? 64 : 2 * (*list).capacity;
+        char **files = realloc((*list).files, capacity * sizeof(char *));
+        if (files == NULL)
+            return 1;
+        (*list).files = files;
+        (*list).capacity = capacity;
+    }
+    *((*list).files + (*list).count++) = path;
+    return 0;
+}
+
+static int compareNames(const void *a, const void *b) {
+    return cmp(*(char **)a, *(char **)b);
+}
+
+/*
+ * Add the JSON files under a directory, in order of name so that the
+ * combined output does not depend on the order of the directory.  Files
+ * that look like our own output are skipped so that running a batch twice
+ * does not canonicalize the results of the first run.
+ */
+static int addDirectory(FILE_LIST *list, char *path, char *skip) {
+    DIR *dir = opendir(path);
+    if (dir == NULL) {
+        perror(path);
+        return 1;
+    }
+    FILE_LIST names = {0};
+    struct dirent *entry;
+    int status = 0;
+    while (status == 0 && (entry = readdir(dir)) != NULL) {
+        char *name = (*entry).d_name;
+        if (*name == '.' && (*(name + 1) == '\0' || (*(name + 1) == '.' && *(name + 2) == '\0')))
+            continue;
+        char *full = joinText(path, endsWith(path, "/") ? '\0' : '/', name);
+        status = full == NULL || addFile(&names, full);
+    }
+    closedir(dir);
+    qsort(names.files, names.count, sizeof(char *), compareNames);
+    for (size_t i = 0; i < names.count; i++) {
+        char *full = *(names.files + i);
+        struct stat info;
+        if (status != 0 || stat(full, &info) != 0) {
+            free(full);
+        } else if (S_ISDIR(info.st_mode)) {
+            status = addDirectory(list, full, skip);
+            free(full);
+        } else if (S_ISREG(info.st_mode) && endsWith(full, ".json")
+                   && (skip == NULL || !endsWith(full, skip))) {
+            status = addFile(list, full);
+        } else {
+            free(full);
+        }
+    }
+    free(names.files);
+    return status;
+}
+
+static int addPath(FILE_LIST *list, char *path, char *skip);
+
+/*
+ * Add each path named on a line of a list file.
+ */
+static int addList(FILE_LIST *list, char *path, char *skip) {
+    FILE *in = fopen(path, "r");
+    if (in == NULL) {
+        perror(path);
+        return 1;
+    }
+    char *line = NULL;
+    size_t capacity = 0;
+    ssize_t n;
+    int status = 0;
+    while (status == 0 && (n = getline(&line, &capacity, in)) >= 0) {
+        while (n > 0 && (*(line + n - 1) == '\n' || *(line + n - 1) == '\r'))
+            *(line + --n) = '\0';
+        if (n == 0)
+            continue;
+        char *copy = joinText(line, '\0', "");
+        status = copy == NULL || addPath(list, copy, skip);
+    }
+    free(line);
+    fclose(in);
+    return status;
+}
+
+static int addPath(FILE_LIST *list, char *path, char *skip) {
+    if (*path == '@')
+        return addList(list, path + 1, skip);
+    struct stat info;
+    if (stat(path, &info) == 0 && S_ISDIR(info.st_mode))
+        return addDirectory(list, path, skip);
+    return addFile(list, path);
+}
+
+/**
+ * @brief  Expand the paths of a batch into the list of files to process.
+ * @details  Directories are searched recursively and @LIST files read, as
+ * described in batch.h.  Paths of plain files are kept even if they do not
+ * exist, so that the failure is reported along with the other results.
+ *
+ * @param files  Set to a new array of the files found.
+ * @param count  Set to the number of files found.
+ * @return  Zero if successful, nonzero if a directory or list could not
+ * be read.
+ */
+int argo_batch_files(ARGO_BATCH *config, char ***files, size_t *count) {
+    FILE_LIST list = {0};
+    char *skip = (*config).suffix;
+    int status = 0;
+    for (int i = 0; status == 0 && i < (*config).path_count; i++)
+        status = addPath(&list, *((*config).paths + i), skip);
+    *files = list.files;
+    *count = list.count;
+    return status;
+}
+
+static double now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/*
+ * Parse one file that has been read into memory and write its output.
+ */
+static void processFile(ARGO_BATCH *config, char *path, char *text, size_t size,
+                        BATCH_RESULT *result, FILE *out) {
+    double start = now();
+    (*result).bytes = size;
+    (*result).status = 1;
+    argo_document_reset();
+    argo_lines_read = 0;
+    FILE *in = size == 0 ? NULL : fmemopen(text, size, "r");
+    if (in == NULL) {
+        fprintf(stderr, "%s: empty document\n", path);
+        return;
+    }
+    ARGO_VALUE *v = argo_read_value(in);
+    int status = v == NULL || argo_read_end(in);
+    fclose(in);
+    if (status) {
+        fprintf(stderr, "%s: invalid document\n", path);
+        return;
+    }
+    if ((global_options & VALIDATE_OPTION) == 0) {
+        if ((*config).output != NULL) {
+            (*result).offset = ftell(out);
+            status = argo_write_value(v, out);
+            if ((global_options & PRETTY_PRINT_OPTION) == 0)
+                fputc('\n', out);
+            (*result).length = ftell(out) - (*result).offset;
+        } else {
+            char *sibling = joinText(path, '\0', (*config).suffix);
+            FILE *f = sibling == NULL ? NULL : fopen(sibling, "w");
+            if (f == NULL) {
+                perror(sibling != NULL ? sibling : path);
+                free(sibling);
+                return;
+            }
+            status = argo_write_value(v, f);
+            if (fclose(f) != 0)
+                status = 1;
+            if (status)
+                fprintf(stderr, "%s: write failed\n", sibling);
+            free(sibling);
+        }
+        if (status)
+            return;
+    }
+    (*result).seconds = now() - start;
+    (*result).status = 0;
+}
+
+/*
+ * Read whatever is left of a file with pread().
+ */
+static int readRest(BATCH_SLOT *slot) {
+    while ((*slot).done < (*slot).size) {
+        ssize_t n = pread((*slot).fd, (*slot).buffer + (*slot).done,
+                          (*slot).size - (*slot).done, (*slot).done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0)
+            return 1;
+        if (n == 0) {
+            (*slot).size = (*slot).done;
+            break;
+        }
+        (*slot).done += n;
+    }
+    return 0;
+}
+
+static void finishSlot(ARGO_BATCH *config, char **files, BATCH_SHARED *shared,
+                       BATCH_SLOT *slot, int failed, FILE *out) {
+    char *path = *(files + (*slot).file);
+    BATCH_RESULT *result = (*shared).results + (*slot).file;
+    if (failed || readRest(slot)) {
+        perror(path);
+        (*result).status = 1;
+    } else {
+        processFile(config, path, (*slot).buffer, (*slot).size, result, out);
+    }
+    close((*slot).fd);
+    free((*slot).buffer);
+    (*slot).buffer = NULL;
+    (*slot).fd = -1;
+}
+
+static int submitSlot(ARGO_URING *ring, BATCH_SLOT *slot, uint64_t tag) {
+    size_t length = (*slot).size - (*slot).done;
+    if (length > BATCH_READ_MAX)
+        length = BATCH_READ_MAX;
+    return argo_uring_read(ring, (*slot).fd, (*slot).buffer + (*slot).done,
+                           length, (*slot).done, tag);
+}
+
+/*
+ * Claim the next file and start reading it into a free slot.  Returns 0
+ * if a read is in flight, 1 if the file was dealt with at once (because it
+ * could not be opened, or is empty, or io_uring is not in use), and -1 if
+ * there are no more files.
+ */
+static int startFile(ARGO_BATCH *config, char **files, size_t count, BATCH_SHARED *shared,
+                     ARGO_URING *ring, BATCH_SLOT *slot, uint64_t tag, int worker, FILE *out) {
+    size_t file = __atomic_fetch_add(&(*shared).cursor, 1, __ATOMIC_RELAXED);
+    if (file >= count)
+        return -1;
+    char *path = *(files + file);
+    BATCH_RESULT *result = (*shared).results + file;
+    (*result).worker = worker;
+    *slot = (BATCH_SLOT){.file = file, .fd = open(path, O_RDONLY)};
+    struct stat info;
+    if ((*slot).fd < 0 || fstat((*slot).fd, &info) != 0) {
+        perror(path);
+        (*result).status = 1;
+        if ((*slot).fd >= 0)
+            close((*slot).fd);
+        return 1;
+    }
+    (*slot).size = info.st_size;
+    (*slot).buffer = malloc((*slot).size + 1);
+    if ((*slot).buffer == NULL || (*slot).size == 0 || ring == NULL || submitSlot(ring, slot, tag)) {
+        finishSlot(config, files, shared, slot, (*slot).buffer == NULL, out);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Body of a worker process: keep up to ARGO_BATCH_DEPTH files being read
+ * and process each as its read completes.
+ */
+static void work(ARGO_BATCH *config, char **files, size_t count, BATCH_SHARED *shared,
+                 int worker, FILE *out) {
+    ARGO_URING uring;
+    ARGO_URING *ring = argo_uring_init(&uring, ARGO_BATCH_DEPTH) == 0 ? &uring : NULL;
+    BATCH_SLOT slots[ARGO_BATCH_DEPTH];
+    int busy[ARGO_BATCH_DEPTH] = {0};
+    int active = 0;
+    int exhausted = 0;
+    argo_intern_enabled = 1;
+    while (1) {
+        for (int i = 0; i < ARGO_BATCH_DEPTH && !exhausted; i++) {
+            while (!busy[i] && !exhausted) {
+                int started = startFile(config, files, count, shared, ring, slots + i, i, worker, out);
+                if (started < 0)
+                    exhausted = 1;
+                else if (started == 0)
+                    busy[i] = 1;
+            }
+        }
+        active = 0;
+        for (int i = 0; i < ARGO_BATCH_DEPTH; i++)
+            active += busy[i];
+        if (active == 0)
+            break;
+        uint64_t tag;
+        int result;
+        if (argo_uring_wait(ring, &tag, &result)) {
+            // The ring has failed: finish everything in flight with pread(),
+            // once the reads the kernel was given are over.  If they cannot
+            // be waited for, their buffers are left to them, and the files
+            // are read again into new ones.
+            int drained = argo_uring_drain(ring) == 0;
+            for (int i = 0; i < ARGO_BATCH_DEPTH; i++) {
+                BATCH_SLOT *slot = slots + i;
+                if (busy[i] && !drained) {
+                    (*slot).buffer = malloc((*slot).size + 1);
+                    (*slot).done = 0;
+                }
+                if (busy[i])
+                    finishSlot(config, files, shared, slot, (*slot).buffer == NULL, out);
+                busy[i] = 0;
+            }
+            argo_uring_free(ring);
+            ring = NULL;
+            continue;
+        }
+        BATCH_SLOT *slot = slots + tag;
+        if (result > 0) {
+            (*slot).done += result;
+            if ((*slot).done < (*slot).size && submitSlot(ring, slot, tag) == 0)
+                continue;
+        }
+        // Done, or a short or refused read: readRest() deals with what is left.
+        finishSlot(config, files, shared, slot, 0, out);
+        busy[tag] = 0;
+    }
+    if (ring != NULL)
+        argo_uring_free(ring);
+    fflush(out);
+}
+
+static BATCH_RESULT *sortResults;
+
+static int compareSeconds(const void *a, const void *b) {
+    double x = (*(sortResults + *(const size_t *)a)).seconds;
+    double y = (*(sortResults + *(const size_t *)b)).seconds;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+/*
+ * Copy the documents from the workers' outputs to the combined output, in
+ * the order in which the files were given.
+ */
+static int mergeOutputs(BATCH_SHARED *shared, size_t count, FILE **outputs, FILE *out) {
+    char *buffer = NULL;
+    size_t capacity = 0;
+    for (size_t i = 0; i < count; i++) {
+        BATCH_RESULT *result = (*shared).results + i;
+        if ((*result).status != 0 || (*result).length == 0)
+            continue;
+        if ((*result).length > capacity) {
+            free(buffer);
+            capacity = (*result).length;
+            buffer = malloc(capacity);
+            if (buffer == NULL)
+                return 1;
+        }
+        int fd = fileno(*(outputs + (*result).worker));
+        if (pread(fd, buffer, (*result).length, (*result).offset) != (ssize_t)(*result).length
+            || fwrite(buffer, 1, (*result).length, out) != (*result).length) {
+            free(buffer);
+            return 1;
+        }
+    }
+    free(buffer);
+    return 0;
+}
+
+static void report(char **files, size_t count, BATCH_SHARED *shared, double seconds) {
+    size_t failed = 0;
+    size_t bytes = 0;
+    size_t *order = malloc(count * sizeof(size_t));
+    for (size_t i = 0; i < count; i++) {
+        BATCH_RESULT *result = (*shared).results + i;
+        if ((*result).status < 0)
+            fprintf(stderr, "%s: not processed\n", *(files + i));
+        failed += (*result).status != 0;
+        bytes += (*result).bytes;
+        if (order != NULL)
+            *(order + i) = i;
+    }
+    double megabytes = bytes / (1024.0 * 1024.0);
+    fprintf(stderr, "%zu files (%zu failed), %.1f MB in %.3f s: %.0f files/s, %.1f MB/s\n",
+            count, failed, megabytes, seconds, count / seconds, megabytes / seconds);
+    if (order == NULL)
+        return;
+    sortResults = (*shared).results;
+    qsort(order, count, sizeof(size_t), compareSeconds);
+    for (size_t i = 0; i < count && i < ARGO_BATCH_SLOWEST; i++) {
+        BATCH_RESULT *result = (*shared).results + *(order + i);
+        if ((*result).status != 0)
+            break;
+        fprintf(stderr, "  %8.3f ms %10zu bytes  %s\n",
+                (*result).seconds * 1000, (*result).bytes, *(files + *(order + i)));
+    }
+    free(order);
+}
+
+/**
+ * @brief  Run a batch, as described in batch.h.
+ *
+ * @return  Zero if every file was processed successfully, nonzero
+ * otherwise.
+ */
+int argo_batch(ARGO_BATCH *config) {
+    double start = now();
+    char **files;
+    size_t count;
+    if (argo_batch_files(config, &files, &count))
+        return 1;
+    if (count == 0) {
+        fprintf(stderr, "No files to process\n");
+        return 1;
+    }
+    int jobs = (*config).jobs;
+    if (jobs <= 0)
+        jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (jobs <= 0)
+        jobs = 1;
+    if ((size_t)jobs > count)
+        jobs = (int)count;
+
+    size_t sharedSize = sizeof(BATCH_SHARED) + count * sizeof(BATCH_RESULT);
+    BATCH_SHARED *shared = mmap(NULL, sharedSize, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (shared == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++)
+        (*((*shared).results + i)).status = -1;
+    FILE **outputs = calloc(jobs, sizeof(FILE *));
+    FILE *out = NULL;
+    int status = outputs == NULL;
+    if (status == 0 && (*config).output != NULL && (global_options & VALIDATE_OPTION) == 0) {
+        out = cmp((*config).output, "-") == 0 ? stdout : fopen((*config).output, "w");
+        if (out == NULL) {
+            perror((*config).output);
+            status = 1;
+        }
+        for (int i = 0; status == 0 && i < jobs; i++)
+            status = (*(outputs + i) = tmpfile()) == NULL;
+    }
+
+    pid_t *pids = calloc(jobs, sizeof(pid_t));
+    int started = 0;
+    fflush(stdout);
+    fflush(stderr);
+    while (status == 0 && pids != NULL && started < jobs) {
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            break;
+        }
+        if (pid == 0) {
+            FILE *mine = *(outputs + started);
+            work(config, files, count, shared, started, mine != NULL ? mine : stdout);
+            _exit(EXIT_SUCCESS);
+        }
+        *(pids + started++) = pid;
+    }
+    for (int i = 0; i < started; i++) {
+        int wstatus;
+        while (waitpid(*(pids + i), &wstatus, 0) < 0 && errno == EINTR)
+            ;
+    }
+    if (started == 0)
+        status = 1;
+
+    if (status == 0 && out != NULL && mergeOutputs(shared, count, outputs, out)) {
+        perror((*config).output);
+        status = 1;
+    }
+    if (out != NULL && out != stdout && fclose(out) != 0)
+        status = 1;
+    if (out == stdout)
+        fflush(stdout);
+    if (status == 0)
+        report(files, count, shared, now() - start);
+    for (size_t i = 0; status == 0 && i < count; i++)
+        status = (*((*shared).results + i)).status != 0;
+
+    for (int i = 0; outputs != NULL && i < jobs; i++)
+        if (*(outputs + i) != NULL)
+            fclose(*(outputs + i));
+    free(outputs);
+    free(pids);
+    munmap(shared, sharedSize);
+    for (size_t i = 0; i < count; i++) {
+        char *file = *(files + i);
+        int given = 0;
+        for (int j = 0; j < (*config).path_count; j++)
+            given |= file == *((*config).paths + j);
+        if (!given)
+            free(file);
+    }
+    free(files);
+    return status;
+}
@@ -0,0 +1,738 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "number.h"
+#include "reader.h"
+#include "schema.h"
+#include "compress.h"
+#include "pipeline.h"
+#include "options.h"
+#include "columnar.h"
+
+ARGO_COLUMNS_CONFIG argo_columns_config;
+
+/*
+ * Number of rows the columns first have room for; always a multiple of 64,
+ * so that the validity bitmaps have whole words.
+ */
+#define FIRST_ROWS 1024
+
+static ARGO_STRING key;
+static ARGO_STRING text;
+static ARGO_NUMBER number;
+
+static char *typeNames[] = {"any", "int64", "double", "string"};
+
+/**
+ * @brief  Find the column type with a given name.
+ *
+ * @param name  "any", "int64", "double" or "string".
+ * @return  The type, or -1 if there is none of that name.
+ */
+int argo_column_type_named(char *name) {
+    for (int type = ARGO_COLUMN_ANY; type <= ARGO_COLUMN_STRING; type++)
+        if (cmp(name, *(typeNames + type)) == 0)
+            return type;
+    return -1;
+}
+
+/**
+ * @brief  Start an empty set of columns.
+ *
+ * @param infer  Nonzero to add a column for every member name read, zero
+ * to extract only the columns declared.
+ */
+void argo_columns_init(ARGO_COLUMNS *t, int infer) {
+    *t = (ARGO_COLUMNS){0};
+    (*t).infer = infer;
+}
+
+/*
+ * Reallocate an array from "old" elements to "new" ones, zeroing the new
+ * elements.  An array of no elements is left unallocated, since realloc()
+ * may return NULL for it.
+ */
+static int resize(void *items, size_t old, size_t new, size_t size) {
+    if (new == 0)
+        return 0;
+    char *p = realloc(*(void **)items, new * size);
+    if (p == NULL) {
+        fprintf(stderr, "[%d] Out of memory for columns\n", argo_lines_read);
+        return 1;
+    }
+    for (size_t i = old * size; i < new * size; i++)
+        *(p + i) = 0;
+    *(void **)items = p;
+    return 0;
+}
+
+/*
+ * Give a column the arrays of a type, with room for the rows of the set.
+ * All the rows so far have no value, so the arrays start out zero.
+ */
+static int setType(ARGO_COLUMNS *t, ARGO_COLUMN *c, int type) {
+    size_t capacity = (*t).row_capacity;
+    if (type == ARGO_COLUMN_INT64 && resize(&(*c).ints, 0, capacity, sizeof(int64_t)))
+        return 1;
+    if (type == ARGO_COLUMN_DOUBLE && resize(&(*c).doubles, 0, capacity, sizeof(double)))
+        return 1;
+    if (type == ARGO_COLUMN_STRING && resize(&(*c).offsets, 0, capacity + 1, sizeof(size_t)))
+        return 1;
+    (*c).type = type;
+    return 0;
+}
+
+/*
+ * Turn an inferred integer column into a double column, once it turns out
+ * to hold a number that is not an integer.
+ */
+static int promote(ARGO_COLUMNS *t, ARGO_COLUMN *c) {
+    if (setType(t, c, ARGO_COLUMN_DOUBLE))
+        return 1;
+    for (size_t i = 0; i < (*t).rows; i++)
+        *((*c).doubles + i) = (double)*((*c).ints + i);
+    free((*c).ints);
+    (*c).ints = NULL;
+    return 0;
+}
+
+/*
+ * Make room in every column for twice as many rows.
+ */
+static int growRows(ARGO_COLUMNS *t) {
+    size_t old = (*t).row_capacity;
+    size_t new = old == 0 ? FIRST_ROWS : 2 * old;
+    for (size_t i = 0; i < (*t).column_count; i++) {
+        ARGO_COLUMN *c = (*t).columns + i;
+        if (resize(&(*c).validity, old / 64, new / 64, sizeof(uint64_t)))
+            return 1;
+        if ((*c).type == ARGO_COLUMN_INT64 && resize(&(*c).ints, old, new, sizeof(int64_t)))
+            return 1;
+        if ((*c).type == ARGO_COLUMN_DOUBLE && resize(&(*c).doubles, old, new, sizeof(double)))
+            return 1;
+        if ((*c).type == ARGO_COLUMN_STRING && resize(&(*c).offsets, old + 1, new + 1, sizeof(size_t)))
+            return 1;
+    }
+    (*t).row_capacity = new;
+    return 0;
+}
+
+/*
+ * Add a column with a name given as code points.
+ */
+static ARGO_COLUMN *addColumn(ARGO_COLUMNS *t, ARGO_CHAR *name, size_t length, int type) {
+    if ((*t).column_count == (*t).column_capacity) {
+        size_t capacity = (*t).column_capacity == 0 ? 8 : 2 * (*t).column_capacity;
+        if (resize(&(*t).columns, (*t).column_capacity, capacity, sizeof(ARGO_COLUMN)))
+            return NULL;
+        (*t).column_capacity = capacity;
+    }
+    ARGO_COLUMN *c = (*t).columns + (*t).column_count;
+    *c = (ARGO_COLUMN){0};
+    for (size_t i = 0; i < length; i++)
+        if (argo_append_char(&(*c).name, *(name + i)))
+            return NULL;
+    if ((*t).row_capacity != 0 && resize(&(*c).validity, 0, (*t).row_capacity / 64, sizeof(uint64_t)))
+        return NULL;
+    if (type != ARGO_COLUMN_ANY && setType(t, c, type))
+        return NULL;
+    (*c).declared = type != ARGO_COLUMN_ANY;
+    (*t).column_count++;
+    return c;
+}
+
+/*
+ * Decode a name given in UTF-8 into "key".
+ */
+static int decodeName(char *name) {
+    key.length = 0;
+    unsigned char *p = (unsigned char *)name;
+    while (*p != '\0') {
+        ARGO_CHAR x = *p++;
+        int more = x >= 0xF0 ? 3 : x >= 0xE0 ? 2 : x >= 0xC0 ? 1 : 0;
+        if (more > 0)
+            x &= 0x3F >> more;
+        while (more-- > 0) {
+            if ((*p & 0xC0) != 0x80)
+                return 1;
+            x = x << 6 | (*p++ & 0x3F);
+        }
+        if (argo_append_char(&key, x))
+            return 1;
+    }
+    return 0;
+}
+
+static int sameName(ARGO_COLUMN *c, ARGO_STRING *name) {
+    if ((*c).name.length != (*name).length)
+        return 0;
+    for (size_t i = 0; i < (*name).length; i++)
+        if (*((*c).name.content + i) != *((*name).content + i))
+            return 0;
+    return 1;
+}
+
+/*
+ * Find the column for a member name, trying first the one after the column
+ * of the previous member, since the objects of an array of records usually
+ * have their members in the same order.
+ */
+static ARGO_COLUMN *lookup(ARGO_COLUMNS *t, ARGO_STRING *name) {
+    size_t count = (*t).column_count;
+    for (size_t n = 0; n < count; n++) {
+        size_t i = ((*t).guess + n) % count;
+        if (sameName((*t).columns + i, name)) {
+            (*t).guess = i + 1;
+            return (*t).columns + i;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Declare a column to be extracted.
+ *
+ * @param name  The member name, in UTF-8.
+ * @param type  ARGO_COLUMN_INT64, ARGO_COLUMN_DOUBLE or ARGO_COLUMN_STRING,
+ * or ARGO_COLUMN_ANY to infer the type from the values.
+ * @return  Zero if successful, nonzero if the name is not valid UTF-8, is
+ * already declared, or memory runs out.
+ */
+int argo_columns_declare(ARGO_COLUMNS *t, char *name, int type) {
+    if (decodeName(name)) {
+        fprintf(stderr, "Invalid column name: %s\n", name);
+        return 1;
+    }
+    if (lookup(t, &key) != NULL) {
+        fprintf(stderr, "Column declared twice: %s\n", name);
+        return 1;
+    }
+    return addColumn(t, key.content, key.length, type) == NULL;
+}
+
+/**
+ * @brief  Find the column for a member name.
+ *
+ * @param name  The member name, in UTF-8.
+ * @return  The column, or NULL if there is none.
+ */
+ARGO_COLUMN *argo_columns_find(ARGO_COLUMNS *t, char *name) {
+    if (decodeName(name))
+        return NULL;
+    return lookup(t, &key);
+}
+
+static void setValid(ARGO_COLUMN *c, size_t row) {
+    *((*c).validity + row / 64) |= 1UL << (row % 64);
+    (*c).count++;
+}
+
+static int storeInt(ARGO_COLUMNS *t, ARGO_COLUMN *c, int64_t value) {
+    if ((*c).type == ARGO_COLUMN_ANY && setType(t, c, ARGO_COLUMN_INT64))
+        return 1;
+    if ((*c).type == ARGO_COLUMN_INT64)
+        *((*c).ints + (*t).rows) = value;
+    else if ((*c).type == ARGO_COLUMN_DOUBLE)
+        *((*c).doubles + (*t).rows) = (double)value;
+    else {
+        (*c).mismatched++;
+        return 0;
+    }
+    setValid(c, (*t).rows);
+    return 0;
+}
+
+static int storeDouble(ARGO_COLUMNS *t, ARGO_COLUMN *c, double value) {
+    if ((*c).type == ARGO_COLUMN_ANY && setType(t, c, ARGO_COLUMN_DOUBLE))
+        return 1;
+    if ((*c).type == ARGO_COLUMN_INT64 && !(*c).declared && promote(t, c))
+        return 1;
+    if ((*c).type != ARGO_COLUMN_DOUBLE) {
+        (*c).mismatched++;
+        return 0;
+    }
+    *((*c).doubles + (*t).rows) = value;
+    setValid(c, (*t).rows);
+    return 0;
+}
+
+/*
+ * Append the UTF-8 encoding of "text" to the blob of a string column.
+ */
+static int storeString(ARGO_COLUMNS *t, ARGO_COLUMN *c) {
+    if ((*c).type == ARGO_COLUMN_ANY && setType(t, c, ARGO_COLUMN_STRING))
+        return 1;
+    if ((*c).type != ARGO_COLUMN_STRING) {
+        (*c).mismatched++;
+        return 0;
+    }
+    size_t need = (*c).blob_length + 4 * text.length;
+    if (need > (*c).blob_capacity) {
+        size_t capacity = (*c).blob_capacity == 0 ? 4096 : 2 * (*c).blob_capacity;
+        if (capacity < need)
+            capacity = need;
+        if (resize(&(*c).blob, (*c).blob_capacity, capacity, 1))
+            return 1;
+        (*c).blob_capacity = capacity;
+    }
+    char *out = (*c).blob + (*c).blob_length;
+    for (size_t i = 0; i < text.length; i++) {
+        ARGO_CHAR x = *(text.content + i);
+        if (x < 0x80) {
+            *out++ = (char)x;
+        } else if (x < 0x800) {
+            *out++ = (char)(0xC0 | (x >> 6));
+            *out++ = (char)(0x80 | (x & 0x3F));
+        } else if (x < 0x10000) {
+            *out++ = (char)(0xE0 | (x >> 12));
+            *out++ = (char)(0x80 | ((x >> 6) & 0x3F));
+            *out++ = (char)(0x80 | (x & 0x3F));
+        } else {
+            *out++ = (char)(0xF0 | (x >> 18));
+            *out++ = (char)(0x80 | ((x >> 12) & 0x3F));
+            *out++ = (char)(0x80 | ((x >> 6) & 0x3F));
+            *out++ = (char)(0x80 | (x & 0x3F));
+        }
+    }
+    (*c).blob_length = out - (*c).blob;
+    setValid(c, (*t).rows);
+    return 0;
+}
+
+/*
+ * Read the value of a member, whose first character has been read, into
+ * its column, or skip it if it has none.
+ */
+static int readCell(ARGO_COLUMNS *t, ARGO_COLUMN *c, int ch, FILE *f) {
+    if (c == NULL || ch == ARGO_N)
+        return argo_schema_skip(ch, f);
+    if (ARGO_COLUMN_VALID(c, (*t).rows) || ch == ARGO_LBRACE || ch == ARGO_LBRACK) {
+        (*c).mismatched++;
+        return argo_schema_skip(ch, f);
+    }
+    if (ch == ARGO_T || ch == ARGO_F) {
+        int value;
+        return argo_schema_boolean(&value, ch, f) || storeInt(t, c, value);
+    }
+    if (ch == ARGO_QUOTE)
+        return argo_schema_string(&text, ch, f) || storeString(t, c);
+    if (ch != ARGO_MINUS && !argo_is_digit(ch)) {
+        argo_schema_error("Expected a value", ch);
+        return 1;
+    }
+    argo_ungetc(ch, f);
+    number.string_value.length = 0;
+    number.valid_string = number.valid_int = number.valid_float = 0;
+    if (argo_read_number(&number, f))
+        return 1;
+    long value;
+    if (argo_number_int(&number, &value) == 0)
+        return storeInt(t, c, value);
+    double x;
+    if (argo_number_float(&number, &x)) {
+        fprintf(stderr, "[%d] Number out of range\n", argo_lines_read);
+        return 1;
+    }
+    return storeDouble(t, c, x);
+}
+
+/*
+ * Read an object, whose '{' has been read, as the next row.
+ */
+static int readRow(ARGO_COLUMNS *t, FILE *f) {
+    if ((*t).rows == (*t).row_capacity && growRows(t))
+        return 1;
+    (*t).guess = 0;
+    int c = argo_getc_nonblank(f);
+    if (c != ARGO_RBRACE) {
+        while (1) {
+            if (c != ARGO_QUOTE) {
+                argo_schema_error("Expected member name", c);
+                return 1;
+            }
+            if (argo_schema_key(&key, f))
+                return 1;
+            ARGO_COLUMN *column = lookup(t, &key);
+            if (column == NULL && (*t).infer) {
+                column = addColumn(t, key.content, key.length, ARGO_COLUMN_ANY);
+                if (column == NULL)
+                    return 1;
+                (*t).guess = (*t).column_count;
+            }
+            if (readCell(t, column, argo_getc_nonblank(f), f))
+                return 1;
+            c = argo_getc_nonblank(f);
+            if (c == ARGO_RBRACE)
+                break;
+            if (c != ARGO_COMMA) {
+                argo_schema_error("Expected ',' or '}' in object", c);
+                return 1;
+            }
+            c = argo_getc_nonblank(f);
+        }
+    }
+    for (size_t i = 0; i < (*t).column_count; i++) {
+        ARGO_COLUMN *column = (*t).columns + i;
+        if ((*column).type == ARGO_COLUMN_STRING)
+            *((*column).offsets + (*t).rows + 1) = (*column).blob_length;
+    }
+    (*t).rows++;
+    return 0;
+}
+
+/**
+ * @brief  Read an array of objects into a set of columns.
+ * @details  Each object is added as a row after those already read, so that
+ * several arrays can be read into the same set one after another.
+ *
+ * @param t  The set of columns.
+ * @param f  Input stream from which the array is to be read.
+ * @return  Zero if successful, nonzero if the input is not an array of
+ * objects or memory runs out.  The rows read before an error are kept.
+ */
+int argo_columns_read(ARGO_COLUMNS *t, FILE *f) {
+    argo_reader_enter(f);
+    int c = argo_getc_nonblank(f);
+    int status = 1;
+    if (c != ARGO_LBRACK) {
+        argo_schema_error("Expected '['", c);
+    } else if ((c = argo_getc_nonblank(f)) == ARGO_RBRACK) {
+        status = 0;
+    } else {
+        while (1) {
+            if (c != ARGO_LBRACE) {
+                argo_schema_error("Expected an object", c);
+                break;
+            }
+            if (readRow(t, f))
+                break;
+            c = argo_getc_nonblank(f);
+            if (c == ARGO_RBRACK) {
+                status = 0;
+                break;
+            }
+            if (c != ARGO_COMMA) {
+                argo_schema_error("Expected ',' or ']' in array", c);
+                break;
+            }
+            c = argo_getc_nonblank(f);
+        }
+    }
+    argo_reader_leave(f);
+    return status;
+}
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+/*
+ * Add the doubles of a run of rows that all have values to the sum,
+ * minimum and maximum, two lanes at a time.
+ */
+static void runDouble(double *p, size_t n, ARGO_COLUMN_STATS *s) {
+    __m128d sum = _mm_setzero_pd();
+    __m128d min = _mm_set1_pd((*s).min);
+    __m128d max = _mm_set1_pd((*s).max);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d x = _mm_loadu_pd(p + i);
+        sum = _mm_add_pd(sum, x);
+        min = _mm_min_pd(min, x);
+        max = _mm_max_pd(max, x);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, sum);
+    (*s).sum += *lanes + *(lanes + 1);
+    _mm_storeu_pd(lanes, min);
+    (*s).min = *lanes < *(lanes + 1) ? *lanes : *(lanes + 1);
+    _mm_storeu_pd(lanes, max);
+    (*s).max = *lanes > *(lanes + 1) ? *lanes : *(lanes + 1);
+    for (; i < n; i++) {
+        double x = *(p + i);
+        (*s).sum += x;
+        if (x < (*s).min)
+            (*s).min = x;
+        if (x > (*s).max)
+            (*s).max = x;
+    }
+}
+
+/*
+ * Add the integers of a run of rows that all have values to the sum,
+ * minimum and maximum.  SSE2 has 64-bit addition but no 64-bit comparison,
+ * so only the sum is taken two lanes at a time.
+ */
+static void runInt(int64_t *p, size_t n, ARGO_COLUMN_STATS *s) {
+    __m128i sum = _mm_setzero_si128();
+    int64_t min = (*s).int_min;
+    int64_t max = (*s).int_max;
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        sum = _mm_add_epi64(sum, _mm_loadu_si128((const __m128i *)(p + i)));
+        int64_t a = *(p + i);
+        int64_t b = *(p + i + 1);
+        min = a < min ? a : min;
+        min = b < min ? b : min;
+        max = a > max ? a : max;
+        max = b > max ? b : max;
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, sum);
+    (*s).int_sum += (int64_t)((uint64_t)*lanes + (uint64_t)*(lanes + 1));
+    for (; i < n; i++) {
+        int64_t x = *(p + i);
+        (*s).int_sum = (int64_t)((uint64_t)(*s).int_sum + (uint64_t)x);
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+    }
+    (*s).int_min = min;
+    (*s).int_max = max;
+}
+#else
+static void runDouble(double *p, size_t n, ARGO_COLUMN_STATS *s) {
+    for (size_t i = 0; i < n; i++) {
+        double x = *(p + i);
+        (*s).sum += x;
+        if (x < (*s).min)
+            (*s).min = x;
+        if (x > (*s).max)
+            (*s).max = x;
+    }
+}
+
+static void runInt(int64_t *p, size_t n, ARGO_COLUMN_STATS *s) {
+    for (size_t i = 0; i < n; i++) {
+        int64_t x = *(p + i);
+        (*s).int_sum = (int64_t)((uint64_t)(*s).int_sum + (uint64_t)x);
+        if (x < (*s).int_min)
+            (*s).int_min = x;
+        if (x > (*s).int_max)
+            (*s).int_max = x;
+    }
+}
+#endif
+
+/**
+ * @brief  Compute the count, sum, minimum and maximum of the values of a
+ * column.
+ * @details  For a string column only the count is computed.  If the column
+ * has no values, the sums are zero and the minimum and maximum are
+ * meaningless.
+ *
+ * @param c  The column.
+ * @param rows  The number of rows of the set the column belongs to.
+ * @param s  Set to the results.
+ * @return  Zero if successful, nonzero if the column is not numeric.
+ */
+int argo_column_stats(ARGO_COLUMN *c, size_t rows, ARGO_COLUMN_STATS *s) {
+    *s = (ARGO_COLUMN_STATS){0, 0, __builtin_inf(), -__builtin_inf(), 0, INT64_MAX, INT64_MIN};
+    (*s).count = (*c).count;
+    if ((*c).type != ARGO_COLUMN_INT64 && (*c).type != ARGO_COLUMN_DOUBLE)
+        return 1;
+    int integer = (*c).type == ARGO_COLUMN_INT64;
+    size_t words = (rows + 63) / 64;
+    size_t word = 0;
+    while (word < words) {
+        // A run of words whose 64 rows all have values.
+        size_t start = word;
+        while (word < words && *((*c).validity + word) == ~0UL && 64 * (word + 1) <= rows)
+            word++;
+        if (word > start) {
+            if (integer)
+                runInt((*c).ints + 64 * start, 64 * (word - start), s);
+            else
+                runDouble((*c).doubles + 64 * start, 64 * (word - start), s);
+            continue;
+        }
+        uint64_t bits = *((*c).validity + word);
+        while (bits != 0) {
+            size_t row = 64 * word + __builtin_ctzl(bits);
+            if (integer)
+                runInt((*c).ints + row, 1, s);
+            else
+                runDouble((*c).doubles + row, 1, s);
+            bits &= bits - 1;
+        }
+        word++;
+    }
+    if (integer) {
+        (*s).sum = (double)(*s).int_sum;
+        (*s).min = (double)(*s).int_min;
+        (*s).max = (double)(*s).int_max;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Free the columns of a set and leave it empty.
+ */
+void argo_columns_free(ARGO_COLUMNS *t) {
+    for (size_t i = 0; i < (*t).column_count; i++) {
+        ARGO_COLUMN *c = (*t).columns + i;
+        free((*c).name.content);
+        free((*c).validity);
+        free((*c).ints);
+        free((*c).doubles);
+        free((*c).offsets);
+        free((*c).blob);
+    }
+    free((*t).columns);
+    argo_columns_init(t, (*t).infer);
+}
+
+/**
+ * @brief  Parse the arguments that follow --columns.
+ * @details  The values of the -f options are gathered at the start of
+ * "argv", over the options themselves.
+ *
+ * @return  0 if they are valid, -1 if not.
+ */
+int argo_columns_args(int argc, char **argv) {
+    int fields = 0;
+    int index = 0;
+    while (index < argc && **(argv + index) == '-' && *(*(argv + index) + 1) != '\0') {
+        if (cmp(*(argv + index), "-f") != 0 || index + 1 >= argc)
+            return -1;
+        *(argv + fields++) = *(argv + index + 1);
+        index += 2;
+    }
+    global_options |= COLUMNS_OPTION;
+    argo_columns_config.fields = argv;
+    argo_columns_config.field_count = fields;
+    argo_columns_config.paths = argv + index;
+    argo_columns_config.path_count = argc - index;
+    return 0;
+}
+
+/*
+ * Declare the column of a NAME[:TYPE] given with -f.  The name is the text
+ * before the last ':', if what follows it is the name of a type.
+ */
+static int declareField(ARGO_COLUMNS *t, char *field) {
+    char *colon = NULL;
+    for (char *p = field; *p != '\0'; p++)
+        if (*p == ':')
+            colon = p;
+    int type = colon == NULL ? -1 : argo_column_type_named(colon + 1);
+    if (type < 0)
+        return argo_columns_declare(t, field, ARGO_COLUMN_ANY);
+    *colon = '\0';
+    int status = argo_columns_declare(t, field, type);
+    *colon = ':';
+    return status;
+}
+
+/*
+ * Read the array in a file, or in standard input if "name" is NULL, into
+ * the columns.
+ */
+static int readFile(ARGO_COLUMNS *t, char *name) {
+    FILE *f = name == NULL ? stdin : fopen(name, "r");
+    if (f == NULL) {
+        perror(name);
+        return 1;
+    }
+    int status = 1;
+    if (argo_input_start(f) >= 0) {
+        status = argo_columns_read(t, f) || argo_read_end(f);
+        argo_pipeline_stop();
+    }
+    if (f != stdin)
+        fclose(f);
+    if (status)
+        fprintf(stderr, "%s: not an array of objects\n", name == NULL ? "-" : name);
+    return status;
+}
+
+/*
+ * Write a member name and the colon after it.
+ */
+static void writeName(char *name, FILE *f) {
+    fputc(ARGO_QUOTE, f);
+    fputs(name, f);
+    fputc(ARGO_QUOTE, f);
+    fputc(ARGO_COLON, f);
+}
+
+/*
+ * Write a member holding a statistic of a column, as an integer for an
+ * integer column.  Returns nonzero if the statistic could not be written,
+ * as for a sum of doubles that overflowed.
+ */
+static int writeStat(char *name, int integer, int64_t value, double x, FILE *f) {
+    fputc(ARGO_COMMA, f);
+    writeName(name, f);
+    if (integer)
+        return argo_schema_write_long((long)value, f);
+    else
+        return argo_schema_write_double(x, f);
+}
+
+static int writeSummary(ARGO_COLUMNS *t, FILE *f) {
+    int status = 0;
+    fputc(ARGO_LBRACE, f);
+    writeName("rows", f);
+    status |= argo_schema_write_long((long)(*t).rows, f);
+    fputc(ARGO_COMMA, f);
+    writeName("columns", f);
+    fputc(ARGO_LBRACK, f);
+    for (size_t i = 0; i < (*t).column_count; i++) {
+        ARGO_COLUMN *c = (*t).columns + i;
+        if (i > 0)
+            fputc(ARGO_COMMA, f);
+        fputc(ARGO_LBRACE, f);
+        writeName("name", f);
+        status |= argo_write_string(&(*c).name, f);
+        fputc(ARGO_COMMA, f);
+        writeName("type", f);
+        fputc(ARGO_QUOTE, f);
+        fputs(*(typeNames + (*c).type), f);
+        fputc(ARGO_QUOTE, f);
+        fputc(ARGO_COMMA, f);
+        writeName("count", f);
+        status |= argo_schema_write_long((long)(*c).count, f);
+        fputc(ARGO_COMMA, f);
+        writeName("mismatched", f);
+        status |= argo_schema_write_long((long)(*c).mismatched, f);
+        ARGO_COLUMN_STATS s;
+        if (argo_column_stats(c, (*t).rows, &s) == 0 && s.count > 0) {
+            int integer = (*c).type == ARGO_COLUMN_INT64;
+            status |= writeStat("sum", integer, s.int_sum, s.sum, f);
+            status |= writeStat("min", integer, s.int_min, s.min, f);
+            status |= writeStat("max", integer, s.int_max, s.max, f);
+        }
+        fputc(ARGO_RBRACE, f);
+    }
+    fputc(ARGO_RBRACK, f);
+    fputc(ARGO_RBRACE, f);
+    fputc(ARGO_LF, f);
+    return status;
+}
+
+/**
+ * @brief  Extract the columns of the arrays in the files and write their
+ * summary, as --columns does.
+ *
+ * @return  0 if every array was read and the summary written, 1 otherwise.
+ */
+int argo_columns_files(ARGO_COLUMNS_CONFIG *config) {
+    ARGO_COLUMNS t;
+    argo_columns_init(&t, (*config).field_count == 0);
+    int status = 0;
+    for (int i = 0; i < (*config).field_count; i++)
+        if (declareField(&t, *((*config).fields + i)))
+            status = 1;
+    if (status == 0 && (*config).path_count == 0)
+        status = readFile(&t, NULL);
+    for (int i = 0; status == 0 && i < (*config).path_count; i++)
+        status = readFile(&t, *((*config).paths + i));
+    if (status == 0 && writeSummary(&t, stdout))
+        status = 1;
+    argo_columns_free(&t);
+    if (fflush(stdout) != 0)
+        status = 1;
+    return status;
+}
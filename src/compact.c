@@ -0,0 +1,386 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+#include "compact.h"
+#include "number.h"
+
+_Static_assert(sizeof(ARGO_CNODE) == 16, "ARGO_CNODE must occupy 16 bytes");
+
+/*
+ * NaN-boxing: a node holding a number that is not stored as an integer keeps
+ * the bits of the double itself.  Every other kind of node uses a negative
+ * quiet NaN, with the kind in the top 16 bits and a 48-bit payload below.
+ * A real NaN is never stored with the sign bit set, so the two cannot clash.
+ */
+#define CTAG_SHIFT 48
+#define CTAG_MASK 0xFFFF000000000000UL
+#define CPAYLOAD_MASK 0x0000FFFFFFFFFFFFUL
+#define CTAG_BASIC 0xFFF9UL              // payload: ARGO_BASIC
+#define CTAG_INT 0xFFFAUL                // payload: 48-bit two's complement integer
+#define CTAG_LONG 0xFFFBUL               // payload: index into longs
+#define CTAG_STRING 0xFFFCUL             // payload: offset into text
+#define CTAG_ARRAY 0xFFFDUL              // payload: first element, or 0
+#define CTAG_OBJECT 0xFFFEUL             // payload: first member, or 0
+#define CQNAN 0x7FF8000000000000UL
+
+#define ctag(bits) ((bits) >> CTAG_SHIFT)
+#define cbox(tag, payload) (((uint64_t)(tag) << CTAG_SHIFT) | ((uint64_t)(payload) & CPAYLOAD_MASK))
+#define cpayload(bits) ((bits) & CPAYLOAD_MASK)
+#define cnode(c, n) ((*(c)).nodes + (n))
+
+#define INT48_MIN (-(1L << 47))
+#define INT48_MAX ((1L << 47) - 1)
+
+typedef union {
+    double d;
+    uint64_t bits;
+} DOUBLE_BITS;
+
+static int growArray(void **array, size_t *capacity, size_t need, size_t size) {
+    if (need <= *capacity)
+        return 0;
+    size_t newCapacity = *capacity == 0 ? 64 : *capacity;
+    while (newCapacity < need)
+        newCapacity *= 2;
+    void *grown = realloc(*array, newCapacity * size);
+    if (grown == NULL) {
+        fprintf(stderr, "Failed to allocate space for compact document\n");
+        return 1;
+    }
+    *array = grown;
+    *capacity = newCapacity;
+    return 0;
+}
+
+static uint32_t newNode(ARGO_COMPACT *c) {
+    if (growArray((void **)&(*c).nodes, &(*c).node_capacity, (*c).node_count + 1, sizeof(ARGO_CNODE)))
+        return 0;
+    uint32_t n = (uint32_t)(*c).node_count++;
+    (*cnode(c, n)).bits = 0;
+    (*cnode(c, n)).next = 0;
+    (*cnode(c, n)).name = 0;
+    return n;
+}
+
+/*
+ * Copy a string into the text, preceded by its length, and return its offset.
+ */
+static size_t addText(ARGO_COMPACT *c, ARGO_STRING *s) {
+    size_t need = (*c).text_length + 1 + (*s).length;
+    if (growArray((void **)&(*c).text, &(*c).text_capacity, need, sizeof(ARGO_CHAR)))
+        return 0;
+    size_t offset = (*c).text_length;
+    *((*c).text + offset) = (ARGO_CHAR)(*s).length;
+    size_t index = 0;
+    while (index < (*s).length) {
+        *((*c).text + offset + 1 + index) = *((*s).content + index);
+        index++;
+    }
+    (*c).text_length = need;
+    return offset;
+}
+
+static int textEquals(ARGO_COMPACT *c, size_t offset, ARGO_STRING *s) {
+    if ((size_t)*((*c).text + offset) != (*s).length)
+        return 0;
+    size_t index = 0;
+    while (index < (*s).length) {
+        if (*((*c).text + offset + 1 + index) != *((*s).content + index))
+            return 0;
+        index++;
+    }
+    return 1;
+}
+
+/*
+ * Return the offset of a member name, storing each distinct name once.
+ * The names map is an open-addressed table of text offsets.
+ */
+static uint32_t addName(ARGO_COMPACT *c, ARGO_STRING *s) {
+    uint32_t *names = (*c).names;
+    if ((*c).names_count + 1 > (*c).names_capacity - (*c).names_capacity / 4) {
+        size_t capacity = (*c).names_capacity == 0 ? 256 : (*c).names_capacity * 2;
+        uint32_t *grown = calloc(capacity, sizeof(uint32_t));
+        if (grown == NULL)
+            return (uint32_t)addText(c, s);
+        size_t index = 0;
+        while (index < (*c).names_capacity) {
+            uint32_t offset = *(names + index);
+            if (offset != 0) {
+                size_t length = (size_t)*((*c).text + offset);
+                size_t slot = argo_intern_hash((*c).text + offset + 1, length) & (capacity - 1);
+                while (*(grown + slot) != 0)
+                    slot = (slot + 1) & (capacity - 1);
+                *(grown + slot) = offset;
+            }
+            index++;
+        }
+        free(names);
+        names = grown;
+        (*c).names = grown;
+        (*c).names_capacity = capacity;
+    }
+    size_t slot = argo_intern_hash((*s).content, (*s).length) & ((*c).names_capacity - 1);
+    while (*(names + slot) != 0) {
+        if (textEquals(c, *(names + slot), s))
+            return *(names + slot);
+        slot = (slot + 1) & ((*c).names_capacity - 1);
+    }
+    uint32_t offset = (uint32_t)addText(c, s);
+    *(names + slot) = offset;
+    (*c).names_count++;
+    return offset;
+}
+
+static uint64_t boxNumber(ARGO_COMPACT *c, ARGO_NUMBER *number) {
+    long value;
+    if (argo_number_int(number, &value) == 0) {
+        if (value >= INT48_MIN && value <= INT48_MAX)
+            return cbox(CTAG_INT, value);
+        if (growArray((void **)&(*c).longs, &(*c).long_capacity, (*c).long_count + 1, sizeof(long)) == 0) {
+            *((*c).longs + (*c).long_count) = value;
+            return cbox(CTAG_LONG, (*c).long_count++);
+        }
+    }
+    DOUBLE_BITS u;
+    if (argo_number_float(number, &u.d))
+        u.d = 0.0;
+    if (u.d != u.d)
+        u.bits = CQNAN;
+    return u.bits;
+}
+
+static uint32_t build(ARGO_COMPACT *c, ARGO_VALUE *v) {
+    uint32_t n = newNode(c);
+    if (n == 0)
+        return 0;
+    if ((*v).name.length != 0 || argo_is_interned(&(*v).name))
+        (*cnode(c, n)).name = addName(c, &(*v).name);
+    if ((*v).type == ARGO_BASIC_TYPE) {
+        (*cnode(c, n)).bits = cbox(CTAG_BASIC, (*v).content.basic);
+    } else if ((*v).type == ARGO_NUMBER_TYPE) {
+        (*cnode(c, n)).bits = boxNumber(c, &(*v).content.number);
+    } else if ((*v).type == ARGO_STRING_TYPE) {
+        (*cnode(c, n)).bits = cbox(CTAG_STRING, addText(c, &(*v).content.string));
+    } else if ((*v).type == ARGO_OBJECT_TYPE || (*v).type == ARGO_ARRAY_TYPE) {
+        ARGO_VALUE *sentinel = (*v).type == ARGO_OBJECT_TYPE
+            ? (*v).content.object.member_list : (*v).content.array.element_list;
+        uint32_t first = 0;
+        uint32_t prev = 0;
+        ARGO_VALUE *child = (*sentinel).next;
+        while (child != NULL && child != sentinel) {
+            uint32_t m = build(c, child);
+            if (m == 0)
+                return 0;
+            if (prev == 0)
+                first = m;
+            else
+                (*cnode(c, prev)).next = m;
+            prev = m;
+            child = (*child).next;
+        }
+        (*cnode(c, n)).bits = cbox((*v).type == ARGO_OBJECT_TYPE ? CTAG_OBJECT : CTAG_ARRAY, first);
+    } else {
+        (*cnode(c, n)).bits = cbox(CTAG_BASIC, ARGO_NULL);
+    }
+    return n;
+}
+
+/**
+ * @brief  Build the compact representation of a value.
+ * @details  The value and everything reachable from it are copied into the
+ * compact document "c", which must either be zeroed or have been used by
+ * earlier calls (several values can share one document).  The source value
+ * is not referenced afterwards, so argo_value_storage can be reused (for
+ * example with argo_document_reset()) while the compact copy is kept.
+ *
+ * @param c  The compact document to add to.
+ * @param v  The value to copy.
+ * @return  The index of the node representing "v", or 0 if memory could
+ * not be allocated.
+ */
+uint32_t argo_compact_build(ARGO_COMPACT *c, ARGO_VALUE *v) {
+    if ((*c).node_count == 0) {
+        if (growArray((void **)&(*c).nodes, &(*c).node_capacity, 1, sizeof(ARGO_CNODE)))
+            return 0;
+        (*(*c).nodes).bits = 0;
+        (*c).node_count = 1;
+    }
+    if ((*c).text_length == 0) {
+        /* Offset 0 means "no name", so the text never starts at 0. */
+        ARGO_STRING empty = {0};
+        addText(c, &empty);
+    }
+    return build(c, v);
+}
+
+/**
+ * @brief  Free all memory held by a compact document and zero it.
+ */
+void argo_compact_free(ARGO_COMPACT *c) {
+    free((*c).nodes);
+    free((*c).text);
+    free((*c).longs);
+    free((*c).names);
+    *c = (ARGO_COMPACT){0};
+}
+
+ARGO_VALUE_TYPE argo_cnode_type(ARGO_COMPACT *c, uint32_t n) {
+    uint64_t bits = (*cnode(c, n)).bits;
+    switch (ctag(bits)) {
+    case CTAG_BASIC:
+        return ARGO_BASIC_TYPE;
+    case CTAG_STRING:
+        return ARGO_STRING_TYPE;
+    case CTAG_ARRAY:
+        return ARGO_ARRAY_TYPE;
+    case CTAG_OBJECT:
+        return ARGO_OBJECT_TYPE;
+    default:
+        return ARGO_NUMBER_TYPE;
+    }
+}
+
+ARGO_BASIC argo_cnode_basic(ARGO_COMPACT *c, uint32_t n) {
+    return (ARGO_BASIC)cpayload((*cnode(c, n)).bits);
+}
+
+/**
+ * @brief  Determine whether a number node holds an exact integer.
+ */
+int argo_cnode_is_int(ARGO_COMPACT *c, uint32_t n) {
+    uint64_t tag = ctag((*cnode(c, n)).bits);
+    return tag == CTAG_INT || tag == CTAG_LONG;
+}
+
+long argo_cnode_int(ARGO_COMPACT *c, uint32_t n) {
+    uint64_t bits = (*cnode(c, n)).bits;
+    if (ctag(bits) == CTAG_INT)
+        return ((long)(bits << 16)) >> 16;
+    if (ctag(bits) == CTAG_LONG)
+        return *((*c).longs + cpayload(bits));
+    return (long)argo_cnode_float(c, n);
+}
+
+double argo_cnode_float(ARGO_COMPACT *c, uint32_t n) {
+    uint64_t bits = (*cnode(c, n)).bits;
+    if (ctag(bits) == CTAG_INT || ctag(bits) == CTAG_LONG)
+        return (double)argo_cnode_int(c, n);
+    DOUBLE_BITS u;
+    u.bits = bits;
+    return u.d;
+}
+
+/**
+ * @brief  Get the content of a string node.
+ *
+ * @param length  Set to the number of code points in the string.
+ * @return  The code points, which belong to the document.
+ */
+ARGO_CHAR *argo_cnode_string(ARGO_COMPACT *c, uint32_t n, size_t *length) {
+    size_t offset = cpayload((*cnode(c, n)).bits);
+    *length = (size_t)*((*c).text + offset);
+    return (*c).text + offset + 1;
+}
+
+/**
+ * @brief  Get the member name of a node.
+ *
+ * @param length  Set to the number of code points in the name.
+ * @return  The code points, or NULL if the node is not an object member.
+ */
+ARGO_CHAR *argo_cnode_name(ARGO_COMPACT *c, uint32_t n, size_t *length) {
+    uint32_t offset = (*cnode(c, n)).name;
+    if (offset == 0) {
+        *length = 0;
+        return NULL;
+    }
+    *length = (size_t)*((*c).text + offset);
+    return (*c).text + offset + 1;
+}
+
+/**
+ * @brief  Get an identifier for the member name of a node.
+ * @details  Within one document, two nodes have equal member names exactly
+ * when they have equal name identifiers.
+ *
+ * @return  The identifier, or 0 if the node is not an object member.
+ */
+uint32_t argo_cnode_name_id(ARGO_COMPACT *c, uint32_t n) {
+    return (*cnode(c, n)).name;
+}
+
+/**
+ * @brief  Get the first element or member of an array or object node.
+ *
+ * @return  The first child, or 0 if there is none.
+ */
+uint32_t argo_cnode_first(ARGO_COMPACT *c, uint32_t n) {
+    uint64_t bits = (*cnode(c, n)).bits;
+    if (ctag(bits) != CTAG_ARRAY && ctag(bits) != CTAG_OBJECT)
+        return 0;
+    return (uint32_t)cpayload(bits);
+}
+
+/**
+ * @brief  Get the next sibling of an element or member.
+ *
+ * @return  The next sibling, or 0 if this is the last one.
+ */
+uint32_t argo_cnode_next(ARGO_COMPACT *c, uint32_t n) {
+    return (*cnode(c, n)).next;
+}
+
+/**
+ * @brief  Write canonical JSON for a node of a compact document.
+ * @details  The output contains no whitespace.  Strings and numbers go
+ * through argo_write_string() and argo_write_number(), so they are written
+ * exactly as for the original value and honor the same options.
+ *
+ * @return  Zero if successful, nonzero if there was an output error or a
+ * number could not be written.
+ */
+int argo_compact_write(ARGO_COMPACT *c, uint32_t n, FILE *f) {
+    ARGO_VALUE_TYPE type = argo_cnode_type(c, n);
+    int status = 0;
+    if (type == ARGO_BASIC_TYPE) {
+        ARGO_BASIC basic = argo_cnode_basic(c, n);
+        fputs(basic == ARGO_NULL ? ARGO_NULL_TOKEN : basic == ARGO_TRUE ? ARGO_TRUE_TOKEN : ARGO_FALSE_TOKEN, f);
+    } else if (type == ARGO_NUMBER_TYPE) {
+        ARGO_NUMBER number = {0};
+        if (argo_cnode_is_int(c, n)) {
+            number.valid_int = 1;
+            number.int_value = argo_cnode_int(c, n);
+        }
+        number.valid_float = 1;
+        number.float_value = argo_cnode_float(c, n);
+        status = argo_write_number(&number, f);
+    } else if (type == ARGO_STRING_TYPE) {
+        ARGO_STRING s = {0};
+        s.content = argo_cnode_string(c, n, &s.length);
+        status = argo_write_string(&s, f);
+    } else {
+        int object = type == ARGO_OBJECT_TYPE;
+        fputc(object ? ARGO_LBRACE : ARGO_LBRACK, f);
+        uint32_t m = argo_cnode_first(c, n);
+        while (m != 0 && status == 0) {
+            if (object) {
+                ARGO_STRING name = {0};
+                name.content = argo_cnode_name(c, m, &name.length);
+                if (argo_write_string(&name, f))
+                    return 1;
+                fputc(ARGO_COLON, f);
+            }
+            status = argo_compact_write(c, m, f);
+            m = argo_cnode_next(c, m);
+            if (m != 0)
+                fputc(ARGO_COMMA, f);
+        }
+        fputc(object ? ARGO_RBRACE : ARGO_RBRACK, f);
+    }
+    return status || ferror(f) ? 1 : 0;
+}
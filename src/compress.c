@@ -0,0 +1,402 @@
+#define _GNU_SOURCE                   // For fopencookie().
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <zlib.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "compress.h"
+#include "pipeline.h"
+
+/*
+ * The parts of the zstd streaming API that are used, declared here since
+ * there is no zstd.h to include.  The structures and the values of
+ * ZSTD_EndDirective are part of the stable ABI of libzstd.so.1.
+ */
+typedef struct zstd_in {
+    const void *src;
+    size_t size;
+    size_t pos;
+} ZSTD_IN;
+
+typedef struct zstd_out {
+    void *dst;
+    size_t size;
+    size_t pos;
+} ZSTD_OUT;
+
+#define ZSTD_E_CONTINUE 0
+#define ZSTD_E_END 2
+
+static struct zstd_api {
+    void *library;
+    void *(*createDCtx)(void);
+    size_t (*decompressStream)(void *dctx, ZSTD_OUT *out, ZSTD_IN *in);
+    size_t (*freeDCtx)(void *dctx);
+    void *(*createCCtx)(void);
+    size_t (*compressStream2)(void *cctx, ZSTD_OUT *out, ZSTD_IN *in, int end);
+    size_t (*freeCCtx)(void *cctx);
+    unsigned (*isError)(size_t code);
+    const char *(*getErrorName)(size_t code);
+} zstd;
+
+static int loadZstd(void) {
+    if (zstd.library != NULL)
+        return 0;
+    void *library = dlopen("libzstd.so.1", RTLD_NOW | RTLD_LOCAL);
+    if (library == NULL) {
+        fprintf(stderr, "zstd is not available: %s\n", dlerror());
+        return 1;
+    }
+    zstd.createDCtx = (void *(*)(void))dlsym(library, "ZSTD_createDCtx");
+    zstd.decompressStream = (size_t (*)(void *, ZSTD_OUT *, ZSTD_IN *))dlsym(library, "ZSTD_decompressStream");
+    zstd.freeDCtx = (size_t (*)(void *))dlsym(library, "ZSTD_freeDCtx");
+    zstd.createCCtx = (void *(*)(void))dlsym(library, "ZSTD_createCCtx");
+    zstd.compressStream2 = (size_t (*)(void *, ZSTD_OUT *, ZSTD_IN *, int))dlsym(library, "ZSTD_compressStream2");
+    zstd.freeCCtx = (size_t (*)(void *))dlsym(library, "ZSTD_freeCCtx");
+    zstd.isError = (unsigned (*)(size_t))dlsym(library, "ZSTD_isError");
+    zstd.getErrorName = (const char *(*)(size_t))dlsym(library, "ZSTD_getErrorName");
+    if (zstd.createDCtx == NULL || zstd.decompressStream == NULL || zstd.freeDCtx == NULL
+        || zstd.createCCtx == NULL || zstd.compressStream2 == NULL || zstd.freeCCtx == NULL
+        || zstd.isError == NULL || zstd.getErrorName == NULL) {
+        fprintf(stderr, "zstd is not available: %s is missing functions\n", "libzstd.so.1");
+        dlclose(library);
+        return 1;
+    }
+    zstd.library = library;
+    return 0;
+}
+
+/*
+ * The descriptor of the input stream, together with the bytes that were
+ * read from it to identify the format, which are returned first.
+ */
+typedef struct input_source {
+    int fd;
+    unsigned char prefix[4];
+    size_t prefix_length;
+    size_t prefix_used;
+} INPUT_SOURCE;
+
+static ssize_t readSource(void *state, unsigned char *buffer, size_t size) {
+    INPUT_SOURCE *s = state;
+    if ((*s).prefix_used < (*s).prefix_length) {
+        size_t n = 0;
+        while (n < size && (*s).prefix_used < (*s).prefix_length)
+            *(buffer + n++) = *((*s).prefix + (*s).prefix_used++);
+        return n;
+    }
+    while (1) {
+        ssize_t n = read((*s).fd, buffer, size);
+        if (n >= 0 || errno != EINTR)
+            return n;
+    }
+}
+
+/*
+ * State of the decompressing producer.  "ended" is set when the stream
+ * (or, for concatenated streams, the last one seen) is complete, so that
+ * the end of the input can be told apart from truncation.
+ */
+typedef struct decoder {
+    INPUT_SOURCE source;
+    int format;
+    unsigned char *in;
+    size_t in_pos;
+    size_t in_length;
+    int eof;
+    int ended;
+    z_stream z;
+    void *dctx;
+} DECODER;
+
+/*
+ * ARGO_PRODUCER that decompresses into the pipeline's block.  Concatenated
+ * streams, as produced by "cat a.gz b.gz", are decompressed one after the
+ * other.
+ */
+static ssize_t decode(void *state, unsigned char *buffer, size_t size) {
+    DECODER *d = state;
+    size_t produced = 0;
+    while (produced == 0) {
+        if ((*d).in_pos == (*d).in_length && !(*d).eof) {
+            ssize_t n = readSource(&(*d).source, (*d).in, ARGO_COMPRESS_BUFFER);
+            if (n < 0) {
+                perror("Reading compressed input");
+                return -1;
+            }
+            (*d).eof = n == 0;
+            (*d).in_pos = 0;
+            (*d).in_length = n;
+        }
+        if ((*d).in_pos == (*d).in_length && (*d).eof) {
+            if (!(*d).ended) {
+                fprintf(stderr, "Compressed input is truncated\n");
+                return -1;
+            }
+            return 0;
+        }
+        if ((*d).format == ARGO_FORMAT_GZIP) {
+            if ((*d).ended) {
+                inflateReset(&(*d).z);
+                (*d).ended = 0;
+            }
+            (*d).z.next_in = (*d).in + (*d).in_pos;
+            (*d).z.avail_in = (*d).in_length - (*d).in_pos;
+            (*d).z.next_out = buffer + produced;
+            (*d).z.avail_out = size - produced;
+            int status = inflate(&(*d).z, Z_NO_FLUSH);
+            (*d).in_pos = (*d).in_length - (*d).z.avail_in;
+            produced = size - (*d).z.avail_out;
+            if (status == Z_STREAM_END) {
+                (*d).ended = 1;
+            } else if (status != Z_OK && status != Z_BUF_ERROR) {
+                fprintf(stderr, "Invalid gzip input: %s\n", (*d).z.msg != NULL ? (*d).z.msg : "error");
+                return -1;
+            }
+        } else {
+            ZSTD_IN in = {(*d).in, (*d).in_length, (*d).in_pos};
+            ZSTD_OUT out = {buffer, size, produced};
+            size_t status = zstd.decompressStream((*d).dctx, &out, &in);
+            if (zstd.isError(status)) {
+                fprintf(stderr, "Invalid zstd input: %s\n", zstd.getErrorName(status));
+                return -1;
+            }
+            (*d).in_pos = in.pos;
+            produced = out.pos;
+            (*d).ended = status == 0;
+        }
+    }
+    return produced;
+}
+
+/*
+ * ARGO_RELEASE for a DECODER.  It may also be given one whose
+ * decompressor was never set up, since a zeroed z_stream is refused by
+ * inflateEnd() without harm and "dctx" is then NULL.
+ */
+static void releaseDecoder(void *state) {
+    DECODER *d = state;
+    if ((*d).format == ARGO_FORMAT_GZIP)
+        inflateEnd(&(*d).z);
+    else if ((*d).dctx != NULL)
+        zstd.freeDCtx((*d).dctx);
+    free((*d).in);
+    free(d);
+}
+
+static int detectFormat(unsigned char *magic, ssize_t length) {
+    if (length >= 2 && *magic == 0x1F && *(magic + 1) == 0x8B)
+        return ARGO_FORMAT_GZIP;
+    if (length >= 4 && *magic == 0x28 && *(magic + 1) == 0xB5 && *(magic + 2) == 0x2F && *(magic + 3) == 0xFD)
+        return ARGO_FORMAT_ZSTD;
+    return ARGO_FORMAT_NONE;
+}
+
+/**
+ * @brief  Prepare to read a stream that may be compressed.
+ * @details  If the stream is compressed, or is not a regular file, a
+ * read-ahead pipeline is started for it, as described in compress.h.  A
+ * regular file that is not compressed is left to be read directly (and
+ * possibly mapped into memory).  Nothing must have been read from the
+ * stream beforehand.
+ *
+ * @param f  The stream to be read.
+ * @return  The format of the stream (ARGO_FORMAT_NONE if it is not
+ * compressed), or -1 on error.
+ */
+int argo_input_start(FILE *f) {
+    int fd = fileno(f);
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+        return -1;
+    int regular = S_ISREG(info.st_mode);
+    INPUT_SOURCE source = {.fd = fd};
+    ssize_t seen = 0;
+    if (regular) {
+        // Look without consuming, so that the file can still be mapped.
+        off_t offset = lseek(fd, 0, SEEK_CUR);
+        seen = offset < 0 ? 0 : pread(fd, source.prefix, sizeof(source.prefix), offset);
+    } else if (argo_pipeline_wanted(f)) {
+        while (source.prefix_length < sizeof(source.prefix)) {
+            ssize_t n = read(fd, source.prefix + source.prefix_length,
+                             sizeof(source.prefix) - source.prefix_length);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            source.prefix_length += n;
+        }
+        seen = source.prefix_length;
+    } else {
+        return ARGO_FORMAT_NONE;
+    }
+    int format = detectFormat(source.prefix, seen);
+    if (format == ARGO_FORMAT_NONE && regular)
+        return ARGO_FORMAT_NONE;
+    if (format == ARGO_FORMAT_NONE) {
+        INPUT_SOURCE *plain = malloc(sizeof(INPUT_SOURCE));
+        if (plain == NULL)
+            return -1;
+        *plain = source;
+        if (argo_pipeline_start(f, readSource, free, plain)) {
+            free(plain);
+            return -1;
+        }
+        return ARGO_FORMAT_NONE;
+    }
+    DECODER *d = calloc(1, sizeof(DECODER));
+    if (d == NULL || ((*d).in = malloc(ARGO_COMPRESS_BUFFER)) == NULL) {
+        free(d);
+        return -1;
+    }
+    (*d).source = source;
+    (*d).format = format;
+    int status = 0;
+    if (format == ARGO_FORMAT_GZIP)
+        status = inflateInit2(&(*d).z, 15 + 16) != Z_OK;
+    else
+        status = loadZstd() || ((*d).dctx = zstd.createDCtx()) == NULL;
+    if (status || argo_pipeline_start(f, decode, releaseDecoder, d)) {
+        releaseDecoder(d);
+        return -1;
+    }
+    return format;
+}
+
+/**
+ * @brief  Look up a compression format by name ("gzip" or "zstd").
+ *
+ * @return  The format, or -1 if the name is not known.
+ */
+int argo_format_named(char *name) {
+    char *names[] = {"gzip", "zstd"};
+    int formats[] = {ARGO_FORMAT_GZIP, ARGO_FORMAT_ZSTD};
+    for (int i = 0; i < 2; i++) {
+        char *a = name;
+        char *b = *(names + i);
+        while (*a != '\0' && *a == *b) {
+            a++;
+            b++;
+        }
+        if (*a == *b)
+            return *(formats + i);
+    }
+    return -1;
+}
+
+/*
+ * State of a compressing stream.
+ */
+typedef struct encoder {
+    FILE *out;
+    int format;
+    z_stream z;
+    void *cctx;
+    unsigned char *buffer;
+} ENCODER;
+
+/*
+ * Compress a chunk of output and write what the compressor produces.  With
+ * "finish" set, the compressed stream is completed.
+ */
+static int encode(ENCODER *e, const char *data, size_t size, int finish) {
+    if ((*e).format == ARGO_FORMAT_GZIP) {
+        (*e).z.next_in = (unsigned char *)data;
+        (*e).z.avail_in = size;
+        int status;
+        do {
+            (*e).z.next_out = (*e).buffer;
+            (*e).z.avail_out = ARGO_COMPRESS_BUFFER;
+            status = deflate(&(*e).z, finish ? Z_FINISH : Z_NO_FLUSH);
+            if (status == Z_STREAM_ERROR)
+                return 1;
+            size_t n = ARGO_COMPRESS_BUFFER - (*e).z.avail_out;
+            if (fwrite((*e).buffer, 1, n, (*e).out) != n)
+                return 1;
+        } while ((*e).z.avail_out == 0 || (finish && status != Z_STREAM_END));
+        return 0;
+    }
+    ZSTD_IN in = {data, size, 0};
+    size_t status;
+    do {
+        ZSTD_OUT out = {(*e).buffer, ARGO_COMPRESS_BUFFER, 0};
+        status = zstd.compressStream2((*e).cctx, &out, &in, finish ? ZSTD_E_END : ZSTD_E_CONTINUE);
+        if (zstd.isError(status)) {
+            fprintf(stderr, "zstd compression failed: %s\n", zstd.getErrorName(status));
+            return 1;
+        }
+        if (fwrite((*e).buffer, 1, out.pos, (*e).out) != out.pos)
+            return 1;
+    } while (finish ? status != 0 : in.pos < in.size);
+    return 0;
+}
+
+static ssize_t encoderWrite(void *cookie, const char *data, size_t size) {
+    return encode(cookie, data, size, 0) ? -1 : (ssize_t)size;
+}
+
+static int encoderClose(void *cookie) {
+    ENCODER *e = cookie;
+    int status = encode(e, NULL, 0, 1);
+    if ((*e).format == ARGO_FORMAT_GZIP)
+        deflateEnd(&(*e).z);
+    else
+        zstd.freeCCtx((*e).cctx);
+    if (fflush((*e).out) != 0)
+        status = 1;
+    free((*e).buffer);
+    free(e);
+    return status ? EOF : 0;
+}
+
+/**
+ * @brief  Open a stream that compresses what is written to it.
+ *
+ * @param out  The stream to which the compressed bytes are written.  It is
+ * flushed, but not closed, by argo_compress_close().
+ * @param format  ARGO_FORMAT_GZIP or ARGO_FORMAT_ZSTD.
+ * @return  The new stream, or NULL on error.
+ */
+FILE *argo_compress_open(FILE *out, int format) {
+    if (format == ARGO_FORMAT_ZSTD && loadZstd())
+        return NULL;
+    ENCODER *e = calloc(1, sizeof(ENCODER));
+    if (e == NULL || ((*e).buffer = malloc(ARGO_COMPRESS_BUFFER)) == NULL) {
+        free(e);
+        return NULL;
+    }
+    (*e).out = out;
+    (*e).format = format;
+    int status;
+    if (format == ARGO_FORMAT_GZIP)
+        status = deflateInit2(&(*e).z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                              Z_DEFAULT_STRATEGY) != Z_OK;
+    else
+        status = ((*e).cctx = zstd.createCCtx()) == NULL;
+    FILE *f = status ? NULL : fopencookie(e, "w", (cookie_io_functions_t){
+        .write = encoderWrite, .close = encoderClose});
+    if (f == NULL) {
+        free((*e).buffer);
+        free(e);
+        return NULL;
+    }
+    // Hand the compressor large chunks rather than stdio's default.
+    setvbuf(f, NULL, _IOFBF, ARGO_COMPRESS_BUFFER);
+    return f;
+}
+
+/**
+ * @brief  Complete and close a stream opened by argo_compress_open().
+ *
+ * @return  Zero if successful, nonzero if an error occurred.
+ */
+int argo_compress_close(FILE *f) {
+    return fclose(f) != 0;
+}
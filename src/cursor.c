@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "reader.h"
+#include "schema.h"
+#include "document.h"
+#include "hashcons.h"
+#include "edit.h"
+#include "cursor.h"
+
+/*
+ * Discard the element returned last, if any.  Its subtrees can no longer
+ * stand for those of later elements in hash-consing, and what
+ * argo_edit_write() kept about its slots no longer applies to them.
+ */
+static void recycle(ARGO_CURSOR *c) {
+    if (argo_next_value == (*c).mark)
+        return;
+    if ((size_t)(argo_next_value - (*c).mark) > (*c).peak)
+        (*c).peak = argo_next_value - (*c).mark;
+    if (argo_value_hashes != NULL)
+        for (int i = (*c).mark; i < argo_next_value; i++)
+            *(argo_value_hashes + i) = 0;
+    argo_hashcons_forget_subtrees();
+    argo_edit_forget();
+    argo_document_truncate((*c).mark);
+}
+
+/**
+ * @brief  Start reading the elements of an array from a stream.
+ * @details  The elements are read into argo_value_storage after whatever
+ * it already holds.
+ *
+ * @param c  The cursor.
+ * @param f  Input stream, positioned before the '[' of the array.
+ * @return  Zero if successful, nonzero if the input does not start with
+ * an array, in which case the cursor need not be closed.
+ */
+int argo_cursor_open(ARGO_CURSOR *c, FILE *f) {
+    *c = (ARGO_CURSOR){f, ARGO_CURSOR_FIRST, argo_next_value, 0, 0};
+    argo_reader_enter(f);
+    int ch = argo_getc_nonblank(f);
+    if (ch != ARGO_LBRACK) {
+        argo_schema_error("Expected '['", ch);
+        argo_reader_leave(f);
+        (*c).file = NULL;
+        (*c).state = ARGO_CURSOR_ERROR;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Read the next element of the array.
+ * @details  The element returned before is discarded first.
+ *
+ * @param c  The cursor.
+ * @return  The element, or NULL if the end of the array has been reached
+ * (the state is then ARGO_CURSOR_END) or the input is not valid (the state
+ * is then ARGO_CURSOR_ERROR, and a message has been printed).
+ */
+ARGO_VALUE *argo_cursor_next(ARGO_CURSOR *c) {
+    if ((*c).state == ARGO_CURSOR_END || (*c).state == ARGO_CURSOR_ERROR)
+        return NULL;
+    recycle(c);
+    FILE *f = (*c).file;
+    int ch = argo_getc_nonblank(f);
+    if ((*c).state == ARGO_CURSOR_MORE || ch == ARGO_RBRACK) {
+        if (ch == ARGO_RBRACK) {
+            (*c).state = ARGO_CURSOR_END;
+            return NULL;
+        }
+        if (ch != ARGO_COMMA) {
+            argo_schema_error("Expected ',' or ']' in array", ch);
+            (*c).state = ARGO_CURSOR_ERROR;
+            return NULL;
+        }
+    } else {
+        argo_ungetc(ch, f);
+    }
+    ARGO_VALUE *v = argo_read_value(f);
+    if (v == NULL) {
+        (*c).state = ARGO_CURSOR_ERROR;
+        return NULL;
+    }
+    (*c).state = ARGO_CURSOR_MORE;
+    (*c).index++;
+    return v;
+}
+
+/**
+ * @brief  Stop reading the array, and discard the element returned last.
+ * @details  The stream is left positioned after the last character read,
+ * which is the ']' if the end of the array was reached.
+ *
+ * @param c  The cursor.
+ * @return  Zero if the whole array was read, nonzero otherwise.
+ */
+int argo_cursor_close(ARGO_CURSOR *c) {
+    recycle(c);
+    if ((*c).file != NULL)
+        argo_reader_leave((*c).file);
+    (*c).file = NULL;
+    return (*c).state != ARGO_CURSOR_END;
+}
@@ -0,0 +1,582 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+#include "number.h"
+#include "options.h"
+#include "reader.h"
+#include "parallel.h"
+#include "pipeline.h"
+#include "compress.h"
+#include "hashcons.h"
+#include "diff.h"
+
+ARGO_DIFF_CONFIG argo_diff_config;
+
+/*
+ * Semantic hash of each value in argo_value_storage, valid for the values
+ * of the documents passed to the current argo_equal() or argo_diff().
+ */
+static unsigned long *hashes;
+
+/*
+ * Objects with more members than this are matched through a hash table;
+ * smaller ones by comparing names in turn.
+ */
+#define LINEAR_MEMBERS 8
+
+#define inStorage(v) ((v) >= argo_value_storage && (v) < argo_value_storage + NUM_ARGO_VALUES)
+
+/*
+ * Set when space ran out while comparing or diffing, after which values
+ * compare unequal and no more of the patch is written.
+ */
+static int failed;
+
+static unsigned long finish(unsigned long h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdUL;
+    h ^= h >> 33;
+    return h;
+}
+
+static ARGO_VALUE *listOf(ARGO_VALUE *v) {
+    return (*v).type == ARGO_OBJECT_TYPE ? (*v).content.object.member_list : (*v).content.array.element_list;
+}
+
+static unsigned long nameHash(ARGO_STRING *s) {
+    return argo_intern_hash((*s).content, (*s).length);
+}
+
+/*
+ * The value of a number, as a double with a single zero, or NaN if it has
+ * none; integers are also compared exactly by numbersEqual().
+ */
+static double numberValue(ARGO_NUMBER *n) {
+    if (argo_number_materialize(n))
+        return __builtin_nan("");
+    double x = (*n).valid_int ? (double)(*n).int_value : (*n).float_value;
+    return x == 0 ? 0.0 : x;
+}
+
+static int numbersEqual(ARGO_NUMBER *a, ARGO_NUMBER *b) {
+    if ((*a).valid_string && (*b).valid_string && argo_strings_equal(&(*a).string_value, &(*b).string_value))
+        return 1;
+    double x = numberValue(a);
+    double y = numberValue(b);
+    // Large integers that round to the same double still differ.
+    if ((*a).valid_int && (*b).valid_int)
+        return (*a).int_value == (*b).int_value;
+    return x == y;
+}
+
+static unsigned long computeHash(ARGO_VALUE *v);
+
+static unsigned long hashOf(ARGO_VALUE *v) {
+    if (hashes != NULL && inStorage(v))
+        return *(hashes + (v - argo_value_storage));
+    return computeHash(v);
+}
+
+static unsigned long computeHash(ARGO_VALUE *v) {
+    unsigned long h = argo_hash_mix(0, (*v).type);
+    switch ((*v).type) {
+    case ARGO_BASIC_TYPE:
+        return finish(argo_hash_mix(h, (*v).content.basic));
+    case ARGO_NUMBER_TYPE: {
+        union {
+            double d;
+            unsigned long bits;
+        } value = {.d = numberValue(&(*v).content.number)};
+        return finish(argo_hash_mix(h, value.bits));
+    }
+    case ARGO_STRING_TYPE:
+        return finish(argo_hash_mix(h, nameHash(&(*v).content.string)));
+    case ARGO_ARRAY_TYPE: {
+        ARGO_VALUE *sentinel = listOf(v);
+        for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+            h = argo_hash_mix(h, hashOf(e));
+        return finish(h);
+    }
+    case ARGO_OBJECT_TYPE: {
+        // A sum, so that the order of the members does not matter.
+        unsigned long sum = 0;
+        ARGO_VALUE *sentinel = listOf(v);
+        for (ARGO_VALUE *m = (*sentinel).next; m != sentinel; m = (*m).next)
+            sum += finish(argo_hash_mix(nameHash(&(*m).name), hashOf(m)));
+        return finish(argo_hash_mix(h, sum));
+    }
+    default:
+        return finish(h);
+    }
+}
+
+/*
+ * Compute and record the hashes of a tree, from the leaves up.
+ */
+static unsigned long prepare(ARGO_VALUE *v) {
+    if ((*v).type == ARGO_OBJECT_TYPE || (*v).type == ARGO_ARRAY_TYPE) {
+        ARGO_VALUE *sentinel = listOf(v);
+        for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+            prepare(e);
+    }
+    unsigned long h = computeHash(v);
+    if (inStorage(v))
+        *(hashes + (v - argo_value_storage)) = h;
+    return h;
+}
+
+static int prepareBoth(ARGO_VALUE *a, ARGO_VALUE *b) {
+    if (hashes == NULL) {
+        hashes = malloc(NUM_ARGO_VALUES * sizeof(unsigned long));
+        if (hashes == NULL) {
+            fprintf(stderr, "Failed to allocate space for hashes\n");
+            return 1;
+        }
+    }
+    prepare(a);
+    prepare(b);
+    return 0;
+}
+
+/*
+ * The members of an object, with the hashes of their names and, for a
+ * large object, an open-addressing table of their positions plus one.
+ */
+typedef struct member_index {
+    ARGO_VALUE **members;
+    unsigned long *names;
+    char *matched;
+    size_t count;
+    size_t *table;
+    size_t size;
+} MEMBER_INDEX;
+
+static void freeIndex(MEMBER_INDEX *ix) {
+    free((*ix).members);
+    free((*ix).names);
+    free((*ix).matched);
+    free((*ix).table);
+}
+
+static int indexMembers(ARGO_VALUE *object, MEMBER_INDEX *ix) {
+    *ix = (MEMBER_INDEX){0};
+    ARGO_VALUE *sentinel = listOf(object);
+    for (ARGO_VALUE *m = (*sentinel).next; m != sentinel; m = (*m).next)
+        (*ix).count++;
+    size_t n = (*ix).count > 0 ? (*ix).count : 1;
+    (*ix).members = malloc(n * sizeof(ARGO_VALUE *));
+    (*ix).names = malloc(n * sizeof(unsigned long));
+    (*ix).matched = calloc(n, 1);
+    if ((*ix).members == NULL || (*ix).names == NULL || (*ix).matched == NULL) {
+        freeIndex(ix);
+        fprintf(stderr, "Failed to allocate space for members\n");
+        return 1;
+    }
+    size_t i = 0;
+    for (ARGO_VALUE *m = (*sentinel).next; m != sentinel; m = (*m).next, i++) {
+        *((*ix).members + i) = m;
+        *((*ix).names + i) = nameHash(&(*m).name);
+    }
+    if ((*ix).count <= LINEAR_MEMBERS)
+        return 0;
+    (*ix).size = 16;
+    while ((*ix).size < 2 * (*ix).count)
+        (*ix).size *= 2;
+    (*ix).table = calloc((*ix).size, sizeof(size_t));
+    if ((*ix).table == NULL) {
+        freeIndex(ix);
+        fprintf(stderr, "Failed to allocate space for members\n");
+        return 1;
+    }
+    for (i = 0; i < (*ix).count; i++) {
+        size_t slot = *((*ix).names + i) & ((*ix).size - 1);
+        while (*((*ix).table + slot) != 0)
+            slot = (slot + 1) & ((*ix).size - 1);
+        *((*ix).table + slot) = i + 1;
+    }
+    return 0;
+}
+
+/*
+ * Find the first member with a given name that has not been matched yet.
+ * Returns its position, or -1 if there is none.
+ */
+static long findMember(MEMBER_INDEX *ix, ARGO_STRING *name) {
+    unsigned long h = nameHash(name);
+    if ((*ix).table == NULL) {
+        for (size_t i = 0; i < (*ix).count; i++)
+            if (!*((*ix).matched + i) && *((*ix).names + i) == h
+                && argo_strings_equal(&(**((*ix).members + i)).name, name))
+                return i;
+        return -1;
+    }
+    long found = -1;
+    size_t slot = h & ((*ix).size - 1);
+    while (*((*ix).table + slot) != 0) {
+        size_t i = *((*ix).table + slot) - 1;
+        // The members of one name all lie in the run of occupied slots
+        // that starts at the slot of the name; take the first unmatched.
+        if (!*((*ix).matched + i) && *((*ix).names + i) == h
+            && argo_strings_equal(&(**((*ix).members + i)).name, name) && (found < 0 || (long)i < found))
+            found = i;
+        slot = (slot + 1) & ((*ix).size - 1);
+    }
+    return found;
+}
+
+static int equalValues(ARGO_VALUE *a, ARGO_VALUE *b) {
+    if (a == b)
+        return 1;
+    if ((*a).type != (*b).type || hashOf(a) != hashOf(b))
+        return 0;
+    switch ((*a).type) {
+    case ARGO_BASIC_TYPE:
+        return (*a).content.basic == (*b).content.basic;
+    case ARGO_NUMBER_TYPE:
+        return numbersEqual(&(*a).content.number, &(*b).content.number);
+    case ARGO_STRING_TYPE:
+        return argo_strings_equal(&(*a).content.string, &(*b).content.string);
+    case ARGO_ARRAY_TYPE: {
+        ARGO_VALUE *sa = listOf(a);
+        ARGO_VALUE *sb = listOf(b);
+        ARGO_VALUE *ea = (*sa).next;
+        ARGO_VALUE *eb = (*sb).next;
+        while (ea != sa && eb != sb) {
+            if (!equalValues(ea, eb))
+                return 0;
+            ea = (*ea).next;
+            eb = (*eb).next;
+        }
+        return ea == sa && eb == sb;
+    }
+    case ARGO_OBJECT_TYPE: {
+        if (listOf(a) == listOf(b))
+            return 1;
+        MEMBER_INDEX ix;
+        if (indexMembers(b, &ix)) {
+            failed = 1;
+            return 0;
+        }
+        ARGO_VALUE *sa = listOf(a);
+        size_t count = 0;
+        int equal = 1;
+        for (ARGO_VALUE *m = (*sa).next; equal && m != sa; m = (*m).next, count++) {
+            long i = findMember(&ix, &(*m).name);
+            if (i < 0 || !equalValues(m, *(ix.members + i)))
+                equal = 0;
+            else
+                *(ix.matched + i) = 1;
+        }
+        equal = equal && count == ix.count;
+        freeIndex(&ix);
+        return equal;
+    }
+    default:
+        return 1;
+    }
+}
+
+/**
+ * @brief  Determine whether two values are semantically equal.
+ * @details  Objects are equal if they have members with the same names and
+ * equal values, in any order; arrays if they have equal elements in the
+ * same order; numbers if they have the same value.
+ *
+ * @return  1 if the values are equal, 0 if not, or -1 if there was not
+ * enough memory to compare them.
+ */
+int argo_equal(ARGO_VALUE *a, ARGO_VALUE *b) {
+    if (prepareBoth(a, b))
+        return -1;
+    failed = 0;
+    int equal = equalValues(a, b);
+    return failed ? -1 : equal;
+}
+
+/*
+ * State of the patch being written.
+ */
+static FILE *out;
+static long operations;
+static ARGO_STRING path;
+static int pretty;
+static size_t indent;
+static ARGO_SUBTREE_WRITER writeSubtree;
+
+static void lineBreak(size_t depth) {
+    if (!pretty)
+        return;
+    fputc(ARGO_LF, out);
+    for (size_t i = 0; i < depth * indent; i++)
+        fputc(ARGO_SPACE, out);
+}
+
+static void writeMemberName(char *name) {
+    fprintf(out, "\"%s\":", name);
+    if (pretty)
+        fputc(ARGO_SPACE, out);
+}
+
+static void emit(char *op, ARGO_VALUE *value) {
+    if (operations++ > 0)
+        fputc(ARGO_COMMA, out);
+    lineBreak(1);
+    fputc(ARGO_LBRACE, out);
+    lineBreak(2);
+    writeMemberName("op");
+    fprintf(out, "\"%s\",", op);
+    lineBreak(2);
+    writeMemberName("path");
+    argo_write_string(&path, out);
+    if (value != NULL) {
+        fputc(ARGO_COMMA, out);
+        lineBreak(2);
+        writeMemberName("value");
+        if (writeSubtree(value, 2, out))
+            failed = 1;
+    }
+    lineBreak(1);
+    fputc(ARGO_RBRACE, out);
+}
+
+/*
+ * Add a reference token to the path, escaped as RFC 6901 requires.
+ */
+static void pushName(ARGO_STRING *name) {
+    failed |= argo_append_char(&path, '/');
+    for (size_t i = 0; i < (*name).length; i++) {
+        ARGO_CHAR c = *((*name).content + i);
+        if (c == '~')
+            failed |= argo_append_char(&path, '~') | argo_append_char(&path, '0');
+        else if (c == '/')
+            failed |= argo_append_char(&path, '~') | argo_append_char(&path, '1');
+        else
+            failed |= argo_append_char(&path, c);
+    }
+}
+
+static void pushIndex(size_t index) {
+    char digits[24];
+    size_t used = sizeof(digits);
+    do {
+        *(digits + --used) = (char)(ARGO_DIGIT0 + index % 10);
+        index /= 10;
+    } while (index != 0);
+    failed |= argo_append_char(&path, '/');
+    while (used < sizeof(digits))
+        failed |= argo_append_char(&path, *(digits + used++));
+}
+
+static void diffValues(ARGO_VALUE *a, ARGO_VALUE *b);
+
+static void diffObjects(ARGO_VALUE *a, ARGO_VALUE *b) {
+    MEMBER_INDEX ix;
+    if (indexMembers(b, &ix)) {
+        failed = 1;
+        return;
+    }
+    ARGO_VALUE *sa = listOf(a);
+    size_t length = path.length;
+    for (ARGO_VALUE *m = (*sa).next; m != sa; m = (*m).next) {
+        long i = findMember(&ix, &(*m).name);
+        pushName(&(*m).name);
+        if (i < 0) {
+            emit("remove", NULL);
+        } else {
+            *(ix.matched + i) = 1;
+            diffValues(m, *(ix.members + i));
+        }
+        path.length = length;
+    }
+    for (size_t i = 0; i < ix.count; i++) {
+        if (*(ix.matched + i))
+            continue;
+        ARGO_VALUE *m = *(ix.members + i);
+        pushName(&(*m).name);
+        emit("add", m);
+        path.length = length;
+    }
+    freeIndex(&ix);
+}
+
+static ARGO_VALUE **elementsOf(ARGO_VALUE *array, size_t *count) {
+    ARGO_VALUE *sentinel = listOf(array);
+    *count = 0;
+    for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+        (*count)++;
+    ARGO_VALUE **elements = malloc((*count > 0 ? *count : 1) * sizeof(ARGO_VALUE *));
+    if (elements == NULL)
+        return NULL;
+    size_t i = 0;
+    for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+        *(elements + i++) = e;
+    return elements;
+}
+
+/*
+ * Equal elements at the start and at the end are left alone; the rest are
+ * paired up in order, and those left over at the end of the run are
+ * removed (last first, so that the indices stay valid) or added.
+ */
+static void diffArrays(ARGO_VALUE *a, ARGO_VALUE *b) {
+    size_t la, lb;
+    ARGO_VALUE **ea = elementsOf(a, &la);
+    ARGO_VALUE **eb = elementsOf(b, &lb);
+    if (ea == NULL || eb == NULL) {
+        fprintf(stderr, "Failed to allocate space for elements\n");
+        failed = 1;
+        free(ea);
+        free(eb);
+        return;
+    }
+    size_t shorter = la < lb ? la : lb;
+    size_t prefix = 0;
+    while (prefix < shorter && equalValues(*(ea + prefix), *(eb + prefix)))
+        prefix++;
+    size_t suffix = 0;
+    while (suffix < shorter - prefix && equalValues(*(ea + la - 1 - suffix), *(eb + lb - 1 - suffix)))
+        suffix++;
+    size_t ma = la - prefix - suffix;
+    size_t mb = lb - prefix - suffix;
+    size_t common = ma < mb ? ma : mb;
+    size_t length = path.length;
+    for (size_t i = 0; i < common; i++) {
+        pushIndex(prefix + i);
+        diffValues(*(ea + prefix + i), *(eb + prefix + i));
+        path.length = length;
+    }
+    for (size_t i = ma; i > common; i--) {
+        pushIndex(prefix + i - 1);
+        emit("remove", NULL);
+        path.length = length;
+    }
+    for (size_t i = common; i < mb; i++) {
+        pushIndex(prefix + i);
+        emit("add", *(eb + prefix + i));
+        path.length = length;
+    }
+    free(ea);
+    free(eb);
+}
+
+static void diffValues(ARGO_VALUE *a, ARGO_VALUE *b) {
+    if (failed || equalValues(a, b))
+        return;
+    if ((*a).type != (*b).type || ((*a).type != ARGO_OBJECT_TYPE && (*a).type != ARGO_ARRAY_TYPE))
+        emit("replace", b);
+    else if ((*a).type == ARGO_OBJECT_TYPE)
+        diffObjects(a, b);
+    else
+        diffArrays(a, b);
+}
+
+/**
+ * @brief  Write a JSON Patch that turns one value into another.
+ * @details  The patch is written in the layout that global_options
+ * selects for canonical output, as argo_write_value() would write it.
+ *
+ * @param from  The old value.
+ * @param to  The new value.
+ * @param f  Stream to which the patch is written.
+ * @return  The number of operations in the patch, which is zero if the
+ * values are equal, or -1 if there was an error.
+ */
+long argo_diff(ARGO_VALUE *from, ARGO_VALUE *to, FILE *f) {
+    if (prepareBoth(from, to))
+        return -1;
+    out = f;
+    operations = 0;
+    failed = 0;
+    path.length = 0;
+    pretty = (global_options & PRETTY_PRINT_OPTION) != 0;
+    indent = global_options & 0xFF;
+    writeSubtree = argo_subtree_writer();
+    fputc(ARGO_LBRACK, out);
+    diffValues(from, to);
+    if (operations > 0)
+        lineBreak(0);
+    fputc(ARGO_RBRACK, out);
+    if (pretty)
+        fputc(ARGO_LF, out);
+    return failed || ferror(out) ? -1 : operations;
+}
+
+/**
+ * @brief  Parse the arguments that follow --diff.
+ *
+ * @return  0 if they are valid, -1 if not.
+ */
+int argo_diff_args(int argc, char **argv) {
+    int options = CANONICALIZE_OPTION;
+    int index = 0;
+    while (index < argc && **(argv + index) == '-' && *(*(argv + index) + 1) != '\0') {
+        char *t = *(argv + index);
+        char *next = index + 1 < argc ? *(argv + index + 1) : NULL;
+        if (cmp(t, "-q") == 0 && !argo_diff_config.quiet) {
+            argo_diff_config.quiet = 1;
+        } else if (cmp(t, "-p") == 0 && (options & PRETTY_PRINT_OPTION) == 0) {
+            int used = argo_indent_option(next, &options);
+            if (used < 0)
+                return -1;
+            index += used;
+        } else if (cmp(t, "-u") == 0 && (options & UTF8_OUTPUT_OPTION) == 0) {
+            options |= UTF8_OUTPUT_OPTION;
+        } else {
+            return -1;
+        }
+        index++;
+    }
+    if (argc - index != 2)
+        return -1;
+    global_options |= options | DIFF_OPTION;
+    argo_diff_config.from = *(argv + index);
+    argo_diff_config.to = *(argv + index + 1);
+    return 0;
+}
+
+static ARGO_VALUE *readFile(char *name) {
+    FILE *f = fopen(name, "r");
+    if (f == NULL) {
+        perror(name);
+        return NULL;
+    }
+    ARGO_VALUE *v = NULL;
+    if (argo_input_start(f) >= 0) {
+        v = argo_read_value(f);
+        if (v != NULL && argo_read_end(f))
+            v = NULL;
+        argo_pipeline_stop();
+    }
+    fclose(f);
+    if (v == NULL)
+        fprintf(stderr, "%s: invalid JSON\n", name);
+    return v;
+}
+
+/**
+ * @brief  Compare the documents in two files, as --diff does.
+ *
+ * @return  0 if they are equal, 1 if they differ, 2 if either could not be
+ * read or the patch could not be written.
+ */
+int argo_diff_files(ARGO_DIFF_CONFIG *config) {
+    argo_intern_enabled = 1;
+    ARGO_VALUE *from = readFile((*config).from);
+    if (from == NULL)
+        return 2;
+    ARGO_VALUE *to = readFile((*config).to);
+    if (to == NULL)
+        return 2;
+    if ((*config).quiet) {
+        int equal = argo_equal(from, to);
+        return equal < 0 ? 2 : !equal;
+    }
+    long count = argo_diff(from, to, stdout);
+    if (fflush(stdout) != 0 || count < 0)
+        return 2;
+    return count > 0;
+}
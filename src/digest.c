@@ -0,0 +1,397 @@
+#define _GNU_SOURCE                   // For fopencookie().
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+#include "document.h"
+#include "options.h"
+#include "reader.h"
+#include "compress.h"
+#include "pipeline.h"
+#include "digest.h"
+
+ARGO_DIGEST_CONFIG argo_digest_config = {ARGO_DIGEST_SHA256, NULL, 0};
+
+/*
+ * Size of the buffer through which a digest stream takes its input.
+ */
+#define DIGEST_BUFFER 8192
+
+#define rotr32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define rotl64(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+static const uint32_t sha256Rounds[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static void sha256Block(uint32_t *state, const unsigned char *p) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++)
+        w[i] = (uint32_t)*(p + 4 * i) << 24 | (uint32_t)*(p + 4 * i + 1) << 16
+            | (uint32_t)*(p + 4 * i + 2) << 8 | (uint32_t)*(p + 4 * i + 3);
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotr32(w[i - 15], 7) ^ rotr32(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr32(w[i - 2], 17) ^ rotr32(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+    uint32_t a = *state, b = *(state + 1), c = *(state + 2), d = *(state + 3);
+    uint32_t e = *(state + 4), f = *(state + 5), g = *(state + 6), h = *(state + 7);
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (rotr32(e, 6) ^ rotr32(e, 11) ^ rotr32(e, 25)) + ((e & f) ^ (~e & g))
+            + sha256Rounds[i] + w[i];
+        uint32_t t2 = (rotr32(a, 2) ^ rotr32(a, 13) ^ rotr32(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    *state += a;
+    *(state + 1) += b;
+    *(state + 2) += c;
+    *(state + 3) += d;
+    *(state + 4) += e;
+    *(state + 5) += f;
+    *(state + 6) += g;
+    *(state + 7) += h;
+}
+
+#define XXH_PRIME1 0x9E3779B185EBCA87UL
+#define XXH_PRIME2 0xC2B2AE3D27D4EB4FUL
+#define XXH_PRIME3 0x165667B19E3779F9UL
+#define XXH_PRIME4 0x85EBCA77C2B2AE63UL
+#define XXH_PRIME5 0x27D4EB2F165667C5UL
+
+static uint64_t read64(const unsigned char *p) {
+    uint64_t x = 0;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    __builtin_memcpy(&x, p, 8);
+#else
+    for (int i = 7; i >= 0; i--)
+        x = x << 8 | *(p + i);
+#endif
+    return x;
+}
+
+static uint64_t xxhRound(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME2;
+    acc = rotl64(acc, 31);
+    return acc * XXH_PRIME1;
+}
+
+static uint64_t xxhMerge(uint64_t acc, uint64_t value) {
+    acc ^= xxhRound(0, value);
+    return acc * XXH_PRIME1 + XXH_PRIME4;
+}
+
+/*
+ * XXH64 consumes 32-byte stripes, SHA-256 64-byte blocks.
+ */
+static void xxh64Block(uint64_t *state, const unsigned char *p) {
+    for (int i = 0; i < 4; i++)
+        *(state + i) = xxhRound(*(state + i), read64(p + 8 * i));
+}
+
+#define blockSize(d) ((*(d)).algorithm == ARGO_DIGEST_SHA256 ? 64 : 32)
+
+/**
+ * @brief  Get the digest algorithm with a given name.
+ *
+ * @param name  "sha256" or "xxh64".
+ * @return  ARGO_DIGEST_SHA256 or ARGO_DIGEST_XXH64, or -1 if the name is
+ * neither.
+ */
+int argo_digest_named(char *name) {
+    char *names[] = {"sha256", "xxh64"};
+    int algorithms[] = {ARGO_DIGEST_SHA256, ARGO_DIGEST_XXH64};
+    for (int i = 0; i < 2; i++)
+        if (cmp(name, *(names + i)) == 0)
+            return *(algorithms + i);
+    return -1;
+}
+
+/**
+ * @brief  Start a digest.
+ *
+ * @param algorithm  ARGO_DIGEST_SHA256 or ARGO_DIGEST_XXH64.
+ */
+void argo_digest_init(ARGO_DIGEST *d, int algorithm) {
+    static const uint32_t sha256Initial[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    };
+    (*d).algorithm = algorithm;
+    (*d).length = 0;
+    (*d).used = 0;
+    if (algorithm == ARGO_DIGEST_SHA256) {
+        for (int i = 0; i < 8; i++)
+            (*d).state.sha256[i] = sha256Initial[i];
+    } else {
+        (*d).state.xxh64[0] = XXH_PRIME1 + XXH_PRIME2;
+        (*d).state.xxh64[1] = XXH_PRIME2;
+        (*d).state.xxh64[2] = 0;
+        (*d).state.xxh64[3] = -XXH_PRIME1;
+    }
+}
+
+static void digestBlock(ARGO_DIGEST *d, const unsigned char *p) {
+    if ((*d).algorithm == ARGO_DIGEST_SHA256)
+        sha256Block((*d).state.sha256, p);
+    else
+        xxh64Block((*d).state.xxh64, p);
+}
+
+/**
+ * @brief  Add bytes to a digest.
+ * @details  Whole blocks are hashed straight from "data"; only the bytes
+ * that do not make up a whole block are copied, to wait for the rest.
+ */
+void argo_digest_update(ARGO_DIGEST *d, const void *data, size_t size) {
+    const unsigned char *p = data;
+    size_t block = blockSize(d);
+    (*d).length += size;
+    if ((*d).used > 0) {
+        while (size > 0 && (*d).used < block) {
+            (*d).block[(*d).used++] = *p++;
+            size--;
+        }
+        if ((*d).used < block)
+            return;
+        digestBlock(d, (*d).block);
+        (*d).used = 0;
+    }
+    while (size >= block) {
+        digestBlock(d, p);
+        p += block;
+        size -= block;
+    }
+    while (size > 0) {
+        (*d).block[(*d).used++] = *p++;
+        size--;
+    }
+}
+
+static size_t sha256Final(ARGO_DIGEST *d, unsigned char *out) {
+    uint64_t bits = (*d).length * 8;
+    (*d).block[(*d).used++] = 0x80;
+    if ((*d).used > 56) {
+        while ((*d).used < 64)
+            (*d).block[(*d).used++] = 0;
+        sha256Block((*d).state.sha256, (*d).block);
+        (*d).used = 0;
+    }
+    while ((*d).used < 56)
+        (*d).block[(*d).used++] = 0;
+    for (int i = 0; i < 8; i++)
+        (*d).block[56 + i] = (unsigned char)(bits >> (56 - 8 * i));
+    sha256Block((*d).state.sha256, (*d).block);
+    for (int i = 0; i < 32; i++)
+        *(out + i) = (unsigned char)((*d).state.sha256[i / 4] >> (24 - 8 * (i % 4)));
+    return 32;
+}
+
+static size_t xxh64Final(ARGO_DIGEST *d, unsigned char *out) {
+    uint64_t *v = (*d).state.xxh64;
+    uint64_t h;
+    if ((*d).length >= 32) {
+        h = rotl64(*v, 1) + rotl64(*(v + 1), 7) + rotl64(*(v + 2), 12) + rotl64(*(v + 3), 18);
+        for (int i = 0; i < 4; i++)
+            h = xxhMerge(h, *(v + i));
+    } else {
+        h = XXH_PRIME5;
+    }
+    h += (*d).length;
+    unsigned char *p = (*d).block;
+    size_t left = (*d).used;
+    while (left >= 8) {
+        h ^= xxhRound(0, read64(p));
+        h = rotl64(h, 27) * XXH_PRIME1 + XXH_PRIME4;
+        p += 8;
+        left -= 8;
+    }
+    if (left >= 4) {
+        uint64_t x = (uint64_t)*p | (uint64_t)*(p + 1) << 8 | (uint64_t)*(p + 2) << 16
+            | (uint64_t)*(p + 3) << 24;
+        h ^= x * XXH_PRIME1;
+        h = rotl64(h, 23) * XXH_PRIME2 + XXH_PRIME3;
+        p += 4;
+        left -= 4;
+    }
+    while (left > 0) {
+        h ^= *p * XXH_PRIME5;
+        h = rotl64(h, 11) * XXH_PRIME1;
+        p++;
+        left--;
+    }
+    h ^= h >> 33;
+    h *= XXH_PRIME2;
+    h ^= h >> 29;
+    h *= XXH_PRIME3;
+    h ^= h >> 32;
+    for (int i = 0; i < 8; i++)
+        *(out + i) = (unsigned char)(h >> (56 - 8 * i));
+    return 8;
+}
+
+/**
+ * @brief  Finish a digest.
+ * @details  The digest is written most significant byte first, which for
+ * XXH64 is the order in which xxhsum(1) prints it.  The ARGO_DIGEST must be
+ * started again before it is used for anything else.
+ *
+ * @param out  Where the digest is written: at most ARGO_DIGEST_MAX bytes.
+ * @return  The number of bytes in the digest.
+ */
+size_t argo_digest_final(ARGO_DIGEST *d, unsigned char *out) {
+    if ((*d).algorithm == ARGO_DIGEST_SHA256)
+        return sha256Final(d, out);
+    return xxh64Final(d, out);
+}
+
+static ssize_t digestWrite(void *cookie, const char *data, size_t size) {
+    argo_digest_update(cookie, data, size);
+    return size;
+}
+
+/**
+ * @brief  Open a stream that adds whatever is written to it to a digest.
+ * @details  Closing the stream passes the last buffered bytes to the
+ * digest, which can then be finished with argo_digest_final().
+ *
+ * @param d  A digest that has been started with argo_digest_init().
+ * @return  The new stream, or NULL on error.
+ */
+FILE *argo_digest_open(ARGO_DIGEST *d) {
+    FILE *f = fopencookie(d, "w", (cookie_io_functions_t){.write = digestWrite});
+    if (f != NULL)
+        setvbuf(f, NULL, _IOFBF, DIGEST_BUFFER);
+    return f;
+}
+
+/**
+ * @brief  Compute the digest of the canonical output for a value.
+ * @details  The value is written with argo_write_value(), in the layout
+ * selected by global_options, to a stream opened by argo_digest_open().
+ *
+ * @param v  The value.
+ * @param algorithm  ARGO_DIGEST_SHA256 or ARGO_DIGEST_XXH64.
+ * @param out  Where the digest is written: at most ARGO_DIGEST_MAX bytes.
+ * @param length  Set to the number of bytes in the digest.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_digest_value(ARGO_VALUE *v, int algorithm, unsigned char *out, size_t *length) {
+    ARGO_DIGEST d;
+    argo_digest_init(&d, algorithm);
+    FILE *f = argo_digest_open(&d);
+    if (f == NULL)
+        return 1;
+    int status = argo_write_value(v, f);
+    if (fclose(f) != 0)
+        status = 1;
+    *length = argo_digest_final(&d, out);
+    return status;
+}
+
+/**
+ * @brief  Parse the arguments that follow --digest.
+ *
+ * @return  0 if they are valid, -1 if not.
+ */
+int argo_digest_args(int argc, char **argv) {
+    int options = CANONICALIZE_OPTION;
+    int algorithm = 0;
+    int index = 0;
+    while (index < argc && **(argv + index) == '-' && *(*(argv + index) + 1) != '\0') {
+        char *t = *(argv + index);
+        char *next = index + 1 < argc ? *(argv + index + 1) : NULL;
+        if (cmp(t, "-a") == 0 && algorithm == 0 && next != NULL) {
+            algorithm = argo_digest_named(next);
+            if (algorithm < 0)
+                return -1;
+            index++;
+        } else if (cmp(t, "-p") == 0 && (options & PRETTY_PRINT_OPTION) == 0) {
+            int used = argo_indent_option(next, &options);
+            if (used < 0)
+                return -1;
+            index += used;
+        } else if (cmp(t, "-u") == 0 && (options & UTF8_OUTPUT_OPTION) == 0) {
+            options |= UTF8_OUTPUT_OPTION;
+        } else if (cmp(t, "-k") == 0 && (options & SORT_KEYS_OPTION) == 0) {
+            options |= SORT_KEYS_OPTION;
+        } else {
+            return -1;
+        }
+        index++;
+    }
+    global_options |= options | DIGEST_OPTION;
+    if (algorithm != 0)
+        argo_digest_config.algorithm = algorithm;
+    argo_digest_config.paths = argv + index;
+    argo_digest_config.path_count = argc - index;
+    return 0;
+}
+
+/*
+ * Read the document in a file, or in standard input if "name" is NULL,
+ * write its digest and return zero, or return nonzero if it could not be
+ * read.
+ */
+static int digestFile(ARGO_DIGEST_CONFIG *config, char *name) {
+    FILE *f = name == NULL ? stdin : fopen(name, "r");
+    if (f == NULL) {
+        perror(name);
+        return 1;
+    }
+    argo_document_reset();
+    ARGO_VALUE *v = NULL;
+    if (argo_input_start(f) >= 0) {
+        v = argo_read_value(f);
+        if (v != NULL && argo_read_end(f))
+            v = NULL;
+        argo_pipeline_stop();
+    }
+    if (f != stdin)
+        fclose(f);
+    if (v == NULL) {
+        fprintf(stderr, "%s: invalid JSON\n", name == NULL ? "-" : name);
+        return 1;
+    }
+    unsigned char digest[ARGO_DIGEST_MAX];
+    size_t length;
+    if (argo_digest_value(v, (*config).algorithm, digest, &length))
+        return 1;
+    for (size_t i = 0; i < length; i++)
+        printf("%02x", digest[i]);
+    printf("  %s\n", name == NULL ? "-" : name);
+    return 0;
+}
+
+/**
+ * @brief  Write the digest of the document in each file, as --digest does.
+ *
+ * @return  0 if every document was read, 1 otherwise.
+ */
+int argo_digest_files(ARGO_DIGEST_CONFIG *config) {
+    argo_intern_enabled = 1;
+    int status = 0;
+    if ((*config).path_count == 0)
+        status = digestFile(config, NULL);
+    for (int i = 0; i < (*config).path_count; i++)
+        if (digestFile(config, *((*config).paths + i)))
+            status = 1;
+    if (fflush(stdout) != 0)
+        status = 1;
+    return status;
+}
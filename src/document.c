@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+#include "document.h"
+#include "hashcons.h"
+#include "edit.h"
+
+size_t argo_spare_count = 0;
+
+static ARGO_STRING *spares = NULL;
+static size_t sparesCapacity = 0;
+
+static void keepSpare(ARGO_STRING *s) {
+    if ((*s).capacity == 0)
+        return;
+    if (argo_spare_count == sparesCapacity) {
+        size_t newCapacity = sparesCapacity == 0 ? 256 : sparesCapacity * 2;
+        ARGO_STRING *newSpares = realloc(spares, newCapacity * sizeof(ARGO_STRING));
+        if (newSpares == NULL) {
+            free((*s).content);
+            return;
+        }
+        spares = newSpares;
+        sparesCapacity = newCapacity;
+    }
+    ARGO_STRING *spare = spares + argo_spare_count++;
+    (*spare).capacity = (*s).capacity;
+    (*spare).length = 0;
+    (*spare).content = (*s).content;
+}
+
+/**
+ * @brief  Discard the current document, keeping its storage for reuse.
+ * @details  Every slot of argo_value_storage used by the current document
+ * is returned to the empty state and argo_next_value is set back to zero.
+ * The buffers of the strings held by those slots (member names that are
+ * not interned, string values, and the text of numbers) become spares for
+ * argo_string_reuse().  They are kept in reverse order, so that the strings
+ * of the next document take the buffers of the strings that were read at
+ * the same point of the previous one, which are likely to be large enough.
+ * Interned names are left in the pool.
+ *
+ * Any ARGO_VALUE pointer into the discarded document becomes invalid.
+ */
+void argo_document_reset(void) {
+    argo_document_truncate(0);
+    argo_hashcons_clear();
+    argo_edit_forget();
+}
+
+/**
+ * @brief  Discard the values in the slots of argo_value_storage from a
+ * given one on.
+ * @details  This is argo_document_reset() for the tail of the storage: the
+ * slots from "mark" on are returned to the empty state, their buffers
+ * become spares, and argo_next_value is set to "mark".  Hash-consing uses
+ * it to give back the slots of a subtree that turned out to be a copy of
+ * one already read.
+ *
+ * @param mark  The first slot to discard.
+ */
+void argo_document_truncate(int mark) {
+    int index = argo_next_value;
+    while (index > mark) {
+        index--;
+        ARGO_VALUE *v = argo_value_storage + index;
+        if ((*v).type == ARGO_STRING_TYPE)
+            keepSpare(&(*v).content.string);
+        else if ((*v).type == ARGO_NUMBER_TYPE)
+            keepSpare(&(*v).content.number.string_value);
+        if (!argo_is_interned(&(*v).name))
+            keepSpare(&(*v).name);
+        *v = (ARGO_VALUE){0};
+    }
+    argo_next_value = mark;
+}
+
+/**
+ * @brief  Give an empty string a spare buffer, if there is one.
+ * @details  If the string has no buffer of its own and a spare buffer is
+ * available from a previous argo_document_reset(), the string takes it, so
+ * that appending to it does not allocate until the spare capacity has been
+ * used up.  Otherwise the string is left unchanged.
+ *
+ * @param s  The string that is about to be filled.
+ */
+void argo_string_reuse(ARGO_STRING *s) {
+    if ((*s).capacity != 0 || (*s).content != NULL || argo_spare_count == 0)
+        return;
+    *s = *(spares + --argo_spare_count);
+}
+
+/**
+ * @brief  Free every spare string buffer.
+ * @details  This is for a program that has finished reading documents
+ * and wants to give the memory back; it is never needed for correctness.
+ */
+void argo_document_release(void) {
+    while (argo_spare_count > 0)
+        free((*(spares + --argo_spare_count)).content);
+    free(spares);
+    spares = NULL;
+    sparesCapacity = 0;
+}
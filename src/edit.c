@@ -0,0 +1,671 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+#include "text.h"
+#include "options.h"
+#include "zerocopy.h"
+#include "hashcons.h"
+#include "sort.h"
+#include "edit.h"
+
+size_t argo_edit_encoded = 0;
+size_t argo_edit_copied = 0;
+
+/*
+ * Where each value lies in the last output of argo_edit_write(), indexed
+ * as argo_value_storage is.  The offset is from the start of the array or
+ * object that holds the value, so that a value copied in one piece keeps
+ * the offsets of everything inside it.
+ */
+#define EDIT_NONE 0                   // Not in the output: to be written afresh.
+#define EDIT_CLEAN 1                  // In the output, unchanged since.
+#define EDIT_DIRTY 2                  // In the output, but changed below.
+
+typedef struct edit_image {
+    size_t offset;
+    size_t length;
+    int state;
+} EDIT_IMAGE;
+
+static EDIT_IMAGE *images;
+static size_t imagedLimit;
+static char *image;
+static size_t imageLength;
+static ARGO_VALUE *imageRoot;
+static int imageOptions;
+
+/*
+ * The current step of the pointer being followed.
+ */
+static ARGO_STRING token;
+
+#define inStorage(v) ((v) >= argo_value_storage && (v) < argo_value_storage + NUM_ARGO_VALUES)
+#define slotOf(v) ((size_t)((v) - argo_value_storage))
+
+static ARGO_VALUE *listOf(ARGO_VALUE *v) {
+    if ((*v).type == ARGO_OBJECT_TYPE)
+        return (*v).content.object.member_list;
+    if ((*v).type == ARGO_ARRAY_TYPE)
+        return (*v).content.array.element_list;
+    return NULL;
+}
+
+static ARGO_VALUE *newValue(void) {
+    if (argo_next_value >= NUM_ARGO_VALUES) {
+        fprintf(stderr, "Too many values (limit is %d)\n", NUM_ARGO_VALUES);
+        return NULL;
+    }
+    ARGO_VALUE *v = argo_value_storage + argo_next_value++;
+    *v = (ARGO_VALUE){0};
+    return v;
+}
+
+static void setState(ARGO_VALUE *v, int state) {
+    if (images != NULL)
+        (*(images + slotOf(v))).state = state;
+}
+
+/*
+ * Note that a value on the path to a change has changed.
+ */
+static void touch(ARGO_VALUE *v) {
+    if (images != NULL && (*(images + slotOf(v))).state == EDIT_CLEAN)
+        (*(images + slotOf(v))).state = EDIT_DIRTY;
+    if (argo_value_hashes != NULL)
+        *(argo_value_hashes + slotOf(v)) = 0;
+}
+
+/*
+ * Forget where the literals of a subtree that was read from another source
+ * lie in the source.
+ */
+static void forgetSpans(ARGO_VALUE *v) {
+    if (argo_spans == NULL)
+        return;
+    *(argo_spans + slotOf(v)) = (ARGO_SOURCE_SPANS){0};
+    ARGO_VALUE *sentinel = listOf(v);
+    if (sentinel != NULL)
+        for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+            forgetSpans(e);
+}
+
+/*
+ * Make a string refer to the buffer of another without owning it.  A
+ * string with content and no capacity is never reused or freed (see
+ * argo_is_interned()).  Names are compared by pointer when both look
+ * interned, so a name that is not in the pool is copied instead.
+ */
+static void borrow(ARGO_STRING *s) {
+    if ((*s).content != NULL)
+        (*s).capacity = 0;
+}
+
+/*
+ * Give a container a list of its own in place of one it shares with other
+ * containers.  The members or elements are copied, but what they hold is
+ * not: an array or object among them shares its list with the member or
+ * element it was copied from, and the list is marked as shared.
+ */
+static int own(ARGO_VALUE *v) {
+    ARGO_VALUE *old = listOf(v);
+    if (old == NULL || !argo_hashcons_is_shared(old))
+        return 0;
+    ARGO_VALUE *sentinel = newValue();
+    if (sentinel == NULL)
+        return 1;
+    (*sentinel).next = sentinel;
+    (*sentinel).prev = sentinel;
+    argo_sort_forget(sentinel);
+    for (ARGO_VALUE *e = (*old).next; e != old; e = (*e).next) {
+        ARGO_VALUE *copy = newValue();
+        if (copy == NULL)
+            return 1;
+        *copy = *e;
+        if (!argo_is_interned(&(*e).name)) {
+            (*copy).name = (ARGO_STRING){0};
+            if (argo_append_chars(&(*copy).name, (*e).name.content, (*e).name.length, (*e).name.length))
+                return 1;
+        }
+        if ((*copy).type == ARGO_STRING_TYPE)
+            borrow(&(*copy).content.string);
+        else if ((*copy).type == ARGO_NUMBER_TYPE)
+            borrow(&(*copy).content.number.string_value);
+        if (listOf(copy) != NULL && argo_hashcons_mark_shared(listOf(copy)))
+            return 1;
+        (*copy).next = sentinel;
+        (*copy).prev = (*sentinel).prev;
+        (*(*sentinel).prev).next = copy;
+        (*sentinel).prev = copy;
+        setState(copy, EDIT_NONE);
+        if (argo_spans != NULL)
+            *(argo_spans + slotOf(copy)) = *(argo_spans + slotOf(e));
+        if (argo_value_hashes != NULL)
+            *(argo_value_hashes + slotOf(copy)) = *(argo_value_hashes + slotOf(e));
+    }
+    if ((*v).type == ARGO_OBJECT_TYPE)
+        (*v).content.object.member_list = sentinel;
+    else
+        (*v).content.array.element_list = sentinel;
+    return 0;
+}
+
+/**
+ * @brief  Decode one reference token of an RFC 6901 JSON Pointer.
+ * @details  The token starts at "p", just after its '/', and ends at the
+ * next '/' or at "end".  The escapes ~0 and ~1 are undone and the UTF-8
+ * encoding is decoded, so that "name" can be compared with member names.
+ *
+ * @param p  The start of the token.
+ * @param end  The end of the pointer.
+ * @param name  The string that receives the decoded token.
+ * @return  The position of the '/' or of "end" that ends the token, or
+ * NULL if the token is malformed.
+ */
+char *argo_pointer_token(char *p, char *end, ARGO_STRING *name) {
+    (*name).length = 0;
+    while (p < end && *p != '/') {
+        unsigned char c = *p++;
+        ARGO_CHAR x;
+        int more;
+        if (c == '~') {
+            if (p == end || (*p != '0' && *p != '1'))
+                return NULL;
+            x = *p++ == '0' ? '~' : '/';
+            more = 0;
+        } else if (c < 0x80) {
+            x = c;
+            more = 0;
+        } else if (c >= 0xC2 && c < 0xE0) {
+            x = c & 0x1F;
+            more = 1;
+        } else if (c >= 0xE0 && c < 0xF0) {
+            x = c & 0x0F;
+            more = 2;
+        } else if (c >= 0xF0 && c < 0xF5) {
+            x = c & 0x07;
+            more = 3;
+        } else {
+            return NULL;
+        }
+        while (more > 0) {
+            if (p == end || (*p & 0xC0) != 0x80)
+                return NULL;
+            x = x << 6 | (*p & 0x3F);
+            p++;
+            more--;
+        }
+        if (argo_append_char(name, x))
+            return NULL;
+    }
+    return p;
+}
+
+/*
+ * The end of a pointer given as a string.
+ */
+static char *pointerEnd(char *pointer) {
+    while (*pointer != '\0')
+        pointer++;
+    return pointer;
+}
+
+/*
+ * Parse "token" as an array index: -1 if it is not one, and the length of
+ * the array if it is "-", which names the place after the last element.
+ */
+static long tokenIndex(ARGO_VALUE *sentinel) {
+    if (token.length == 1 && *token.content == '-') {
+        long count = 0;
+        for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+            count++;
+        return count;
+    }
+    if (token.length == 0 || (token.length > 1 && *token.content == '0') || token.length > 18)
+        return -1;
+    long index = 0;
+    for (size_t i = 0; i < token.length; i++) {
+        ARGO_CHAR c = *(token.content + i);
+        if (!argo_is_digit(c))
+            return -1;
+        index = 10 * index + (c - '0');
+    }
+    return index;
+}
+
+/*
+ * Find the element of an array at an index, or the sentinel if the index
+ * is the length of the array, or NULL if it is beyond.
+ */
+static ARGO_VALUE *elementAt(ARGO_VALUE *sentinel, long index) {
+    if (index < 0)
+        return NULL;
+    ARGO_VALUE *e = (*sentinel).next;
+    while (index > 0 && e != sentinel) {
+        e = (*e).next;
+        index--;
+    }
+    return index == 0 ? e : NULL;
+}
+
+/*
+ * Find the value that the current step names in a container, or NULL if
+ * there is none.  With "end" set, the place after the last element of an
+ * array is named by its sentinel.
+ */
+static ARGO_VALUE *step(ARGO_VALUE *v, int end) {
+    if ((*v).type == ARGO_OBJECT_TYPE)
+        return argo_object_member(v, &token);
+    if ((*v).type != ARGO_ARRAY_TYPE)
+        return NULL;
+    ARGO_VALUE *sentinel = (*v).content.array.element_list;
+    ARGO_VALUE *e = elementAt(sentinel, tokenIndex(sentinel));
+    return e == sentinel && !end ? NULL : e;
+}
+
+/*
+ * Follow a pointer to the container that holds what it names, copying the
+ * shared lists and marking the containers on the way as changed, and leave
+ * the last step in "token".  The container is NULL if the pointer names
+ * the root.
+ */
+static int follow(ARGO_VALUE *root, char *pointer, ARGO_VALUE **container) {
+    if (!inStorage(root)) {
+        fprintf(stderr, "Document is not in argo_value_storage\n");
+        return 1;
+    }
+    argo_hashcons_forget_subtrees();
+    *container = NULL;
+    if (*pointer == '\0')
+        return 0;
+    if (*pointer != '/') {
+        fprintf(stderr, "Malformed pointer: %s\n", pointer);
+        return 1;
+    }
+    ARGO_VALUE *v = root;
+    char *p = pointer;
+    char *end = pointerEnd(pointer);
+    while (1) {
+        p = argo_pointer_token(p + 1, end, &token);
+        if (p == NULL) {
+            fprintf(stderr, "Malformed pointer: %s\n", pointer);
+            return 1;
+        }
+        if (own(v))
+            return 1;
+        touch(v);
+        if (p == end)
+            break;
+        v = step(v, 0);
+        if (v == NULL) {
+            fprintf(stderr, "No value at %s\n", pointer);
+            return 1;
+        }
+    }
+    if ((*v).type != ARGO_OBJECT_TYPE && (*v).type != ARGO_ARRAY_TYPE) {
+        fprintf(stderr, "No container at %s\n", pointer);
+        return 1;
+    }
+    *container = v;
+    return 0;
+}
+
+/**
+ * @brief  Find the value that a JSON Pointer names.
+ *
+ * @param root  The document.
+ * @param pointer  An RFC 6901 JSON Pointer.
+ * @return  The value, or NULL if there is none.
+ */
+ARGO_VALUE *argo_edit_find(ARGO_VALUE *root, char *pointer) {
+    ARGO_VALUE *v = root;
+    char *p = pointer;
+    char *end = pointerEnd(pointer);
+    while (p < end && *p == '/') {
+        p = argo_pointer_token(p + 1, end, &token);
+        if (p == NULL || (v = step(v, 0)) == NULL)
+            return NULL;
+    }
+    return p == end ? v : NULL;
+}
+
+static int checkNew(ARGO_VALUE *value) {
+    if (!inStorage(value) || (*value).next != NULL || (*value).prev != NULL) {
+        fprintf(stderr, "Value to be added is not a document by itself\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Give a value that is in the document the content of a new one, which is
+ * left holding the old content, to be reclaimed with the rest of the
+ * storage.
+ */
+static void replaceWith(ARGO_VALUE *target, ARGO_VALUE *value) {
+    ARGO_VALUE old = *target;
+    (*target).type = (*value).type;
+    (*target).content = (*value).content;
+    (*value).type = old.type;
+    (*value).content = old.content;
+    setState(target, EDIT_NONE);
+    if (argo_value_hashes != NULL)
+        *(argo_value_hashes + slotOf(target)) = *(argo_value_hashes + slotOf(value));
+    if (argo_spans != NULL) {
+        ARGO_SPAN name = (*(argo_spans + slotOf(target))).name;
+        forgetSpans(target);
+        (*(argo_spans + slotOf(target))).name = name;
+    }
+}
+
+/*
+ * Link a new value into a list before a given member or element, naming
+ * it with the current step if the list is that of an object.
+ */
+static int insertBefore(ARGO_VALUE *container, ARGO_VALUE *before, ARGO_VALUE *value) {
+    if ((*container).type == ARGO_OBJECT_TYPE) {
+        ARGO_STRING name = {0};
+        if (argo_append_chars(&name, token.content, token.length, token.length))
+            return 1;
+        (*value).name = name;
+    }
+    (*value).next = before;
+    (*value).prev = (*before).prev;
+    (*(*before).prev).next = value;
+    (*before).prev = value;
+    setState(value, EDIT_NONE);
+    forgetSpans(value);
+    return 0;
+}
+
+static void detach(ARGO_VALUE *v) {
+    (*(*v).prev).next = (*v).next;
+    (*(*v).next).prev = (*v).prev;
+    (*v).next = NULL;
+    (*v).prev = NULL;
+}
+
+/**
+ * @brief  Add a value to a document, as the "add" operation of a JSON
+ * Patch does.
+ * @details  If the pointer names a member of an object, the member is set
+ * to the value, replacing the first member of that name if there is one
+ * and following the last member otherwise.  If it names an element of an
+ * array, or the place after the last one ("-"), the value is inserted
+ * there.  If it names the root, the root is replaced.
+ *
+ * @param root  The document.
+ * @param pointer  An RFC 6901 JSON Pointer.
+ * @param value  The value to add, which becomes part of the document.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_edit_add(ARGO_VALUE *root, char *pointer, ARGO_VALUE *value) {
+    ARGO_VALUE *container;
+    if (checkNew(value) || follow(root, pointer, &container))
+        return 1;
+    if (container == NULL) {
+        replaceWith(root, value);
+        return 0;
+    }
+    ARGO_VALUE *target = step(container, 1);
+    if ((*container).type == ARGO_OBJECT_TYPE) {
+        if (target != NULL) {
+            replaceWith(target, value);
+            return 0;
+        }
+        argo_sort_forget((*container).content.object.member_list);
+        return insertBefore(container, (*container).content.object.member_list, value);
+    }
+    if (target == NULL) {
+        fprintf(stderr, "No place for a value at %s\n", pointer);
+        return 1;
+    }
+    return insertBefore(container, target, value);
+}
+
+/**
+ * @brief  Replace a value of a document, as the "replace" operation of a
+ * JSON Patch does.
+ *
+ * @param root  The document.
+ * @param pointer  An RFC 6901 JSON Pointer to a value that exists.
+ * @param value  The new value, which becomes part of the document.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_edit_replace(ARGO_VALUE *root, char *pointer, ARGO_VALUE *value) {
+    ARGO_VALUE *container;
+    if (checkNew(value) || follow(root, pointer, &container))
+        return 1;
+    ARGO_VALUE *target = container == NULL ? root : step(container, 0);
+    if (target == NULL) {
+        fprintf(stderr, "No value at %s\n", pointer);
+        return 1;
+    }
+    replaceWith(target, value);
+    return 0;
+}
+
+/**
+ * @brief  Remove a member of an object or an element of an array from a
+ * document, as the "remove" operation of a JSON Patch does.
+ *
+ * @param root  The document.
+ * @param pointer  An RFC 6901 JSON Pointer to a value that exists, other
+ * than the root.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_edit_remove(ARGO_VALUE *root, char *pointer) {
+    ARGO_VALUE *container;
+    if (follow(root, pointer, &container))
+        return 1;
+    ARGO_VALUE *target = container == NULL ? NULL : step(container, 0);
+    if (target == NULL) {
+        fprintf(stderr, "No value to remove at %s\n", pointer);
+        return 1;
+    }
+    detach(target);
+    if ((*container).type == ARGO_OBJECT_TYPE)
+        argo_sort_forget((*container).content.object.member_list);
+    return 0;
+}
+
+/**
+ * @brief  Remove and insert a run of elements of an array in a document.
+ * @details  The elements from "index" on, "remove" of them, are removed,
+ * and the values are inserted in their place, in order.
+ *
+ * @param root  The document.
+ * @param pointer  An RFC 6901 JSON Pointer to the array.
+ * @param index  Index of the first element to remove, or of the place to
+ * insert, which may be the length of the array.
+ * @param remove  Number of elements to remove.
+ * @param values  Values to insert, each of which becomes part of the
+ * document.
+ * @param count  Number of values to insert.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_edit_splice(ARGO_VALUE *root, char *pointer, size_t index, size_t remove,
+                     ARGO_VALUE **values, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        if (checkNew(*(values + i)))
+            return 1;
+    ARGO_VALUE *container;
+    if (follow(root, pointer, &container))
+        return 1;
+    ARGO_VALUE *array = container == NULL ? root : step(container, 0);
+    if (array == NULL || (*array).type != ARGO_ARRAY_TYPE) {
+        fprintf(stderr, "No array at %s\n", pointer);
+        return 1;
+    }
+    if (own(array))
+        return 1;
+    touch(array);
+    ARGO_VALUE *sentinel = (*array).content.array.element_list;
+    ARGO_VALUE *at = elementAt(sentinel, (long)index);
+    ARGO_VALUE *end = at;
+    for (size_t i = 0; end != NULL && i < remove; i++)
+        end = end == sentinel ? NULL : (*end).next;
+    if (end == NULL) {
+        fprintf(stderr, "Splice beyond the end of the array at %s\n", pointer);
+        return 1;
+    }
+    while (at != end) {
+        ARGO_VALUE *next = (*at).next;
+        detach(at);
+        at = next;
+    }
+    for (size_t i = 0; i < count; i++)
+        if (insertBefore(array, end, *(values + i)))
+            return 1;
+    return 0;
+}
+
+/*
+ * State of argo_edit_write() while it runs.
+ */
+static FILE *out;
+static int pretty;
+static size_t indent;
+static int sorted;
+
+static void writeIndent(size_t count) {
+    static const char spaces[] = "                                ";
+    fputc(ARGO_LF, out);
+    while (count > sizeof(spaces) - 1) {
+        fwrite(spaces, 1, sizeof(spaces) - 1, out);
+        count -= sizeof(spaces) - 1;
+    }
+    fwrite(spaces, 1, count, out);
+}
+
+/*
+ * Write a value at the given depth, and record where it lies relative to
+ * the start of its container.  A value that is unchanged is copied from
+ * the last output, where it starts at "old"; one that has changed below is
+ * written piece by piece, with its members or elements copied from the
+ * last output where they can be; and one that is new, or inside a new one
+ * ("fresh"), is written entirely.
+ */
+static int encode(ARGO_VALUE *v, size_t depth, size_t old, size_t parent, int fresh) {
+    size_t start = ftell(out);
+    EDIT_IMAGE *record = images + slotOf(v);
+    int state = fresh ? EDIT_NONE : (*record).state;
+    ARGO_VALUE *sentinel = listOf(v);
+    int status = 0;
+    if (state == EDIT_CLEAN) {
+        fwrite(image + old, 1, (*record).length, out);
+        argo_edit_copied += (*record).length;
+    } else if ((*v).type == ARGO_BASIC_TYPE && (*v).content.basic == ARGO_TRUE) {
+        fputs(ARGO_TRUE_TOKEN, out);
+    } else if ((*v).type == ARGO_BASIC_TYPE && (*v).content.basic == ARGO_FALSE) {
+        fputs(ARGO_FALSE_TOKEN, out);
+    } else if ((*v).type == ARGO_BASIC_TYPE && (*v).content.basic == ARGO_NULL) {
+        fputs(ARGO_NULL_TOKEN, out);
+    } else if ((*v).type == ARGO_NUMBER_TYPE) {
+        status = argo_write_number(&(*v).content.number, out);
+    } else if ((*v).type == ARGO_STRING_TYPE) {
+        status = argo_write_string(&(*v).content.string, out);
+    } else if (sentinel == NULL) {
+        status = 1;
+    } else {
+        int object = (*v).type == ARGO_OBJECT_TYPE;
+        int sort = sorted && object;
+        fputc(object ? ARGO_LBRACE : ARGO_LBRACK, out);
+        ARGO_VALUE *node = sort ? argo_sorted_first(sentinel) : (*sentinel).next;
+        while (node != sentinel && status == 0) {
+            if (pretty)
+                writeIndent((depth + 1) * indent);
+            if (object) {
+                status = argo_write_string(&(*node).name, out);
+                fputc(ARGO_COLON, out);
+                if (pretty)
+                    fputc(ARGO_SPACE, out);
+            }
+            if (status == 0)
+                status = encode(node, depth + 1, old + (*(images + slotOf(node))).offset, start,
+                                state == EDIT_NONE);
+            node = sort ? argo_sorted_next(sentinel, node) : (*node).next;
+            if (node != sentinel)
+                fputc(ARGO_COMMA, out);
+        }
+        if (pretty && (*sentinel).next != sentinel)
+            writeIndent(depth * indent);
+        fputc(object ? ARGO_RBRACE : ARGO_RBRACK, out);
+    }
+    if (state != EDIT_CLEAN)
+        argo_edit_encoded++;
+    (*record).offset = start - parent;
+    (*record).length = ftell(out) - start;
+    (*record).state = EDIT_CLEAN;
+    if (slotOf(v) >= imagedLimit)
+        imagedLimit = slotOf(v) + 1;
+    return status;
+}
+
+/**
+ * @brief  Write canonical JSON for a document, reusing what was written
+ * for it last time.
+ * @details  The output is that of argo_write_value(), in the layout that
+ * global_options selects.  What is written is also kept, in place of what
+ * was kept before, for the next call.
+ *
+ * @param root  The document, in argo_value_storage.
+ * @param f  Output stream to which JSON is to be written.
+ * @return  Zero if the operation is completely successful,
+ * nonzero if there is any error.
+ */
+int argo_edit_write(ARGO_VALUE *root, FILE *f) {
+    if (!inStorage(root))
+        return argo_write_value(root, f);
+    if (images == NULL) {
+        images = calloc(NUM_ARGO_VALUES, sizeof(EDIT_IMAGE));
+        if (images == NULL)
+            return argo_write_value(root, f);
+    }
+    char *text = NULL;
+    size_t length = 0;
+    out = open_memstream(&text, &length);
+    if (out == NULL)
+        return argo_write_value(root, f);
+    pretty = (global_options & PRETTY_PRINT_OPTION) != 0;
+    indent = pretty ? (size_t)(global_options & 0xFF) : 0;
+    sorted = (global_options & SORT_KEYS_OPTION) != 0;
+    int fresh = image == NULL || root != imageRoot || global_options != imageOptions;
+    argo_edit_encoded = 0;
+    argo_edit_copied = 0;
+    int status = encode(root, 0, 0, 0, fresh);
+    if (fclose(out) != 0)
+        status = 1;
+    out = NULL;
+    if (status) {
+        free(text);
+        argo_edit_forget();
+        return 1;
+    }
+    fwrite(text, 1, length, f);
+    if (pretty)
+        fputc(ARGO_LF, f);
+    free(image);
+    image = text;
+    imageLength = length;
+    imageRoot = root;
+    imageOptions = global_options;
+    return ferror(f) ? 1 : 0;
+}
+
+/**
+ * @brief  Forget the output kept by argo_edit_write().
+ * @details  This is called by argo_document_reset().
+ */
+void argo_edit_forget(void) {
+    free(image);
+    image = NULL;
+    imageLength = 0;
+    imageRoot = NULL;
+    for (size_t i = 0; i < imagedLimit; i++)
+        *(images + i) = (EDIT_IMAGE){0};
+    imagedLimit = 0;
+}
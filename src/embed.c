@@ -0,0 +1,270 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <float.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "number.h"
+#include "embed.h"
+
+/*
+ * Values of the document in the order they are emitted, and the position
+ * of each in that order, indexed by its slot in argo_value_storage.
+ */
+static ARGO_VALUE **order;
+static int *position;
+static int count;
+
+/*
+ * Text of all names, strings and numbers, with an open-addressing table of
+ * the texts already stored, so that each distinct text is emitted once.
+ */
+typedef struct text_entry {
+    size_t offset;
+    size_t length;
+    int used;
+} TEXT_ENTRY;
+
+static ARGO_CHAR *pool;
+static size_t poolLength;
+static size_t poolCapacity;
+static TEXT_ENTRY *texts;
+static size_t textsSize;
+static size_t textsUsed;
+
+static int visit(ARGO_VALUE *v) {
+    if (v < argo_value_storage || v >= argo_value_storage + NUM_ARGO_VALUES) {
+        fprintf(stderr, "Value is not in argo_value_storage\n");
+        return 1;
+    }
+    *(position + (v - argo_value_storage)) = count;
+    *(order + count++) = v;
+    if ((*v).type != ARGO_OBJECT_TYPE && (*v).type != ARGO_ARRAY_TYPE)
+        return 0;
+    ARGO_VALUE *sentinel = (*v).type == ARGO_OBJECT_TYPE
+        ? (*v).content.object.member_list : (*v).content.array.element_list;
+    *(position + (sentinel - argo_value_storage)) = count;
+    *(order + count++) = sentinel;
+    for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+        if (visit(e))
+            return 1;
+    return 0;
+}
+
+static size_t hashText(ARGO_CHAR *content, size_t length) {
+    size_t h = 14695981039346656037UL;
+    for (size_t i = 0; i < length; i++)
+        h = (h ^ (size_t)*(content + i)) * 1099511628211UL;
+    return h;
+}
+
+static int growTexts(void) {
+    size_t size = textsSize == 0 ? 1024 : 2 * textsSize;
+    TEXT_ENTRY *grown = calloc(size, sizeof(TEXT_ENTRY));
+    if (grown == NULL)
+        return 1;
+    for (size_t i = 0; i < textsSize; i++) {
+        TEXT_ENTRY *e = texts + i;
+        if (!(*e).used)
+            continue;
+        size_t slot = hashText(pool + (*e).offset, (*e).length) & (size - 1);
+        while ((*(grown + slot)).used)
+            slot = (slot + 1) & (size - 1);
+        *(grown + slot) = *e;
+    }
+    free(texts);
+    texts = grown;
+    textsSize = size;
+    return 0;
+}
+
+/*
+ * Find the offset in the pool of a text, adding it if it is not there.
+ */
+static int storeText(ARGO_STRING *s, size_t *offset) {
+    if (2 * (textsUsed + 1) > textsSize && growTexts())
+        return 1;
+    size_t slot = hashText((*s).content, (*s).length) & (textsSize - 1);
+    while ((*(texts + slot)).used) {
+        TEXT_ENTRY *e = texts + slot;
+        if ((*e).length == (*s).length) {
+            size_t i = 0;
+            while (i < (*s).length && *(pool + (*e).offset + i) == *((*s).content + i))
+                i++;
+            if (i == (*s).length) {
+                *offset = (*e).offset;
+                return 0;
+            }
+        }
+        slot = (slot + 1) & (textsSize - 1);
+    }
+    if (poolLength + (*s).length > poolCapacity) {
+        size_t capacity = poolCapacity == 0 ? 4096 : poolCapacity;
+        while (capacity < poolLength + (*s).length)
+            capacity *= 2;
+        ARGO_CHAR *grown = realloc(pool, capacity * sizeof(ARGO_CHAR));
+        if (grown == NULL)
+            return 1;
+        pool = grown;
+        poolCapacity = capacity;
+    }
+    for (size_t i = 0; i < (*s).length; i++)
+        *(pool + poolLength + i) = *((*s).content + i);
+    *(texts + slot) = (TEXT_ENTRY){poolLength, (*s).length, 1};
+    textsUsed++;
+    *offset = poolLength;
+    poolLength += (*s).length;
+    return 0;
+}
+
+static int writeText(ARGO_STRING *s, FILE *out) {
+    size_t offset = 0;
+    if ((*s).length == 0) {
+        fputs("{0}", out);
+        return 0;
+    }
+    if (storeText(s, &offset))
+        return 1;
+    fprintf(out, "S(%zu, %zu)", offset, (*s).length);
+    return 0;
+}
+
+static void writeDouble(double x, FILE *out) {
+    if (x > DBL_MAX)
+        fputs("__builtin_inf()", out);
+    else if (x < -DBL_MAX)
+        fputs("-__builtin_inf()", out);
+    else
+        fprintf(out, "%.17g", x);
+}
+
+/*
+ * Write a pointer to a value as a reference to its entry.  The outermost
+ * value is on no list, and its links are null.
+ */
+static void writeLink(ARGO_VALUE *p, FILE *out) {
+    if (p == NULL)
+        fputs("NULL", out);
+    else
+        fprintf(out, "V(%d)", *(position + (p - argo_value_storage)));
+}
+
+static int writeEntry(ARGO_VALUE *v, FILE *out) {
+    static char *typeNames[] = {
+        "ARGO_NO_TYPE", "ARGO_BASIC_TYPE", "ARGO_NUMBER_TYPE",
+        "ARGO_STRING_TYPE", "ARGO_OBJECT_TYPE", "ARGO_ARRAY_TYPE"
+    };
+    static char *basicNames[] = {"ARGO_NULL", "ARGO_TRUE", "ARGO_FALSE"};
+    fprintf(out, "    {%s, ", typeNames[(*v).type]);
+    writeLink((*v).next, out);
+    fputs(", ", out);
+    writeLink((*v).prev, out);
+    fputs(", ", out);
+    if (writeText(&(*v).name, out))
+        return 1;
+    switch ((*v).type) {
+    case ARGO_BASIC_TYPE:
+        fprintf(out, ", .content.basic = %s", basicNames[(*v).content.basic]);
+        break;
+    case ARGO_NUMBER_TYPE: {
+        ARGO_NUMBER *n = &(*v).content.number;
+        argo_number_materialize(n);
+        fputs(", .content.number = {", out);
+        if (writeText(&(*n).string_value, out))
+            return 1;
+        fprintf(out, ", %ldL, ", (*n).valid_int ? (*n).int_value : 0);
+        writeDouble((*n).float_value, out);
+        fprintf(out, ", %d, %d, %d}", (*n).valid_string, (*n).valid_int, (*n).valid_float);
+        break;
+    }
+    case ARGO_STRING_TYPE:
+        fputs(", .content.string = ", out);
+        if (writeText(&(*v).content.string, out))
+            return 1;
+        break;
+    case ARGO_OBJECT_TYPE:
+        fputs(", .content.object = {", out);
+        writeLink((*v).content.object.member_list, out);
+        fputc('}', out);
+        break;
+    case ARGO_ARRAY_TYPE:
+        fputs(", .content.array = {", out);
+        writeLink((*v).content.array.element_list, out);
+        fputc('}', out);
+        break;
+    default:
+        break;
+    }
+    fputs("},\n", out);
+    return 0;
+}
+
+static void release(void) {
+    free(order);
+    free(position);
+    free(pool);
+    free(texts);
+    order = NULL;
+    position = NULL;
+    pool = NULL;
+    texts = NULL;
+    count = 0;
+    poolLength = poolCapacity = textsSize = textsUsed = 0;
+}
+
+/**
+ * @brief  Write a C source file that defines a document as static data.
+ * @details  The file defines "ARGO_VALUE *const NAME", pointing to the
+ * document, and nothing else with external linkage.  The value must be
+ * held in argo_value_storage, as argo_read_value() leaves it.  The binary
+ * forms of its numbers are computed, if they were not already.
+ *
+ * @param v  The document.
+ * @param name  The C identifier by which the document is to be known.
+ * @param origin  Where the document came from, for a comment in the file.
+ * @param out  Stream to which the source is written.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_embed_write(ARGO_VALUE *v, char *name, char *origin, FILE *out) {
+    order = malloc(NUM_ARGO_VALUES * sizeof(ARGO_VALUE *));
+    position = malloc(NUM_ARGO_VALUES * sizeof(int));
+    if (order == NULL || position == NULL || visit(v)) {
+        release();
+        return 1;
+    }
+    // The values are formatted first, since that is what fills the pool of
+    // text that has to be defined before them.
+    char *entries = NULL;
+    size_t entriesLength = 0;
+    FILE *buffer = open_memstream(&entries, &entriesLength);
+    if (buffer == NULL) {
+        release();
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (writeEntry(*(order + i), buffer)) {
+            fclose(buffer);
+            free(entries);
+            release();
+            return 1;
+        }
+    }
+    fclose(buffer);
+    fprintf(out, "/* Generated by bin/argo_embed from %s.  Do not edit. */\n", origin);
+    fputs("#include <stddef.h>\n\n#include \"argo.h\"\n#include \"embed.h\"\n\n", out);
+    fprintf(out, "static const ARGO_CHAR text[%zu] = {", poolLength > 0 ? poolLength : 1);
+    for (size_t i = 0; i < poolLength; i++)
+        fprintf(out, "%s%d,", i % 16 == 0 ? "\n    " : " ", *(pool + i));
+    fputs(poolLength > 0 ? "\n};\n\n" : "0};\n\n", out);
+    fprintf(out, "static const ARGO_VALUE values[%d];\n\n", count);
+    fputs("#define V(i) ((ARGO_VALUE *)values + (i))\n", out);
+    fputs("#define S(offset, length) ARGO_EMBED_STRING(text, offset, length)\n\n", out);
+    fprintf(out, "static const ARGO_VALUE values[%d] = {\n", count);
+    fwrite(entries, 1, entriesLength, out);
+    fputs("};\n\n", out);
+    free(entries);
+    fprintf(out, "ARGO_VALUE *const %s = (ARGO_VALUE *)values;\n", name);
+    release();
+    return ferror(out) ? 1 : 0;
+}
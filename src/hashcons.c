@@ -0,0 +1,353 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+#include "document.h"
+#include "hashcons.h"
+
+int argo_hashcons_enabled = 0;
+unsigned long *argo_value_hashes = NULL;
+size_t argo_hashcons_shared = 0;
+size_t argo_hashcons_saved = 0;
+
+/*
+ * Containers read so far in the current document, by hash, in an
+ * open-addressing table, and the number of slots of argo_value_hashes that
+ * may be nonzero.
+ */
+typedef struct hashcons_entry {
+    unsigned long hash;
+    ARGO_VALUE *value;
+} HASHCONS_ENTRY;
+
+static HASHCONS_ENTRY *table;
+static size_t tableSize;
+static size_t tableUsed;
+static size_t hashedLimit;
+
+/*
+ * Sentinels of the lists that more than one container has been given,
+ * marked by slot, and the number of slots that may be marked.
+ */
+static unsigned char *sharedLists;
+static size_t sharedLimit;
+
+#define inStorage(v) ((v) >= argo_value_storage && (v) < argo_value_storage + NUM_ARGO_VALUES)
+
+/**
+ * @brief  Combine a hash with one more value.
+ * @details  The result depends on the order in which values are combined.
+ *
+ * @param h  The hash so far.
+ * @param x  The value to add to it.
+ * @return  The combined hash.
+ */
+unsigned long argo_hash_mix(unsigned long h, unsigned long x) {
+    return h ^ (x + 0x9e3779b97f4a7c15UL + (h << 6) + (h >> 2));
+}
+
+static unsigned long cachedHash(ARGO_VALUE *v) {
+    if (argo_value_hashes != NULL && inStorage(v))
+        return *(argo_value_hashes + (v - argo_value_storage));
+    return 0;
+}
+
+static ARGO_VALUE *listOf(ARGO_VALUE *v) {
+    if ((*v).type == ARGO_OBJECT_TYPE)
+        return (*v).content.object.member_list;
+    if ((*v).type == ARGO_ARRAY_TYPE)
+        return (*v).content.array.element_list;
+    return NULL;
+}
+
+/**
+ * @brief  Compare the contents of two strings.
+ * @details  Unlike argo_names_equal(), this does not assume that two
+ * interned strings with different contents pointers differ.
+ *
+ * @return  Nonzero if the strings have the same characters.
+ */
+int argo_strings_equal(ARGO_STRING *a, ARGO_STRING *b) {
+    if ((*a).length != (*b).length)
+        return 0;
+    if ((*a).content == (*b).content)
+        return 1;
+    for (size_t i = 0; i < (*a).length; i++)
+        if (*((*a).content + i) != *((*b).content + i))
+            return 0;
+    return 1;
+}
+
+/*
+ * Numbers are compared by their text if they have one; a number built
+ * without text is compared by its binary value.
+ */
+static int numbersEqual(ARGO_NUMBER *a, ARGO_NUMBER *b) {
+    if ((*a).valid_string || (*b).valid_string)
+        return (*a).valid_string && (*b).valid_string && argo_strings_equal(&(*a).string_value, &(*b).string_value);
+    if ((*a).valid_int || (*b).valid_int)
+        return (*a).valid_int && (*b).valid_int && (*a).int_value == (*b).int_value;
+    return (*a).valid_float && (*b).valid_float && (*a).float_value == (*b).float_value;
+}
+
+static unsigned long numberHash(ARGO_NUMBER *n) {
+    if ((*n).valid_string)
+        return argo_intern_hash((*n).string_value.content, (*n).string_value.length);
+    if ((*n).valid_int)
+        return (unsigned long)(*n).int_value;
+    union {
+        double d;
+        unsigned long bits;
+    } value = {.d = (*n).float_value};
+    return value.bits;
+}
+
+/*
+ * Hash a value from its content and the hashes of its children, which are
+ * taken from argo_value_hashes when they are known.
+ */
+static unsigned long computeHash(ARGO_VALUE *v) {
+    unsigned long h = argo_hash_mix(0, (*v).type);
+    switch ((*v).type) {
+    case ARGO_BASIC_TYPE:
+        h = argo_hash_mix(h, (*v).content.basic);
+        break;
+    case ARGO_NUMBER_TYPE:
+        h = argo_hash_mix(h, numberHash(&(*v).content.number));
+        break;
+    case ARGO_STRING_TYPE:
+        h = argo_hash_mix(h, argo_intern_hash((*v).content.string.content, (*v).content.string.length));
+        break;
+    case ARGO_OBJECT_TYPE:
+    case ARGO_ARRAY_TYPE: {
+        ARGO_VALUE *sentinel = listOf(v);
+        for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next) {
+            if ((*v).type == ARGO_OBJECT_TYPE)
+                h = argo_hash_mix(h, argo_intern_hash((*e).name.content, (*e).name.length));
+            h = argo_hash_mix(h, argo_value_hash(e));
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdUL;
+    h ^= h >> 33;
+    // Zero means "unknown" in argo_value_hashes.
+    return h == 0 ? 1 : h;
+}
+
+/**
+ * @brief  Compute the structural hash of a value.
+ * @details  The hash depends only on the type and content of the value
+ * and, for an array or object, on the names and hashes of its members or
+ * elements, in order.  Values that argo_subtree_equal() finds equal have
+ * equal hashes.  The hash recorded while reading is returned if there is
+ * one; otherwise the hash is computed, which takes time proportional to
+ * the size of the subtree.
+ *
+ * @param v  The value.
+ * @return  Its hash, which is never zero.
+ */
+unsigned long argo_value_hash(ARGO_VALUE *v) {
+    unsigned long h = cachedHash(v);
+    return h != 0 ? h : computeHash(v);
+}
+
+/**
+ * @brief  Determine whether two values are equal.
+ * @details  Values are equal if they have the same type and content, and,
+ * for arrays and objects, equal elements or members with the same names,
+ * in the same order.  Numbers are compared by their text.  Values whose
+ * hashes were recorded while reading are unequal at once if those hashes
+ * differ, and arrays or objects that share their list (as identical ones
+ * do after hash-consing) are equal at once.
+ *
+ * @return  Nonzero if the values are equal, zero otherwise.
+ */
+int argo_subtree_equal(ARGO_VALUE *a, ARGO_VALUE *b) {
+    if (a == b)
+        return 1;
+    if ((*a).type != (*b).type)
+        return 0;
+    unsigned long ha = cachedHash(a);
+    unsigned long hb = cachedHash(b);
+    if (ha != 0 && hb != 0 && ha != hb)
+        return 0;
+    switch ((*a).type) {
+    case ARGO_BASIC_TYPE:
+        return (*a).content.basic == (*b).content.basic;
+    case ARGO_NUMBER_TYPE:
+        return numbersEqual(&(*a).content.number, &(*b).content.number);
+    case ARGO_STRING_TYPE:
+        return argo_strings_equal(&(*a).content.string, &(*b).content.string);
+    case ARGO_OBJECT_TYPE:
+    case ARGO_ARRAY_TYPE: {
+        ARGO_VALUE *sa = listOf(a);
+        ARGO_VALUE *sb = listOf(b);
+        if (sa == sb)
+            return 1;
+        ARGO_VALUE *ea = (*sa).next;
+        ARGO_VALUE *eb = (*sb).next;
+        while (ea != sa && eb != sb) {
+            if ((*a).type == ARGO_OBJECT_TYPE && !argo_strings_equal(&(*ea).name, &(*eb).name))
+                return 0;
+            if (!argo_subtree_equal(ea, eb))
+                return 0;
+            ea = (*ea).next;
+            eb = (*eb).next;
+        }
+        return ea == sa && eb == sb;
+    }
+    default:
+        return 1;
+    }
+}
+
+static int growTable(void) {
+    size_t size = tableSize == 0 ? 1024 : 2 * tableSize;
+    HASHCONS_ENTRY *grown = calloc(size, sizeof(HASHCONS_ENTRY));
+    if (grown == NULL) {
+        fprintf(stderr, "[%d] Failed to allocate space for subtree table\n", argo_lines_read);
+        return 1;
+    }
+    for (size_t i = 0; i < tableSize; i++) {
+        HASHCONS_ENTRY *e = table + i;
+        if ((*e).value == NULL)
+            continue;
+        size_t slot = (*e).hash & (size - 1);
+        while ((*(grown + slot)).value != NULL)
+            slot = (slot + 1) & (size - 1);
+        *(grown + slot) = *e;
+    }
+    free(table);
+    table = grown;
+    tableSize = size;
+    return 0;
+}
+
+/**
+ * @brief  Record the hash of a value that has just been read, and share
+ * it with an identical array or object read earlier.
+ * @details  This is called by argo_read_value() for each value, after the
+ * value's children, when argo_hashcons_enabled is set.  If the value is an
+ * array or object identical to one already in the table, it is given that
+ * one's list, and the slots of argo_value_storage from its own sentinel on,
+ * which hold nothing but its copy of the list, are discarded with
+ * argo_document_truncate().  Otherwise an array or object is entered in
+ * the table.
+ *
+ * @param v  The value, in argo_value_storage.
+ * @return  Zero if successful, nonzero if out of memory.
+ */
+int argo_hashcons_value(ARGO_VALUE *v) {
+    if (argo_value_hashes == NULL) {
+        argo_value_hashes = calloc(NUM_ARGO_VALUES, sizeof(unsigned long));
+        if (argo_value_hashes == NULL) {
+            fprintf(stderr, "[%d] Failed to allocate space for hashes\n", argo_lines_read);
+            return 1;
+        }
+    }
+    size_t index = v - argo_value_storage;
+    unsigned long h = computeHash(v);
+    *(argo_value_hashes + index) = h;
+    if (index >= hashedLimit)
+        hashedLimit = index + 1;
+    ARGO_VALUE *sentinel = listOf(v);
+    if (sentinel == NULL)
+        return 0;
+    if (2 * (tableUsed + 1) > tableSize && growTable())
+        return 1;
+    size_t slot = h & (tableSize - 1);
+    while ((*(table + slot)).value != NULL) {
+        HASHCONS_ENTRY *e = table + slot;
+        if ((*e).hash == h && argo_subtree_equal((*e).value, v)) {
+            int mark = sentinel - argo_value_storage;
+            size_t end = argo_next_value;
+            if (argo_hashcons_mark_shared(listOf((*e).value)))
+                return 1;
+            if ((*v).type == ARGO_OBJECT_TYPE)
+                (*v).content.object.member_list = listOf((*e).value);
+            else
+                (*v).content.array.element_list = listOf((*e).value);
+            for (size_t i = mark; i < end && i < hashedLimit; i++)
+                *(argo_value_hashes + i) = 0;
+            argo_document_truncate(mark);
+            argo_hashcons_shared++;
+            argo_hashcons_saved += end - mark;
+            return 0;
+        }
+        slot = (slot + 1) & (tableSize - 1);
+    }
+    *(table + slot) = (HASHCONS_ENTRY){h, v};
+    tableUsed++;
+    return 0;
+}
+
+/**
+ * @brief  Note that a list belongs to more than one container.
+ *
+ * @param sentinel  The sentinel of the list of members or elements.
+ * @return  Zero if successful, nonzero otherwise.
+ */
+int argo_hashcons_mark_shared(ARGO_VALUE *sentinel) {
+    if (!inStorage(sentinel))
+        return 0;
+    if (sharedLists == NULL && (sharedLists = calloc(NUM_ARGO_VALUES, 1)) == NULL) {
+        fprintf(stderr, "[%d] Failed to allocate space for hashes\n", argo_lines_read);
+        return 1;
+    }
+    size_t shared = sentinel - argo_value_storage;
+    *(sharedLists + shared) = 1;
+    if (shared >= sharedLimit)
+        sharedLimit = shared + 1;
+    return 0;
+}
+
+/**
+ * @brief  Determine whether a list belongs to more than one container.
+ * @details  A list that hash-consing has given to a second container is
+ * reachable from several places, and has to be copied before one of them
+ * is changed (see edit.h).
+ *
+ * @param sentinel  The sentinel of the list of members or elements.
+ * @return  Nonzero if the list is shared, zero otherwise.
+ */
+int argo_hashcons_is_shared(ARGO_VALUE *sentinel) {
+    if (sharedLists == NULL || !inStorage(sentinel))
+        return 0;
+    return *(sharedLists + (sentinel - argo_value_storage));
+}
+
+/**
+ * @brief  Forget the subtrees read so far, so that no value read from now
+ * on is given the list of one of them.
+ * @details  This is called when a document is changed (see edit.h): the
+ * subtrees in the table may no longer hold what they held when they were
+ * read, so they can no longer stand for what is read next.
+ */
+void argo_hashcons_forget_subtrees(void) {
+    for (size_t i = 0; i < tableSize; i++)
+        *(table + i) = (HASHCONS_ENTRY){0};
+    tableUsed = 0;
+}
+
+/**
+ * @brief  Forget the subtrees and hashes of the current document.
+ * @details  This is called by argo_document_reset().
+ */
+void argo_hashcons_clear(void) {
+    argo_hashcons_forget_subtrees();
+    for (size_t i = 0; i < hashedLimit; i++)
+        *(argo_value_hashes + i) = 0;
+    hashedLimit = 0;
+    for (size_t i = 0; i < sharedLimit; i++)
+        *(sharedLists + i) = 0;
+    sharedLimit = 0;
+    argo_hashcons_shared = 0;
+    argo_hashcons_saved = 0;
+}
@@ -0,0 +1,221 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "intern.h"
+
+int argo_intern_enabled = 0;
+size_t argo_intern_count = 0;
+size_t argo_intern_allocs = 0;
+
+static ARGO_INTERN_ENTRY **internTable = NULL;
+static size_t internTableSize = 0;
+
+#define INTERN_INITIAL_SIZE 64
+
+/**
+ * @brief  Compute the hash of a sequence of code points.
+ * @details  FNV-1a over the code points of the string.  This is the hash
+ * stored with each interned name, so it can also be used by callers that
+ * need a hash of a name without looking at its content again.
+ *
+ * @param content  The code points to hash.
+ * @param length  The number of code points.
+ * @return  The hash value.
+ */
+unsigned long argo_intern_hash(ARGO_CHAR *content, size_t length) {
+    unsigned long hash = 14695981039346656037UL;
+    size_t index = 0;
+    while (index < length) {
+        hash = hash ^ (unsigned long)(unsigned int)*(content + index);
+        hash = hash * 1099511628211UL;
+        index++;
+    }
+    return hash;
+}
+
+static int contentEqual(ARGO_CHAR *a, ARGO_CHAR *b, size_t length) {
+    size_t index = 0;
+    while (index < length) {
+        if (*(a + index) != *(b + index))
+            return 0;
+        index++;
+    }
+    return 1;
+}
+
+static int growTable(void) {
+    size_t newSize = internTableSize == 0 ? INTERN_INITIAL_SIZE : internTableSize * 2;
+    ARGO_INTERN_ENTRY **newTable = calloc(newSize, sizeof(ARGO_INTERN_ENTRY *));
+    if (newTable == NULL) {
+        fprintf(stderr, "[%d] Failed to allocate space for name table\n", argo_lines_read);
+        return 1;
+    }
+    argo_intern_allocs++;
+    size_t index = 0;
+    while (index < internTableSize) {
+        ARGO_INTERN_ENTRY *entry = *(internTable + index);
+        while (entry != NULL) {
+            ARGO_INTERN_ENTRY *next = (*entry).next;
+            size_t slot = (*entry).hash & (newSize - 1);
+            (*entry).next = *(newTable + slot);
+            *(newTable + slot) = entry;
+            entry = next;
+        }
+        index++;
+    }
+    free(internTable);
+    internTable = newTable;
+    internTableSize = newSize;
+    return 0;
+}
+
+static ARGO_INTERN_ENTRY *lookup(ARGO_CHAR *content, size_t length, unsigned long hash) {
+    if (internTableSize == 0)
+        return NULL;
+    ARGO_INTERN_ENTRY *entry = *(internTable + (hash & (internTableSize - 1)));
+    while (entry != NULL) {
+        if ((*entry).hash == hash && (*entry).length == length
+            && contentEqual((*entry).content, content, length))
+            return entry;
+        entry = (*entry).next;
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Find the pool entry holding a specified name.
+ *
+ * @param content  The code points of the name.
+ * @param length  The number of code points.
+ * @return  The entry, or NULL if the name has never been interned.
+ */
+ARGO_INTERN_ENTRY *argo_intern_find(ARGO_CHAR *content, size_t length) {
+    return lookup(content, length, argo_intern_hash(content, length));
+}
+
+/**
+ * @brief  Make a string refer to the pooled copy of a name.
+ * @details  Looks up the content of "src" in the pool, adding it if it is
+ * not already there, and sets "dst" to refer to the pooled copy.  Only one
+ * allocation is made per distinct name; interning a name that is already in
+ * the pool allocates nothing.  The content of "src" is not modified, so a
+ * caller can reuse it as a scratch buffer.  "src" and "dst" may be the same
+ * string, but any buffer owned by "dst" is not freed.
+ *
+ * @param src  The name to intern.
+ * @param dst  The string that is to refer to the pooled copy.
+ * @return  Zero if successful, nonzero if memory could not be allocated.
+ */
+int argo_intern_string(ARGO_STRING *src, ARGO_STRING *dst) {
+    size_t length = (*src).length;
+    unsigned long hash = argo_intern_hash((*src).content, length);
+    ARGO_INTERN_ENTRY *entry = lookup((*src).content, length, hash);
+    if (entry == NULL) {
+        if (argo_intern_count >= internTableSize - internTableSize / 4 && growTable())
+            return 1;
+        entry = malloc(sizeof(ARGO_INTERN_ENTRY) + length * sizeof(ARGO_CHAR));
+        if (entry == NULL) {
+            fprintf(stderr, "[%d] Failed to allocate space for name\n", argo_lines_read);
+            return 1;
+        }
+        argo_intern_allocs++;
+        (*entry).hash = hash;
+        (*entry).length = length;
+        size_t index = 0;
+        while (index < length) {
+            *((*entry).content + index) = *((*src).content + index);
+            index++;
+        }
+        size_t slot = hash & (internTableSize - 1);
+        (*entry).next = *(internTable + slot);
+        *(internTable + slot) = entry;
+        argo_intern_count++;
+    }
+    (*dst).capacity = 0;
+    (*dst).length = length;
+    (*dst).content = (*entry).content;
+    return 0;
+}
+
+/**
+ * @brief  Determine whether a string refers to a pooled name.
+ *
+ * @return  Nonzero if the string was set by argo_intern_string().
+ */
+int argo_is_interned(ARGO_STRING *s) {
+    return (*s).capacity == 0 && (*s).content != NULL;
+}
+
+/**
+ * @brief  Compare two member names for equality.
+ * @details  If both names are interned this is a pointer comparison;
+ * otherwise the contents are compared.
+ *
+ * @return  Nonzero if the names are equal.
+ */
+int argo_names_equal(ARGO_STRING *a, ARGO_STRING *b) {
+    if ((*a).length != (*b).length)
+        return 0;
+    if ((*a).content == (*b).content)
+        return 1;
+    if (argo_is_interned(a) && argo_is_interned(b))
+        return 0;
+    return contentEqual((*a).content, (*b).content, (*a).length);
+}
+
+/**
+ * @brief  Find the member of an object with a specified name.
+ * @details  If the requested name is present in the pool, it is first
+ * replaced by the pooled copy, so that every comparison against an
+ * interned member name is a single pointer comparison.
+ *
+ * @param v  The object to search.
+ * @param name  The name of the member.
+ * @return  The member, or NULL if "v" is not an object or has no member
+ * with that name.
+ */
+ARGO_VALUE *argo_object_member(ARGO_VALUE *v, ARGO_STRING *name) {
+    if (v == NULL || (*v).type != ARGO_OBJECT_TYPE)
+        return NULL;
+    ARGO_STRING key = *name;
+    if (!argo_is_interned(&key) && key.length != 0) {
+        ARGO_INTERN_ENTRY *entry = argo_intern_find(key.content, key.length);
+        if (entry != NULL) {
+            key.capacity = 0;
+            key.content = (*entry).content;
+        }
+    }
+    ARGO_VALUE *sentinel = (*v).content.object.member_list;
+    ARGO_VALUE *member = (*sentinel).next;
+    while (member != NULL && member != sentinel) {
+        if (argo_names_equal(&(*member).name, &key))
+            return member;
+        member = (*member).next;
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Release every name held in the pool.
+ * @details  Any string still referring to a pooled name becomes invalid.
+ */
+void argo_intern_clear(void) {
+    size_t index = 0;
+    while (index < internTableSize) {
+        ARGO_INTERN_ENTRY *entry = *(internTable + index);
+        while (entry != NULL) {
+            ARGO_INTERN_ENTRY *next = (*entry).next;
+            free(entry);
+            entry = next;
+        }
+        index++;
+    }
+    free(internTable);
+    internTable = NULL;
+    internTableSize = 0;
+    argo_intern_count = 0;
+    argo_intern_allocs = 0;
+}
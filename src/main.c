@@ -4,6 +4,17 @@
 #include "argo.h"
 #include "global.h"
 #include "debug.h"
+#include "intern.h"
+#include "options.h"
+#include "reader.h"
+#include "parallel.h"
+#include "zerocopy.h"
+#include "server.h"
+#include "batch.h"
+#include "compress.h"
+#include "diff.h"
+#include "digest.h"
+#include "columnar.h"
 
 #ifdef _STRING_H
 #error "Do not #include <string.h>. You will get a ZERO."
@@ -20,23 +31,54 @@
 int main(int argc, char **argv)
 {
     if(validargs(argc, argv) == -1) {
-        USAGE(*argv, EXIT_FAILURE);
+        ARGO_USAGE(*argv, EXIT_FAILURE);
         return EXIT_FAILURE;
     } else if(global_options == HELP_OPTION) {
-        USAGE(*argv, EXIT_SUCCESS);
+        ARGO_USAGE(*argv, EXIT_SUCCESS);
         return EXIT_SUCCESS;
     }
 
 
-    if ((global_options & 0x40000000) == 0x40000000) {
-        argo_read_value(stdin);
-
+    if ((global_options & SERVE_OPTION) != 0)
+        return argo_serve(argo_serve_path, 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+    if ((global_options & BATCH_OPTION) != 0)
+        return argo_batch(&argo_batch_config) ? EXIT_FAILURE : EXIT_SUCCESS;
+    if ((global_options & DIFF_OPTION) != 0)
+        return argo_diff_files(&argo_diff_config);
+    if ((global_options & DIGEST_OPTION) != 0)
+        return argo_digest_files(&argo_digest_config) ? EXIT_FAILURE : EXIT_SUCCESS;
+    if ((global_options & COLUMNS_OPTION) != 0)
+        return argo_columns_files(&argo_columns_config) ? EXIT_FAILURE : EXIT_SUCCESS;
+    argo_intern_enabled = 1;
+    int format = argo_input_start(stdin);
+    if (format < 0)
+        return EXIT_FAILURE;
+    if ((global_options & ZERO_COPY_OPTION) != 0 && format == ARGO_FORMAT_NONE)
+        argo_source_map(stdin);
+    ARGO_VALUE *v = argo_read_value(stdin);
+    if (v == NULL)
+        return EXIT_FAILURE;
+    if (argo_read_end(stdin))
+        return EXIT_FAILURE;
+    if ((global_options & VALIDATE_OPTION) != 0)
+        return EXIT_SUCCESS;
+    FILE *out = stdout;
+    if ((global_options & GZIP_OUTPUT_OPTION) != 0)
+        out = argo_compress_open(stdout, ARGO_FORMAT_GZIP);
+    else if ((global_options & ZSTD_OUTPUT_OPTION) != 0)
+        out = argo_compress_open(stdout, ARGO_FORMAT_ZSTD);
+    if (out == NULL)
+        return EXIT_FAILURE;
+    int status;
+    if ((global_options & ZERO_COPY_OPTION) != 0) {
+        status = argo_write_value_zero_copy(v, out);
+        argo_source_unmap();
     } else {
-        argo_write_value(argo_read_value(stdin), stdout);
+        status = argo_write_value_parallel(v, out, 0);
     }
-
-    // TO BE IMPLEMENTED
-    return EXIT_FAILURE;
+    if (out != stdout && argo_compress_close(out))
+        status = 1;
+    return status ? EXIT_FAILURE : EXIT_SUCCESS;
 }
 
 /*
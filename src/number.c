@@ -0,0 +1,104 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <limits.h>
+#include <math.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "number.h"
+
+#define NUMBER_BUFFER_SIZE 64
+
+/**
+ * @brief  Compute the binary representations of a number from its text.
+ * @details  If neither the integer nor the floating-point representation of
+ * the number is valid, they are computed from the text and cached.  The
+ * integer representation is valid only if the text has no fraction or
+ * exponent part and its value fits in a long.  A number too large in
+ * magnitude for a double has neither, and stays unconverted; one too small
+ * is taken as the nearest double, which may be zero.  A number that already
+ * has a binary representation is left alone.
+ *
+ * @return  Zero if the number has a valid floating-point representation
+ * afterwards, nonzero otherwise.
+ */
+int argo_number_materialize(ARGO_NUMBER *n) {
+    if ((*n).valid_float || (*n).valid_int) {
+        if (!(*n).valid_float) {
+            (*n).float_value = (double)(*n).int_value;
+            (*n).valid_float = 1;
+        }
+        return 0;
+    }
+    if (!(*n).valid_string || (*n).string_value.length == 0)
+        return 1;
+    ARGO_STRING *s = &(*n).string_value;
+    char local[NUMBER_BUFFER_SIZE];
+    char *text = local;
+    if ((*s).length >= NUMBER_BUFFER_SIZE) {
+        text = malloc((*s).length + 1);
+        if (text == NULL)
+            return 1;
+    }
+    int integer = 1;
+    int negative = 0;
+    unsigned long magnitude = 0;
+    size_t index = 0;
+    while (index < (*s).length) {
+        ARGO_CHAR c = *((*s).content + index);
+        *(text + index) = (char)c;
+        if (c == ARGO_MINUS && index == 0) {
+            negative = 1;
+        } else if (argo_is_digit(c) && integer) {
+            if (magnitude > (ULONG_MAX - (c - ARGO_DIGIT0)) / 10)
+                integer = 0;
+            else
+                magnitude = magnitude * 10 + (c - ARGO_DIGIT0);
+        } else {
+            integer = 0;
+        }
+        index++;
+    }
+    *(text + index) = '\0';
+    double value = strtod(text, NULL);
+    if (text != local)
+        free(text);
+    if (isinf(value))
+        return 1;
+    if (integer && (negative ? magnitude <= (unsigned long)LONG_MAX + 1 : magnitude <= LONG_MAX)) {
+        (*n).int_value = negative ? (long)(0 - magnitude) : (long)magnitude;
+        (*n).valid_int = 1;
+    }
+    (*n).float_value = value;
+    (*n).valid_float = 1;
+    return 0;
+}
+
+/**
+ * @brief  Get the value of a number as an integer.
+ *
+ * @param value  Set to the value, if it is an integer.
+ * @return  Zero if the number has an exact integer representation,
+ * nonzero otherwise.
+ */
+int argo_number_int(ARGO_NUMBER *n, long *value) {
+    argo_number_materialize(n);
+    if (!(*n).valid_int)
+        return 1;
+    *value = (*n).int_value;
+    return 0;
+}
+
+/**
+ * @brief  Get the value of a number in floating point.
+ *
+ * @param value  Set to the value.
+ * @return  Zero if successful, nonzero if the number holds no valid value.
+ */
+int argo_number_float(ARGO_NUMBER *n, double *value) {
+    if (argo_number_materialize(n))
+        return 1;
+    *value = (*n).float_value;
+    return 0;
+}
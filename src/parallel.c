@@ -0,0 +1,386 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "options.h"
+#include "parallel.h"
+#include "sort.h"
+
+/*
+ * Number of pieces passed to each writev(); this is IOV_MAX on Linux.
+ */
+#define WRITEV_BATCH 1024
+
+/*
+ * One piece of the output.  A piece is either text laid out by the calling
+ * thread ("value" is NULL) or a run of "count" consecutive elements of an
+ * array or members of an object, starting at "value", to be written by a
+ * worker at the given depth; in both cases "text" and "length" hold the
+ * bytes once they are known.
+ */
+typedef struct argo_piece {
+    ARGO_VALUE *value;
+    ARGO_VALUE *sentinel;             // List that "value" is on.
+    size_t count;
+    size_t depth;
+    int object;
+    char *text;
+    size_t length;
+    int status;
+} ARGO_PIECE;
+
+typedef struct argo_plan {
+    ARGO_PIECE *pieces;
+    size_t count;
+    size_t capacity;
+    FILE *glue;                       // Stream collecting the current text piece,
+    char *glue_text;                  // into this buffer.
+    size_t glue_length;
+    ARGO_SUBTREE_WRITER writer;
+    size_t indent;
+    int pretty;
+    int sorted;                       // Members in order of their names.
+    size_t next;                      // Next piece to be claimed by a worker.
+} ARGO_PLAN;
+
+/*
+ * Measure the work in a subtree, giving up as soon as it exceeds "limit".
+ */
+static size_t measure(ARGO_VALUE *v, size_t limit) {
+    size_t work = 1;
+    ARGO_VALUE *sentinel;
+    if ((*v).type == ARGO_STRING_TYPE)
+        return work + (*v).content.string.length / 16;
+    else if ((*v).type == ARGO_OBJECT_TYPE)
+        sentinel = (*v).content.object.member_list;
+    else if ((*v).type == ARGO_ARRAY_TYPE)
+        sentinel = (*v).content.array.element_list;
+    else
+        return work;
+    ARGO_VALUE *node = (*sentinel).next;
+    while (node != sentinel && work <= limit) {
+        work += measure(node, limit - work) + (*node).name.length / 16;
+        node = (*node).next;
+    }
+    return work;
+}
+
+static ARGO_PIECE *newPiece(ARGO_PLAN *plan) {
+    if ((*plan).count == (*plan).capacity) {
+        size_t capacity = (*plan).capacity == 0 ? 64 : (*plan).capacity * 2;
+        ARGO_PIECE *pieces = realloc((*plan).pieces, capacity * sizeof(ARGO_PIECE));
+        if (pieces == NULL) {
+            fprintf(stderr, "Failed to allocate space for output plan\n");
+            return NULL;
+        }
+        (*plan).pieces = pieces;
+        (*plan).capacity = capacity;
+    }
+    ARGO_PIECE *piece = (*plan).pieces + (*plan).count++;
+    (*piece).value = NULL;
+    (*piece).sentinel = NULL;
+    (*piece).count = 0;
+    (*piece).depth = 0;
+    (*piece).object = 0;
+    (*piece).text = NULL;
+    (*piece).length = 0;
+    (*piece).status = 0;
+    return piece;
+}
+
+/*
+ * Start a new text piece, into which the layout is written.  The stream
+ * writes to the plan rather than to the piece, since the pieces may move
+ * while it is open.
+ */
+static int openGlue(ARGO_PLAN *plan) {
+    (*plan).glue = open_memstream(&(*plan).glue_text, &(*plan).glue_length);
+    return (*plan).glue == NULL;
+}
+
+static int closeGlue(ARGO_PLAN *plan) {
+    int status = fclose((*plan).glue) != 0;
+    (*plan).glue = NULL;
+    ARGO_PIECE *piece = newPiece(plan);
+    if (piece == NULL) {
+        free((*plan).glue_text);
+        return 1;
+    }
+    (*piece).text = (*plan).glue_text;
+    (*piece).length = (*plan).glue_length;
+    return status;
+}
+
+/*
+ * Finish the current text piece and add one for a run of elements after it.
+ */
+static int addRun(ARGO_PLAN *plan, ARGO_VALUE *sentinel, ARGO_VALUE *first, size_t count,
+                  size_t depth, int object) {
+    if (closeGlue(plan))
+        return 1;
+    ARGO_PIECE *piece = newPiece(plan);
+    if (piece == NULL)
+        return 1;
+    (*piece).value = first;
+    (*piece).sentinel = sentinel;
+    (*piece).count = count;
+    (*piece).depth = depth;
+    (*piece).object = object;
+    return openGlue(plan);
+}
+
+/*
+ * Write what precedes an element at the given depth in its container: the
+ * line break and indentation, if pretty, and the name, if it is a member.
+ */
+static int writeLead(ARGO_PLAN *plan, ARGO_VALUE *node, size_t depth, int object, FILE *out) {
+    if ((*plan).pretty) {
+        size_t count = depth * (*plan).indent;
+        fputc(ARGO_LF, out);
+        while (count > 0) {
+            fputc(ARGO_SPACE, out);
+            count--;
+        }
+    }
+    if (object) {
+        if (argo_write_string(&(*node).name, out))
+            return 1;
+        fputc(ARGO_COLON, out);
+        if ((*plan).pretty)
+            fputc(ARGO_SPACE, out);
+    }
+    return 0;
+}
+
+/*
+ * The element or member after "node" in the order it is written.
+ */
+static ARGO_VALUE *following(ARGO_PLAN *plan, ARGO_VALUE *sentinel, ARGO_VALUE *node, int object) {
+    return (*plan).sorted && object ? argo_sorted_next(sentinel, node) : (*node).next;
+}
+
+/*
+ * Write a run of elements, with the commas between them.
+ */
+static int writeRun(ARGO_PLAN *plan, ARGO_PIECE *piece, FILE *out) {
+    ARGO_VALUE *node = (*piece).value;
+    size_t index = 0;
+    while (index < (*piece).count) {
+        if (index > 0)
+            fputc(ARGO_COMMA, out);
+        if (writeLead(plan, node, (*piece).depth, (*piece).object, out)
+            || (*plan).writer(node, (*piece).depth, out))
+            return 1;
+        node = following(plan, (*piece).sentinel, node, (*piece).object);
+        index++;
+    }
+    return ferror(out) ? 1 : 0;
+}
+
+/*
+ * Lay out a container that is too large to be written by one worker.  This
+ * writes exactly what writer_variant.h writes, except that the elements
+ * are either split further, if they are large containers themselves, or
+ * gathered into runs of about ARGO_PARALLEL_GRAIN units of work, each of
+ * which is handed to a worker.
+ */
+static int split(ARGO_PLAN *plan, ARGO_VALUE *v, size_t depth) {
+    ARGO_VALUE *sentinel;
+    int object = (*v).type == ARGO_OBJECT_TYPE;
+    if (object)
+        sentinel = (*v).content.object.member_list;
+    else
+        sentinel = (*v).content.array.element_list;
+    fputc(object ? ARGO_LBRACE : ARGO_LBRACK, (*plan).glue);
+    ARGO_VALUE *node = (*plan).sorted && object ? argo_sorted_first(sentinel) : (*sentinel).next;
+    ARGO_VALUE *start = node;
+    if (node == sentinel) {
+        fputc(object ? ARGO_RBRACE : ARGO_RBRACK, (*plan).glue);
+        return 0;
+    }
+    ARGO_VALUE *first = NULL;
+    size_t count = 0;
+    size_t pending = 0;
+    while (node != sentinel) {
+        size_t work = measure(node, ARGO_PARALLEL_GRAIN);
+        int large = work > ARGO_PARALLEL_GRAIN
+            && ((*node).type == ARGO_OBJECT_TYPE || (*node).type == ARGO_ARRAY_TYPE);
+        if (count > 0 && (large || pending + work > ARGO_PARALLEL_GRAIN)) {
+            if (addRun(plan, sentinel, first, count, depth + 1, object))
+                return 1;
+            count = 0;
+            pending = 0;
+        }
+        if (node != start && count == 0)
+            fputc(ARGO_COMMA, (*plan).glue);
+        if (large) {
+            if (writeLead(plan, node, depth + 1, object, (*plan).glue)
+                || split(plan, node, depth + 1))
+                return 1;
+        } else {
+            if (count == 0)
+                first = node;
+            count++;
+            pending += work;
+        }
+        node = following(plan, sentinel, node, object);
+    }
+    if (count > 0 && addRun(plan, sentinel, first, count, depth + 1, object))
+        return 1;
+    if ((*plan).pretty)
+        writeLead(plan, v, depth, 0, (*plan).glue);
+    fputc(object ? ARGO_RBRACE : ARGO_RBRACK, (*plan).glue);
+    return 0;
+}
+
+/*
+ * Body of each worker: claim runs in order until none are left.
+ */
+static void *work(void *arg) {
+    ARGO_PLAN *plan = arg;
+    while (1) {
+        size_t index = __atomic_fetch_add(&(*plan).next, 1, __ATOMIC_RELAXED);
+        if (index >= (*plan).count)
+            return NULL;
+        ARGO_PIECE *piece = (*plan).pieces + index;
+        if ((*piece).value == NULL)
+            continue;
+        FILE *out = open_memstream(&(*piece).text, &(*piece).length);
+        if (out == NULL) {
+            (*piece).status = 1;
+            continue;
+        }
+        (*piece).status = writeRun(plan, piece, out);
+        if (fclose(out) != 0)
+            (*piece).status = 1;
+    }
+}
+
+/*
+ * Emit the pieces in order, with as few system calls as possible.  A stream
+ * that has no file descriptor (a memory stream, say) gets them through
+ * fwrite() instead.
+ */
+static int emit(ARGO_PLAN *plan, FILE *f) {
+    int fd = fileno(f);
+    if (fd == -1 || fflush(f) != 0) {
+        size_t index = 0;
+        while (index < (*plan).count) {
+            ARGO_PIECE *piece = (*plan).pieces + index;
+            fwrite((*piece).text, 1, (*piece).length, f);
+            index++;
+        }
+        return ferror(f) ? 1 : 0;
+    }
+    struct iovec vector[WRITEV_BATCH];
+    size_t index = 0;
+    size_t offset = 0;
+    while (index < (*plan).count) {
+        int used = 0;
+        size_t scan = index;
+        while (scan < (*plan).count && used < WRITEV_BATCH) {
+            ARGO_PIECE *piece = (*plan).pieces + scan;
+            size_t skip = scan == index ? offset : 0;
+            if ((*piece).length > skip) {
+                vector[used].iov_base = (*piece).text + skip;
+                vector[used].iov_len = (*piece).length - skip;
+                used++;
+            }
+            scan++;
+        }
+        if (used == 0)
+            break;
+        ssize_t written = writev(fd, vector, used);
+        if (written < 0) {
+            fprintf(stderr, "Failed to write output\n");
+            return 1;
+        }
+        while (index < (*plan).count && written > 0) {
+            size_t left = (*((*plan).pieces + index)).length - offset;
+            if ((size_t)written < left) {
+                offset += written;
+                written = 0;
+            } else {
+                written -= left;
+                offset = 0;
+                index++;
+            }
+        }
+        while (index < (*plan).count && (*((*plan).pieces + index)).length == offset) {
+            offset = 0;
+            index++;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Write canonical JSON representing a specified value to a
+ * specified output stream, using several threads.
+ * @details  The output is byte-for-byte that of argo_write_value(), in the
+ * layout selected by global_options.  A value too small to be worth
+ * dividing, or a request for a single thread, is simply passed to
+ * argo_write_value().
+ *
+ * @param v  Data structure representing a value.
+ * @param f  Output stream to which JSON is to be written.
+ * @param threads  Number of threads to use; zero means one per online
+ * processor.
+ * @return  Zero if the operation is completely successful,
+ * nonzero if there is any error.
+ */
+int argo_write_value_parallel(ARGO_VALUE *v, FILE *f, int threads) {
+    if (threads == 0)
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads <= 1 || ((*v).type != ARGO_OBJECT_TYPE && (*v).type != ARGO_ARRAY_TYPE)
+        || measure(v, ARGO_PARALLEL_GRAIN) <= ARGO_PARALLEL_GRAIN)
+        return argo_write_value(v, f);
+    ARGO_PLAN plan = {0};
+    plan.writer = argo_subtree_writer();
+    plan.pretty = (global_options & PRETTY_PRINT_OPTION) != 0;
+    plan.indent = plan.pretty ? (size_t)(global_options & 0xFF) : 0;
+    plan.sorted = (global_options & SORT_KEYS_OPTION) != 0;
+    // Objects are sorted before the workers start, since two of them could
+    // otherwise reach a shared one at once.
+    if (plan.sorted && argo_sort_tree(v))
+        return argo_write_value(v, f);
+    int status = openGlue(&plan) || split(&plan, v, 0);
+    if (plan.glue != NULL) {
+        if (status == 0 && plan.pretty)
+            fputc(ARGO_LF, plan.glue);
+        if (closeGlue(&plan))
+            status = 1;
+    }
+    if (status == 0) {
+        pthread_t *workers = malloc((threads - 1) * sizeof(pthread_t));
+        int started = 0;
+        while (workers != NULL && started < threads - 1
+               && pthread_create(workers + started, NULL, work, &plan) == 0)
+            started++;
+        work(&plan);
+        while (started > 0) {
+            started--;
+            pthread_join(*(workers + started), NULL);
+        }
+        free(workers);
+        size_t index = 0;
+        while (index < plan.count && status == 0) {
+            status = (*(plan.pieces + index)).status;
+            index++;
+        }
+        if (status == 0)
+            status = emit(&plan, f);
+    }
+    size_t index = 0;
+    while (index < plan.count) {
+        free((*(plan.pieces + index)).text);
+        index++;
+    }
+    free(plan.pieces);
+    return status;
+}
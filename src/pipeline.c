@@ -0,0 +1,245 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "pipeline.h"
+#include "reader.h"
+
+/*
+ * One block of the ring.  A block of length zero marks the end of the
+ * input, and "failed" is set on it if the input ended with an error.
+ */
+typedef struct pipeline_block {
+    unsigned char *data;
+    size_t length;
+    int failed;
+} PIPELINE_BLOCK;
+
+typedef struct argo_pipeline {
+    PIPELINE_BLOCK blocks[ARGO_PIPELINE_BLOCKS];
+    unsigned head;                    // Blocks published by the producer.
+    unsigned tail;                    // Blocks given back by the consumer.
+    int stopping;
+    int holding;                      // Consumer is reading block "tail".
+    int finished;                     // Consumer has reached the end.
+    ARGO_PRODUCER produce;
+    ARGO_RELEASE release;             // Frees "state" once the producer has stopped.
+    void *state;
+    int fd;
+    unsigned char *saved_block;       // The reader's own buffer, while we run.
+    pthread_t thread;
+} ARGO_PIPELINE;
+
+static ARGO_PIPELINE *pipeline;
+
+static void futexWait(unsigned *word, unsigned seen) {
+    syscall(SYS_futex, word, FUTEX_WAIT_PRIVATE, seen, NULL, NULL, 0);
+}
+
+static void futexWake(unsigned *word) {
+    syscall(SYS_futex, word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+static ssize_t readProducer(void *state, unsigned char *buffer, size_t size) {
+    ARGO_PIPELINE *p = state;
+    while (1) {
+        ssize_t n = read((*p).fd, buffer, size);
+        if (n >= 0 || errno != EINTR)
+            return n;
+    }
+}
+
+/*
+ * Wait for a free block at the head of the ring.  Returns NULL if the
+ * pipeline is being stopped.
+ */
+static PIPELINE_BLOCK *claimBlock(ARGO_PIPELINE *p) {
+    unsigned tail;
+    while ((*p).head - (tail = __atomic_load_n(&(*p).tail, __ATOMIC_ACQUIRE)) == ARGO_PIPELINE_BLOCKS) {
+        if (__atomic_load_n(&(*p).stopping, __ATOMIC_ACQUIRE))
+            return NULL;
+        futexWait(&(*p).tail, tail);
+    }
+    PIPELINE_BLOCK *block = (*p).blocks + (*p).head % ARGO_PIPELINE_BLOCKS;
+    (*block).length = 0;
+    (*block).failed = 0;
+    return block;
+}
+
+static void publishBlock(ARGO_PIPELINE *p) {
+    __atomic_store_n(&(*p).head, (*p).head + 1, __ATOMIC_RELEASE);
+    futexWake(&(*p).head);
+}
+
+/*
+ * Body of the producer thread.  A block is published once it holds at
+ * least ARGO_READ_BLOCK bytes, so that a slow source still feeds the parser
+ * promptly rather than once a whole block has arrived.  The end of the
+ * input is marked by an empty block.
+ */
+static void *producerThread(void *arg) {
+    ARGO_PIPELINE *p = arg;
+    int failed = 0;
+    while (1) {
+        PIPELINE_BLOCK *block = claimBlock(p);
+        if (block == NULL)
+            return NULL;
+        int end = 0;
+        while ((*block).length < ARGO_READ_BLOCK) {
+            ssize_t n = (*p).produce((*p).state, (*block).data + (*block).length,
+                                     ARGO_PIPELINE_BLOCK - (*block).length);
+            if (n <= 0) {
+                failed = n < 0;
+                end = 1;
+                break;
+            }
+            (*block).length += n;
+            if (__atomic_load_n(&(*p).stopping, __ATOMIC_ACQUIRE))
+                return NULL;
+        }
+        (*block).failed = end && failed;
+        int empty = (*block).length == 0;
+        publishBlock(p);
+        if (end && empty)
+            return NULL;
+        if (end) {
+            if ((block = claimBlock(p)) == NULL)
+                return NULL;
+            (*block).failed = failed;
+            publishBlock(p);
+            return NULL;
+        }
+    }
+}
+
+/**
+ * @brief  Decide whether input from a stream is worth reading ahead.
+ *
+ * @return  Nonzero if the stream is a pipe, socket or character device.
+ */
+int argo_pipeline_wanted(FILE *f) {
+    struct stat info;
+    if (fstat(fileno(f), &info) != 0)
+        return 0;
+    return S_ISFIFO(info.st_mode) || S_ISSOCK(info.st_mode) || S_ISCHR(info.st_mode);
+}
+
+/**
+ * @brief  Start reading a stream ahead of the parser.
+ * @details  Until argo_pipeline_stop() is called, argo_reader takes its
+ * input from the ring rather than from the stream, and so must not be
+ * used to read any other stream.  Nothing must have been read from the
+ * stream through stdio beforehand.
+ *
+ * @param f  The stream to be read.
+ * @param produce  Source of the bytes, or NULL to read() the stream.
+ * @param release  Called with "state" by argo_pipeline_stop(), or NULL.
+ * @param state  Passed to "produce".
+ * @return  Zero if the producer thread was started, nonzero otherwise, in
+ * which case "state" is left to the caller.
+ */
+int argo_pipeline_start(FILE *f, ARGO_PRODUCER produce, ARGO_RELEASE release, void *state) {
+    if (pipeline != NULL)
+        return 1;
+    ARGO_PIPELINE *p = calloc(1, sizeof(ARGO_PIPELINE));
+    if (p == NULL)
+        return 1;
+    for (int i = 0; i < ARGO_PIPELINE_BLOCKS; i++) {
+        if (((*((*p).blocks + i)).data = malloc(ARGO_PIPELINE_BLOCK)) == NULL) {
+            while (i-- > 0)
+                free((*((*p).blocks + i)).data);
+            free(p);
+            return 1;
+        }
+    }
+    (*p).fd = fileno(f);
+    (*p).produce = produce != NULL ? produce : readProducer;
+    (*p).release = produce != NULL ? release : NULL;
+    (*p).state = produce != NULL ? state : p;
+    if (pthread_create(&(*p).thread, NULL, producerThread, p) != 0) {
+        for (int i = 0; i < ARGO_PIPELINE_BLOCKS; i++)
+            free((*((*p).blocks + i)).data);
+        free(p);
+        return 1;
+    }
+    pipeline = p;
+    (*p).saved_block = argo_reader.block;
+    argo_reader.pipeline = p;
+    argo_reader.file = f;
+    argo_reader.next = NULL;
+    argo_reader.end = NULL;
+    argo_reader.block = NULL;
+    return 0;
+}
+
+/**
+ * @brief  Move argo_reader on to the next block of the ring.
+ * @details  This is what argo_reader_fill() does while a pipeline is
+ * running.  The block that was being read is given back to the producer.
+ *
+ * @return  The first byte of the next block, which is consumed, or EOF.
+ */
+int argo_pipeline_fill(ARGO_READER *r) {
+    ARGO_PIPELINE *p = (*r).pipeline;
+    if ((*p).holding) {
+        __atomic_store_n(&(*p).tail, (*p).tail + 1, __ATOMIC_RELEASE);
+        futexWake(&(*p).tail);
+        (*p).holding = 0;
+    }
+    (*r).next = (*r).block;
+    (*r).end = (*r).block;
+    if ((*p).finished)
+        return EOF;
+    unsigned head;
+    while ((head = __atomic_load_n(&(*p).head, __ATOMIC_ACQUIRE)) == (*p).tail)
+        futexWait(&(*p).head, head);
+    PIPELINE_BLOCK *block = (*p).blocks + (*p).tail % ARGO_PIPELINE_BLOCKS;
+    if ((*block).length == 0) {
+        if ((*block).failed)
+            fprintf(stderr, "[%d] Error reading input\n", argo_lines_read);
+        (*p).finished = 1;
+        return EOF;
+    }
+    (*p).holding = 1;
+    (*r).block = (*block).data;
+    (*r).next = (*r).block;
+    (*r).end = (*r).block + (*block).length;
+    return *(*r).next++;
+}
+
+/**
+ * @brief  Stop the pipeline, if one is running, and return argo_reader to
+ * reading streams directly.  Input that was read ahead is discarded, and
+ * the state of the producer is released.
+ */
+void argo_pipeline_stop(void) {
+    ARGO_PIPELINE *p = pipeline;
+    if (p == NULL)
+        return;
+    __atomic_store_n(&(*p).stopping, 1, __ATOMIC_RELEASE);
+    // Change "tail" too, so that a producer about to sleep on it does not.
+    __atomic_store_n(&(*p).tail, (*p).tail + 1, __ATOMIC_RELEASE);
+    futexWake(&(*p).tail);
+    // The producer may be blocked in read(), which is a cancellation point.
+    pthread_cancel((*p).thread);
+    pthread_join((*p).thread, NULL);
+    if ((*p).release != NULL)
+        (*p).release((*p).state);
+    for (int i = 0; i < ARGO_PIPELINE_BLOCKS; i++)
+        free((*((*p).blocks + i)).data);
+    argo_reader.pipeline = NULL;
+    argo_reader.file = NULL;
+    argo_reader.block = (*p).saved_block;
+    argo_reader.next = argo_reader.block;
+    argo_reader.end = argo_reader.block;
+    free(p);
+    pipeline = NULL;
+}
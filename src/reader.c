@@ -0,0 +1,187 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "reader.h"
+#include "pipeline.h"
+
+ARGO_READER argo_reader;
+
+/**
+ * @brief  Start reading from a stream.
+ * @details  The outermost call binds argo_reader to the stream.  If it was
+ * bound to another stream whose read-ahead could not be handed back, that
+ * read-ahead is discarded.
+ */
+void argo_reader_enter(FILE *f) {
+    if (argo_reader.depth++ > 0)
+        return;
+    if (argo_reader.file != f) {
+        argo_reader.file = f;
+        argo_reader.next = argo_reader.block;
+        argo_reader.end = argo_reader.block;
+        argo_reader.base = ftell(f);
+    }
+}
+
+/**
+ * @brief  Finish reading from a stream.
+ * @details  When the outermost call finishes, bytes read ahead are handed
+ * back to the stream if it can seek, and kept otherwise.
+ */
+void argo_reader_leave(FILE *f) {
+    if (--argo_reader.depth > 0)
+        return;
+    long unread = (long)(argo_reader.end - argo_reader.next);
+    if (unread == 0 || (argo_reader.pipeline == NULL && fseek(f, -unread, SEEK_CUR) == 0)) {
+        argo_reader.file = NULL;
+        argo_reader.next = argo_reader.block;
+        argo_reader.end = argo_reader.block;
+    }
+}
+
+/**
+ * @brief  Read the next block of the stream.
+ * @details  This is called by argo_getc() when every byte read so far has
+ * been consumed.  The first byte of the new block is consumed and returned.
+ * While a read-ahead pipeline is running, the block comes from its ring.
+ *
+ * @return  The next byte, or EOF at end of input or on error.
+ */
+int argo_reader_fill(ARGO_READER *r) {
+    (*r).base += (*r).end - (*r).block;
+    if ((*r).pipeline != NULL)
+        return argo_pipeline_fill(r);
+    if ((*r).block == NULL) {
+        (*r).block = malloc(ARGO_READ_BLOCK);
+        if ((*r).block == NULL) {
+            fprintf(stderr, "[%d] Failed to allocate input buffer\n", argo_lines_read);
+            return EOF;
+        }
+        (*r).block_size = ARGO_READ_BLOCK;
+    }
+    (*r).next = (*r).block;
+    (*r).end = (*r).block;
+    if ((*r).file == NULL)
+        return EOF;
+    size_t n = fread((*r).block, 1, (*r).block_size, (*r).file);
+    if (n == 0)
+        return EOF;
+    (*r).end = (*r).block + n;
+    return *(*r).next++;
+}
+
+#define SPACES8 0x2020202020202020UL
+
+static uint64_t load64(const unsigned char *p) {
+    uint64_t word;
+    __builtin_memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+/*
+ * Return a pointer to the first byte in [p, end) that is not whitespace,
+ * or end.  Sixteen bytes are classified at a time.
+ */
+static unsigned char *skipBlank(unsigned char *p, unsigned char *end) {
+    const __m128i space = _mm_set1_epi8(ARGO_SPACE);
+    const __m128i lf = _mm_set1_epi8(ARGO_LF);
+    const __m128i cr = _mm_set1_epi8(ARGO_CR);
+    const __m128i ht = _mm_set1_epi8(ARGO_HT);
+    while (end - p >= 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)p);
+        __m128i blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, lf)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(bytes, cr), _mm_cmpeq_epi8(bytes, ht)));
+        unsigned int mask = ~(unsigned int)_mm_movemask_epi8(blank) & 0xFFFF;
+        if (mask != 0)
+            return p + __builtin_ctz(mask);
+        p += 16;
+    }
+    while (p < end && argo_is_whitespace(*p))
+        p++;
+    return p;
+}
+#else
+static unsigned char *skipBlank(unsigned char *p, unsigned char *end) {
+    while (p < end && argo_is_whitespace(*p))
+        p++;
+    return p;
+}
+#endif
+
+/*
+ * Count the newlines in a run of whitespace that has been skipped, so that
+ * error messages can report the line on which they occurred.
+ */
+static void countLines(unsigned char *p, unsigned char *end) {
+    while (p < end) {
+        if (*p == ARGO_LF)
+            argo_lines_read++;
+        p++;
+    }
+}
+
+/**
+ * @brief  Skip whitespace and return the next character.
+ * @details  Pretty-printed input is mostly a newline followed by a run of
+ * spaces, so that case is handled first, eight spaces at a time; anything
+ * else is left to a vectorized scan of the buffered block.  Newlines that
+ * are skipped are counted in argo_lines_read.
+ *
+ * @return  The first character that is not whitespace (which is consumed),
+ * or EOF.
+ */
+int argo_skip_whitespace(ARGO_READER *r) {
+    while (1) {
+        unsigned char *p = (*r).next;
+        unsigned char *end = (*r).end;
+        if (p < end && !argo_is_whitespace(*p)) {
+            (*r).next = p + 1;
+            return *p;
+        }
+        if (p < end && *p == ARGO_LF) {
+            argo_lines_read++;
+            p++;
+            while (end - p >= 8 && load64(p) == SPACES8)
+                p += 8;
+        }
+        unsigned char *blank = p;
+        p = skipBlank(p, end);
+        countLines(blank, p);
+        if (p < end) {
+            (*r).next = p + 1;
+            return *p;
+        }
+        (*r).next = end;
+        int c = argo_reader_fill(r);
+        if (c == ARGO_LF)
+            argo_lines_read++;
+        if (c == EOF || !argo_is_whitespace(c))
+            return c;
+    }
+}
+
+/**
+ * @brief  Check that nothing but whitespace remains in a stream.
+ * @details  This is used after a value has been read, since a document
+ * consists of exactly one value.  A one-line message is output to standard
+ * error if anything else is found.
+ *
+ * @param f  The stream from which the value was read.
+ * @return  Zero if the rest of the stream is whitespace, nonzero otherwise.
+ */
+int argo_read_end(FILE *f) {
+    argo_reader_enter(f);
+    int c = argo_getc_nonblank(f);
+    argo_reader_leave(f);
+    if (c == EOF)
+        return 0;
+    fprintf(stderr, "[%d] Unexpected input after the end of the value\n", argo_lines_read);
+    return 1;
+}
@@ -0,0 +1,249 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <limits.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "number.h"
+#include "reader.h"
+#include "schema.h"
+
+static ARGO_NUMBER number;
+static ARGO_STRING scratch;
+
+/**
+ * @brief  Print a message about unexpected input, in the same form as the
+ * messages of argo_read_value().
+ *
+ * @param what  What was expected.
+ * @param c  The character found instead, or EOF.
+ */
+void argo_schema_error(char *what, int c) {
+    if (c == EOF)
+        fprintf(stderr, "[%d] %s: unexpected end of input\n", argo_lines_read, what);
+    else if (c >= 0x20 && c < 0x7F)
+        fprintf(stderr, "[%d] %s: unexpected character '%c'\n", argo_lines_read, what, c);
+    else
+        fprintf(stderr, "[%d] %s: unexpected byte 0x%02x\n", argo_lines_read, what, c);
+}
+
+/**
+ * @brief  Read a member name, whose opening quote has been read, and the
+ * colon after it.
+ *
+ * @param key  Set to the name; its buffer is reused from call to call.
+ */
+int argo_schema_key(ARGO_STRING *key, FILE *f) {
+    (*key).length = 0;
+    if (argo_read_string(key, f))
+        return 1;
+    int c = argo_getc_nonblank(f);
+    if (c != ARGO_COLON) {
+        argo_schema_error("Expected ':' after member name", c);
+        return 1;
+    }
+    return 0;
+}
+
+static int readNumber(int c, FILE *f) {
+    if (c != ARGO_MINUS && !argo_is_digit(c)) {
+        argo_schema_error("Expected a number", c);
+        return 1;
+    }
+    argo_ungetc(c, f);
+    number.string_value.length = 0;
+    return argo_read_number(&number, f);
+}
+
+/**
+ * @brief  Read a number that must be an integer.
+ * @details  The digits are accumulated straight into the result, without
+ * going through the text of the number.
+ *
+ * @param c  The first character of the value, already read.
+ */
+int argo_schema_long(long *value, int c, FILE *f) {
+    int negative = c == ARGO_MINUS;
+    if (negative)
+        c = argo_getc(f);
+    if (!argo_is_digit(c)) {
+        argo_schema_error("Expected an integer", c);
+        return 1;
+    }
+    unsigned long limit = negative ? (unsigned long)LONG_MAX + 1 : LONG_MAX;
+    unsigned long magnitude = c - ARGO_DIGIT0;
+    int first = c;
+    while (1) {
+        c = argo_getc(f);
+        if (!argo_is_digit(c))
+            break;
+        if (first == ARGO_DIGIT0) {
+            argo_schema_error("Invalid number", c);
+            return 1;
+        }
+        if (magnitude > (limit - (c - ARGO_DIGIT0)) / 10) {
+            fprintf(stderr, "[%d] Integer out of range\n", argo_lines_read);
+            return 1;
+        }
+        magnitude = magnitude * 10 + (c - ARGO_DIGIT0);
+    }
+    if (c == ARGO_PERIOD || c == ARGO_E || c == 'E') {
+        fprintf(stderr, "[%d] Expected an integer\n", argo_lines_read);
+        return 1;
+    }
+    argo_ungetc(c, f);
+    *value = negative ? (long)(0 - magnitude) : (long)magnitude;
+    return 0;
+}
+
+/**
+ * @brief  Read a number.
+ *
+ * @param c  The first character of the value, already read.
+ */
+int argo_schema_double(double *value, int c, FILE *f) {
+    if (readNumber(c, f))
+        return 1;
+    if (argo_number_float(&number, value)) {
+        fprintf(stderr, "[%d] Number out of range\n", argo_lines_read);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Read a string into a field, reusing the field's buffer.
+ *
+ * @param c  The first character of the value, already read.
+ */
+int argo_schema_string(ARGO_STRING *value, int c, FILE *f) {
+    if (c != ARGO_QUOTE) {
+        argo_schema_error("Expected a string", c);
+        return 1;
+    }
+    (*value).length = 0;
+    return argo_read_string(value, f);
+}
+
+static int readLiteral(char *token, FILE *f) {
+    for (char *p = token + 1; *p != '\0'; p++) {
+        int c = argo_getc(f);
+        if (c != *p) {
+            argo_schema_error("Invalid literal", c);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Read "true" or "false".
+ *
+ * @param c  The first character of the value, already read.
+ */
+int argo_schema_boolean(int *value, int c, FILE *f) {
+    if (c == ARGO_T) {
+        *value = 1;
+        return readLiteral(ARGO_TRUE_TOKEN, f);
+    }
+    if (c == ARGO_F) {
+        *value = 0;
+        return readLiteral(ARGO_FALSE_TOKEN, f);
+    }
+    argo_schema_error("Expected true or false", c);
+    return 1;
+}
+
+/**
+ * @brief  Read and discard a value of any type, such as that of a member
+ * the schema does not describe.
+ *
+ * @param c  The first character of the value, already read.
+ */
+int argo_schema_skip(int c, FILE *f) {
+    if (c == ARGO_QUOTE) {
+        scratch.length = 0;
+        return argo_read_string(&scratch, f);
+    }
+    if (c == ARGO_T)
+        return readLiteral(ARGO_TRUE_TOKEN, f);
+    if (c == ARGO_F)
+        return readLiteral(ARGO_FALSE_TOKEN, f);
+    if (c == ARGO_N)
+        return readLiteral(ARGO_NULL_TOKEN, f);
+    if (c == ARGO_LBRACE || c == ARGO_LBRACK) {
+        int close = c == ARGO_LBRACE ? ARGO_RBRACE : ARGO_RBRACK;
+        c = argo_getc_nonblank(f);
+        if (c == close)
+            return 0;
+        while (1) {
+            if (close == ARGO_RBRACE) {
+                if (c != ARGO_QUOTE) {
+                    argo_schema_error("Expected member name", c);
+                    return 1;
+                }
+                if (argo_schema_key(&scratch, f))
+                    return 1;
+                c = argo_getc_nonblank(f);
+            }
+            if (argo_schema_skip(c, f))
+                return 1;
+            c = argo_getc_nonblank(f);
+            if (c == close)
+                return 0;
+            if (c != ARGO_COMMA) {
+                argo_schema_error(close == ARGO_RBRACE ? "Expected ',' or '}' in object"
+                                  : "Expected ',' or ']' in array", c);
+                return 1;
+            }
+            c = argo_getc_nonblank(f);
+        }
+    }
+    return readNumber(c, f);
+}
+
+/**
+ * @brief  Make room for one more element of an array field.
+ *
+ * @param items  The elements, reallocated if full.
+ * @param capacity  The number of elements there is room for.
+ * @param count  The number of elements in use.
+ * @param size  The size of an element.
+ * @return  Zero if successful, nonzero if out of memory.
+ */
+int argo_schema_grow(void **items, size_t *capacity, size_t count, size_t size) {
+    if (count < *capacity)
+        return 0;
+    size_t grown = *capacity == 0 ? 8 : 2 * *capacity;
+    char *p = realloc(*items, grown * size);
+    if (p == NULL) {
+        fprintf(stderr, "[%d] Out of memory\n", argo_lines_read);
+        return 1;
+    }
+    // New elements start out empty, so that their buffers can be reused.
+    for (size_t i = *capacity * size; i < grown * size; i++)
+        *(p + i) = 0;
+    *items = p;
+    *capacity = grown;
+    return 0;
+}
+
+/**
+ * @brief  Write an integer field in canonical form.
+ * @return  Zero if successful, nonzero if there was an output error.
+ */
+int argo_schema_write_long(long value, FILE *f) {
+    ARGO_NUMBER n = {.int_value = value, .valid_int = 1};
+    return argo_write_number(&n, f);
+}
+
+/**
+ * @brief  Write a number field in canonical form.
+ * @return  Zero if successful, nonzero if the value is infinite or NaN,
+ * which JSON cannot express, or if there was an output error.
+ */
+int argo_schema_write_double(double value, FILE *f) {
+    ARGO_NUMBER n = {.float_value = value, .valid_float = 1};
+    return argo_write_number(&n, f);
+}
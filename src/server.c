@@ -0,0 +1,426 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "document.h"
+#include "intern.h"
+#include "reader.h"
+#include "edit.h"
+#include "server.h"
+
+char *argo_serve_path = NULL;
+
+#define SERVE_EVENTS 64
+#define SERVE_READ 65536
+
+/*
+ * State of one client connection: the bytes received that do not yet make
+ * up a whole request, and the bytes of responses not yet sent.
+ */
+typedef struct argo_connection {
+    int fd;
+    char *in;
+    size_t in_used;
+    size_t in_capacity;
+    char *out;
+    size_t out_used;
+    size_t out_sent;
+    size_t out_capacity;
+    int writing;                      // Nonzero if waiting for EPOLLOUT.
+} ARGO_CONNECTION;
+
+static volatile sig_atomic_t stopping = 0;
+
+static void stop(int signal) {
+    stopping = 1;
+}
+
+static uint32_t getBig32(unsigned char *p) {
+    return ((uint32_t)*p << 24) | ((uint32_t)*(p + 1) << 16) | ((uint32_t)*(p + 2) << 8) | *(p + 3);
+}
+
+static void putBig32(unsigned char *p, uint32_t x) {
+    *p = x >> 24;
+    *(p + 1) = x >> 16;
+    *(p + 2) = x >> 8;
+    *(p + 3) = x;
+}
+
+/*
+ * Find the value that a JSON pointer refers to, or NULL if there is none.
+ */
+static ARGO_VALUE *resolvePointer(ARGO_VALUE *v, char *p, char *end, ARGO_STRING *name) {
+    while (v != NULL && p < end) {
+        if (*p != ARGO_FSLASH)
+            return NULL;
+        p = argo_pointer_token(p + 1, end, name);
+        if (p == NULL)
+            return NULL;
+        if ((*v).type == ARGO_OBJECT_TYPE) {
+            v = argo_object_member(v, name);
+        } else if ((*v).type == ARGO_ARRAY_TYPE) {
+            size_t index = 0;
+            size_t digit = 0;
+            if ((*name).length == 0 || ((*name).length > 1 && *(*name).content == '0'))
+                return NULL;
+            while (digit < (*name).length) {
+                ARGO_CHAR c = *((*name).content + digit);
+                if (!argo_is_digit(c))
+                    return NULL;
+                index = index * 10 + (c - '0');
+                digit++;
+            }
+            ARGO_VALUE *sentinel = (*v).content.array.element_list;
+            v = (*sentinel).next;
+            while (v != sentinel && index > 0) {
+                v = (*v).next;
+                index--;
+            }
+            if (v == sentinel)
+                return NULL;
+        } else {
+            return NULL;
+        }
+    }
+    return v;
+}
+
+/**
+ * @brief  Carry out one request of the daemon protocol.
+ * @details  The document in the body is parsed into argo_value_storage,
+ * after discarding whatever document was there, and the result of the
+ * operation is written to "out".  The operations are described in
+ * server.h.
+ *
+ * @param op  The operation code.
+ * @param body  The body of the request.
+ * @param length  The length of the body.
+ * @param out  Stream to which the output, or an error message, is written.
+ * @return  Zero if the request succeeded, nonzero if it failed.
+ */
+int argo_serve_request(int op, char *body, size_t length, FILE *out) {
+    static ARGO_STRING name;
+    char *pointer = body;
+    char *pointerEnd = body;
+    if (op == ARGO_OP_QUERY) {
+        while (pointerEnd < body + length && *pointerEnd != '\0')
+            pointerEnd++;
+        if (pointerEnd == body + length) {
+            fprintf(out, "Query has no document");
+            return 1;
+        }
+        length -= pointerEnd + 1 - body;
+        body = pointerEnd + 1;
+    } else if (op != ARGO_OP_VALIDATE && op != ARGO_OP_CANONICALIZE && op != ARGO_OP_PRETTY) {
+        fprintf(out, "Unknown operation 0x%02x", op);
+        return 1;
+    }
+    argo_document_reset();
+    argo_lines_read = 0;
+    FILE *in = length == 0 ? NULL : fmemopen(body, length, "r");
+    if (in == NULL) {
+        fprintf(out, "Empty document");
+        return 1;
+    }
+    ARGO_VALUE *v = argo_read_value(in);
+    int status = v == NULL || argo_read_end(in);
+    fclose(in);
+    if (status) {
+        fprintf(out, "[%d] Invalid document", argo_lines_read);
+        return 1;
+    }
+    if (op == ARGO_OP_QUERY) {
+        v = resolvePointer(v, pointer, pointerEnd, &name);
+        if (v == NULL) {
+            fprintf(out, "No value at the given pointer");
+            return 1;
+        }
+    }
+    if (op == ARGO_OP_VALIDATE)
+        return 0;
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    if (op == ARGO_OP_PRETTY)
+        global_options |= PRETTY_PRINT_OPTION | 4;
+    status = argo_write_value(v, out);
+    global_options = saved;
+    return status;
+}
+
+static int reserve(char **buffer, size_t *capacity, size_t needed) {
+    if (needed <= *capacity)
+        return 0;
+    size_t size = *capacity == 0 ? SERVE_READ : *capacity;
+    while (size < needed)
+        size *= 2;
+    char *grown = realloc(*buffer, size);
+    if (grown == NULL)
+        return 1;
+    *buffer = grown;
+    *capacity = size;
+    return 0;
+}
+
+static void closeConnection(int epfd, ARGO_CONNECTION *c) {
+    epoll_ctl(epfd, EPOLL_CTL_DEL, (*c).fd, NULL);
+    close((*c).fd);
+    free((*c).in);
+    free((*c).out);
+    free(c);
+}
+
+/*
+ * Send as much pending output as the socket will take, and ask to be told
+ * when it will take more if some is left.  Returns nonzero if the
+ * connection has failed.
+ */
+static int flushConnection(int epfd, ARGO_CONNECTION *c) {
+    while ((*c).out_sent < (*c).out_used) {
+        ssize_t n = write((*c).fd, (*c).out + (*c).out_sent, (*c).out_used - (*c).out_sent);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (n <= 0)
+            return 1;
+        (*c).out_sent += n;
+    }
+    if ((*c).out_sent == (*c).out_used)
+        (*c).out_sent = (*c).out_used = 0;
+    int writing = (*c).out_used != 0;
+    if (writing != (*c).writing) {
+        struct epoll_event event = {.events = EPOLLIN | (writing ? EPOLLOUT : 0), .data.ptr = c};
+        epoll_ctl(epfd, EPOLL_CTL_MOD, (*c).fd, &event);
+        (*c).writing = writing;
+    }
+    return 0;
+}
+
+/*
+ * Serve every whole request received on a connection.  The response body
+ * is formatted into "scratch", a memory stream reused from one request to
+ * the next.  Returns nonzero if the connection is to be closed.
+ */
+static int serveRequests(ARGO_CONNECTION *c, FILE *scratch, char **scratchText) {
+    size_t start = 0;
+    while ((*c).in_used - start >= ARGO_REQUEST_HEADER) {
+        unsigned char *header = (unsigned char *)(*c).in + start;
+        uint32_t length = getBig32(header + 1);
+        if (length > ARGO_REQUEST_MAX)
+            return 1;
+        if ((*c).in_used - start < ARGO_REQUEST_HEADER + length)
+            break;
+        struct timespec begin, end;
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        fseek(scratch, 0, SEEK_SET);
+        int status = argo_serve_request(*header, (char *)header + ARGO_REQUEST_HEADER, length, scratch);
+        fflush(scratch);
+        size_t bodyLength = ftell(scratch);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        long micros = (end.tv_sec - begin.tv_sec) * 1000000L + (end.tv_nsec - begin.tv_nsec) / 1000;
+        if (reserve(&(*c).out, &(*c).out_capacity, (*c).out_used + ARGO_RESPONSE_HEADER + bodyLength))
+            return 1;
+        unsigned char *response = (unsigned char *)(*c).out + (*c).out_used;
+        *response = status ? 1 : 0;
+        putBig32(response + 1, (uint32_t)micros);
+        putBig32(response + 5, (uint32_t)bodyLength);
+        unsigned char *text = response + ARGO_RESPONSE_HEADER;
+        size_t index = 0;
+        while (index < bodyLength) {
+            *(text + index) = *(*scratchText + index);
+            index++;
+        }
+        (*c).out_used += ARGO_RESPONSE_HEADER + bodyLength;
+        start += ARGO_REQUEST_HEADER + length;
+    }
+    size_t index = 0;
+    while (start + index < (*c).in_used) {
+        *((*c).in + index) = *((*c).in + start + index);
+        index++;
+    }
+    (*c).in_used -= start;
+    return 0;
+}
+
+/*
+ * Read what has arrived on a connection and serve it.  Returns nonzero if
+ * the connection is to be closed.
+ */
+static int readConnection(int epfd, ARGO_CONNECTION *c, FILE *scratch, char **scratchText) {
+    while (1) {
+        if (reserve(&(*c).in, &(*c).in_capacity, (*c).in_used + SERVE_READ))
+            return 1;
+        ssize_t n = read((*c).fd, (*c).in + (*c).in_used, (*c).in_capacity - (*c).in_used);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (n <= 0)
+            return 1;
+        (*c).in_used += n;
+        if (serveRequests(c, scratch, scratchText))
+            return 1;
+    }
+    return flushConnection(epfd, c);
+}
+
+static void acceptConnections(int epfd, int listener) {
+    while (1) {
+        int fd = accept(listener, NULL, NULL);
+        if (fd < 0)
+            return;
+        ARGO_CONNECTION *c = calloc(1, sizeof(ARGO_CONNECTION));
+        if (c == NULL || fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+        (*c).fd = fd;
+        struct epoll_event event = {.events = EPOLLIN, .data.ptr = c};
+        if (epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &event) < 0) {
+            close(fd);
+            free(c);
+        }
+    }
+}
+
+/*
+ * Body of each worker process.
+ */
+static void serveWorker(int listener) {
+    /* Fault in this process's copy of the value storage once, up front. */
+    volatile char *page = (volatile char *)argo_value_storage;
+    while (page < (volatile char *)(argo_value_storage + NUM_ARGO_VALUES)) {
+        *page = 0;
+        page += 4096;
+    }
+    char *scratchText = NULL;
+    size_t scratchLength = 0;
+    FILE *scratch = open_memstream(&scratchText, &scratchLength);
+    int epfd = epoll_create1(0);
+    struct epoll_event event = {.events = EPOLLIN | EPOLLEXCLUSIVE, .data.ptr = NULL};
+    if (scratch == NULL || epfd < 0 || epoll_ctl(epfd, EPOLL_CTL_ADD, listener, &event) < 0) {
+        fprintf(stderr, "Failed to start worker\n");
+        exit(EXIT_FAILURE);
+    }
+    struct epoll_event events[SERVE_EVENTS];
+    while (!stopping) {
+        int n = epoll_wait(epfd, events, SERVE_EVENTS, -1);
+        int index = 0;
+        while (index < n) {
+            ARGO_CONNECTION *c = events[index].data.ptr;
+            if (c == NULL) {
+                acceptConnections(epfd, listener);
+            } else {
+                int failed = 0;
+                if (events[index].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                    failed = readConnection(epfd, c, scratch, &scratchText);
+                if (!failed && (events[index].events & EPOLLOUT))
+                    failed = flushConnection(epfd, c);
+                if (failed)
+                    closeConnection(epfd, c);
+            }
+            index++;
+        }
+    }
+    exit(EXIT_SUCCESS);
+}
+
+/**
+ * @brief  Serve requests on a Unix domain socket until interrupted.
+ * @details  The socket is created at "path" (replacing any socket already
+ * there), and the given number of worker processes is started to serve it.
+ * When SIGINT or SIGTERM is received, the workers are stopped and the
+ * socket is removed.
+ *
+ * @param path  Path of the socket.
+ * @param workers  Number of worker processes; zero means one per online
+ * processor.
+ * @return  Zero when the daemon has been stopped, nonzero if it could not
+ * be started.
+ */
+int argo_serve(char *path, int workers) {
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    size_t length = 0;
+    while (*(path + length) != '\0')
+        length++;
+    if (length >= sizeof(address.sun_path)) {
+        fprintf(stderr, "Socket path is too long: %s\n", path);
+        return 1;
+    }
+    while (length > 0) {
+        length--;
+        *(address.sun_path + length) = *(path + length);
+    }
+    struct stat info;
+    if (stat(path, &info) == 0 && S_ISSOCK(info.st_mode))
+        unlink(path);
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0 || bind(listener, (struct sockaddr *)&address, sizeof(address)) < 0
+        || listen(listener, SOMAXCONN) < 0
+        || fcntl(listener, F_SETFL, fcntl(listener, F_GETFL) | O_NONBLOCK) < 0) {
+        perror(path);
+        return 1;
+    }
+    if (workers == 0)
+        workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (workers < 1)
+        workers = 1;
+    signal(SIGPIPE, SIG_IGN);
+    struct sigaction action = {.sa_handler = stop};
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    pid_t *pids = calloc(workers, sizeof(pid_t));
+    if (pids == NULL) {
+        fprintf(stderr, "Failed to allocate space for workers\n");
+        return 1;
+    }
+    int index = 0;
+    while (index < workers) {
+        *(pids + index) = fork();
+        if (*(pids + index) == 0)
+            serveWorker(listener);
+        index++;
+    }
+    fprintf(stderr, "Serving on %s with %d workers\n", path, workers);
+    while (!stopping) {
+        pid_t pid = wait(NULL);
+        if (pid < 0 && errno == ECHILD)
+            break;
+        index = 0;
+        while (pid > 0 && !stopping && index < workers) {
+            /* Replace a worker that has died. */
+            if (*(pids + index) == pid) {
+                *(pids + index) = fork();
+                if (*(pids + index) == 0)
+                    serveWorker(listener);
+            }
+            index++;
+        }
+    }
+    index = 0;
+    while (index < workers) {
+        if (*(pids + index) > 0)
+            kill(*(pids + index), SIGTERM);
+        index++;
+    }
+    while (wait(NULL) > 0 || errno == EINTR)
+        continue;
+    free(pids);
+    close(listener);
+    unlink(path);
+    return 0;
+}
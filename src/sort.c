@@ -0,0 +1,192 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "sort.h"
+
+ARGO_VALUE **argo_sorted_links = NULL;
+
+#define inStorage(v) ((v) >= argo_value_storage && (v) < argo_value_storage + NUM_ARGO_VALUES)
+#define linkOf(v) (*(argo_sorted_links + ((v) - argo_value_storage)))
+
+/*
+ * Number of runs a list can be split into while it is sorted: a list of
+ * fewer than 2^SORT_BINS members never needs more.
+ */
+#define SORT_BINS 32
+
+/*
+ * Key by which a code point sorts among UTF-16 code units.  A code point
+ * beyond U+FFFF is a surrogate pair, whose high surrogate (D800 to DBFF)
+ * sorts before the code points from U+E000 to U+FFFF, though the code
+ * point itself is larger; the key puts the first code unit in the upper
+ * bits and the low ten bits of the pair below it.
+ */
+#define utf16Key(c) \
+    ((unsigned int)(c) < 0x10000 ? (unsigned long)(c) << 10 \
+     : ((0xD7C0UL + ((unsigned int)(c) >> 10)) << 10) | ((unsigned int)(c) & 0x3FF))
+
+/**
+ * @brief  Compare two member names in the order of RFC 8785.
+ *
+ * @return  A negative number, zero or a positive number as "a" sorts
+ * before, together with or after "b".
+ */
+int argo_compare_names(ARGO_STRING *a, ARGO_STRING *b) {
+    size_t length = (*a).length < (*b).length ? (*a).length : (*b).length;
+    ARGO_CHAR *p = (*a).content;
+    ARGO_CHAR *q = (*b).content;
+    if (p != q) {
+        for (size_t i = 0; i < length; i++) {
+            ARGO_CHAR x = *(p + i);
+            ARGO_CHAR y = *(q + i);
+            if (x != y)
+                return utf16Key(x) < utf16Key(y) ? -1 : 1;
+        }
+    }
+    return (*a).length < (*b).length ? -1 : (*a).length > (*b).length ? 1 : 0;
+}
+
+/*
+ * Merge two sorted runs linked through argo_sorted_links and ended by
+ * "end".  The members of "a" were read before those of "b", and come first
+ * among equal names.
+ */
+static ARGO_VALUE *merge(ARGO_VALUE *a, ARGO_VALUE *b, ARGO_VALUE *end) {
+    ARGO_VALUE *head = end;
+    ARGO_VALUE **tail = &head;
+    while (a != end && b != end) {
+        if (argo_compare_names(&(*b).name, &(*a).name) < 0) {
+            *tail = b;
+            tail = &linkOf(b);
+            b = linkOf(b);
+        } else {
+            *tail = a;
+            tail = &linkOf(a);
+            a = linkOf(a);
+        }
+    }
+    *tail = a != end ? a : b;
+    return head;
+}
+
+/*
+ * Link the members of a list in sorted order.  A list that is already in
+ * order, as the objects of canonical output are, is recognized in one pass.
+ * Otherwise each member is merged into runs whose lengths are powers of
+ * two, as a binary counter is incremented, and the runs are merged at the
+ * end, which sorts in O(n log n) comparisons without allocating.
+ */
+static ARGO_VALUE *sortList(ARGO_VALUE *sentinel) {
+    ARGO_VALUE *m = (*sentinel).next;
+    while (m != sentinel && (*m).next != sentinel
+           && argo_compare_names(&(*m).name, &(*(*m).next).name) <= 0)
+        m = (*m).next;
+    if (m == sentinel || (*m).next == sentinel) {
+        for (m = (*sentinel).next; m != sentinel; m = (*m).next)
+            linkOf(m) = (*m).next;
+        return (*sentinel).next;
+    }
+    ARGO_VALUE *bins[SORT_BINS];
+    for (int i = 0; i < SORT_BINS; i++)
+        bins[i] = sentinel;
+    for (m = (*sentinel).next; m != sentinel; m = (*m).next) {
+        ARGO_VALUE *run = m;
+        linkOf(m) = sentinel;
+        int i = 0;
+        while (i < SORT_BINS - 1 && bins[i] != sentinel) {
+            run = merge(bins[i], run, sentinel);
+            bins[i] = sentinel;
+            i++;
+        }
+        bins[i] = i == SORT_BINS - 1 ? merge(bins[i], run, sentinel) : run;
+    }
+    ARGO_VALUE *sorted = sentinel;
+    for (int i = 0; i < SORT_BINS; i++)
+        if (bins[i] != sentinel)
+            sorted = merge(bins[i], sorted, sentinel);
+    return sorted;
+}
+
+/**
+ * @brief  Get the first member of an object in sorted order.
+ * @details  The members are sorted, if they have not been since the object
+ * was read; argo_sorted_next() then gives the rest of them.  This is not
+ * safe to call on one object from several threads at once: see
+ * argo_sort_tree().
+ *
+ * @param sentinel  The sentinel of the object's member list.
+ * @return  The first member, or "sentinel" if there are none.
+ */
+ARGO_VALUE *argo_sorted_first(ARGO_VALUE *sentinel) {
+    if (!inStorage(sentinel))
+        return argo_sorted_after(sentinel, NULL);
+    if (argo_sorted_links == NULL) {
+        argo_sorted_links = calloc(NUM_ARGO_VALUES, sizeof(ARGO_VALUE *));
+        if (argo_sorted_links == NULL)
+            return argo_sorted_after(sentinel, NULL);
+    }
+    if (linkOf(sentinel) == NULL)
+        linkOf(sentinel) = sortList(sentinel);
+    return linkOf(sentinel);
+}
+
+/**
+ * @brief  Find the member that follows another in sorted order by scanning
+ * the list.
+ * @details  This is how argo_sorted_next() orders an object that has no
+ * entries in argo_sorted_links.  It takes time proportional to the number
+ * of members.
+ *
+ * @param sentinel  The sentinel of the object's member list.
+ * @param member  A member of the list, or NULL for the first.
+ * @return  The next member, or "sentinel" after the last one.
+ */
+ARGO_VALUE *argo_sorted_after(ARGO_VALUE *sentinel, ARGO_VALUE *member) {
+    ARGO_VALUE *best = NULL;
+    int passed = member == NULL;
+    for (ARGO_VALUE *m = (*sentinel).next; m != sentinel; m = (*m).next) {
+        if (m == member) {
+            passed = 1;
+            continue;
+        }
+        if (member != NULL) {
+            int order = argo_compare_names(&(*m).name, &(*member).name);
+            if (order < 0 || (order == 0 && !passed))
+                continue;
+        }
+        if (best == NULL || argo_compare_names(&(*m).name, &(*best).name) < 0)
+            best = m;
+    }
+    return best != NULL ? best : sentinel;
+}
+
+/**
+ * @brief  Sort the members of every object in a value.
+ * @details  Writing a value sorts its objects as it reaches them.  Threads
+ * that write parts of one value at once must not do so, since an object
+ * can be reachable from more than one part when it is shared (see
+ * hashcons.h); argo_write_value_parallel() calls this first instead.
+ *
+ * @param v  The value.
+ * @return  Zero if successful, nonzero if out of memory.
+ */
+int argo_sort_tree(ARGO_VALUE *v) {
+    ARGO_VALUE *sentinel;
+    if ((*v).type == ARGO_OBJECT_TYPE) {
+        sentinel = (*v).content.object.member_list;
+        argo_sorted_first(sentinel);
+        if (argo_sorted_links == NULL && inStorage(sentinel))
+            return 1;
+    } else if ((*v).type == ARGO_ARRAY_TYPE) {
+        sentinel = (*v).content.array.element_list;
+    } else {
+        return 0;
+    }
+    for (ARGO_VALUE *e = (*sentinel).next; e != sentinel; e = (*e).next)
+        if (argo_sort_tree(e))
+            return 1;
+    return 0;
+}
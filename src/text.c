@@ -0,0 +1,69 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "text.h"
+
+/**
+ * @brief  Ensure that a string has room for a specified number of code points.
+ * @details  If the capacity of the string is less than "capacity", its
+ * content is reallocated to exactly that size; otherwise nothing is done.
+ * A string whose content it does not own (an interned name) is given a
+ * buffer of its own, which starts out empty.
+ *
+ * @return  Zero if successful, nonzero if memory could not be allocated.
+ */
+int argo_string_reserve(ARGO_STRING *s, size_t capacity) {
+    if (capacity <= (*s).capacity)
+        return 0;
+    if ((*s).capacity == 0) {
+        (*s).content = NULL;
+        (*s).length = 0;
+    }
+    ARGO_CHAR *content = realloc((*s).content, capacity * sizeof(ARGO_CHAR));
+    if (content == NULL) {
+        fprintf(stderr, "[%d] Failed to allocate space for string text", argo_lines_read);
+        return 1;
+    }
+    (*s).content = content;
+    (*s).capacity = capacity;
+    return 0;
+}
+
+/**
+ * @brief  Append a run of characters to a string.
+ * @details  This is the bulk form of argo_append_char().  The string grows
+ * at most once per call: to exactly the size needed when it has no
+ * content yet, to "hint" code points if a hint is given that is large
+ * enough, and otherwise by at least doubling, so that a string built from
+ * many runs without hints still grows geometrically.
+ *
+ * @param s  The string to append to.
+ * @param chars  The code points to append.
+ * @param count  The number of code points to append.
+ * @param hint  The expected final length of the string, or zero if unknown.
+ * @return  Zero if successful, nonzero if memory could not be allocated.
+ */
+int argo_append_chars(ARGO_STRING *s, ARGO_CHAR *chars, size_t count, size_t hint) {
+    size_t length = (*s).capacity == 0 ? 0 : (*s).length;
+    size_t need = length + count;
+    if (need > (*s).capacity) {
+        size_t capacity = need;
+        if (hint > capacity)
+            capacity = hint;
+        else if ((*s).capacity != 0 && capacity < (*s).capacity * 2)
+            capacity = (*s).capacity * 2;
+        if (argo_string_reserve(s, capacity))
+            return 1;
+    }
+    ARGO_CHAR *to = (*s).content + length;
+    size_t index = 0;
+    while (index < count) {
+        *(to + index) = *(chars + index);
+        index++;
+    }
+    (*s).length = need;
+    return 0;
+}
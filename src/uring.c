@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "uring.h"
+
+/**
+ * @brief  Set up an io_uring instance with room for "entries" reads in
+ * flight.
+ *
+ * @return  Zero if successful, nonzero if io_uring is not available.
+ */
+int argo_uring_init(ARGO_URING *ring, unsigned entries) {
+    struct io_uring_params params = {0};
+    *ring = (ARGO_URING){0};
+    int fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0)
+        return 1;
+    (*ring).fd = fd;
+    (*ring).entries = params.sq_entries;
+    (*ring).sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    (*ring).cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if ((*ring).cq_ring_size > (*ring).sq_ring_size)
+            (*ring).sq_ring_size = (*ring).cq_ring_size;
+        (*ring).cq_ring_size = 0;
+    }
+    (*ring).sq_ring = mmap(NULL, (*ring).sq_ring_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if ((*ring).sq_ring == MAP_FAILED) {
+        close(fd);
+        return 1;
+    }
+    if ((*ring).cq_ring_size == 0) {
+        (*ring).cq_ring = (*ring).sq_ring;
+    } else {
+        (*ring).cq_ring = mmap(NULL, (*ring).cq_ring_size, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if ((*ring).cq_ring == MAP_FAILED) {
+            munmap((*ring).sq_ring, (*ring).sq_ring_size);
+            close(fd);
+            return 1;
+        }
+    }
+    (*ring).sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    (*ring).sqes = mmap(NULL, (*ring).sqes_size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if ((*ring).sqes == MAP_FAILED) {
+        (*ring).sqes = NULL;
+        argo_uring_free(ring);
+        return 1;
+    }
+    char *sq = (*ring).sq_ring;
+    char *cq = (*ring).cq_ring;
+    (*ring).sq_head = (unsigned *)(sq + params.sq_off.head);
+    (*ring).sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    (*ring).sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    (*ring).sq_array = (unsigned *)(sq + params.sq_off.array);
+    (*ring).cq_head = (unsigned *)(cq + params.cq_off.head);
+    (*ring).cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    (*ring).cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    (*ring).cqes = cq + params.cq_off.cqes;
+    return 0;
+}
+
+/**
+ * @brief  Release an io_uring instance.
+ */
+void argo_uring_free(ARGO_URING *ring) {
+    if ((*ring).sqes != NULL)
+        munmap((*ring).sqes, (*ring).sqes_size);
+    if ((*ring).cq_ring != NULL && (*ring).cq_ring != (*ring).sq_ring)
+        munmap((*ring).cq_ring, (*ring).cq_ring_size);
+    if ((*ring).sq_ring != NULL)
+        munmap((*ring).sq_ring, (*ring).sq_ring_size);
+    if ((*ring).fd > 0)
+        close((*ring).fd);
+    *ring = (ARGO_URING){0};
+}
+
+/**
+ * @brief  Queue a read of a file.
+ * @details  The read is passed to the kernel by the next argo_uring_wait().
+ *
+ * @param tag  Value returned by argo_uring_wait() when the read completes.
+ * @return  Zero if the read was queued, nonzero if the ring is full.
+ */
+int argo_uring_read(ARGO_URING *ring, int fd, void *buffer, size_t length, off_t offset, uint64_t tag) {
+    unsigned tail = *(*ring).sq_tail;
+    if (tail - __atomic_load_n((*ring).sq_head, __ATOMIC_ACQUIRE) >= (*ring).entries)
+        return 1;
+    unsigned index = tail & *(*ring).sq_mask;
+    struct io_uring_sqe *sqe = (struct io_uring_sqe *)(*ring).sqes + index;
+    *sqe = (struct io_uring_sqe){0};
+    (*sqe).opcode = IORING_OP_READ;
+    (*sqe).fd = fd;
+    (*sqe).addr = (uint64_t)(uintptr_t)buffer;
+    (*sqe).len = (uint32_t)length;
+    (*sqe).off = (uint64_t)offset;
+    (*sqe).user_data = tag;
+    *((*ring).sq_array + index) = index;
+    __atomic_store_n((*ring).sq_tail, tail + 1, __ATOMIC_RELEASE);
+    (*ring).pending++;
+    return 0;
+}
+
+/**
+ * @brief  Submit queued reads and wait for one to complete.
+ *
+ * @param tag  Set to the tag of the read that completed.
+ * @param result  Set to the number of bytes read, or to a negative errno.
+ * @return  Zero if a read completed, nonzero on error.
+ */
+int argo_uring_wait(ARGO_URING *ring, uint64_t *tag, int *result) {
+    while (1) {
+        unsigned head = *(*ring).cq_head;
+        if (head != __atomic_load_n((*ring).cq_tail, __ATOMIC_ACQUIRE)) {
+            struct io_uring_cqe *cqe = (struct io_uring_cqe *)(*ring).cqes + (head & *(*ring).cq_mask);
+            *tag = (*cqe).user_data;
+            *result = (*cqe).res;
+            __atomic_store_n((*ring).cq_head, head + 1, __ATOMIC_RELEASE);
+            (*ring).inflight--;
+            return 0;
+        }
+        int submitted = (int)syscall(__NR_io_uring_enter, (*ring).fd, (*ring).pending, 1,
+                                     IORING_ENTER_GETEVENTS, NULL, 0);
+        if (submitted < 0) {
+            if (errno == EINTR)
+                continue;
+            return 1;
+        }
+        (*ring).pending -= submitted;
+        (*ring).inflight += submitted;
+    }
+}
+
+/**
+ * @brief  Wait for every read that has been submitted to complete, and
+ * discard the completions.
+ * @details  Reads that were queued but not submitted are never submitted.
+ *
+ * @return  Zero if no read is in flight any more, nonzero if waiting
+ * failed, in which case the buffers of the reads in flight must be left
+ * alone.
+ */
+int argo_uring_drain(ARGO_URING *ring) {
+    while ((*ring).inflight > 0) {
+        unsigned head = *(*ring).cq_head;
+        if (head != __atomic_load_n((*ring).cq_tail, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n((*ring).cq_head, head + 1, __ATOMIC_RELEASE);
+            (*ring).inflight--;
+            continue;
+        }
+        if (syscall(__NR_io_uring_enter, (*ring).fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0
+            && errno != EINTR)
+            return 1;
+    }
+    return 0;
+}
@@ -3,6 +3,13 @@
 #include "argo.h"
 #include "global.h"
 #include "debug.h"
+#include "options.h"
+#include "server.h"
+#include "batch.h"
+#include "diff.h"
+#include "digest.h"
+#include "columnar.h"
+#include "compress.h"
 
 /**
  * @brief Validates command line arguments passed to the program.
@@ -22,8 +29,8 @@
 int cmp(char *a, char *b) {
     if (a == NULL || b == NULL)
         return 11;
-    char ap = *a;
-    char bp = *b;
+    unsigned char ap = *a;
+    unsigned char bp = *b;
     int i = 1;
     while (ap != '\0') {
         if (bp == '\0')
@@ -51,6 +58,8 @@ int validDigit(char *indent) {
         index = index + 1;
         tmp = tmp - 48;
         converted = converted + (int)tmp;
+        if (converted > 0xFFFF)
+            return -1;
         tmp = *(indent + index);
     }
     // if (converted < 0 || converted > 255)
@@ -59,32 +68,86 @@ int validDigit(char *indent) {
     return converted;
 }
 
+/**
+ * @brief  Parse the optional INDENT that may follow -p.
+ * @details  The argument after -p is taken as the indent only if it starts
+ * with a digit, so that an operand following -p, such as a file name, is
+ * left alone; it must then be a number no greater than 0xFF.
+ *
+ * @param next  The argument after -p, or NULL if there is none.
+ * @param options  PRETTY_PRINT_OPTION and the indent (4 if none is given)
+ * are added to it.
+ * @return  The number of arguments used after -p (0 or 1), or -1 if the
+ * indent is invalid.
+ */
+int argo_indent_option(char *next, int *options) {
+    int indent = 4;
+    int used = 0;
+    if (next != NULL && *next >= '0' && *next <= '9') {
+        indent = validDigit(next);
+        if (indent < 0 || indent > 0xFF)
+            return -1;
+        used = 1;
+    }
+    *options |= PRETTY_PRINT_OPTION | indent;
+    return used;
+}
+
 int validargs(int argc, char **argv) {
     // TO BE IMPLEMENTED
     if (argc == 1)
         return -1;
     char *t = *(argv + 1);
+    if (cmp(t, "--serve") == 0) {
+        if (argc != 3)
+            return -1;
+        global_options |= SERVE_OPTION;
+        argo_serve_path = *(argv + 2);
+        return 0;
+    }
+    if (cmp(t, "--batch") == 0)
+        return argo_batch_args(argc - 2, argv + 2);
+    if (cmp(t, "--diff") == 0)
+        return argo_diff_args(argc - 2, argv + 2);
+    if (cmp(t, "--digest") == 0)
+        return argo_digest_args(argc - 2, argv + 2);
+    if (cmp(t, "--columns") == 0)
+        return argo_columns_args(argc - 2, argv + 2);
     if (cmp(t, "-h") == 0) {
         global_options |= 0x80000000;
         return 0;
     } else if (cmp(t, "-c") == 0) {
-        if (argc > 2)
-            t = *(argv + 2);
-        if (argc == 2) {
-            global_options |= 0x20000000;
-            return 0;
-        } else if (cmp(t, "-p") == 0) {
-            if (argc == 4) {
-                if (validDigit(*(argv + 3)) < 0)
+        int options = 0x20000000;
+        int index = 2;
+        while (index < argc) {
+            t = *(argv + index);
+            if (cmp(t, "-p") == 0 && (options & 0x10000000) == 0) {
+                int used = argo_indent_option(index + 1 < argc ? *(argv + index + 1) : NULL, &options);
+                if (used < 0)
+                    return -1;
+                index += used;
+            } else if (cmp(t, "-u") == 0 && (options & UTF8_OUTPUT_OPTION) == 0) {
+                options |= UTF8_OUTPUT_OPTION;
+            } else if (cmp(t, "-k") == 0 && (options & SORT_KEYS_OPTION) == 0) {
+                options |= SORT_KEYS_OPTION;
+            } else if (cmp(t, "-z") == 0 && (options & ZERO_COPY_OPTION) == 0) {
+                options |= ZERO_COPY_OPTION;
+            } else if (cmp(t, "-Z") == 0 && (options & (GZIP_OUTPUT_OPTION | ZSTD_OUTPUT_OPTION)) == 0
+                       && index + 1 < argc) {
+                int format = argo_format_named(*(argv + ++index));
+                if (format == ARGO_FORMAT_GZIP)
+                    options |= GZIP_OUTPUT_OPTION;
+                else if (format == ARGO_FORMAT_ZSTD)
+                    options |= ZSTD_OUTPUT_OPTION;
+                else
                     return -1;
-                global_options |= 0x30000000;
-                global_options |= (validDigit(*(argv + 3)));
-            } else if (argc > 4)
+            } else {
                 return -1;
-            if (argc == 3)
-                global_options |= 0x30000004;
-            return 0;
+            }
+            index++;
         }
+        global_options |= options;
+        return 0;
     } else if (cmp(t, "-v") == 0) {
         if (argc != 2)
             return -1;
@@ -0,0 +1,296 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "argo.h"
+#include "global.h"
+#include "debug.h"
+#include "options.h"
+#include "zerocopy.h"
+#include "sort.h"
+
+ARGO_SOURCE_SPANS *argo_spans = NULL;
+
+static char *sourceBase = NULL;
+static size_t sourceSize = 0;
+
+/*
+ * Number of pieces passed to each writev(), and the amount of formatted
+ * text that is allowed to accumulate before they are written.
+ */
+#define GATHER_BATCH 1024
+#define GATHER_SCRATCH (64 * 1024)
+
+/*
+ * Output being gathered for writev().  A piece whose "base" is NULL lies in
+ * the scratch stream, at the offset recorded for it; its address is only
+ * filled in just before the pieces are written, since the scratch buffer
+ * may move as it grows.
+ */
+typedef struct argo_gather {
+    int fd;
+    struct iovec vector[GATHER_BATCH];
+    size_t offset[GATHER_BATCH];
+    int used;
+    FILE *scratch;
+    char *scratch_text;
+    size_t scratch_length;
+    int pretty;
+    size_t indent;
+    int status;
+} ARGO_GATHER;
+
+/**
+ * @brief  Map a regular file being read so that its bytes can be reused
+ * for output.
+ * @details  If "f" is a nonempty regular file, it is mapped into memory and
+ * the parser starts recording the spans of literals that can be copied to
+ * canonical output unchanged.
+ *
+ * @param f  The stream from which the value will be read.
+ * @return  Zero if the file was mapped, nonzero if it cannot be (in which
+ * case the zero-copy writer falls back to argo_write_value()).
+ */
+int argo_source_map(FILE *f) {
+    struct stat info;
+    int fd = fileno(f);
+    if (fd == -1 || fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0)
+        return 1;
+    void *base = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (base == MAP_FAILED)
+        return 1;
+    argo_spans = calloc(NUM_ARGO_VALUES, sizeof(ARGO_SOURCE_SPANS));
+    if (argo_spans == NULL) {
+        fprintf(stderr, "Failed to allocate space for source spans\n");
+        munmap(base, info.st_size);
+        return 1;
+    }
+    sourceBase = base;
+    sourceSize = info.st_size;
+    return 0;
+}
+
+/**
+ * @brief  Release the mapping made by argo_source_map() and stop recording
+ * spans.
+ */
+void argo_source_unmap(void) {
+    if (sourceBase != NULL)
+        munmap(sourceBase, sourceSize);
+    free(argo_spans);
+    argo_spans = NULL;
+    sourceBase = NULL;
+    sourceSize = 0;
+}
+
+static void flushGather(ARGO_GATHER *g) {
+    if ((*g).used == 0)
+        return;
+    fflush((*g).scratch);
+    struct iovec *vector = (*g).vector;
+    int count = (*g).used;
+    int index = 0;
+    while (index < count) {
+        if ((*(vector + index)).iov_base == NULL)
+            (*(vector + index)).iov_base = (*g).scratch_text + *((*g).offset + index);
+        index++;
+    }
+    while (count > 0 && (*g).status == 0) {
+        ssize_t written = writev((*g).fd, vector, count);
+        if (written < 0) {
+            fprintf(stderr, "Failed to write output\n");
+            (*g).status = 1;
+            break;
+        }
+        while (count > 0 && (size_t)written >= (*vector).iov_len) {
+            written -= (*vector).iov_len;
+            vector++;
+            count--;
+        }
+        if (count > 0) {
+            (*vector).iov_base = (char *)(*vector).iov_base + written;
+            (*vector).iov_len -= written;
+        }
+    }
+    (*g).used = 0;
+    fseek((*g).scratch, 0, SEEK_SET);
+}
+
+/*
+ * Make room for one more piece, writing out those gathered so far if the
+ * list or the scratch text is full.  This is done before anything is added
+ * to the scratch stream, since writing out the pieces rewinds it.
+ */
+static void reserveGather(ARGO_GATHER *g) {
+    if ((*g).used == GATHER_BATCH || ftell((*g).scratch) >= GATHER_SCRATCH)
+        flushGather(g);
+}
+
+/*
+ * Add a piece that points into the source.
+ */
+static void gatherSource(ARGO_GATHER *g, ARGO_SPAN *span) {
+    reserveGather(g);
+    (*((*g).vector + (*g).used)).iov_base = sourceBase + (*span).offset;
+    (*((*g).vector + (*g).used)).iov_len = (*span).length;
+    (*g).used++;
+}
+
+/*
+ * Add the text written to the scratch stream since offset "start", which
+ * extends the previous piece when that one ends where the text begins.
+ */
+static void gatherScratch(ARGO_GATHER *g, long start) {
+    long end = ftell((*g).scratch);
+    if (end <= start)
+        return;
+    int last = (*g).used - 1;
+    if (last >= 0 && (*((*g).vector + last)).iov_base == NULL
+        && *((*g).offset + last) + (*((*g).vector + last)).iov_len == (size_t)start) {
+        (*((*g).vector + last)).iov_len += end - start;
+        return;
+    }
+    (*((*g).vector + (*g).used)).iov_base = NULL;
+    (*((*g).vector + (*g).used)).iov_len = end - start;
+    *((*g).offset + (*g).used) = start;
+    (*g).used++;
+}
+
+/*
+ * Write a name, string or number from the source if its span is usable,
+ * otherwise by formatting it into the scratch stream.  Literals true, false
+ * and null (for which "span" is NULL) are formatted too.
+ */
+static void gatherLiteral(ARGO_GATHER *g, ARGO_VALUE *v, ARGO_SPAN *span, int name) {
+    if (span != NULL && (*span).length != 0 && (*span).offset + (*span).length <= sourceSize) {
+        gatherSource(g, span);
+        return;
+    }
+    reserveGather(g);
+    long start = ftell((*g).scratch);
+    int status = 0;
+    if (name)
+        status = argo_write_string(&(*v).name, (*g).scratch);
+    else if ((*v).type == ARGO_STRING_TYPE)
+        status = argo_write_string(&(*v).content.string, (*g).scratch);
+    else if ((*v).type == ARGO_NUMBER_TYPE)
+        status = argo_write_number(&(*v).content.number, (*g).scratch);
+    else if ((*v).type == ARGO_BASIC_TYPE && (*v).content.basic == ARGO_TRUE)
+        fputs(ARGO_TRUE_TOKEN, (*g).scratch);
+    else if ((*v).type == ARGO_BASIC_TYPE && (*v).content.basic == ARGO_FALSE)
+        fputs(ARGO_FALSE_TOKEN, (*g).scratch);
+    else if ((*v).type == ARGO_BASIC_TYPE && (*v).content.basic == ARGO_NULL)
+        fputs(ARGO_NULL_TOKEN, (*g).scratch);
+    else
+        status = 1;
+    if (status)
+        (*g).status = 1;
+    gatherScratch(g, start);
+}
+
+static void gatherIndent(ARGO_GATHER *g, size_t depth) {
+    reserveGather(g);
+    long start = ftell((*g).scratch);
+    size_t count = depth * (*g).indent;
+    fputc(ARGO_LF, (*g).scratch);
+    while (count > 0) {
+        fputc(ARGO_SPACE, (*g).scratch);
+        count--;
+    }
+    gatherScratch(g, start);
+}
+
+static void gatherChar(ARGO_GATHER *g, int c) {
+    reserveGather(g);
+    long start = ftell((*g).scratch);
+    fputc(c, (*g).scratch);
+    gatherScratch(g, start);
+}
+
+/*
+ * Lay out a value as writer_variant.h does.
+ */
+static void gatherValue(ARGO_GATHER *g, ARGO_VALUE *v, size_t depth) {
+    ARGO_VALUE *sentinel;
+    int object;
+    if ((*v).type == ARGO_OBJECT_TYPE) {
+        sentinel = (*v).content.object.member_list;
+        object = 1;
+    } else if ((*v).type == ARGO_ARRAY_TYPE) {
+        sentinel = (*v).content.array.element_list;
+        object = 0;
+    } else if ((*v).type == ARGO_STRING_TYPE || (*v).type == ARGO_NUMBER_TYPE) {
+        gatherLiteral(g, v, &(*(argo_spans + (v - argo_value_storage))).value, 0);
+        return;
+    } else {
+        gatherLiteral(g, v, NULL, 0);
+        return;
+    }
+    gatherChar(g, object ? ARGO_LBRACE : ARGO_LBRACK);
+    int sorted = object && (global_options & SORT_KEYS_OPTION) != 0;
+    ARGO_VALUE *node = sorted ? argo_sorted_first(sentinel) : (*sentinel).next;
+    if (node != sentinel) {
+        while ((*g).status == 0) {
+            if ((*g).pretty)
+                gatherIndent(g, depth + 1);
+            if (object) {
+                gatherLiteral(g, node, &(*(argo_spans + (node - argo_value_storage))).name, 1);
+                gatherChar(g, ARGO_COLON);
+                if ((*g).pretty)
+                    gatherChar(g, ARGO_SPACE);
+            }
+            gatherValue(g, node, depth + 1);
+            node = sorted ? argo_sorted_next(sentinel, node) : (*node).next;
+            if (node == sentinel)
+                break;
+            gatherChar(g, ARGO_COMMA);
+        }
+        if ((*g).pretty)
+            gatherIndent(g, depth);
+    }
+    gatherChar(g, object ? ARGO_RBRACE : ARGO_RBRACK);
+}
+
+/**
+ * @brief  Write canonical JSON representing a value read from a mapped
+ * source, reusing the bytes of the source where possible.
+ * @details  The output is that of argo_write_value().  If the source was not
+ * mapped, or "f" has no file descriptor, argo_write_value() is used.
+ *
+ * @param v  Data structure representing a value.
+ * @param f  Output stream to which JSON is to be written.
+ * @return  Zero if the operation is completely successful,
+ * nonzero if there is any error.
+ */
+int argo_write_value_zero_copy(ARGO_VALUE *v, FILE *f) {
+    if (argo_spans == NULL || fileno(f) == -1 || fflush(f) != 0)
+        return argo_write_value(v, f);
+    ARGO_GATHER *g = malloc(sizeof(ARGO_GATHER));
+    if (g == NULL) {
+        fprintf(stderr, "Failed to allocate space for output\n");
+        return 1;
+    }
+    (*g).fd = fileno(f);
+    (*g).used = 0;
+    (*g).pretty = (global_options & PRETTY_PRINT_OPTION) != 0;
+    (*g).indent = global_options & 0xFF;
+    (*g).status = 0;
+    (*g).scratch_text = NULL;
+    (*g).scratch = open_memstream(&(*g).scratch_text, &(*g).scratch_length);
+    if ((*g).scratch == NULL) {
+        free(g);
+        return argo_write_value(v, f);
+    }
+    gatherValue(g, v, 0);
+    if ((*g).pretty)
+        gatherChar(g, ARGO_LF);
+    flushGather(g);
+    int status = (*g).status;
+    fclose((*g).scratch);
+    free((*g).scratch_text);
+    free(g);
+    return status;
+}
@@ -0,0 +1,949 @@
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "argo.h"
+#include "global.h"
+#include "intern.h"
+#include "text.h"
+#include "compact.h"
+#include "number.h"
+#include "parallel.h"
+#include "zerocopy.h"
+#include "server.h"
+#include "batch.h"
+#include "pipeline.h"
+#include "compress.h"
+#include "reader.h"
+#include "schema.h"
+#include "embed.h"
+#include "hashcons.h"
+#include "document.h"
+#include "diff.h"
+#include "options.h"
+#include "sort.h"
+#include "digest.h"
+#include "edit.h"
+#include "columnar.h"
+#include "cursor.h"
+#include "order.h"
+
+static ARGO_VALUE *read_from_string(char *text) {
+    FILE *f = fmemopen(text, strlen(text), "r");
+    ARGO_VALUE *v = argo_read_value(f);
+    fclose(f);
+    return v;
+}
+
+Test(argo_suite, intern_shares_names) {
+    argo_intern_clear();
+    argo_intern_enabled = 1;
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("{\"version\":\"1\",\"dev\":\"2\",\"inner\":{\"version\":\"3\"}}");
+    argo_intern_enabled = 0;
+    cr_assert_not_null(v, "Object was not read");
+    cr_assert_eq(argo_intern_count, 3, "Expected 3 distinct names, got %zu", argo_intern_count);
+
+    ARGO_STRING key = {0};
+    argo_append_char(&key, 'v');
+    argo_append_char(&key, 'e');
+    argo_append_char(&key, 'r');
+    argo_append_char(&key, 's');
+    argo_append_char(&key, 'i');
+    argo_append_char(&key, 'o');
+    argo_append_char(&key, 'n');
+    ARGO_VALUE *outer = argo_object_member(v, &key);
+    cr_assert_not_null(outer, "Member \"version\" not found");
+    ARGO_STRING inner_key = {0};
+    argo_append_char(&inner_key, 'i');
+    argo_append_char(&inner_key, 'n');
+    argo_append_char(&inner_key, 'n');
+    argo_append_char(&inner_key, 'e');
+    argo_append_char(&inner_key, 'r');
+    ARGO_VALUE *inner = argo_object_member(argo_object_member(v, &inner_key), &key);
+    cr_assert_not_null(inner, "Nested member \"version\" not found");
+    cr_assert_eq((*outer).name.content, (*inner).name.content,
+                 "Equal names do not share interned storage");
+}
+
+Test(argo_suite, surrogate_pair_decoding) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("\"a\\ud83d\\ude00\\u00e9\"");
+    cr_assert_not_null(v, "String was not read");
+    ARGO_STRING *s = &(*v).content.string;
+    cr_assert_eq((*s).length, 3, "Expected 3 code points, got %zu", (*s).length);
+    cr_assert_eq(*((*s).content + 1), 0x1F600, "Surrogate pair decoded as 0x%x",
+                 *((*s).content + 1));
+    cr_assert_eq(*((*s).content + 2), 0xE9, "Escape decoded as 0x%x", *((*s).content + 2));
+}
+
+Test(argo_suite, append_chars_sizes_once) {
+    ARGO_CHAR run[100];
+    int i = 0;
+    while (i < 100) {
+        run[i] = 'a' + (i % 26);
+        i++;
+    }
+    ARGO_STRING s = {0};
+    cr_assert_eq(argo_append_chars(&s, run, 100, 0), 0, "Append failed");
+    cr_assert_eq(s.capacity, 100, "Expected exact capacity 100, got %zu", s.capacity);
+    ARGO_STRING t = {0};
+    argo_append_chars(&t, run, 10, 1000);
+    argo_append_chars(&t, run, 100, 1000);
+    cr_assert_eq(t.capacity, 1000, "Size hint not honored, capacity %zu", t.capacity);
+    cr_assert_eq(t.length, 110, "Expected length 110, got %zu", t.length);
+    cr_assert_eq(t.content[109], run[99], "Content not appended correctly");
+}
+
+Test(argo_suite, compact_round_trip) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("{\"a\":[1,-2,140737488355328,0.5],\"b\":\"xy\",\"a\":\"z\"}");
+    cr_assert_not_null(v, "Object was not read");
+    ARGO_COMPACT c = {0};
+    uint32_t root = argo_compact_build(&c, v);
+    cr_assert_neq(root, 0, "Compact build failed");
+    cr_assert_eq(sizeof(ARGO_CNODE), 16, "Compact node is %zu bytes", sizeof(ARGO_CNODE));
+    cr_assert_eq(argo_cnode_type(&c, root), ARGO_OBJECT_TYPE, "Root is not an object");
+    uint32_t a = argo_cnode_first(&c, root);
+    uint32_t b = argo_cnode_next(&c, a);
+    uint32_t a2 = argo_cnode_next(&c, b);
+    cr_assert_eq(argo_cnode_name_id(&c, a), argo_cnode_name_id(&c, a2), "Equal names differ");
+    cr_assert_neq(argo_cnode_name_id(&c, a), argo_cnode_name_id(&c, b), "Distinct names equal");
+    uint32_t e = argo_cnode_first(&c, a);
+    cr_assert_eq(argo_cnode_int(&c, e), 1, "First element wrong");
+    e = argo_cnode_next(&c, e);
+    cr_assert_eq(argo_cnode_int(&c, e), -2, "Second element wrong");
+    e = argo_cnode_next(&c, e);
+    cr_assert_eq(argo_cnode_int(&c, e), 140737488355328L, "Wide integer wrong");
+    e = argo_cnode_next(&c, e);
+    cr_assert(!argo_cnode_is_int(&c, e), "Fraction stored as integer");
+    cr_assert_eq(argo_cnode_float(&c, e), 0.5, "Fraction wrong");
+    argo_compact_free(&c);
+}
+
+Test(argo_suite, lazy_number_conversion) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("[1234,0.25e2,2.5e1]");
+    cr_assert_not_null(v, "Array was not read");
+    ARGO_VALUE *first = (*(*v).content.array.element_list).next;
+    ARGO_NUMBER *n = &(*first).content.number;
+    cr_assert_eq((*n).valid_float, 0, "Number converted eagerly");
+    cr_assert_eq((*n).valid_string, ARGO_CANONICAL_TEXT, "Canonical integer not recognized");
+    long i;
+    cr_assert_eq(argo_number_int(n, &i), 0, "Integer not available");
+    cr_assert_eq(i, 1234, "Expected 1234, got %ld", i);
+    ARGO_NUMBER *second = &(*(*first).next).content.number;
+    ARGO_NUMBER *third = &(*(*(*first).next).next).content.number;
+    cr_assert_eq((*second).valid_string, ARGO_CANONICAL_TEXT, "Canonical fraction not recognized");
+    cr_assert_eq((*third).valid_string, 1, "Non-canonical text marked canonical");
+    double d;
+    cr_assert_eq(argo_number_float(third, &d), 0, "Float not available");
+    cr_assert_eq(d, 25.0, "Expected 25, got %f", d);
+    cr_assert_neq(argo_number_int(third, &i), 0, "Fraction reported as integer");
+}
+
+Test(argo_suite, out_of_range_numbers_rejected) {
+    argo_next_value = 0;
+    cr_assert_null(read_from_string("[1e400]"), "Overflowing exponent accepted");
+    cr_assert_null(read_from_string("[-0.2e309]"), "Overflowing fraction accepted");
+    char digits[400];
+    memset(digits, '9', sizeof(digits) - 1);
+    digits[sizeof(digits) - 1] = '\0';
+    cr_assert_null(read_from_string(digits), "Overflowing integer accepted");
+    ARGO_VALUE *v = read_from_string("[0.1e309, 1e-400]");
+    cr_assert_not_null(v, "Numbers in range rejected");
+    ARGO_VALUE *first = (*(*v).content.array.element_list).next;
+    double d;
+    cr_assert_eq(argo_number_float(&(*first).content.number, &d), 0, "Float not available");
+    cr_assert_eq(d, 1e308, "Expected 1e308, got %g", d);
+    cr_assert_eq(argo_number_float(&(*(*first).next).content.number, &d), 0, "Underflow rejected");
+    cr_assert_eq(d, 0.0, "Expected 0, got %g", d);
+    ARGO_NUMBER n = {0};
+    argo_append_chars(&n.string_value, (ARGO_CHAR[]){'1', 'e', '9', '9', '9'}, 5, 0);
+    n.valid_string = 1;
+    cr_assert_neq(argo_number_float(&n, &d), 0, "Overflow converted");
+    cr_assert_eq(n.valid_float, 0, "Overflow marked valid");
+    free(n.string_value.content);
+}
+
+Test(argo_suite, non_finite_numbers_not_written) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("[1.5]");
+    cr_assert_not_null(v, "Array was not read");
+    ARGO_NUMBER *n = &(*(*(*v).content.array.element_list).next).content.number;
+    double values[] = {__builtin_inf(), -__builtin_inf(), __builtin_nan("")};
+    for (int i = 0; i < 3; i++) {
+        *n = (ARGO_NUMBER){.float_value = values[i], .valid_float = 1};
+        FILE *f = tmpfile();
+        cr_assert_neq(argo_write_value(v, f), 0, "Value %d written", i);
+        cr_assert_neq(argo_write_value_parallel(v, f, 2), 0, "Value %d written in parallel", i);
+        cr_assert_neq(argo_schema_write_double(values[i], f), 0, "Field %d written", i);
+        fclose(f);
+    }
+}
+
+Test(argo_suite, literals_and_empty_containers) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("[true, false, null, {}, []]");
+    cr_assert_not_null(v, "Array was not read");
+    ARGO_VALUE *sentinel = (*v).content.array.element_list;
+    ARGO_VALUE *e = (*sentinel).next;
+    int expected[] = {ARGO_TRUE, ARGO_FALSE, ARGO_NULL};
+    for (int i = 0; i < 3; i++) {
+        cr_assert_eq((*e).type, ARGO_BASIC_TYPE, "Element %d is not a literal", i);
+        cr_assert_eq((*e).content.basic, expected[i], "Element %d has the wrong value", i);
+        e = (*e).next;
+    }
+    ARGO_VALUE *members = (*e).content.object.member_list;
+    cr_assert_eq((*members).next, members, "Empty object has members");
+    e = (*e).next;
+    ARGO_VALUE *elements = (*e).content.array.element_list;
+    cr_assert_eq((*elements).next, elements, "Empty array has elements");
+    cr_assert_eq((*e).next, sentinel, "Array has extra elements");
+    cr_assert_null(read_from_string("[1, tru]"), "Invalid literal accepted");
+    cr_assert_null(read_from_string("{\"a\" 1}"), "Missing colon accepted");
+}
+
+Test(argo_suite, pretty_writer_layout) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("{\"a\":[1,{}],\"\":-1.5}");
+    cr_assert_not_null(v, "Object was not read");
+    char *text = NULL;
+    size_t size = 0;
+    FILE *f = open_memstream(&text, &size);
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION | PRETTY_PRINT_OPTION | 2;
+    int status = argo_write_value(v, f);
+    global_options = saved;
+    fclose(f);
+    cr_assert_eq(status, 0, "Write failed");
+    char *expected = "{\n  \"a\": [\n    1,\n    {}\n  ],\n  \"\": -0.15e1\n}\n";
+    cr_assert_str_eq(text, expected, "Got \"%s\"", text);
+    free(text);
+}
+
+static char *write_to_string(ARGO_VALUE *v, int threads, size_t *length) {
+    FILE *f = tmpfile();
+    int status = threads ? argo_write_value_parallel(v, f, threads) : argo_write_value(v, f);
+    cr_assert_eq(status, 0, "Write failed");
+    fflush(f);
+    *length = ftell(f);
+    char *text = malloc(*length + 1);
+    rewind(f);
+    cr_assert_eq(fread(text, 1, *length, f), *length, "Short read");
+    *(text + *length) = '\0';
+    fclose(f);
+    return text;
+}
+
+Test(argo_suite, string_escapes_match_reference) {
+    // Runs of plain characters around each escape, long enough for the
+    // wide scan and for the write buffer to fill.
+    ARGO_STRING s = {0};
+    char *expected = malloc(64 * 1024);
+    size_t used = 0;
+    *(expected + used++) = '"';
+    ARGO_CHAR extra[] = {0x100, 0x7ff, 0xfffd, 0x1f600};
+    for (ARGO_CHAR c = 0; c <= 0x104; c++) {
+        ARGO_CHAR x = c <= 0x100 ? c : *(extra + c - 0x101);
+        for (ARGO_CHAR pad = 0; pad < c % 23; pad++) {
+            argo_append_char(&s, 'a' + pad % 26);
+            *(expected + used++) = 'a' + pad % 26;
+        }
+        argo_append_char(&s, x);
+        if (x == '"' || x == '\\')
+            used += sprintf(expected + used, "\\%c", (char)x);
+        else if (x == '\b' || x == '\f' || x == '\n' || x == '\r' || x == '\t')
+            used += sprintf(expected + used, "\\%c", x == '\b' ? 'b' : x == '\f' ? 'f' : x == '\n' ? 'n'
+                            : x == '\r' ? 'r' : 't');
+        else if (x >= 0x20 && x < 0xff)
+            *(expected + used++) = (char)x;
+        else if (x <= 0xffff)
+            used += sprintf(expected + used, "\\u%04x", x);
+        else
+            used += sprintf(expected + used, "\\ud83d\\ude00");
+    }
+    *(expected + used++) = '"';
+    FILE *f = tmpfile();
+    cr_assert_eq(argo_write_string(&s, f), 0, "Write failed");
+    fflush(f);
+    size_t length = ftell(f);
+    char *text = malloc(length + 1);
+    rewind(f);
+    cr_assert_eq(fread(text, 1, length, f), length, "Short read");
+    fclose(f);
+    cr_assert_eq(length, used, "Wrong length %zu, expected %zu", length, used);
+    cr_assert_eq(memcmp(text, expected, used), 0, "Escapes differ from the reference");
+    free(text);
+    free(expected);
+    free(s.content);
+}
+
+Test(argo_suite, whitespace_skipped_between_tokens) {
+    // Every kind of whitespace in every place, and a run of spaces that
+    // crosses the end of a block.
+    char *head = " \t\r\n[\n                                        1 \t, {\r\n\t\"a\"   :   true";
+    char *tail = "}\n    ,\n        \"x\"\r\n]  \nX";
+    size_t run = ARGO_READ_BLOCK + 100;
+    size_t length = strlen(head) + run + strlen(tail);
+    char *input = malloc(length + 1);
+    sprintf(input, "%s%*s%s", head, (int)run, "", tail);
+    argo_next_value = 0;
+    FILE *f = fmemopen(input, length, "r");
+    ARGO_VALUE *v = argo_read_value(f);
+    cr_assert_not_null(v, "Padded input not read");
+    cr_assert_eq(fgetc(f), ' ', "Stream not left just after the value");
+    fclose(f);
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    size_t actual_length;
+    char *actual = write_to_string(v, 0, &actual_length);
+    global_options = saved;
+    cr_assert_str_eq(actual, "[1,{\"a\":true},\"x\"]", "Got \"%s\"", actual);
+    free(actual);
+    free(input);
+}
+
+Test(argo_suite, parallel_writer_matches_sequential) {
+    size_t count = ARGO_PARALLEL_GRAIN / 2;
+    char *input = malloc(count * 32 + 64);
+    size_t used = sprintf(input, "{\"big\":[");
+    for (size_t i = 0; i < count; i++)
+        used += sprintf(input + used, "%s{\"k\":[%zu,\"s\\n\"]}", i ? "," : "", i);
+    sprintf(input + used, "],\"small\":{}}");
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string(input);
+    cr_assert_not_null(v, "Document was not read");
+    int saved = global_options;
+    int layouts[] = {CANONICALIZE_OPTION, CANONICALIZE_OPTION | PRETTY_PRINT_OPTION | 3};
+    for (int i = 0; i < 2; i++) {
+        global_options = layouts[i];
+        size_t expected_length, actual_length;
+        char *expected = write_to_string(v, 0, &expected_length);
+        char *actual = write_to_string(v, 4, &actual_length);
+        cr_assert_eq(actual_length, expected_length, "Lengths differ in layout %d", i);
+        cr_assert_str_eq(actual, expected, "Output differs in layout %d", i);
+        free(expected);
+        free(actual);
+    }
+    global_options = saved;
+    free(input);
+}
+
+Test(argo_suite, zero_copy_matches_writer) {
+    char *input = "{ \"plain\" : [1, 0.5e1, -0.25e-2, 10.0, \"x y\"],\n"
+        "  \"esc\\u0041ped\" : \"tab\\there\", \"\" : [true, null, {}] }";
+    FILE *in = tmpfile();
+    fputs(input, in);
+    rewind(in);
+    cr_assert_eq(argo_source_map(in), 0, "Source was not mapped");
+    argo_next_value = 0;
+    ARGO_VALUE *v = argo_read_value(in);
+    fclose(in);
+    cr_assert_not_null(v, "Object was not read");
+    ARGO_VALUE *plain = (*(*v).content.object.member_list).next;
+    cr_assert_eq((*(argo_spans + (plain - argo_value_storage))).name.length, 7, "Plain name has no span");
+    cr_assert_eq((*(argo_spans + ((*plain).next - argo_value_storage))).name.length, 0,
+                 "Escaped name has a span");
+    int saved = global_options;
+    int layouts[] = {CANONICALIZE_OPTION, CANONICALIZE_OPTION | PRETTY_PRINT_OPTION | 4};
+    for (int i = 0; i < 2; i++) {
+        global_options = layouts[i];
+        FILE *expected = tmpfile();
+        FILE *actual = tmpfile();
+        cr_assert_eq(argo_write_value(v, expected), 0, "Write failed");
+        cr_assert_eq(argo_write_value_zero_copy(v, actual), 0, "Zero-copy write failed");
+        fflush(expected);
+        long length = ftell(expected);
+        cr_assert_eq(ftell(actual), length, "Lengths differ in layout %d", i);
+        rewind(expected);
+        rewind(actual);
+        for (long j = 0; j < length; j++)
+            cr_assert_eq(fgetc(actual), fgetc(expected), "Output differs at byte %ld", j);
+        fclose(expected);
+        fclose(actual);
+    }
+    global_options = saved;
+    argo_source_unmap();
+}
+
+Test(argo_suite, serve_request_operations) {
+    char *text = NULL;
+    size_t size = 0;
+    FILE *out = open_memstream(&text, &size);
+    char query[] = "/a~1b/1\0{\"a/b\": [true, {\"c\": 1.50}], \"d\": null}";
+    cr_assert_eq(argo_serve_request(ARGO_OP_QUERY, query, sizeof(query) - 1, out), 0, "Query failed");
+    fflush(out);
+    cr_assert_str_eq(text, "{\"c\":0.15e1}", "Got \"%s\"", text);
+    fseek(out, 0, SEEK_SET);
+    char missing[] = "/a~1b/2\0{\"a/b\": [true, {\"c\": 1.50}]}";
+    cr_assert_neq(argo_serve_request(ARGO_OP_QUERY, missing, sizeof(missing) - 1, out), 0,
+                  "Query past the end succeeded");
+    fseek(out, 0, SEEK_SET);
+    char escape[] = "/a~2b\0{\"a~2b\": 1}";
+    cr_assert_neq(argo_serve_request(ARGO_OP_QUERY, escape, sizeof(escape) - 1, out), 0,
+                  "Malformed escape accepted");
+    cr_assert_null(argo_edit_find(read_from_string("{\"a~2b\": 1}"), "/a~2b"), "Malformed escape followed");
+    fseek(out, 0, SEEK_SET);
+    char bad[] = "[1,";
+    cr_assert_neq(argo_serve_request(ARGO_OP_VALIDATE, bad, sizeof(bad) - 1, out), 0,
+                  "Invalid document accepted");
+    fclose(out);
+    free(text);
+}
+
+Test(argo_suite, batch_combined_output) {
+    char dir[] = "/tmp/argo_batch_XXXXXX";
+    cr_assert_neq(mkdtemp(dir), NULL, "mkdtemp failed");
+    char *texts[] = {"[1, 2.50]", "{\"b\": null, \"a\": \"x\"}", "true"};
+    char *names[] = {"b.json", "a.json", "c.json"};
+    char path[64];
+    for (int i = 0; i < 3; i++) {
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        FILE *f = fopen(path, "w");
+        fputs(texts[i], f);
+        fclose(f);
+    }
+    char output[64];
+    snprintf(output, sizeof(output), "%s/out", dir);
+    char *paths[] = {dir};
+    ARGO_BATCH config = {output, ARGO_BATCH_SUFFIX, 2, 1, paths};
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    cr_assert_eq(argo_batch(&config), 0, "Batch failed");
+    global_options = saved;
+    char text[256] = {0};
+    FILE *f = fopen(output, "r");
+    fread(text, 1, sizeof(text) - 1, f);
+    fclose(f);
+    cr_assert_str_eq(text, "{\"b\":null,\"a\":\"x\"}\n[1,0.25e1]\ntrue\n", "Got \"%s\"", text);
+    for (int i = 0; i < 3; i++) {
+        snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+        unlink(path);
+    }
+    unlink(output);
+    rmdir(dir);
+}
+
+typedef struct chunked_source {
+    char *text;
+    size_t length;
+    size_t offset;
+    int released;
+} CHUNKED_SOURCE;
+
+static ssize_t chunked_produce(void *state, unsigned char *buffer, size_t size) {
+    CHUNKED_SOURCE *source = state;
+    size_t n = source->length - source->offset;
+    if (n > 4099)
+        n = 4099;
+    if (n > size)
+        n = size;
+    memcpy(buffer, source->text + source->offset, n);
+    source->offset += n;
+    return n;
+}
+
+static void chunked_release(void *state) {
+    CHUNKED_SOURCE *source = state;
+    source->released++;
+}
+
+Test(argo_suite, pipeline_handles_straddling_tokens) {
+    char *text = NULL;
+    size_t length = 0;
+    FILE *doc = open_memstream(&text, &length);
+    fputc('[', doc);
+    for (int i = 0; i < 6000; i++)
+        fprintf(doc, "%s\"item \\u00e9 %d\", -1234.5e-3, true", i ? ", " : "", i);
+    fputc(']', doc);
+    fclose(doc);
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    FILE *direct = fmemopen(text, length, "r");
+    size_t expected_length, actual_length;
+    char *expected = write_to_string(argo_read_value(direct), 0, &expected_length);
+    fclose(direct);
+    CHUNKED_SOURCE source = {text, length, 0, 0};
+    FILE *in = tmpfile();
+    cr_assert_eq(argo_pipeline_start(in, chunked_produce, chunked_release, &source), 0, "Pipeline did not start");
+    ARGO_VALUE *v = argo_read_value(in);
+    cr_assert_neq(v, NULL, "Read through the pipeline failed");
+    cr_assert_eq(argo_read_end(in), 0, "Trailing input reported");
+    argo_pipeline_stop();
+    cr_assert_eq(source.released, 1, "Producer state not released");
+    fclose(in);
+    char *actual = write_to_string(v, 0, &actual_length);
+    global_options = saved;
+    cr_assert_eq(actual_length, expected_length, "Lengths differ");
+    cr_assert_str_eq(actual, expected, "Output differs");
+    free(actual);
+    free(expected);
+    free(text);
+}
+
+Test(argo_suite, compressed_round_trip) {
+    char text[] = "{\"name\": \"argo\", \"values\": [1, 2.5, null, false]}";
+    int formats[] = {ARGO_FORMAT_GZIP, ARGO_FORMAT_ZSTD};
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    FILE *direct = fmemopen(text, sizeof(text) - 1, "r");
+    size_t expected_length, actual_length;
+    char *expected = write_to_string(argo_read_value(direct), 0, &expected_length);
+    fclose(direct);
+    for (int i = 0; i < 2; i++) {
+        FILE *file = tmpfile();
+        FILE *compressed = argo_compress_open(file, formats[i]);
+        cr_assert_neq(compressed, NULL, "Could not open format %d", formats[i]);
+        fputs(text, compressed);
+        cr_assert_eq(argo_compress_close(compressed), 0, "Compression failed");
+        rewind(file);
+        cr_assert_eq(argo_input_start(file), formats[i], "Format not recognized");
+        ARGO_VALUE *v = argo_read_value(file);
+        argo_pipeline_stop();
+        fclose(file);
+        cr_assert_neq(v, NULL, "Read of format %d failed", formats[i]);
+        char *actual = write_to_string(v, 0, &actual_length);
+        cr_assert_str_eq(actual, expected, "Output differs for format %d", formats[i]);
+        free(actual);
+    }
+    global_options = saved;
+    free(expected);
+}
+
+Test(argo_suite, schema_readers_skip_and_convert) {
+    char text[] = "{\"skip\": [1, {\"a\": \"\\u00e9\"}, null], \"n\": -42, \"x\": 2.5e1, \"b\": true,"
+        " \"s\": \"hi\", \"bad\": 1.0}";
+    FILE *f = fmemopen(text, sizeof(text) - 1, "r");
+    ARGO_STRING key = {0};
+    ARGO_STRING s = {0};
+    long n = 0;
+    double x = 0;
+    int b = 0;
+    long bad = 0;
+    argo_reader_enter(f);
+    cr_assert_eq(argo_getc_nonblank(f), ARGO_LBRACE, "Expected '{'");
+    cr_assert_eq(argo_getc_nonblank(f), ARGO_QUOTE, "Expected a name");
+    cr_assert_eq(argo_schema_key(&key, f), 0, "Key not read");
+    cr_assert_eq(key.length, 4, "Wrong key length");
+    cr_assert_eq(argo_schema_skip(argo_getc_nonblank(f), f), 0, "Skip failed");
+    cr_assert_eq(argo_getc_nonblank(f), ARGO_COMMA, "Skip consumed too much");
+    argo_getc_nonblank(f);
+    argo_schema_key(&key, f);
+    cr_assert_eq(argo_schema_long(&n, argo_getc_nonblank(f), f), 0, "Integer not read");
+    argo_getc_nonblank(f);
+    argo_getc_nonblank(f);
+    argo_schema_key(&key, f);
+    cr_assert_eq(argo_schema_double(&x, argo_getc_nonblank(f), f), 0, "Number not read");
+    argo_getc_nonblank(f);
+    argo_getc_nonblank(f);
+    argo_schema_key(&key, f);
+    cr_assert_eq(argo_schema_boolean(&b, argo_getc_nonblank(f), f), 0, "Boolean not read");
+    argo_getc_nonblank(f);
+    argo_getc_nonblank(f);
+    argo_schema_key(&key, f);
+    cr_assert_eq(argo_schema_string(&s, argo_getc_nonblank(f), f), 0, "String not read");
+    argo_getc_nonblank(f);
+    argo_getc_nonblank(f);
+    argo_schema_key(&key, f);
+    cr_assert_neq(argo_schema_long(&bad, argo_getc_nonblank(f), f), 0, "1.0 accepted as an integer");
+    argo_reader_leave(f);
+    fclose(f);
+    cr_assert_eq(n, -42, "Wrong integer %ld", n);
+    cr_assert_float_eq(x, 25.0, 1e-9, "Wrong number %f", x);
+    cr_assert_eq(b, 1, "Wrong boolean");
+    cr_assert_eq(s.length, 2, "Wrong string length");
+    cr_assert_eq(*s.content, 'h', "Wrong string");
+    free(key.content);
+    free(s.content);
+}
+
+static int read_order(char *text, ORDER *order) {
+    FILE *f = fmemopen(text, strlen(text), "r");
+    int status = order_read(order, f);
+    fclose(f);
+    return status;
+}
+
+Test(argo_suite, generated_reader_matches_generic) {
+    char *valid = "{\"id\": 7, \"symbol\": \"A\", \"price\": 1.5, \"quantity\": 2,"
+        " \"tags\": [\"x\", \"y\"], \"fill\": {\"venue\": \"V\", \"extra\": [1, {}]}}";
+    char *invalid[] = {
+        "{\"id\": 7, \"symbol\": \"A\", \"price\": 1.5, \"quantity\": 2,}",
+        "{\"id\": 7, \"symbol\": \"A\", \"price\": 1.5, \"quantity\": 2, \"tags\": [\"x\",]}",
+        "{\"id\": 7, \"symbol\": \"A\", \"price\": 1.5, \"quantity\": 2, \"fill\": {\"time\": 1,}}",
+        "{\"id\": 7, \"symbol\": \"A\", \"price\": 1.5, \"quantity\": 2, \"other\": [1,]}",
+    };
+    ORDER order = {0};
+    cr_assert_eq(read_order(valid, &order), 0, "Valid order rejected");
+    cr_assert_eq(order.tags_count, 2, "Wrong number of tags");
+    cr_assert_not_null(read_from_string(valid), "Valid order rejected by argo_read_value()");
+    for (int i = 0; i < 4; i++) {
+        cr_assert_null(read_from_string(invalid[i]), "Input %d accepted by argo_read_value()", i);
+        cr_assert_neq(read_order(invalid[i], &order), 0, "Input %d accepted by order_read()", i);
+    }
+    order_free(&order);
+}
+
+Test(argo_suite, embed_writes_shared_text) {
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("{\"a\": [1, \"a\", true]}");
+    cr_assert_neq(v, NULL, "Read failed");
+    char *text = NULL;
+    size_t length = 0;
+    FILE *out = open_memstream(&text, &length);
+    cr_assert_eq(argo_embed_write(v, "doc", "test", out), 0, "Embedding failed");
+    fclose(out);
+    cr_assert_neq(strstr(text, "static const ARGO_VALUE values[7] = {"), NULL, "Wrong number of values");
+    cr_assert_neq(strstr(text, "static const ARGO_CHAR text[2] = {"), NULL, "Text not shared");
+    cr_assert_neq(strstr(text, ".content.basic = ARGO_TRUE"), NULL, "Missing literal");
+    cr_assert_neq(strstr(text, "ARGO_VALUE *const doc = (ARGO_VALUE *)values;"), NULL, "Missing definition");
+    free(text);
+}
+
+// {"name": "argo"}, laid out as bin/argo_embed writes it.
+static const ARGO_CHAR embeddedText[] = {'n', 'a', 'm', 'e', 'a', 'r', 'g', 'o'};
+static const ARGO_VALUE embeddedValues[3] = {
+    {ARGO_OBJECT_TYPE, NULL, NULL, {0}, .content.object = {(ARGO_VALUE *)embeddedValues + 1}},
+    {ARGO_NO_TYPE, (ARGO_VALUE *)embeddedValues + 2, (ARGO_VALUE *)embeddedValues + 2, {0}},
+    {ARGO_STRING_TYPE, (ARGO_VALUE *)embeddedValues + 1, (ARGO_VALUE *)embeddedValues + 1,
+     ARGO_EMBED_STRING(embeddedText, 0, 4), .content.string = ARGO_EMBED_STRING(embeddedText, 4, 4)},
+};
+
+Test(argo_suite, embed_members_found_with_interning) {
+    ARGO_VALUE *doc = (ARGO_VALUE *)embeddedValues;
+    ARGO_STRING key = {0};
+    argo_append_chars(&key, (ARGO_CHAR *)embeddedText, 4, 0);
+    cr_assert_not_null(argo_object_member(doc, &key), "Member not found");
+    argo_intern_clear();
+    argo_intern_enabled = 1;
+    argo_next_value = 0;
+    ARGO_VALUE *v = read_from_string("{\"name\": 1}");
+    argo_intern_enabled = 0;
+    cr_assert_not_null(v, "Object was not read");
+    cr_assert_eq(argo_object_member(doc, &key), embeddedValues + 2, "Member not found once the name is pooled");
+    cr_assert_eq(argo_object_member(doc, &(*(*(*v).content.object.member_list).next).name), embeddedValues + 2,
+                 "Member not found by an interned name");
+    argo_intern_clear();
+    free(key.content);
+}
+
+Test(argo_suite, hashcons_shares_identical_subtrees) {
+    char *text = "{\"a\": {\"x\": [1, \"s\"], \"y\": true}, \"b\": {\"x\": [1, \"s\"], \"y\": true},"
+        " \"c\": {\"x\": [1, \"s\"], \"y\": false}}";
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    argo_document_reset();
+    ARGO_VALUE *plain = read_from_string(text);
+    int plainSlots = argo_next_value;
+    size_t expected_length, actual_length;
+    char *expected = write_to_string(plain, 0, &expected_length);
+    unsigned long expected_hash = argo_value_hash(plain);
+    argo_document_reset();
+    argo_hashcons_enabled = 1;
+    ARGO_VALUE *v = read_from_string(text);
+    argo_hashcons_enabled = 0;
+    cr_assert_neq(v, NULL, "Read failed");
+    cr_assert_lt(argo_next_value, plainSlots, "No slots were saved");
+    ARGO_VALUE *sentinel = (*v).content.object.member_list;
+    ARGO_VALUE *a = (*sentinel).next;
+    ARGO_VALUE *b = (*a).next;
+    ARGO_VALUE *c = (*b).next;
+    cr_assert_eq((*a).content.object.member_list, (*b).content.object.member_list, "Members not shared");
+    cr_assert(argo_subtree_equal(a, b), "Equal subtrees compare unequal");
+    cr_assert_not(argo_subtree_equal(a, c), "Different subtrees compare equal");
+    cr_assert_neq(argo_value_hash(a), argo_value_hash(c), "Different subtrees hash alike");
+    cr_assert_eq(argo_value_hash(v), expected_hash, "Hash depends on sharing");
+    char *actual = write_to_string(v, 0, &actual_length);
+    cr_assert_str_eq(actual, expected, "Output differs");
+    argo_document_reset();
+    global_options = saved;
+    free(actual);
+    free(expected);
+}
+
+Test(argo_suite, truncate_clears_allocated_slots) {
+    argo_document_reset();
+    ARGO_VALUE *v = read_from_string("[{\"a\": \"x\"}, [1]]");
+    cr_assert_neq(v, NULL, "Read failed");
+    int end = argo_next_value;
+    ARGO_VALUE *past = argo_value_storage + end;
+    *past = (ARGO_VALUE){.type = ARGO_BASIC_TYPE, .content.basic = ARGO_TRUE};
+    argo_document_truncate(1);
+    cr_assert_eq(argo_next_value, 1, "Mark not restored");
+    cr_assert_eq((*v).type, ARGO_ARRAY_TYPE, "Slot before the mark cleared");
+    for (int i = 1; i < end; i++)
+        cr_assert_eq((*(argo_value_storage + i)).type, ARGO_NO_TYPE, "Slot %d not cleared", i);
+    cr_assert_eq((*past).type, ARGO_BASIC_TYPE, "Unallocated slot cleared");
+    *past = (ARGO_VALUE){0};
+    argo_document_reset();
+}
+
+Test(argo_suite, diff_writes_json_patch) {
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    argo_document_reset();
+    ARGO_VALUE *a = read_from_string("{\"n\": 1, \"s\": \"x\", \"l\": [1, 2, 3, 4], \"o\": {\"a/b\": true}}");
+    ARGO_VALUE *b = read_from_string("{\"o\": {\"a/b\": true}, \"l\": [1.0, 2, 3, 4], \"s\": \"x\", \"n\": 10e-1}");
+    ARGO_VALUE *c = read_from_string("{\"n\": 2, \"l\": [1, 9, 4], \"o\": {}, \"t\": null}");
+    cr_assert(a != NULL && b != NULL && c != NULL, "Read failed");
+    cr_assert_eq(argo_equal(a, b), 1, "Reordered members or equal numbers compare unequal");
+    cr_assert_not(argo_equal(a, c), "Different documents compare equal");
+    char *text = NULL;
+    size_t length = 0;
+    FILE *out = open_memstream(&text, &length);
+    cr_assert_eq(argo_diff(a, b, out), 0, "Equal documents have a nonempty patch");
+    fclose(out);
+    cr_assert_str_eq(text, "[]", "Wrong empty patch");
+    free(text);
+    out = open_memstream(&text, &length);
+    cr_assert_eq(argo_diff(a, c, out), 6, "Wrong number of operations");
+    fclose(out);
+    cr_assert_str_eq(text, "[{\"op\":\"replace\",\"path\":\"/n\",\"value\":2},"
+        "{\"op\":\"remove\",\"path\":\"/s\"},"
+        "{\"op\":\"replace\",\"path\":\"/l/1\",\"value\":9},"
+        "{\"op\":\"remove\",\"path\":\"/l/2\"},"
+        "{\"op\":\"remove\",\"path\":\"/o/a~1b\"},"
+        "{\"op\":\"add\",\"path\":\"/t\",\"value\":null}]", "Wrong patch");
+    free(text);
+    argo_document_reset();
+    global_options = saved;
+}
+
+Test(argo_suite, sorted_keys_in_utf16_order) {
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION | SORT_KEYS_OPTION;
+    argo_document_reset();
+    ARGO_VALUE *v = read_from_string("{\"b\": 1, \"\\ue000\": 2, \"\\ud83d\\ude00\": 3, \"a\": {\"y\": [{\"d\": 0, \"c\": 0}], \"x\": 4},"
+        " \"ab\": 5, \"a\": 6}");
+    cr_assert_neq(v, NULL, "Read failed");
+    char *expected = "{\"a\":{\"x\":4,\"y\":[{\"c\":0,\"d\":0}]},\"a\":6,\"ab\":5,\"b\":1,"
+        "\"\\ud83d\\ude00\":3,\"\\ue000\":2}";
+    size_t length;
+    char *first = write_to_string(v, 0, &length);
+    cr_assert_str_eq(first, expected, "Wrong sorted output");
+    ARGO_VALUE *sentinel = (*v).content.object.member_list;
+    cr_assert_neq(*(argo_sorted_links + (sentinel - argo_value_storage)), NULL, "Order not cached");
+    char *again = write_to_string(v, 0, &length);
+    cr_assert_str_eq(again, expected, "Cached order differs");
+    char *parallel = write_to_string(v, 4, &length);
+    cr_assert_str_eq(parallel, expected, "Parallel output differs");
+    ARGO_VALUE *m = argo_sorted_after(sentinel, NULL);
+    cr_assert_eq(m, argo_sorted_first(sentinel), "Scan disagrees with sort");
+    while (m != sentinel) {
+        ARGO_VALUE *next = argo_sorted_after(sentinel, m);
+        cr_assert_eq(next, argo_sorted_next(sentinel, m), "Scan disagrees with sort");
+        m = next;
+    }
+    global_options = CANONICALIZE_OPTION;
+    char *unsorted = write_to_string(v, 0, &length);
+    cr_assert_eq(*(unsorted + 2), 'b', "Input order lost");
+    argo_document_reset();
+    global_options = saved;
+    free(first);
+    free(again);
+    free(parallel);
+    free(unsorted);
+}
+
+static char *digest_hex(unsigned char *digest, size_t length, char *hex) {
+    for (size_t i = 0; i < length; i++)
+        sprintf(hex + 2 * i, "%02x", digest[i]);
+    return hex;
+}
+
+Test(argo_suite, digest_of_canonical_output) {
+    unsigned char digest[ARGO_DIGEST_MAX];
+    char hex[2 * ARGO_DIGEST_MAX + 1];
+    ARGO_DIGEST d;
+    argo_digest_init(&d, ARGO_DIGEST_SHA256);
+    argo_digest_update(&d, "abc", 3);
+    cr_assert_str_eq(digest_hex(digest, argo_digest_final(&d, digest), hex),
+                     "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", "Wrong SHA-256");
+    argo_digest_init(&d, ARGO_DIGEST_XXH64);
+    argo_digest_update(&d, "Nobody inspects", 15);
+    argo_digest_update(&d, " the spammish repetition", 24);
+    cr_assert_str_eq(digest_hex(digest, argo_digest_final(&d, digest), hex), "fbcea83c8a378bf1", "Wrong XXH64");
+
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION | PRETTY_PRINT_OPTION | 2;
+    argo_document_reset();
+    ARGO_VALUE *v = read_from_string("{\"b\": [1, 2.50, \"\\u00e9\"], \"a\": {\"x\": null}}");
+    cr_assert_neq(v, NULL, "Read failed");
+    size_t length;
+    char *text = write_to_string(v, 0, &length);
+    for (int algorithm = ARGO_DIGEST_SHA256; algorithm <= ARGO_DIGEST_XXH64; algorithm++) {
+        unsigned char expected[ARGO_DIGEST_MAX];
+        argo_digest_init(&d, algorithm);
+        argo_digest_update(&d, text, length);
+        size_t expected_length = argo_digest_final(&d, expected);
+        size_t actual_length;
+        cr_assert_eq(argo_digest_value(v, algorithm, digest, &actual_length), 0, "Digest failed");
+        cr_assert_eq(actual_length, expected_length, "Wrong digest length");
+        cr_assert_eq(memcmp(digest, expected, actual_length), 0, "Digest differs from that of the output");
+    }
+    argo_document_reset();
+    global_options = saved;
+    free(text);
+}
+
+static char *edit_to_string(ARGO_VALUE *v) {
+    FILE *f = tmpfile();
+    cr_assert_eq(argo_edit_write(v, f), 0, "Write failed");
+    fflush(f);
+    size_t length = ftell(f);
+    char *text = malloc(length + 1);
+    rewind(f);
+    cr_assert_eq(fread(text, 1, length, f), length, "Short read");
+    *(text + length) = '\0';
+    fclose(f);
+    return text;
+}
+
+Test(argo_suite, edit_rewrites_only_changes) {
+    int saved = global_options;
+    global_options = CANONICALIZE_OPTION;
+    argo_document_reset();
+    argo_hashcons_enabled = 1;
+    ARGO_VALUE *v = read_from_string("{\"a\": {\"x\": [1, 2, 3], \"y\": true}, \"b\": {\"x\": [1, 2, 3], \"y\": true},"
+                                     " \"c/d\": [\"long unchanged text\", {\"e\": null}]}");
+    cr_assert_neq(v, NULL, "Read failed");
+    char *first = edit_to_string(v);
+    cr_assert_str_eq(first, "{\"a\":{\"x\":[1,2,3],\"y\":true},\"b\":{\"x\":[1,2,3],\"y\":true},"
+                     "\"c/d\":[\"long unchanged text\",{\"e\":null}]}", "Wrong first output");
+    ARGO_VALUE *e = argo_edit_find(v, "/c~1d/1/e");
+    cr_assert(e != NULL && (*e).type == ARGO_BASIC_TYPE && (*e).content.basic == ARGO_NULL, "Pointer not followed");
+
+    cr_assert_eq(argo_edit_replace(v, "/a/x/1", read_from_string("20")), 0, "Replace failed");
+    cr_assert_eq(argo_edit_add(v, "/b/z", read_from_string("[]")), 0, "Add failed");
+    cr_assert_eq(argo_edit_remove(v, "/a/y"), 0, "Remove failed");
+    ARGO_VALUE *values[] = {read_from_string("\"s\""), read_from_string("false")};
+    cr_assert_eq(argo_edit_splice(v, "/b/x", 0, 2, values, 2), 0, "Splice failed");
+    cr_assert_neq(argo_edit_remove(v, "/b/w"), 0, "Removed a missing member");
+    cr_assert_neq(argo_edit_add(v, "/b/x/9", read_from_string("0")), 0, "Added beyond the end");
+
+    size_t expected_length;
+    char *expected = write_to_string(v, 0, &expected_length);
+    cr_assert_str_eq(expected, "{\"a\":{\"x\":[1,20,3]},\"b\":{\"x\":[\"s\",false,3],\"y\":true,\"z\":[]},"
+                     "\"c/d\":[\"long unchanged text\",{\"e\":null}]}", "Edits not applied in one place only");
+    char *second = edit_to_string(v);
+    cr_assert_str_eq(second, expected, "Incremental output differs");
+    cr_assert_lt(argo_edit_encoded, 16, "Unchanged values were written afresh");
+    cr_assert_geq(argo_edit_copied, strlen("[\"long unchanged text\",{\"e\":null}]"), "Unchanged values were not copied");
+    argo_hashcons_enabled = 0;
+    argo_document_reset();
+    global_options = saved;
+    free(first);
+    free(second);
+    free(expected);
+}
+
+Test(argo_suite, columns_extract_and_aggregate) {
+    size_t rows = 300;
+    char *input = malloc(rows * 64 + 64);
+    char *p = input;
+    p += sprintf(p, "[");
+    for (size_t i = 0; i < rows; i++) {
+        // Row 7 has no "val", and "id" turns into a double column at row 200.
+        if (i == 7)
+            p += sprintf(p, "{\"id\": %zu, \"name\": \"n\\u00e9\"},", i);
+        else if (i == 200)
+            p += sprintf(p, "{\"id\": 0.5, \"val\": %d, \"name\": \"x\"},", (int)i - 100);
+        else
+            p += sprintf(p, "{\"id\": %zu, \"val\": %d, \"name\": \"x\"},", i, (int)i - 100);
+    }
+    sprintf(p - 1, "]");
+    ARGO_COLUMNS t;
+    argo_columns_init(&t, 1);
+    cr_assert_eq(argo_columns_declare(&t, "val", ARGO_COLUMN_DOUBLE), 0, "Declare failed");
+    FILE *f = fmemopen(input, strlen(input), "r");
+    cr_assert_eq(argo_columns_read(&t, f), 0, "Read failed");
+    fclose(f);
+    cr_assert_eq(t.rows, rows, "Wrong number of rows");
+    cr_assert_eq(t.column_count, 3, "Wrong number of columns");
+
+    ARGO_COLUMN *val = argo_columns_find(&t, "val");
+    ARGO_COLUMN *id = argo_columns_find(&t, "id");
+    ARGO_COLUMN *name = argo_columns_find(&t, "name");
+    cr_assert_eq((*val).type, ARGO_COLUMN_DOUBLE, "Declared type not kept");
+    cr_assert_eq((*id).type, ARGO_COLUMN_DOUBLE, "Integer column not promoted");
+    cr_assert_eq((*name).type, ARGO_COLUMN_STRING, "Wrong inferred type");
+    cr_assert_not(ARGO_COLUMN_VALID(val, 7), "Missing member has a value");
+    cr_assert(ARGO_COLUMN_VALID(val, 8), "Member has no value");
+    cr_assert_eq(*((*id).doubles + 199), 199.0, "Wrong value after promotion");
+    cr_assert_eq(*((*name).offsets + 8) - *((*name).offsets + 7), 3, "Wrong string length");
+    cr_assert_eq(memcmp((*name).blob + *((*name).offsets + 7), "n\xc3\xa9", 3), 0, "Wrong string text");
+
+    ARGO_COLUMN_STATS s;
+    cr_assert_eq(argo_column_stats(val, t.rows, &s), 0, "Stats failed");
+    double sum = 0;
+    for (size_t i = 0; i < rows; i++)
+        if (i != 7)
+            sum += (double)i - 100;
+    cr_assert_eq(s.count, rows - 1, "Wrong count");
+    cr_assert_eq(s.sum, sum, "Wrong sum");
+    cr_assert_eq(s.min, -100.0, "Wrong minimum");
+    cr_assert_eq(s.max, (double)rows - 101, "Wrong maximum");
+    cr_assert_neq(argo_column_stats(name, t.rows, &s), 0, "Stats of a string column");
+    argo_columns_free(&t);
+    free(input);
+}
+
+Test(argo_suite, columns_declared_without_rows) {
+    ARGO_COLUMNS t;
+    argo_columns_init(&t, 1);
+    cr_assert_eq(argo_columns_declare(&t, "i", ARGO_COLUMN_INT64), 0, "Declare failed");
+    cr_assert_eq(argo_columns_declare(&t, "d", ARGO_COLUMN_DOUBLE), 0, "Declare failed");
+    cr_assert_eq(argo_columns_declare(&t, "s", ARGO_COLUMN_STRING), 0, "Declare failed");
+    FILE *f = fmemopen("[]", 2, "r");
+    cr_assert_eq(argo_columns_read(&t, f), 0, "Read failed");
+    fclose(f);
+    cr_assert_eq(t.rows, 0, "Wrong number of rows");
+    ARGO_COLUMN_STATS s;
+    cr_assert_eq(argo_column_stats(argo_columns_find(&t, "i"), t.rows, &s), 0, "Stats failed");
+    cr_assert_eq(s.count, 0, "Wrong count");
+    argo_columns_free(&t);
+}
+
+Test(argo_suite, cursor_recycles_elements) {
+    // More elements than argo_value_storage could hold at once.
+    size_t count = NUM_ARGO_VALUES;
+    char *input = malloc(count * 32 + 64);
+    char *p = input;
+    p += sprintf(p, " [");
+    for (size_t i = 0; i < count; i++)
+        p += sprintf(p, "{\"n\": %zu, \"s\": \"text\"}, ", i);
+    sprintf(p - 2, "] ");
+    argo_document_reset();
+    FILE *f = fmemopen(input, strlen(input), "r");
+    ARGO_CURSOR c;
+    cr_assert_eq(argo_cursor_open(&c, f), 0, "Open failed");
+    ARGO_STRING n = {0};
+    argo_append_char(&n, 'n');
+    size_t sum = 0;
+    ARGO_VALUE *v;
+    while ((v = argo_cursor_next(&c)) != NULL) {
+        cr_assert_eq(v, argo_value_storage, "Element not read into recycled slots");
+        long value;
+        cr_assert_eq(argo_number_int(&(*argo_object_member(v, &n)).content.number, &value), 0, "No number");
+        sum += value;
+    }
+    cr_assert_eq(argo_cursor_close(&c), 0, "Array not read to the end");
+    fclose(f);
+    cr_assert_eq(c.index, count, "Wrong number of elements");
+    cr_assert_eq(sum, count * (count - 1) / 2, "Wrong elements");
+    cr_assert_leq(c.peak, 5, "Elements not recycled");
+
+    f = fmemopen("[1, 2", 5, "r");
+    cr_assert_eq(argo_cursor_open(&c, f), 0, "Open failed");
+    cr_assert_neq(argo_cursor_next(&c), NULL, "First element not read");
+    cr_assert_neq(argo_cursor_next(&c), NULL, "Second element not read");
+    cr_assert_eq(argo_cursor_next(&c), NULL, "Read past the end of input");
+    cr_assert_eq(c.state, ARGO_CURSOR_ERROR, "Unterminated array accepted");
+    cr_assert_neq(argo_cursor_close(&c), 0, "Unterminated array accepted");
+    fclose(f);
+    argo_document_reset();
+    free(n.content);
+    free(input);
+}